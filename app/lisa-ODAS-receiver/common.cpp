@@ -20,13 +20,13 @@ int parse_ini_file(char * ini_name)
 	MIN_THRESHOLD = iniparser_getint(ini, "led:min_threshold",5);
 	MAX_BRIGHTNESS = iniparser_getint(ini, "led:max_brightness",220	);
 	
-	SLEEP_ACCEPT_LOOP = iniparser_getdouble(ini, "internal:sleep_accept_loop",0.5);
-	MAX_EMPTY_MESSAGE = iniparser_getint(ini, "internal:max_empty_message",200);
+	IDLE_TIMEOUT = iniparser_getdouble(ini, "internal:idle_timeout",5.0);
 	// RECV_PCM_BUFFERS = iniparser_getint(ini, "internal:recv_pcm_buffers",4);
 	// MAX_ODAS_SOURCES = iniparser_getint(ini, "internal:dump_pcm",4);
 	DUMP_PCM = iniparser_getboolean(ini, "internal:dump_pcm", 0);
 	// NUM_OF_ODAS_DATA_SOURCES = iniparser_getint(ini, "internal:num_of_odas_data_sources",4 );
 	MAX_RECV_BACKLOG = iniparser_getint(ini, "internal:max_recv_backlog",1);
+	DISPATCH_QUEUE_LEN = iniparser_getint(ini, "internal:dispatch_queue_len",16);
 	
 	// Raw wave data stream from ODAS
 	// as defined in SSS module in configuration sss.separated|postfiltered
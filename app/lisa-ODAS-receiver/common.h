@@ -28,10 +28,8 @@ extern int DECREMENT;
 extern int MIN_THRESHOLD ;
 // MAX_BRIGHTNESS: 0 - 255
 extern short int MAX_BRIGHTNESS;
-// SLEEP IN SEC, 0.1s -> 100 ms, wating time before checking if a socket connection is available (accept return > 0)
-extern float SLEEP_ACCEPT_LOOP ;
-// How many empty messges should be received before raising a timeout
-extern int MAX_EMPTY_MESSAGE;
+// IDLE TIMEOUT IN SEC, a connection that does not receive any data for this time is closed and accepted again (0 never times out)
+extern float IDLE_TIMEOUT ;
 //In a recv call, how many buffers of PCM data should i acquire. 
 // Provide a balance between CPU usage (less buffers, higher CPU) and Latency (less buffers, lower latency) (TODO: find balance)
 #define RECV_PCM_BUFFERS 4
@@ -43,6 +41,8 @@ extern bool DUMP_PCM ;
 #define NUM_OF_ODAS_DATA_SOURCES 4 
 // The max baclog message number in socket recv. WIth 1 I assume only one message at time is processed (TODO: not sure of this assumption)
 extern short int MAX_RECV_BACKLOG;
+// Messages of a stream waiting for its worker (decode and python callback), the oldest is dropped when it is behind
+extern int DISPATCH_QUEUE_LEN;
 
 // Raw wave data stream
 // as defined in SSS module in configuration sss.separated|postfiltered
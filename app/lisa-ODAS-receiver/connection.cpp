@@ -1,11 +1,6 @@
 
 #include "connection.h"
 
-/* --------------------------------------------- */
-/* ---------- INTERNAL DATA STRUCTURE ---------- */
-/* --------------------------------------------- */
-static int counter_no_data = MAX_EMPTY_MESSAGE; //counter for empty messages, used for timeout
-static int counter_max_empty_msg = 100;
 // CONNECTION SECTION
 int init_connection(sockaddr_in &server_address, int port_number, int backlog) {
 	/*Init a non blocking connection and return the socket ID*/
@@ -40,38 +35,72 @@ int accept_connection(int server_id) {
 		}
 	} else {
 		debug_print(DEBUG_CONNECTION, " [Connected] Server_id=%d   Connection_id=%d\n", server_id, connection_id);
+		// Reads are driven by the reactor, they must never block the other streams
+		fcntl(connection_id, F_SETFL, O_NONBLOCK);
 	}
-	counter_no_data = MAX_EMPTY_MESSAGE; // reset the counter! this is important in case or restart of the connection
 	fflush(stdout);
 	return connection_id;
 }
 
-bool reception_terminate(unsigned int rcvd_bytes[]) {
-	/*If any connetion terminated abnormally return true, not receiving data after a while is a sign of data closing*/
-	for (int c = 0 ; c < NUM_OF_ODAS_DATA_SOURCES; c++) {	
-		debug_print(DEBUG_CONNECTION, " For %s len msg received is %d\n", ODAS_data_source_str[c], rcvd_bytes[c]);
-		if (rcvd_bytes[c] == -1) {
-			debug_print(DEBUG_CONNECTION, "reception terminate  for income data %s\n" , ODAS_data_source_str[c]);
-			return true;
-		} else if ((rcvd_bytes[c] == 0) ) {
-			counter_no_data--;
-			if (counter_no_data<=0) {
-				debug_print(DEBUG_CONNECTION, "timeout for income data %s\n" , ODAS_data_source_str[c]);
-				return true;
-			} 
-			debug_print(DEBUG_CONNECTION, "Decrease timeout counter %d/%d\n" , counter_no_data, MAX_EMPTY_MESSAGE);
-		} else {
-			counter_no_data = MAX_EMPTY_MESSAGE; // reset the counter
-			debug_print(DEBUG_CONNECTION, "Reset counter, \n" , counter_no_data);
-		}
-	}
-	fflush(stdout);
-	return false;
-}
-
 int close_connection(int server_id) {
 	shutdown(server_id, SHUT_RDWR);
 	int retval = close(server_id);
 	debug_print(DEBUG_CONNECTION, "Close connection server %d, return value %d\n" , server_id, retval);
 	return retval;
 }
+
+// REACTOR SECTION
+int init_reactor() {
+	int reactor_id = epoll_create1(EPOLL_CLOEXEC);
+	if (reactor_id==-1) {
+		fprintf(stderr,"creating the reactor, error errno=%d - %s\n", errno, strerror(errno));
+		exit(-2);
+	}
+	return reactor_id;
+}
+
+int reactor_watch(int reactor_id, int fd, reactor_event_kind kind, int odas_id) {
+	/*Level triggered: a stream with data left is reported again on the next wait, after the other streams had their turn*/
+	struct epoll_event event;
+	memset(&event, 0, sizeof(event));
+	event.events = EPOLLIN;
+	event.data.u32 = (unsigned int)kind*NUM_OF_ODAS_DATA_SOURCES + odas_id;
+	int retval = epoll_ctl(reactor_id, EPOLL_CTL_ADD, fd, &event);
+	debug_print(DEBUG_CONNECTION, "reactor %d watch fd %d for %s, returned %d\n", reactor_id, fd, ODAS_data_source_str[odas_id], retval);
+	return retval;
+}
+
+int reactor_unwatch(int reactor_id, int fd) {
+	int retval = epoll_ctl(reactor_id, EPOLL_CTL_DEL, fd, NULL);
+	debug_print(DEBUG_CONNECTION, "reactor %d unwatch fd %d, returned %d\n", reactor_id, fd, retval);
+	return retval;
+}
+
+int init_idle_timer() {
+	int timer_id = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if (timer_id==-1) {
+		fprintf(stderr,"creating an idle timer, error errno=%d - %s\n", errno, strerror(errno));
+		exit(-2);
+	}
+	return timer_id;
+}
+
+void arm_idle_timer(int timer_id, float seconds) {
+	/*One shot timer, 0 seconds disarm it*/
+	struct itimerspec spec;
+	memset(&spec, 0, sizeof(spec));
+	if (seconds > 0.0) {
+		spec.it_value.tv_sec = (time_t) seconds;
+		spec.it_value.tv_nsec = (long) ((seconds - (float) spec.it_value.tv_sec) * 1000000000.0);
+		if (spec.it_value.tv_sec == 0 and spec.it_value.tv_nsec == 0) {
+			spec.it_value.tv_nsec = 1; // 0 would disarm
+		}
+	}
+	timerfd_settime(timer_id, 0, &spec, NULL);
+}
+
+double monotonic_seconds() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double) now.tv_sec + (double) now.tv_nsec * 1E-9;
+}
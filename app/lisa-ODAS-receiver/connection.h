@@ -12,12 +12,27 @@
 #include <fcntl.h> /* Added for the nonblocking socket */
 #include <unistd.h> /*usleep */
 #include <sys/ioctl.h> // FIONREAD
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <time.h>
+
+// Max number of events handled for each epoll_wait
+#define MAX_REACTOR_EVENTS 16
+// What a file descriptor watched by the reactor is, the event data is kind*NUM_OF_ODAS_DATA_SOURCES + data source
+enum reactor_event_kind{EVENT_LISTEN = 0, EVENT_DATA = 1, EVENT_TIMER = 2};
 
 
 int init_connection(sockaddr_in &server_address, int port_number, int backlog);
 int accept_connection(int server_id);
-bool reception_terminate(unsigned int rcvd_bytes[]);
 int close_connection(int server_id);
 
+// Reactor: one epoll instance watches the listening sockets, the connections and the idle timers of all the streams
+int init_reactor();
+int reactor_watch(int reactor_id, int fd, reactor_event_kind kind, int odas_id);
+int reactor_unwatch(int reactor_id, int fd);
+int init_idle_timer();
+void arm_idle_timer(int timer_id, float seconds);
+double monotonic_seconds();
+
 
 #endif
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "matrix_odas_receiver.h"
 #include "python_wrapper.h"
 
+#include <pthread.h>
+
 #ifdef MATRIX_LED
 #pragma message "MATRIX_LED flag is ON"
 #include "led_bus.h"
@@ -34,9 +36,9 @@ int INCREMENT = 20;
 int DECREMENT = 2;
 int MIN_THRESHOLD = 5;
 int short MAX_BRIGHTNESS = 220;
-float SLEEP_ACCEPT_LOOP = 1.0;
-int MAX_EMPTY_MESSAGE = 200;
+float IDLE_TIMEOUT = 5.0;
 short int MAX_RECV_BACKLOG = 4;
+int DISPATCH_QUEUE_LEN = 16;
 int SSS_SAMPLERATE = 16000;
 bool USE_MATRIX_LED = false; // This is more for debug and works only with matrix overloop leds
 
@@ -47,6 +49,21 @@ bool USE_MATRIX_LED = false; // This is more for debug and works only with matri
 static SSL_struct SSL_data;
 static SST_struct SST_data;
 const int backlog = MAX_RECV_BACKLOG; // The number of message in queue in a recv
+static int reactor_id = -1; // epoll instance watching all the streams
+static int timers_id[NUM_OF_ODAS_DATA_SOURCES] = {0, 0, 0, 0}; // idle timer (timerfd) of each stream
+static double last_activity[NUM_OF_ODAS_DATA_SOURCES] = {0.0, 0.0, 0.0, 0.0}; // last time data was received, in sec
+
+// Messages received by the reactor, waiting for the worker of their stream (decode and python callbacks)
+static char *queue_messages[NUM_OF_ODAS_DATA_SOURCES] = {NULL, NULL, NULL, NULL}; // DISPATCH_QUEUE_LEN slots of n_bytes_msg[c] bytes
+static unsigned int *queue_sizes[NUM_OF_ODAS_DATA_SOURCES] = {NULL, NULL, NULL, NULL}; // size of the message in each slot
+static unsigned int queue_head[NUM_OF_ODAS_DATA_SOURCES] = {0, 0, 0, 0}; // oldest slot
+static unsigned int queue_count[NUM_OF_ODAS_DATA_SOURCES] = {0, 0, 0, 0}; // slots in use
+static unsigned long queue_dropped[NUM_OF_ODAS_DATA_SOURCES] = {0, 0, 0, 0}; // messages dropped because the worker was behind
+static bool queue_stop[NUM_OF_ODAS_DATA_SOURCES] = {false, false, false, false}; // ask the worker to terminate
+static pthread_mutex_t queue_mutex[NUM_OF_ODAS_DATA_SOURCES];
+static pthread_cond_t queue_filled[NUM_OF_ODAS_DATA_SOURCES];
+static pthread_t workers_id[NUM_OF_ODAS_DATA_SOURCES];
+static pthread_mutex_t doa_mutex = PTHREAD_MUTEX_INITIALIZER; // SSL_data and SST_data are drawn on the leds from two workers
 
 #ifdef MATRIX_LED
 static hal_leds_struct hw_led;
@@ -130,6 +147,169 @@ void decode_audio_stream_raw(FILE* outfile, char* odas_stream_msg, int message_l
 	}
 }
 
+// Decode a received message and hand it to the python callbacks (worker of the stream)
+void dispatch_message(int c, char* message, unsigned int message_size, unsigned long n_messages) {
+	void* SSx_data;
+	debug_print(DEBUG_INCOME_MSG, "[Count %d] RECEIVED stream message %s: len=%d\n",n_messages,  ODAS_data_source_str[c], message_size);
+	// accordingly to enum ODAS_data_source, 0 SSL, 1 SST, ...
+	// Decode an incoming message and store in the proper C structure
+	if (c == SST or c == SSL) {
+		message[message_size] = 0x00; 
+		debug_print(DEBUG_INCOME_MSG, "RECEIVED JSON message %s: len=%d\n", ODAS_data_source_str[c], message_size);
+		// Each structure is only written by its own worker, the lock keeps the leds from reading it half decoded
+		pthread_mutex_lock(&doa_mutex);
+		decode_message( c, message);
+#ifdef MATRIX_LED
+		if (USE_MATRIX_LED) {
+			// Finally, set all the pots with all complete data
+			set_all_pots(&hw_led ,&SSL_data, &SST_data);
+		}
+#endif
+		pthread_mutex_unlock(&doa_mutex);
+		if (has_py_callback(c)) {
+			SSx_data = NULL;
+			SSx_data = c == SSL ? (void*)&SSL_data : SSx_data;
+			SSx_data = c == SST ? (void*)&SST_data : SSx_data;
+			py_callback_message(c, SSx_data) ;
+		}
+	} else if (c == SSS_S or c == SSS_P) {
+		debug_print(DEBUG_INCOME_MSG, "RECEIVED PCM message %s: len=%d\n", ODAS_data_source_str[c], message_size);
+		if (DUMP_PCM) {  
+			decode_audio_stream_raw(dump_outfile_fd[c], message, message_size);
+		} 
+		if (has_py_callback(c)) {
+			py_callback_stream(c,  message_size, message);
+		}
+	} else {
+		printf("Here with invalid c=%d",c );
+	}
+}
+
+// Copy the received message in the queue of its stream, the oldest message is dropped when the worker is behind
+void enqueue_message(int c) {
+	unsigned int slot;
+	pthread_mutex_lock(&queue_mutex[c]);
+	if (queue_count[c] == (unsigned int) DISPATCH_QUEUE_LEN) {
+		if (queue_dropped[c] == 0) {
+			printf("[%s worker is behind, dropping the oldest messages]\n", ODAS_data_source_str[c]);
+			fflush(stdout);
+		}
+		queue_dropped[c]++;
+		queue_head[c] = (queue_head[c] + 1) % DISPATCH_QUEUE_LEN;
+		queue_count[c]--;
+	}
+	slot = (queue_head[c] + queue_count[c]) % DISPATCH_QUEUE_LEN;
+	memcpy(queue_messages[c] + slot * n_bytes_msg[c], messages[c], messages_size[c]);
+	queue_sizes[c][slot] = messages_size[c];
+	queue_count[c]++;
+	pthread_cond_signal(&queue_filled[c]);
+	pthread_mutex_unlock(&queue_mutex[c]);
+}
+
+// Worker of a stream: a slow python callback only delays its own stream, never the reactor.
+// The python callbacks are ctypes functions, which take the GIL by themselves when called from this thread
+void* dispatch_worker(void* arg) {
+	int c = (int) (long) arg;
+	char* message = (char *)malloc(sizeof(char) * n_bytes_msg[c]);
+	unsigned int message_size;
+	unsigned long n_messages = 0;
+	while (1) {
+		pthread_mutex_lock(&queue_mutex[c]);
+		while (queue_count[c] == 0 and !queue_stop[c]) {
+			pthread_cond_wait(&queue_filled[c], &queue_mutex[c]);
+		}
+		if (queue_count[c] == 0) {
+			pthread_mutex_unlock(&queue_mutex[c]);
+			break;
+		}
+		message_size = queue_sizes[c][queue_head[c]];
+		memcpy(message, queue_messages[c] + queue_head[c] * n_bytes_msg[c], message_size);
+		queue_head[c] = (queue_head[c] + 1) % DISPATCH_QUEUE_LEN;
+		queue_count[c]--;
+		pthread_mutex_unlock(&queue_mutex[c]);
+		dispatch_message(c, message, message_size, ++n_messages);
+	}
+	free(message);
+	return NULL;
+}
+
+void close_stream(int c) {
+	if (connections_id[c] <= 0) {
+		return;
+	}
+	printf("Closing [%s connection (%d) - server (%d)", ODAS_data_source_str[c], connections_id[c], servers_id[c]);
+	reactor_unwatch(reactor_id, connections_id[c]);
+	int conncetion_retval = close_connection(connections_id[c]);
+	connections_id[c] = 0; // delete the connection reference, the descriptor is released even if close reported an error
+	arm_idle_timer(timers_id[c], 0.0);
+	printf(" ... %s", conncetion_retval == 0 ? " CLOSED]\n" : "ERROR]\n");
+	pthread_mutex_lock(&queue_mutex[c]);
+	if (queue_dropped[c] > 0) {
+		printf("[%s %lu message(s) dropped by the worker queue]\n", ODAS_data_source_str[c], queue_dropped[c]);
+		queue_dropped[c] = 0;
+	}
+	pthread_mutex_unlock(&queue_mutex[c]);
+	fflush(stdout);
+}
+
+void accept_stream(int c) {
+	int connection_id = accept_connection(servers_id[c]);
+	if (connection_id <= 0) {
+		return; // nothing pending anymore
+	}
+	if (connections_id[c] > 0) {
+		// ODAS restarted and connected again, the new connection replaces the old one
+		printf("[%s new connection (%d) replaces (%d)]\n", ODAS_data_source_str[c], connection_id, connections_id[c]);
+		close_stream(c);
+	}
+	connections_id[c] = connection_id;
+	reactor_watch(reactor_id, connection_id, EVENT_DATA, c);
+	last_activity[c] = monotonic_seconds();
+	arm_idle_timer(timers_id[c], IDLE_TIMEOUT);
+	printf("[%s(%d) CONNECTED]\n", ODAS_data_source_str[c], connection_id);
+	fflush(stdout);
+}
+
+// One recv for each readiness event: a stream with more data waits its next turn, after the other ready streams.
+// The message only goes in the queue of the stream, so recv never waits for a decode or a callback
+void receive_stream(int c) {
+	if (connections_id[c] <= 0) {
+		return; // closed earlier in the same batch of events
+	}
+	// JSON messages are terminated after the received bytes, keep room for it
+	int max_len = (c == SST or c == SSL) ? n_bytes_msg[c] - 1 : n_bytes_msg[c];
+	int retval = recv(connections_id[c] , messages[c], max_len, 0);
+	if (retval > 0) {
+		messages_size[c] = retval;
+		last_activity[c] = monotonic_seconds();
+		enqueue_message(c);
+		return;
+	}
+	messages_size[c] = 0;
+	if (retval == 0) {
+		debug_print(DEBUG_CONNECTION, "%s closed by peer\n", ODAS_data_source_str[c]);
+		close_stream(c);
+	} else if (errno != EAGAIN and errno != EWOULDBLOCK and errno != EINTR) {
+		fprintf(stderr, "receiving %s, error errno=%d - %s\n", ODAS_data_source_str[c], errno, strerror(errno));
+		close_stream(c);
+	}
+}
+
+// The idle timer is armed once per connection, data received in between only moves the deadline
+void check_idle_stream(int c) {
+	uint64_t expirations;
+	if (read(timers_id[c], &expirations, sizeof(expirations)) != sizeof(expirations) or connections_id[c] <= 0) {
+		return;
+	}
+	double idle = monotonic_seconds() - last_activity[c];
+	if (idle >= IDLE_TIMEOUT) {
+		debug_print(DEBUG_CONNECTION, "timeout for income data %s, idle %f sec\n" , ODAS_data_source_str[c], idle);
+		close_stream(c);
+	} else {
+		arm_idle_timer(timers_id[c], IDLE_TIMEOUT - idle);
+	}
+}
+
 int main_loop(bool dump_file, bool use_matrix_led) {
 #ifdef MATRIX_LED
   USE_MATRIX_LED = use_matrix_led;
@@ -168,6 +348,18 @@ int main_loop(bool dump_file, bool use_matrix_led) {
   printf(" [OK]\n");
   fflush(stdout);
 
+// INIT QUEUES
+  if (DISPATCH_QUEUE_LEN < 1) {
+	  printf("main_loop: DISPATCH_QUEUE_LEN must be at least 1\n");
+	  return -1;
+  }
+  for (c = 0 ; c < NUM_OF_ODAS_DATA_SOURCES; c++) {
+	queue_messages[c] = (char *)malloc(sizeof(char) * n_bytes_msg[c] * DISPATCH_QUEUE_LEN);
+	queue_sizes[c] = (unsigned int *)malloc(sizeof(unsigned int) * DISPATCH_QUEUE_LEN);
+	pthread_mutex_init(&queue_mutex[c], NULL);
+	pthread_cond_init(&queue_filled[c], NULL);
+  }
+
 // DUMP FILES
   if (DUMP_PCM) {  
 	  printf(" Init output file(s) with %d @ %d Hz", (unsigned int) SSS_BITS/8, SSS_SAMPLERATE);
@@ -183,131 +375,91 @@ int main_loop(bool dump_file, bool use_matrix_led) {
 	  }
 	  printf(" [OK]\n");
   }
+  // INIT WORKERS
+  printf(" Init workers");
+  for (c = 0 ; c < NUM_OF_ODAS_DATA_SOURCES; c++) {
+	  if (port_numbers[c]) {
+		  printf(" ... %s ", ODAS_data_source_str[c]);
+		  if (pthread_create(&workers_id[c], NULL, dispatch_worker, (void *) (long) c) != 0) {
+			  printf("Fail creating the worker of %s", ODAS_data_source_str[c]);
+			  exit(-1);
+		  }
+	  }
+  }
+  printf(" [OK]\n");
   // INIT CONNECTIONS
   printf(" Init listening");
+  reactor_id = init_reactor();
   for (c = 0 ; c < NUM_OF_ODAS_DATA_SOURCES; c++) {
 	  if (port_numbers[c]) {
 		  printf(" ... %s ", ODAS_data_source_str[c]);
 		  servers_id[c] = init_connection(servers_address[c], port_numbers[c], backlog); 
+		  timers_id[c] = init_idle_timer();
+		  reactor_watch(reactor_id, servers_id[c], EVENT_LISTEN, c);
+		  reactor_watch(reactor_id, timers_id[c], EVENT_TIMER, c);
 		  printf(" (%d)", servers_id[c]);
 	  }
   }
   printf(" [OK]\n");
+  printf(" Waiting For Connections\n ");
   fflush(stdout);
-  while(1) {
-	
-	  
-	// ACCEPT CONNECTIONS
-	  printf(" Waiting For Connections\n ");
-	  bool services_connected = false;
-	  printf("Connecting: ");
-	  while (!services_connected) {
-		for (c = 0 ; c < NUM_OF_ODAS_DATA_SOURCES; c++) {
-		  if (port_numbers[c]) {
-			printf("[%s", ODAS_data_source_str[c]);
-			if (connections_id[c] <= 0) {
-				connections_id[c] = accept_connection(servers_id[c]); 
-			}
-			printf("(%d)-%s", connections_id[c], connections_id[c] >= 0 ? " CONNECTED]\n" : ".]");
-			fflush(stdout);
-		  } 
-		}
-		services_connected = true;
-		for (c = 0 ; c < NUM_OF_ODAS_DATA_SOURCES; c++) {	
-		  services_connected = services_connected and (port_numbers[c] ? connections_id[c] > 0 : true);
-		}
-		printf("[services_connected %s\n", services_connected ? "True]" : "False]");
-		//services_connected = (portNumber_ssl ? connection_id_ssl > 0 : true) and (portNumber_sst ? connection_id_sst > 0 : true); 
-		usleep( (unsigned int)(SLEEP_ACCEPT_LOOP*1000000) ); 
-	  } 
-	  printf("Connection [OK]\n");
-	  fflush(stdout);
 
-	// RECEIVING DATA
-	  printf("Receiving data........... \n");
-	  int bytes_available;
-	  void* SSx_data;
-	  unsigned long n_cycles = 1; // Just a counter
-	  while (!reception_terminate(messages_size)) { 
-		  // Separator to print only when debugging but not with the debug formatting	  
-		  if (DEBUG_INCOME_MSG) { printf("---------------------------------\nSTART RECEPTION: %d\n---------------------------------\n", n_cycles);}
-		  for (c = 0 ; c < NUM_OF_ODAS_DATA_SOURCES; c++) {	
-			if (!port_numbers[c]) {
-				// skip if 0, port not selected -> service not in use
-				continue;
-			}
-			memset(messages[c], '\0', sizeof(char) * n_bytes_msg[c]); // Reset before using, fill the message of NULLs (reset and possible previous values from previous iteraction)
-			ioctl(connections_id[c] ,FIONREAD,&bytes_available);
-			messages_size[c] = port_numbers[c] ? recv(connections_id[c] , messages[c], n_bytes_msg[c], 0): 0; // Received the message, if available
-			//messages_size[c] = port_numbers[c] ? recv(connections_id[c] , messages[c], n_bytes_msg[c], MSG_DONTWAIT ): 0; // Received the message, if available
-			debug_print(DEBUG_INCOME_MSG, "[Count %d] RECEIVED stream message %s: len=%d - bytes_available(before recv)=%d, ratio %f\n",n_cycles,  ODAS_data_source_str[c], messages_size[c], bytes_available, (float)bytes_available/n_bytes_msg[c]);
-			if (messages_size[c]) {
-				// accordingly to enum ODAS_data_source, 0 SSL, 1 SST, ...
-				// Decode an incoming message and store in the proper C structure
-				if (c == SST or c == SSL) {
-					messages[c][messages_size[c]] = 0x00; 
-					debug_print(DEBUG_INCOME_MSG, "RECEIVED JSON message %s: len=%d\n", ODAS_data_source_str[c], messages_size[c]);
-					decode_message( c, messages[c]);
-					if (has_py_callback(c)) {
-						SSx_data = NULL;
-						SSx_data = c == SSL ? (void*)&SSL_data : SSx_data;
-						SSx_data = c == SST ? (void*)&SST_data : SSx_data;
-						py_callback_message(c, SSx_data) ;
-					}			
-				} else if (c == SSS_S or c == SSS_P) {
-					debug_print(DEBUG_INCOME_MSG, "RECEIVED PCM message %s: len=%d\n", ODAS_data_source_str[c], messages_size[c]);
-					if (DUMP_PCM) {  
-						decode_audio_stream_raw(dump_outfile_fd[c], messages[c], messages_size[c]);
-					} 
-					if (has_py_callback(c)) {
-						py_callback_stream(c,  messages_size[c], messages[c]);
-					}
-				} else {
-					printf("Here with invalid c=%d",c );
-				}
-			} else {
-				debug_print(DEBUG_INCOME_MSG, "returned 0 len for %s: len=%d\n", ODAS_data_source_str[c], messages_size[c]);
-			}
-			if (DEBUG_INCOME_MSG) { printf("END RECEPTION message %s: len=%d\n+-+-+-+-+-+-+-+-+-+-\n", ODAS_data_source_str[c], messages_size[c]); }
-			fflush(stdout);
+// RECEIVING DATA
+  // Every stream is accepted, read and timed out on its own, as soon as the reactor reports it ready
+  struct epoll_event events[MAX_REACTOR_EVENTS];
+  unsigned long n_cycles = 1; // Just a counter
+  while(1) {
+	  int n_events = epoll_wait(reactor_id, events, MAX_REACTOR_EVENTS, -1);
+	  if (n_events == -1) {
+		  if (errno == EINTR) {
+			  continue;
 		  }
-	#ifdef MATRIX_LED
-		  if (USE_MATRIX_LED) {
-			 // Finally, set all the pots with all complete data
-			set_all_pots(&hw_led ,&SSL_data, &SST_data);
+		  fprintf(stderr, "waiting for events, error errno=%d - %s\n", errno, strerror(errno));
+		  break;
+	  }
+	  // Separator to print only when debugging but not with the debug formatting	  
+	  if (DEBUG_INCOME_MSG) { printf("---------------------------------\nSTART RECEPTION: %d (%d events)\n---------------------------------\n", n_cycles, n_events);}
+	  for (int e = 0; e < n_events; e++) {
+		  c = events[e].data.u32 % NUM_OF_ODAS_DATA_SOURCES;
+		  switch (events[e].data.u32 / NUM_OF_ODAS_DATA_SOURCES) {
+			  case EVENT_LISTEN:
+				  accept_stream(c);
+				  break;
+			  case EVENT_DATA:
+				  receive_stream(c);
+				  break;
+			  case EVENT_TIMER:
+				  check_idle_stream(c);
+				  break;
 		  }
-	#endif
-		  if (DEBUG_INCOME_MSG) { printf("---------------------------------\nEND RECEPTION: %d\n---------------------------------\n\n", n_cycles);}
-		  n_cycles++;
 	  }
-	 
-	// CLOSING CONNECTION
-	  printf("Closing connection");
-	  services_connected = true;
-	  int conncetion_retval;
-	  while (services_connected) {
-		for (c = 0 ; c < NUM_OF_ODAS_DATA_SOURCES; c++) {
-		  if (port_numbers[c]) {
-			if (connections_id[c] != 0) {
-				printf("Closing [connection (%d) - server (%d)", connections_id[c], servers_id[c]);
-				conncetion_retval = close_connection(connections_id[c]); //close_connection(servers_id[c]); 
-				if (conncetion_retval == 0) {
-					connections_id[c] = 0; // delete the connection reference
-				}
-				printf(" ... %s", conncetion_retval == 0 ? " CLOSED]\n" : "OPEN]\n");
-				fflush(stdout);
-			}
-		  } 
-		}
-		services_connected = false;
-		for (c = 0 ; c < NUM_OF_ODAS_DATA_SOURCES; c++) {	
-		  services_connected = services_connected and (port_numbers[c] ? connections_id[c] == 0 : false);
-		}
-	  } 
-	  printf("Disconnected [OK]\n");
-	  fflush(stdout);
-  }// end while(1) big loop
-   printf("Receiving Data terminated [OK]\n");
+	  if (DEBUG_INCOME_MSG) { printf("---------------------------------\nEND RECEPTION: %d\n---------------------------------\n\n", n_cycles);}
+	  n_cycles++;
+  }
+
+// CLOSING CONNECTION
+  printf("Closing connection");
+  for (c = 0 ; c < NUM_OF_ODAS_DATA_SOURCES; c++) {
+	  if (port_numbers[c]) {
+		  close_stream(c);
+		  close(timers_id[c]);
+		  close_connection(servers_id[c]);
+	  }
+  }
+  close(reactor_id);
+  printf("Disconnected [OK]\n");
+  // The workers dispatch what is still queued, then terminate
+  for (c = 0 ; c < NUM_OF_ODAS_DATA_SOURCES; c++) {
+	  pthread_mutex_lock(&queue_mutex[c]);
+	  queue_stop[c] = true;
+	  pthread_cond_signal(&queue_filled[c]);
+	  pthread_mutex_unlock(&queue_mutex[c]);
+	  if (port_numbers[c]) {
+		  pthread_join(workers_id[c], NULL);
+	  }
+  }
+  printf("Workers terminated [OK]\n");
+  printf("Receiving Data terminated [OK]\n");
 	if (DUMP_PCM) {  
 	  for (c = 0 ; c < NUM_OF_ODAS_DATA_SOURCES; c++) {	
 		if (c==SSS_S or c == SSS_P) {
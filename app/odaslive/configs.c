@@ -17,6 +17,7 @@
             // +------------------------------------------------------+  
 
                 cfgs->src_hops_mics_config = parameters_src_hops_mics_config(file_config);
+                cfgs->src_frontend_mics_config = parameters_src_frontend_mics_config(file_config);
 
             // +------------------------------------------------------+
             // | Message                                              |
@@ -73,6 +74,12 @@
 
                 cfgs->msg_spectra_mics_config = parameters_msg_spectra_mics_config(file_config);
 
+            // +------------------------------------------------------+
+            // | Sink                                                 |
+            // +------------------------------------------------------+  
+
+                cfgs->snk_spectra_mics_config = parameters_snk_spectra_mics_config(file_config);
+
         // +----------------------------------------------------------+
         // | Noise                                                    |
         // +----------------------------------------------------------+  
@@ -89,6 +96,12 @@
 
                 cfgs->msg_powers_mics_config = parameters_msg_powers_mics_config(file_config);
 
+            // +------------------------------------------------------+
+            // | Sink                                                 |
+            // +------------------------------------------------------+  
+
+                cfgs->snk_powers_mics_config = parameters_snk_powers_mics_config(file_config);
+
         // +----------------------------------------------------------+
         // | SSL                                                      |
         // +----------------------------------------------------------+  
@@ -226,6 +239,8 @@
 
                 cfgs->snk_hops_seps_vol_config = parameters_snk_hops_seps_vol_config(file_config);
                 cfgs->snk_hops_pfs_vol_config = parameters_snk_hops_pfs_vol_config(file_config);
+                cfgs->snk_backend_seps_config = parameters_snk_backend_seps_config(file_config);
+                cfgs->snk_backend_pfs_config = parameters_snk_backend_pfs_config(file_config);
 
         // +----------------------------------------------------------+
         // | Classify                                                 |
@@ -266,6 +281,10 @@
             // +------------------------------------------------------+  
 
                 src_hops_cfg_destroy(cfgs->src_hops_mics_config);
+
+                if (cfgs->src_frontend_mics_config != NULL) {
+                    src_frontend_cfg_destroy(cfgs->src_frontend_mics_config);
+                }
                 
             // +------------------------------------------------------+
             // | Message                                              |
@@ -321,6 +340,14 @@
 
                 msg_spectra_cfg_destroy(cfgs->msg_spectra_mics_config);
 
+            // +------------------------------------------------------+
+            // | Sink                                                 |
+            // +------------------------------------------------------+  
+
+                if (cfgs->snk_spectra_mics_config != NULL) {
+                    snk_spectra_cfg_destroy(cfgs->snk_spectra_mics_config);
+                }
+
         // +----------------------------------------------------------+
         // | Noise                                                    |
         // +----------------------------------------------------------+  
@@ -336,6 +363,14 @@
             // +------------------------------------------------------+  
 
                 msg_powers_cfg_destroy(cfgs->msg_powers_mics_config);
+
+            // +------------------------------------------------------+
+            // | Sink                                                 |
+            // +------------------------------------------------------+  
+
+                if (cfgs->snk_powers_mics_config != NULL) {
+                    snk_powers_cfg_destroy(cfgs->snk_powers_mics_config);
+                }
                             
         // +----------------------------------------------------------+
         // | SSL                                                      |
@@ -475,6 +510,13 @@
                 snk_hops_cfg_destroy(cfgs->snk_hops_seps_vol_config);
                 snk_hops_cfg_destroy(cfgs->snk_hops_pfs_vol_config);
 
+                if (cfgs->snk_backend_seps_config != NULL) {
+                    snk_backend_cfg_destroy(cfgs->snk_backend_seps_config);
+                }
+                if (cfgs->snk_backend_pfs_config != NULL) {
+                    snk_backend_cfg_destroy(cfgs->snk_backend_pfs_config);
+                }
+
         // +----------------------------------------------------------+
         // | Classify                                                 |
         // +----------------------------------------------------------+
@@ -9,6 +9,7 @@
     typedef struct configs {
                 
         src_hops_cfg * src_hops_mics_config;
+        src_frontend_cfg * src_frontend_mics_config;
         msg_hops_cfg * msg_hops_mics_raw_config;
 
         mod_mapping_cfg * mod_mapping_mics_config;
@@ -19,9 +20,11 @@
 
         mod_stft_cfg * mod_stft_mics_config;
         msg_spectra_cfg * msg_spectra_mics_config;
+        snk_spectra_cfg * snk_spectra_mics_config;
 
         mod_noise_cfg * mod_noise_mics_config;
         msg_powers_cfg * msg_powers_mics_config;
+        snk_powers_cfg * snk_powers_mics_config;
 
         mod_ssl_cfg * mod_ssl_config;
         msg_pots_cfg * msg_pots_ssl_config;
@@ -54,6 +57,8 @@
         msg_hops_cfg * msg_hops_pfs_vol_config;
         snk_hops_cfg * snk_hops_seps_vol_config;
         snk_hops_cfg * snk_hops_pfs_vol_config;
+        snk_backend_cfg * snk_backend_seps_config;
+        snk_backend_cfg * snk_backend_pfs_config;
 
         mod_classify_cfg * mod_classify_config;
         msg_categories_cfg * msg_categories_config;
@@ -56,6 +56,15 @@
 
             char stopProcess;
 
+        // +------------------------------------------------------+
+        // | Batch                                                |
+        // +------------------------------------------------------+
+
+            char batch;
+            struct timespec batchBegin;
+            struct timespec batchEnd;
+            src_hops_obj * batchSource;
+
     // +----------------------------------------------------------+
     // | Signal handler                                           |
     // +----------------------------------------------------------+  
@@ -85,11 +94,18 @@
             char verbose = 0x00;
 
             type = processing_multithread;
+            batch = 0x00;
 
-            while ((c = getopt(argc,argv, "c:hsv")) != -1) {
+            while ((c = getopt(argc,argv, "bc:hsv")) != -1) {
 
                 switch(c) {
 
+                    case 'b':
+
+                        batch = 0x01;
+
+                    break;
+
                     case 'c':
 
                         file_config = (char *) malloc(sizeof(char) * (strlen(optarg)+1));
@@ -108,6 +124,7 @@
                         printf("| Repository:  github.com/introlab/odas              |\n");
                         printf("| Version:     1.0                                   |\n");
                         printf("+----------------------------------------------------+\n");        
+                        printf("| -b       Batch: process a file as fast as possible |\n");
                         printf("| -c       Configuration file (.cfg)                 |\n");
                         printf("| -h       Help                                      |\n");
                         printf("| -s       Process sequentially (no multithread)     |\n");
@@ -175,6 +192,7 @@
                 if (verbose == 0x01) printf("| + Initializing configurations...... "); fflush(stdout); 
 
                 cfgs = configs_construct(file_config);
+                threads_batch_check(batch, cfgs);
 
                 if (verbose == 0x01) printf("[Done] |\n");
 
@@ -188,19 +206,32 @@
                 
                 if (verbose == 0x01) printf("[Done] |\n");   
 
+                if (objs->src_frontend_mics_object == NULL) {
+                    batchSource = objs->src_hops_mics_object;
+                }
+                else {
+                    batchSource = objs->src_frontend_mics_object->src_hops;
+                }
+
             // +--------------------------------------------------+
             // | Processing                                       |
             // +--------------------------------------------------+  
 
                 if (verbose == 0x01) printf("| + Processing....................... "); fflush(stdout);
 
+                clock_gettime(CLOCK_MONOTONIC, &batchBegin);
+
                 threads_single_open(objs);
                 stopProcess = 0;
                 while((threads_single_process(objs, prf) == 0) && (stopProcess == 0));
                 threads_single_close(objs);
 
+                clock_gettime(CLOCK_MONOTONIC, &batchEnd);
+
                 if (verbose == 0x01) printf("[Done] |\n");
 
+                if (batch == 0x01) threads_batch_printf(batchSource, &batchBegin, &batchEnd);
+
             // +--------------------------------------------------+
             // | Free memory                                      |
             // +--------------------------------------------------+  
@@ -236,6 +267,7 @@
                 if (verbose == 0x01) printf("| + Initializing configurations...... "); fflush(stdout); 
 
                 cfgs = configs_construct(file_config);
+                threads_batch_check(batch, cfgs);
 
                 if (verbose == 0x01) printf("[Done] |\n");
 
@@ -249,6 +281,13 @@
 
                 if (verbose == 0x01) printf("[Done] |\n");
 
+                if (aobjs->asrc_frontend_mics_object == NULL) {
+                    batchSource = aobjs->asrc_hops_mics_object->src_hops;
+                }
+                else {
+                    batchSource = aobjs->asrc_frontend_mics_object->src_frontend->src_hops;
+                }
+
             // +--------------------------------------------------+
             // | Launch threads                                   |
             // +--------------------------------------------------+  
@@ -257,6 +296,8 @@
 
                 if (verbose == 0x01) printf("| + Launch threads................... "); fflush(stdout); 
 
+                clock_gettime(CLOCK_MONOTONIC, &batchBegin);
+
                 threads_multiple_start(aobjs);
 
                 if (verbose == 0x01) printf("[Done] |\n");
@@ -269,8 +310,12 @@
                 
                 threads_multiple_join(aobjs);
 
+                clock_gettime(CLOCK_MONOTONIC, &batchEnd);
+
                 if (verbose == 0x01) printf("[Done] |\n");
 
+                if (batch == 0x01) threads_batch_printf(batchSource, &batchBegin, &batchEnd);
+
             // +--------------------------------------------------+
             // | Free memory                                      |
             // +--------------------------------------------------+  
@@ -23,6 +23,20 @@
                     objs->src_hops_mics_object = src_hops_construct(cfgs->src_hops_mics_config, 
                                                                     cfgs->msg_hops_mics_raw_config);
 
+                    if (cfgs->src_frontend_mics_config != NULL) {
+
+                        objs->src_frontend_mics_object = src_frontend_construct(cfgs->src_frontend_mics_config,
+                                                                                cfgs->msg_hops_mics_raw_config,
+                                                                                cfgs->msg_hops_mics_rs_config,
+                                                                                cfgs->msg_spectra_mics_config);
+
+                    }
+                    else {
+
+                        objs->src_frontend_mics_object = NULL;
+
+                    }
+
                 // +--------------------------------------------------+
                 // | Connector                                        |
                 // +--------------------------------------------------+  
@@ -62,7 +76,7 @@
                 // | Connector                                        |
                 // +--------------------------------------------------+  
 
-                    objs->con_hops_mics_rs_object = con_hops_construct(2, cfgs->msg_hops_mics_rs_config);                    
+                    objs->con_hops_mics_rs_object = con_hops_construct((objs->src_frontend_mics_object == NULL) ? 2 : 1, cfgs->msg_hops_mics_rs_config);                    
 
             // +------------------------------------------------------+
             // | STFT                                                 |
@@ -80,7 +94,23 @@
                 // | Connector                                        |
                 // +--------------------------------------------------+  
 
-                    objs->con_spectra_mics_object = con_spectra_construct(3, cfgs->msg_spectra_mics_config);
+                    objs->con_spectra_mics_object = con_spectra_construct((cfgs->snk_spectra_mics_config == NULL) ? 3 : 4, cfgs->msg_spectra_mics_config);
+
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+  
+
+                    if (cfgs->snk_spectra_mics_config != NULL) {
+
+                        objs->snk_spectra_mics_object = snk_spectra_construct(cfgs->snk_spectra_mics_config,
+                                                                              cfgs->msg_spectra_mics_config);
+
+                    }
+                    else {
+
+                        objs->snk_spectra_mics_object = NULL;
+
+                    }
 
             // +------------------------------------------------------+
             // | Noise                                                |
@@ -98,7 +128,23 @@
                 // | Connector                                        |
                 // +--------------------------------------------------+  
 
-                    objs->con_powers_mics_object = con_powers_construct(1, cfgs->msg_powers_mics_config);
+                    objs->con_powers_mics_object = con_powers_construct((cfgs->snk_powers_mics_config == NULL) ? 1 : 2, cfgs->msg_powers_mics_config);
+
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+  
+
+                    if (cfgs->snk_powers_mics_config != NULL) {
+
+                        objs->snk_powers_mics_object = snk_powers_construct(cfgs->snk_powers_mics_config,
+                                                                            cfgs->msg_powers_mics_config);
+
+                    }
+                    else {
+
+                        objs->snk_powers_mics_object = NULL;
+
+                    }
 
             // +------------------------------------------------------+
             // | SSL                                                  |
@@ -186,7 +232,7 @@
                 // | Connector                                        |
                 // +--------------------------------------------------+                    
 
-                    objs->con_spectra_seps_object = con_spectra_construct(1, cfgs->msg_spectra_seps_config);
+                    objs->con_spectra_seps_object = con_spectra_construct((cfgs->snk_backend_seps_config == NULL) ? 1 : 2, cfgs->msg_spectra_seps_config);
                     objs->con_spectra_pfs_object = con_spectra_construct(1, cfgs->msg_spectra_pfs_config);
 
             // +------------------------------------------------------+
@@ -209,7 +255,7 @@
                 // | Connector                                        |
                 // +--------------------------------------------------+                     
 
-                    objs->con_hops_seps_object = con_hops_construct(2, cfgs->msg_hops_seps_config);
+                    objs->con_hops_seps_object = con_hops_construct((cfgs->snk_backend_seps_config == NULL) ? 2 : 1, cfgs->msg_hops_seps_config);
                     objs->con_hops_pfs_object = con_hops_construct(1, cfgs->msg_hops_pfs_config);
 
             // +------------------------------------------------------+
@@ -266,6 +312,34 @@
                     objs->snk_hops_pfs_vol_object = snk_hops_construct(cfgs->snk_hops_pfs_vol_config, 
                                                                        cfgs->msg_hops_pfs_vol_config);
 
+                    if (cfgs->snk_backend_seps_config != NULL) {
+
+                        objs->snk_backend_seps_object = snk_backend_construct(cfgs->snk_backend_seps_config,
+                                                                              cfgs->msg_spectra_seps_config,
+                                                                              cfgs->msg_hops_seps_config,
+                                                                              cfgs->msg_hops_seps_vol_config);
+
+                    }
+                    else {
+
+                        objs->snk_backend_seps_object = NULL;
+
+                    }
+
+                    if (cfgs->snk_backend_pfs_config != NULL) {
+
+                        objs->snk_backend_pfs_object = snk_backend_construct(cfgs->snk_backend_pfs_config,
+                                                                             cfgs->msg_spectra_pfs_config,
+                                                                             cfgs->msg_hops_pfs_config,
+                                                                             cfgs->msg_hops_pfs_vol_config);
+
+                    }
+                    else {
+
+                        objs->snk_backend_pfs_object = NULL;
+
+                    }
+
             // +------------------------------------------------------+
             // | Classify                                             |
             // +------------------------------------------------------+  
@@ -339,9 +413,29 @@
                 // | Module                                           |
                 // +--------------------------------------------------+  
 
-                    mod_stft_connect(objs->mod_stft_mics_object, 
-                                     objs->con_hops_mics_rs_object->outs[0], 
-                                     objs->con_spectra_mics_object->in);
+                    if (objs->src_frontend_mics_object == NULL) {
+
+                        mod_stft_connect(objs->mod_stft_mics_object, 
+                                         objs->con_hops_mics_rs_object->outs[0], 
+                                         objs->con_spectra_mics_object->in);
+
+                    }
+                    else {
+
+                        src_frontend_connect(objs->src_frontend_mics_object,
+                                             objs->con_hops_mics_rs_object->in,
+                                             objs->con_spectra_mics_object->in);
+
+                    }
+
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+  
+
+                    if (objs->snk_spectra_mics_object != NULL) {
+                        snk_spectra_connect(objs->snk_spectra_mics_object,
+                                            objs->con_spectra_mics_object->outs[3]);
+                    }
 
             // +------------------------------------------------------+
             // | Noise                                                |
@@ -355,6 +449,15 @@
                                       objs->con_spectra_mics_object->outs[0],
                                       objs->con_powers_mics_object->in);
 
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+  
+
+                    if (objs->snk_powers_mics_object != NULL) {
+                        snk_powers_connect(objs->snk_powers_mics_object,
+                                           objs->con_powers_mics_object->outs[1]);
+                    }
+
             // +------------------------------------------------------+
             // | SSL                                                  |
             // +------------------------------------------------------+  
@@ -383,7 +486,7 @@
                 // +--------------------------------------------------+
 
                     inj_targets_connect(objs->inj_targets_sst_object,
-                                        objs->con_hops_mics_rs_object->outs[1],
+                                        objs->con_hops_mics_rs_object->outs[(objs->src_frontend_mics_object == NULL) ? 1 : 0],
                                         objs->con_targets_sst_object->in);
 
             // +------------------------------------------------------+
@@ -479,6 +582,16 @@
                     snk_hops_connect(objs->snk_hops_pfs_vol_object,
                                      objs->con_hops_pfs_vol_object->outs[0]);
 
+                    if (objs->snk_backend_seps_object != NULL) {
+                        snk_backend_connect(objs->snk_backend_seps_object,
+                                            objs->con_spectra_seps_object->outs[1]);
+                    }
+
+                    if (objs->snk_backend_pfs_object != NULL) {
+                        snk_backend_connect(objs->snk_backend_pfs_object,
+                                            objs->con_spectra_pfs_object->outs[0]);
+                    }
+
             // +------------------------------------------------------+
             // | Classify                                             |
             // +------------------------------------------------------+  
@@ -488,7 +601,7 @@
                 // +--------------------------------------------------+  
 
                     mod_classify_connect(objs->mod_classify_object,
-                                         objs->con_hops_seps_object->outs[1],
+                                         objs->con_hops_seps_object->outs[(cfgs->snk_backend_seps_config == NULL) ? 1 : 0],
                                          objs->con_tracks_sst_object->outs[1],
                                          objs->con_categories_object->in);
 
@@ -507,6 +620,12 @@
             mod_resample_enable(objs->mod_resample_mics_object);
             mod_stft_enable(objs->mod_stft_mics_object);
 
+            if ((objs->snk_powers_mics_object != NULL) && (cfgs->snk_powers_mics_config->interface->type != interface_blackhole)) {
+
+                mod_noise_enable(objs->mod_noise_mics_object);
+
+            }
+
             if (cfgs->snk_pots_ssl_config->interface->type != interface_blackhole) {
 
                 mod_ssl_enable(objs->mod_ssl_object);
@@ -526,9 +645,12 @@
                 mod_sst_enable(objs->mod_sst_object);
                 mod_noise_enable(objs->mod_noise_mics_object);
                 mod_sss_enable(objs->mod_sss_object);
-                mod_istft_enable(objs->mod_istft_seps_object);
-                mod_resample_enable(objs->mod_resample_seps_object);
-                mod_volume_enable(objs->mod_volume_seps_object);
+
+                if (objs->snk_backend_seps_object == NULL) {
+                    mod_istft_enable(objs->mod_istft_seps_object);
+                    mod_resample_enable(objs->mod_resample_seps_object);
+                    mod_volume_enable(objs->mod_volume_seps_object);
+                }
 
             }
 
@@ -538,9 +660,12 @@
                 mod_sst_enable(objs->mod_sst_object);
                 mod_noise_enable(objs->mod_noise_mics_object);
                 mod_sss_enable(objs->mod_sss_object);
-                mod_istft_enable(objs->mod_istft_pfs_object);
-                mod_resample_enable(objs->mod_resample_pfs_object);
-                mod_volume_enable(objs->mod_volume_pfs_object);
+
+                if (objs->snk_backend_pfs_object == NULL) {
+                    mod_istft_enable(objs->mod_istft_pfs_object);
+                    mod_resample_enable(objs->mod_resample_pfs_object);
+                    mod_volume_enable(objs->mod_volume_pfs_object);
+                }
 
             }
 
@@ -576,6 +701,10 @@
                 // +--------------------------------------------------+  
 
                     src_hops_destroy(objs->src_hops_mics_object);
+
+                    if (objs->src_frontend_mics_object != NULL) {
+                        src_frontend_destroy(objs->src_frontend_mics_object);
+                    }
                     
                 // +--------------------------------------------------+
                 // | Connector                                        |
@@ -631,6 +760,14 @@
 
                     con_spectra_destroy(objs->con_spectra_mics_object);
 
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+  
+
+                    if (objs->snk_spectra_mics_object != NULL) {
+                        snk_spectra_destroy(objs->snk_spectra_mics_object);
+                    }
+
             // +------------------------------------------------------+
             // | Noise                                                |
             // +------------------------------------------------------+  
@@ -647,6 +784,14 @@
 
                     con_powers_destroy(objs->con_powers_mics_object);
 
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+  
+
+                    if (objs->snk_powers_mics_object != NULL) {
+                        snk_powers_destroy(objs->snk_powers_mics_object);
+                    }
+
             // +------------------------------------------------------+
             // | SSL                                                  |
             // +------------------------------------------------------+  
@@ -785,6 +930,14 @@
                     snk_hops_destroy(objs->snk_hops_seps_vol_object);
                     snk_hops_destroy(objs->snk_hops_pfs_vol_object);
 
+                    if (objs->snk_backend_seps_object != NULL) {
+                        snk_backend_destroy(objs->snk_backend_seps_object);
+                    }
+
+                    if (objs->snk_backend_pfs_object != NULL) {
+                        snk_backend_destroy(objs->snk_backend_pfs_object);
+                    }
+
             // +------------------------------------------------------+
             // | Classify                                             |
             // +------------------------------------------------------+  
@@ -834,6 +987,20 @@
 
                     objs->asrc_hops_mics_object = asrc_hops_construct(cfgs->src_hops_mics_config, 
                                                                       cfgs->msg_hops_mics_raw_config);
+
+                    if (cfgs->src_frontend_mics_config != NULL) {
+
+                        objs->asrc_frontend_mics_object = asrc_frontend_construct(cfgs->src_frontend_mics_config,
+                                                                                  cfgs->msg_hops_mics_raw_config,
+                                                                                  cfgs->msg_hops_mics_rs_config,
+                                                                                  cfgs->msg_spectra_mics_config);
+
+                    }
+                    else {
+
+                        objs->asrc_frontend_mics_object = NULL;
+
+                    }
                 
                 // +--------------------------------------------------+
                 // | Connector                                        |
@@ -874,7 +1041,7 @@
                 // | Connector                                        |
                 // +--------------------------------------------------+
 
-                    objs->acon_hops_mics_rs_object = acon_hops_construct(2, objs->nMessages, cfgs->msg_hops_mics_rs_config);
+                    objs->acon_hops_mics_rs_object = acon_hops_construct((objs->asrc_frontend_mics_object == NULL) ? 2 : 1, objs->nMessages, cfgs->msg_hops_mics_rs_config);
 
             // +------------------------------------------------------+
             // | STFT                                                 |
@@ -892,7 +1059,23 @@
                 // | Connector                                        |
                 // +--------------------------------------------------+
                     
-                    objs->acon_spectra_mics_object = acon_spectra_construct(3, objs->nMessages, cfgs->msg_spectra_mics_config);
+                    objs->acon_spectra_mics_object = acon_spectra_construct((cfgs->snk_spectra_mics_config == NULL) ? 3 : 4, objs->nMessages, cfgs->msg_spectra_mics_config);
+
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+  
+
+                    if (cfgs->snk_spectra_mics_config != NULL) {
+
+                        objs->asnk_spectra_mics_object = asnk_spectra_construct(cfgs->snk_spectra_mics_config,
+                                                                                cfgs->msg_spectra_mics_config);
+
+                    }
+                    else {
+
+                        objs->asnk_spectra_mics_object = NULL;
+
+                    }
 
             // +------------------------------------------------------+
             // | Noise                                                |
@@ -910,7 +1093,23 @@
                 // | Connector                                        |
                 // +--------------------------------------------------+
                     
-                    objs->acon_powers_mics_object = acon_powers_construct(1, objs->nMessages, cfgs->msg_powers_mics_config);
+                    objs->acon_powers_mics_object = acon_powers_construct((cfgs->snk_powers_mics_config == NULL) ? 1 : 2, objs->nMessages, cfgs->msg_powers_mics_config);
+
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+  
+
+                    if (cfgs->snk_powers_mics_config != NULL) {
+
+                        objs->asnk_powers_mics_object = asnk_powers_construct(cfgs->snk_powers_mics_config,
+                                                                              cfgs->msg_powers_mics_config);
+
+                    }
+                    else {
+
+                        objs->asnk_powers_mics_object = NULL;
+
+                    }
 
             // +------------------------------------------------------+
             // | SSL                                                  |
@@ -998,7 +1197,7 @@
                 // | Connector                                        |
                 // +--------------------------------------------------+                    
 
-                    objs->acon_spectra_seps_object = acon_spectra_construct(1, objs->nMessages, cfgs->msg_spectra_seps_config);
+                    objs->acon_spectra_seps_object = acon_spectra_construct((cfgs->snk_backend_seps_config == NULL) ? 1 : 2, objs->nMessages, cfgs->msg_spectra_seps_config);
                     objs->acon_spectra_pfs_object = acon_spectra_construct(1, objs->nMessages, cfgs->msg_spectra_pfs_config);
 
             // +------------------------------------------------------+
@@ -1021,7 +1220,7 @@
                 // | Connector                                        |
                 // +--------------------------------------------------+                     
 
-                    objs->acon_hops_seps_object = acon_hops_construct(2, objs->nMessages, cfgs->msg_hops_seps_config);
+                    objs->acon_hops_seps_object = acon_hops_construct((cfgs->snk_backend_seps_config == NULL) ? 2 : 1, objs->nMessages, cfgs->msg_hops_seps_config);
                     objs->acon_hops_pfs_object = acon_hops_construct(1, objs->nMessages, cfgs->msg_hops_pfs_config);
 
             // +------------------------------------------------------+
@@ -1080,6 +1279,34 @@
                     objs->asnk_hops_pfs_vol_object = asnk_hops_construct(cfgs->snk_hops_pfs_vol_config, 
                                                                          cfgs->msg_hops_pfs_vol_config);
 
+                    if (cfgs->snk_backend_seps_config != NULL) {
+
+                        objs->asnk_backend_seps_object = asnk_backend_construct(cfgs->snk_backend_seps_config,
+                                                                                cfgs->msg_spectra_seps_config,
+                                                                                cfgs->msg_hops_seps_config,
+                                                                                cfgs->msg_hops_seps_vol_config);
+
+                    }
+                    else {
+
+                        objs->asnk_backend_seps_object = NULL;
+
+                    }
+
+                    if (cfgs->snk_backend_pfs_config != NULL) {
+
+                        objs->asnk_backend_pfs_object = asnk_backend_construct(cfgs->snk_backend_pfs_config,
+                                                                               cfgs->msg_spectra_pfs_config,
+                                                                               cfgs->msg_hops_pfs_config,
+                                                                               cfgs->msg_hops_pfs_vol_config);
+
+                    }
+                    else {
+
+                        objs->asnk_backend_pfs_object = NULL;
+
+                    }
+
             // +------------------------------------------------------+
             // | Classify                                             |
             // +------------------------------------------------------+  
@@ -1153,9 +1380,29 @@
                 // | Module                                           |
                 // +--------------------------------------------------+  
 
-                    amod_stft_connect(objs->amod_stft_mics_object, 
-                                      objs->acon_hops_mics_rs_object->outs[0], 
-                                      objs->acon_spectra_mics_object->in);
+                    if (objs->asrc_frontend_mics_object == NULL) {
+
+                        amod_stft_connect(objs->amod_stft_mics_object, 
+                                          objs->acon_hops_mics_rs_object->outs[0], 
+                                          objs->acon_spectra_mics_object->in);
+
+                    }
+                    else {
+
+                        asrc_frontend_connect(objs->asrc_frontend_mics_object,
+                                              objs->acon_hops_mics_rs_object->in,
+                                              objs->acon_spectra_mics_object->in);
+
+                    }
+
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+  
+
+                    if (objs->asnk_spectra_mics_object != NULL) {
+                        asnk_spectra_connect(objs->asnk_spectra_mics_object,
+                                             objs->acon_spectra_mics_object->outs[3]);
+                    }
 
             // +------------------------------------------------------+
             // | Noise                                                |
@@ -1169,6 +1416,15 @@
                                        objs->acon_spectra_mics_object->outs[0],
                                        objs->acon_powers_mics_object->in);
 
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+  
+
+                    if (objs->asnk_powers_mics_object != NULL) {
+                        asnk_powers_connect(objs->asnk_powers_mics_object,
+                                            objs->acon_powers_mics_object->outs[1]);
+                    }
+
             // +------------------------------------------------------+
             // | SSL                                                  |
             // +------------------------------------------------------+  
@@ -1197,7 +1453,7 @@
                 // +--------------------------------------------------+  
 
                     ainj_targets_connect(objs->ainj_targets_sst_object,
-                                         objs->acon_hops_mics_rs_object->outs[1],
+                                         objs->acon_hops_mics_rs_object->outs[(objs->asrc_frontend_mics_object == NULL) ? 1 : 0],
                                          objs->acon_targets_sst_object->in);
 
             // +------------------------------------------------------+
@@ -1293,6 +1549,16 @@
                     asnk_hops_connect(objs->asnk_hops_pfs_vol_object,
                                       objs->acon_hops_pfs_vol_object->outs[0]);
 
+                    if (objs->asnk_backend_seps_object != NULL) {
+                        asnk_backend_connect(objs->asnk_backend_seps_object,
+                                             objs->acon_spectra_seps_object->outs[1]);
+                    }
+
+                    if (objs->asnk_backend_pfs_object != NULL) {
+                        asnk_backend_connect(objs->asnk_backend_pfs_object,
+                                             objs->acon_spectra_pfs_object->outs[0]);
+                    }
+
             // +------------------------------------------------------+
             // | Classify                                             |
             // +------------------------------------------------------+  
@@ -1302,7 +1568,7 @@
                 // +--------------------------------------------------+  
 
                     amod_classify_connect(objs->amod_classify_object,
-                                          objs->acon_hops_seps_object->outs[1],
+                                          objs->acon_hops_seps_object->outs[(cfgs->snk_backend_seps_config == NULL) ? 1 : 0],
                                           objs->acon_tracks_sst_object->outs[1],
                                           objs->acon_categories_object->in);
 
@@ -1321,6 +1587,12 @@
             amod_resample_enable(objs->amod_resample_mics_object);
             amod_stft_enable(objs->amod_stft_mics_object);
 
+            if ((objs->asnk_powers_mics_object != NULL) && (cfgs->snk_powers_mics_config->interface->type != interface_blackhole)) {
+
+                amod_noise_enable(objs->amod_noise_mics_object);
+
+            }
+
             if (cfgs->snk_pots_ssl_config->interface->type != interface_blackhole) {
 
                 amod_ssl_enable(objs->amod_ssl_object);
@@ -1340,9 +1612,12 @@
                 amod_sst_enable(objs->amod_sst_object);
                 amod_noise_enable(objs->amod_noise_mics_object);
                 amod_sss_enable(objs->amod_sss_object);
-                amod_istft_enable(objs->amod_istft_seps_object);
-                amod_resample_enable(objs->amod_resample_seps_object);
-                amod_volume_enable(objs->amod_volume_seps_object);
+
+                if (objs->asnk_backend_seps_object == NULL) {
+                    amod_istft_enable(objs->amod_istft_seps_object);
+                    amod_resample_enable(objs->amod_resample_seps_object);
+                    amod_volume_enable(objs->amod_volume_seps_object);
+                }
 
             }
 
@@ -1352,9 +1627,12 @@
                 amod_sst_enable(objs->amod_sst_object);
                 amod_noise_enable(objs->amod_noise_mics_object);
                 amod_sss_enable(objs->amod_sss_object);
-                amod_istft_enable(objs->amod_istft_pfs_object);
-                amod_resample_enable(objs->amod_resample_pfs_object);
-                amod_volume_enable(objs->amod_volume_pfs_object);
+
+                if (objs->asnk_backend_pfs_object == NULL) {
+                    amod_istft_enable(objs->amod_istft_pfs_object);
+                    amod_resample_enable(objs->amod_resample_pfs_object);
+                    amod_volume_enable(objs->amod_volume_pfs_object);
+                }
 
             }
 
@@ -1390,6 +1668,10 @@
                 // +--------------------------------------------------+  
 
                     asrc_hops_destroy(objs->asrc_hops_mics_object);
+
+                    if (objs->asrc_frontend_mics_object != NULL) {
+                        asrc_frontend_destroy(objs->asrc_frontend_mics_object);
+                    }
                     
                 // +--------------------------------------------------+
                 // | Connector                                        |
@@ -1445,6 +1727,14 @@
 
                     acon_spectra_destroy(objs->acon_spectra_mics_object);   
 
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+  
+
+                    if (objs->asnk_spectra_mics_object != NULL) {
+                        asnk_spectra_destroy(objs->asnk_spectra_mics_object);
+                    }
+
             // +------------------------------------------------------+
             // | Noise                                                |
             // +------------------------------------------------------+  
@@ -1461,6 +1751,14 @@
 
                     acon_powers_destroy(objs->acon_powers_mics_object);  
 
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+  
+
+                    if (objs->asnk_powers_mics_object != NULL) {
+                        asnk_powers_destroy(objs->asnk_powers_mics_object);
+                    }
+
             // +------------------------------------------------------+
             // | SSL                                                  |
             // +------------------------------------------------------+  
@@ -1599,6 +1897,14 @@
                     asnk_hops_destroy(objs->asnk_hops_seps_vol_object);
                     asnk_hops_destroy(objs->asnk_hops_pfs_vol_object);
 
+                    if (objs->asnk_backend_seps_object != NULL) {
+                        asnk_backend_destroy(objs->asnk_backend_seps_object);
+                    }
+
+                    if (objs->asnk_backend_pfs_object != NULL) {
+                        asnk_backend_destroy(objs->asnk_backend_pfs_object);
+                    }
+
             // +------------------------------------------------------+
             // | Classify                                             |
             // +------------------------------------------------------+  
@@ -10,6 +10,7 @@
     typedef struct objects {
 
         src_hops_obj * src_hops_mics_object;
+        src_frontend_obj * src_frontend_mics_object;
         con_hops_obj * con_hops_mics_raw_object; 
 
         mod_mapping_obj * mod_mapping_mics_object;
@@ -20,9 +21,11 @@
 
         mod_stft_obj * mod_stft_mics_object;
         con_spectra_obj * con_spectra_mics_object;
+        snk_spectra_obj * snk_spectra_mics_object;
 
         mod_noise_obj * mod_noise_mics_object;
         con_powers_obj * con_powers_mics_object;
+        snk_powers_obj * snk_powers_mics_object;
 
         mod_ssl_obj * mod_ssl_object;
         snk_pots_obj * snk_pots_ssl_object;
@@ -55,6 +58,8 @@
         con_hops_obj * con_hops_pfs_vol_object;
         snk_hops_obj * snk_hops_seps_vol_object;
         snk_hops_obj * snk_hops_pfs_vol_object;
+        snk_backend_obj * snk_backend_seps_object;
+        snk_backend_obj * snk_backend_pfs_object;
 
         mod_classify_obj * mod_classify_object;
         con_categories_obj * con_categories_object;
@@ -67,6 +72,7 @@
         unsigned int nMessages;
 
         asrc_hops_obj * asrc_hops_mics_object;
+        asrc_frontend_obj * asrc_frontend_mics_object;
         acon_hops_obj * acon_hops_mics_raw_object; 
 
         amod_mapping_obj * amod_mapping_mics_object;
@@ -77,9 +83,11 @@
 
         amod_stft_obj * amod_stft_mics_object;
         acon_spectra_obj * acon_spectra_mics_object;
+        asnk_spectra_obj * asnk_spectra_mics_object;
 
         amod_noise_obj * amod_noise_mics_object;
         acon_powers_obj * acon_powers_mics_object;
+        asnk_powers_obj * asnk_powers_mics_object;
 
         amod_ssl_obj * amod_ssl_object;
         asnk_pots_obj * asnk_pots_ssl_object;
@@ -112,6 +120,8 @@
         acon_hops_obj * acon_hops_pfs_vol_object;
         asnk_hops_obj * asnk_hops_seps_vol_object;
         asnk_hops_obj * asnk_hops_pfs_vol_object;
+        asnk_backend_obj * asnk_backend_seps_object;
+        asnk_backend_obj * asnk_backend_pfs_object;
 
         amod_classify_obj * amod_classify_object;
         acon_categories_obj * acon_categories_object;
@@ -141,6 +141,205 @@
 
     }
 
+    char parameters_exists(const char * file, const char * path) {
+
+        config_t cfg;
+        char rtnValue;
+
+        config_init(&cfg); 
+
+        if(!config_read_file(&cfg, file))
+        {
+            
+            printf("%s:%d - %s\n", config_error_file(&cfg), config_error_line(&cfg), config_error_text(&cfg));
+            config_destroy(&cfg);
+          
+            exit(EXIT_FAILURE);
+
+        }       
+
+        if (config_lookup(&cfg, path) == NULL) {
+            rtnValue = 0;
+        }
+        else {
+            rtnValue = 1;
+        }
+
+        config_destroy(&cfg);   
+
+        return rtnValue;
+
+    }
+
+    void parameters_lookup_queue(const char * file, const char * path, interface_obj * interface) {
+
+        char tmpPath[256];
+        char * tmpStr;
+
+        // +----------------------------------------------------------+
+        // | Queue size in bytes (optional, 1 MB if not specified)    |
+        // +----------------------------------------------------------+
+
+            snprintf(tmpPath, sizeof(tmpPath), "%s.queueSize", path);
+
+            if (parameters_exists(file, tmpPath) == 1) {
+
+                interface->queueSize = parameters_lookup_int(file, tmpPath);
+
+                if (interface->queueSize < 1024) {
+                    printf("%s: Queue size must be at least 1024 bytes\n", tmpPath);
+                    exit(EXIT_FAILURE);
+                }
+
+            }
+
+        // +----------------------------------------------------------+
+        // | Overflow policy (optional, "drop_oldest" if not given)   |
+        // +----------------------------------------------------------+
+
+            snprintf(tmpPath, sizeof(tmpPath), "%s.overflow", path);
+
+            if (parameters_exists(file, tmpPath) == 1) {
+
+                tmpStr = parameters_lookup_string(file, tmpPath);
+
+                if (strcmp(tmpStr, "drop_oldest") == 0) {
+                    interface->overflow = 'o';
+                }
+                else if (strcmp(tmpStr, "drop_newest") == 0) {
+                    interface->overflow = 'n';
+                }
+                else if (strcmp(tmpStr, "block") == 0) {
+                    interface->overflow = 'b';
+                }
+                else {
+                    printf("%s: Invalid overflow policy\n", tmpPath);
+                    exit(EXIT_FAILURE);
+                }
+
+                free((void *) tmpStr);
+
+            }
+
+    }
+
+    void parameters_lookup_datagram(const char * file, const char * path, interface_obj * interface) {
+
+        char tmpPath[256];
+
+        // +----------------------------------------------------------+
+        // | Datagram size (optional, 1472 bytes if not specified)    |
+        // +----------------------------------------------------------+
+
+            snprintf(tmpPath, sizeof(tmpPath), "%s.mtu", path);
+
+            if (parameters_exists(file, tmpPath) == 1) {
+
+                interface->mtu = parameters_lookup_int(file, tmpPath);
+
+                if ((interface->mtu < 64) || (interface->mtu > 65507)) {
+                    printf("%s: Datagram size must be between 64 and 65507 bytes\n", tmpPath);
+                    exit(EXIT_FAILURE);
+                }
+
+            }
+
+        // +----------------------------------------------------------+
+        // | Multicast time to live (optional, 1 if not specified)    |
+        // +----------------------------------------------------------+
+
+            snprintf(tmpPath, sizeof(tmpPath), "%s.ttl", path);
+
+            if (parameters_exists(file, tmpPath) == 1) {
+
+                interface->ttl = parameters_lookup_int(file, tmpPath);
+
+                if (interface->ttl > 255) {
+                    printf("%s: Time to live must be between 0 and 255\n", tmpPath);
+                    exit(EXIT_FAILURE);
+                }
+
+            }
+
+    }
+
+    void parameters_lookup_batch(const char * file, const char * path, interface_obj * interface) {
+
+        char tmpPath[256];
+        int batch;
+        int latency;
+
+        // +----------------------------------------------------------+
+        // | Hops per write (optional, 1 if not specified)            |
+        // +----------------------------------------------------------+
+
+            snprintf(tmpPath, sizeof(tmpPath), "%s.batch", path);
+
+            if (parameters_exists(file, tmpPath) == 1) {
+
+                batch = parameters_lookup_int(file, tmpPath);
+
+                if (batch < 1) {
+                    printf("%s: Batch must hold at least one hop\n", tmpPath);
+                    exit(EXIT_FAILURE);
+                }
+
+                interface->batch = (unsigned int) batch;
+
+            }
+
+        // +----------------------------------------------------------+
+        // | Latency bound in ms (optional, none if not specified)    |
+        // +----------------------------------------------------------+
+
+            // Checked when a hop arrives, so it only holds while the stream keeps flowing
+            snprintf(tmpPath, sizeof(tmpPath), "%s.latency", path);
+
+            if (parameters_exists(file, tmpPath) == 1) {
+
+                latency = parameters_lookup_int(file, tmpPath);
+
+                if (latency < 0) {
+                    printf("%s: Invalid latency\n", tmpPath);
+                    exit(EXIT_FAILURE);
+                }
+
+                interface->latency = (unsigned int) latency;
+
+            }
+
+    }
+
+    void parameters_lookup_rotation(const char * file, const char * path, interface_obj * interface) {
+
+        char tmpPath[256];
+
+        // +----------------------------------------------------------+
+        // | Size of each file in MB (optional, no limit if not set)  |
+        // +----------------------------------------------------------+
+
+            snprintf(tmpPath, sizeof(tmpPath), "%s.rotateSize", path);
+
+            if (parameters_exists(file, tmpPath) == 1) {
+
+                interface->rotateSize = ((unsigned long long) parameters_lookup_int(file, tmpPath)) * 1048576ull;
+
+            }
+
+        // +----------------------------------------------------------+
+        // | Length of each file in s (optional, no limit if not set) |
+        // +----------------------------------------------------------+
+
+            snprintf(tmpPath, sizeof(tmpPath), "%s.rotateTime", path);
+
+            if (parameters_exists(file, tmpPath) == 1) {
+
+                interface->rotateTime = parameters_lookup_int(file, tmpPath);
+
+            }
+
+    }
+
     src_hops_cfg * parameters_src_hops_mics_config(const char * fileConfig) {
 
         src_hops_cfg * cfg;
@@ -212,6 +411,117 @@
 
             free((void *) tmpStr1);
 
+        // +----------------------------------------------------------+
+        // | Soundcard access (optional, "rw" if not specified)       |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "raw.interface.access") == 1) {
+
+                tmpStr1 = parameters_lookup_string(fileConfig, "raw.interface.access");
+
+                if (strcmp(tmpStr1, "rw") == 0) {
+                    cfg->access = 'r';
+                }
+                else if (strcmp(tmpStr1, "mmap") == 0) {
+                    cfg->access = 'm';
+                }
+                else {
+                    printf("raw.interface.access: Invalid access type\n");
+                    exit(EXIT_FAILURE);
+                }
+
+                free((void *) tmpStr1);
+
+            }
+            else {
+
+                cfg->access = 'r';
+
+            }
+
+        // +----------------------------------------------------------+
+        // | Period size and count (optional, driver defaults if 0)   |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "raw.interface.periodSize") == 1) {
+                cfg->periodSize = parameters_lookup_int(fileConfig, "raw.interface.periodSize");
+            }
+            else {
+                cfg->periodSize = 0;
+            }
+
+            if (parameters_exists(fileConfig, "raw.interface.nPeriods") == 1) {
+                cfg->nPeriods = parameters_lookup_int(fileConfig, "raw.interface.nPeriods");
+            }
+            else {
+                cfg->nPeriods = 0;
+            }
+
+        return cfg;
+
+    }
+
+    src_frontend_cfg * parameters_src_frontend_mics_config(const char * fileConfig) {
+
+        src_frontend_cfg * cfg;
+        src_hops_cfg * src_hops_config;
+        mod_mapping_cfg * mod_mapping_config;
+        mod_resample_cfg * mod_resample_config;
+        char * tmpStr1;
+        char fused;
+
+        // +----------------------------------------------------------+
+        // | Front-end (optional, "modular" if not specified)         |
+        // +----------------------------------------------------------+
+
+            fused = 0;
+
+            if (parameters_exists(fileConfig, "raw.frontend") == 1) {
+
+                tmpStr1 = parameters_lookup_string(fileConfig, "raw.frontend");
+
+                if (strcmp(tmpStr1, "modular") == 0) {
+                    fused = 0;
+                }
+                else if (strcmp(tmpStr1, "fused") == 0) {
+                    fused = 1;
+                }
+                else {
+                    printf("raw.frontend: Invalid front-end\n");
+                    exit(EXIT_FAILURE);
+                }
+
+                free((void *) tmpStr1);
+
+            }
+
+            // No configuration means the modular stages are used
+            if (fused == 0) {
+                return (src_frontend_cfg *) NULL;
+            }
+
+        cfg = src_frontend_cfg_construct();
+
+        // +----------------------------------------------------------+
+        // | Format, interface, links and resampler                   |
+        // +----------------------------------------------------------+
+
+            src_hops_config = parameters_src_hops_mics_config(fileConfig);
+            mod_mapping_config = parameters_mod_mapping_mics_config(fileConfig);
+            mod_resample_config = parameters_mod_resample_mics_config(fileConfig);
+
+            cfg->format = format_clone(src_hops_config->format);
+            cfg->interface = interface_clone(src_hops_config->interface);
+            cfg->links = links_clone(mod_mapping_config->links);
+            cfg->nTaps = mod_resample_config->nTaps;
+            cfg->access = src_hops_config->access;
+            cfg->periodSize = src_hops_config->periodSize;
+            cfg->nPeriods = src_hops_config->nPeriods;
+
+            src_hops_cfg_destroy(src_hops_config);
+            mod_mapping_cfg_destroy(mod_mapping_config);
+            mod_resample_cfg_destroy(mod_resample_config);
+
         return cfg;
 
     }
@@ -308,6 +618,7 @@
 
         unsigned int tmpInt1;
         unsigned int tmpInt2;
+        char * tmpStr1;
 
         cfg = mod_resample_cfg_construct();
 
@@ -326,6 +637,45 @@
             cfg->fSin = tmpInt1;
             cfg->fSout = tmpInt2;
 
+        // +----------------------------------------------------------+
+        // | Resampler (optional, "spectral" if not specified)        |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "raw.resampler.mode") == 1) {
+
+                tmpStr1 = parameters_lookup_string(fileConfig, "raw.resampler.mode");
+
+                if (strcmp(tmpStr1, "spectral") == 0) {
+                    cfg->mode = 's';
+                }
+                else if (strcmp(tmpStr1, "polyphase") == 0) {
+                    cfg->mode = 'p';
+                }
+                else {
+                    printf("raw.resampler.mode: Invalid resampler mode\n");
+                    exit(EXIT_FAILURE);
+                }
+
+                free((void *) tmpStr1);
+
+            }
+            else {
+
+                cfg->mode = 's';
+
+            }
+
+            if (parameters_exists(fileConfig, "raw.resampler.taps") == 1) {
+
+                cfg->nTaps = parameters_lookup_int(fileConfig, "raw.resampler.taps");
+
+            }
+            else {
+
+                cfg->nTaps = 0;
+
+            }
+
         return cfg;
 
     }
@@ -400,6 +750,151 @@
 
     }
 
+    snk_spectra_cfg * parameters_snk_spectra_mics_config(const char * fileConfig) {
+
+        snk_spectra_cfg * cfg;
+        char * tmpStr1;
+        char * tmpStr2;
+        unsigned int tmpInt1;
+        unsigned int iChannel;
+
+        // +----------------------------------------------------------+
+        // | Output (optional, no sink if not specified)              |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "stft.spectra") == 0) {
+                return (snk_spectra_cfg *) NULL;
+            }
+
+        cfg = snk_spectra_cfg_construct();
+
+        // +----------------------------------------------------------+
+        // | Sample rate                                              |
+        // +----------------------------------------------------------+
+
+            cfg->fS = parameters_lookup_int(fileConfig, "general.samplerate.mu");
+
+        // +----------------------------------------------------------+
+        // | Format                                                   |
+        // +----------------------------------------------------------+
+
+            tmpStr1 = parameters_lookup_string(fileConfig, "stft.spectra.format");
+
+            if (strcmp(tmpStr1, "binary") == 0) { cfg->format = format_construct_binary_float(); }
+            else if (strcmp(tmpStr1, "undefined") == 0) { cfg->format = format_construct_undefined(); }
+            else { printf("stft.spectra.format: Invalid format\n"); exit(EXIT_FAILURE); }
+
+            free((void *) tmpStr1);
+
+        // +----------------------------------------------------------+
+        // | Interface                                                |
+        // +----------------------------------------------------------+
+
+            tmpStr1 = parameters_lookup_string(fileConfig, "stft.spectra.interface.type");
+
+            if (strcmp(tmpStr1, "blackhole") == 0) {
+
+                cfg->interface = interface_construct_blackhole();
+
+            }
+            else if (strcmp(tmpStr1, "file") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "stft.spectra.interface.path");
+                cfg->interface = interface_construct_file(tmpStr2);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "socket") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "stft.spectra.interface.ip");
+                tmpInt1 = parameters_lookup_int(fileConfig, "stft.spectra.interface.port");
+
+                cfg->interface = interface_construct_socket(tmpStr2, tmpInt1);
+                parameters_lookup_queue(fileConfig, "stft.spectra.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "udp") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "stft.spectra.interface.ip");
+                tmpInt1 = parameters_lookup_int(fileConfig, "stft.spectra.interface.port");
+
+                cfg->interface = interface_construct_udp(tmpStr2, tmpInt1);
+                parameters_lookup_datagram(fileConfig, "stft.spectra.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "shm") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "stft.spectra.interface.name");
+
+                // Ring of 4 MB unless specified
+                if (parameters_exists(fileConfig, "stft.spectra.interface.size") == 1) {
+                    tmpInt1 = parameters_lookup_int(fileConfig, "stft.spectra.interface.size");
+                }
+                else {
+                    tmpInt1 = 4194304;
+                }
+
+                cfg->interface = interface_construct_shm(tmpStr2, tmpInt1);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "mmap") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "stft.spectra.interface.path");
+                cfg->interface = interface_construct_mmap(tmpStr2);
+                free((void *) tmpStr2);
+
+            }
+            else {
+
+                printf("stft.spectra.interface.type: Invalid type\n");
+                exit(EXIT_FAILURE);
+
+            }
+
+            free((void *) tmpStr1);
+
+        // +----------------------------------------------------------+
+        // | Bin decimation (optional, all bins if not specified)     |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "stft.spectra.binStep") == 1) {
+
+                cfg->binStep = parameters_lookup_int(fileConfig, "stft.spectra.binStep");
+
+                if (cfg->binStep == 0) {
+                    printf("stft.spectra.binStep: Invalid value\n");
+                    exit(EXIT_FAILURE);
+                }
+
+            }
+
+        // +----------------------------------------------------------+
+        // | Channels (optional, all channels if not specified)       |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "stft.spectra.channels") == 1) {
+
+                cfg->nChannels = parameters_count(fileConfig, "stft.spectra.channels");
+                cfg->channels = (unsigned int *) malloc(sizeof(unsigned int) * cfg->nChannels);
+
+                for (iChannel = 0; iChannel < cfg->nChannels; iChannel++) {
+
+                    tmpStr1 = (char *) malloc(sizeof(char) * 1024);
+                    sprintf(tmpStr1, "stft.spectra.channels.[%u]", iChannel);
+                    cfg->channels[iChannel] = parameters_lookup_int(fileConfig, tmpStr1);
+                    free((void *) tmpStr1);
+
+                }
+
+            }
+
+        return cfg;
+
+    }
+
     mod_noise_cfg * parameters_mod_noise_mics_config(const char * fileConfig) {
 
         mod_noise_cfg * cfg;
@@ -472,6 +967,151 @@
 
     }
 
+    snk_powers_cfg * parameters_snk_powers_mics_config(const char * fileConfig) {
+
+        snk_powers_cfg * cfg;
+        char * tmpStr1;
+        char * tmpStr2;
+        unsigned int tmpInt1;
+        unsigned int iChannel;
+
+        // +----------------------------------------------------------+
+        // | Output (optional, no sink if not specified)              |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "sne.powers") == 0) {
+                return (snk_powers_cfg *) NULL;
+            }
+
+        cfg = snk_powers_cfg_construct();
+
+        // +----------------------------------------------------------+
+        // | Sample rate                                              |
+        // +----------------------------------------------------------+
+
+            cfg->fS = parameters_lookup_int(fileConfig, "general.samplerate.mu");
+
+        // +----------------------------------------------------------+
+        // | Format                                                   |
+        // +----------------------------------------------------------+
+
+            tmpStr1 = parameters_lookup_string(fileConfig, "sne.powers.format");
+
+            if (strcmp(tmpStr1, "binary") == 0) { cfg->format = format_construct_binary_float(); }
+            else if (strcmp(tmpStr1, "undefined") == 0) { cfg->format = format_construct_undefined(); }
+            else { printf("sne.powers.format: Invalid format\n"); exit(EXIT_FAILURE); }
+
+            free((void *) tmpStr1);
+
+        // +----------------------------------------------------------+
+        // | Interface                                                |
+        // +----------------------------------------------------------+
+
+            tmpStr1 = parameters_lookup_string(fileConfig, "sne.powers.interface.type");
+
+            if (strcmp(tmpStr1, "blackhole") == 0) {
+
+                cfg->interface = interface_construct_blackhole();
+
+            }
+            else if (strcmp(tmpStr1, "file") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sne.powers.interface.path");
+                cfg->interface = interface_construct_file(tmpStr2);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "socket") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sne.powers.interface.ip");
+                tmpInt1 = parameters_lookup_int(fileConfig, "sne.powers.interface.port");
+
+                cfg->interface = interface_construct_socket(tmpStr2, tmpInt1);
+                parameters_lookup_queue(fileConfig, "sne.powers.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "udp") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sne.powers.interface.ip");
+                tmpInt1 = parameters_lookup_int(fileConfig, "sne.powers.interface.port");
+
+                cfg->interface = interface_construct_udp(tmpStr2, tmpInt1);
+                parameters_lookup_datagram(fileConfig, "sne.powers.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "shm") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sne.powers.interface.name");
+
+                // Ring of 4 MB unless specified
+                if (parameters_exists(fileConfig, "sne.powers.interface.size") == 1) {
+                    tmpInt1 = parameters_lookup_int(fileConfig, "sne.powers.interface.size");
+                }
+                else {
+                    tmpInt1 = 4194304;
+                }
+
+                cfg->interface = interface_construct_shm(tmpStr2, tmpInt1);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "mmap") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sne.powers.interface.path");
+                cfg->interface = interface_construct_mmap(tmpStr2);
+                free((void *) tmpStr2);
+
+            }
+            else {
+
+                printf("sne.powers.interface.type: Invalid type\n");
+                exit(EXIT_FAILURE);
+
+            }
+
+            free((void *) tmpStr1);
+
+        // +----------------------------------------------------------+
+        // | Bin decimation (optional, all bins if not specified)     |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "sne.powers.binStep") == 1) {
+
+                cfg->binStep = parameters_lookup_int(fileConfig, "sne.powers.binStep");
+
+                if (cfg->binStep == 0) {
+                    printf("sne.powers.binStep: Invalid value\n");
+                    exit(EXIT_FAILURE);
+                }
+
+            }
+
+        // +----------------------------------------------------------+
+        // | Channels (optional, all channels if not specified)       |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "sne.powers.channels") == 1) {
+
+                cfg->nChannels = parameters_count(fileConfig, "sne.powers.channels");
+                cfg->channels = (unsigned int *) malloc(sizeof(unsigned int) * cfg->nChannels);
+
+                for (iChannel = 0; iChannel < cfg->nChannels; iChannel++) {
+
+                    tmpStr1 = (char *) malloc(sizeof(char) * 1024);
+                    sprintf(tmpStr1, "sne.powers.channels.[%u]", iChannel);
+                    cfg->channels[iChannel] = parameters_lookup_int(fileConfig, tmpStr1);
+                    free((void *) tmpStr1);
+
+                }
+
+            }
+
+        return cfg;
+
+    }
+
     mod_ssl_cfg * parameters_mod_ssl_config(const char * fileConfig) {
 
         mod_ssl_cfg * cfg;
@@ -730,6 +1370,7 @@
 
             if (strcmp(tmpStr1, "json") == 0) { cfg->format = format_construct_text_json(); }
             else if (strcmp(tmpStr1, "binary") == 0) { cfg->format = format_construct_binary_float(); }
+            else if (strcmp(tmpStr1, "wire") == 0) { cfg->format = format_construct_binary_wire(); }
             else if (strcmp(tmpStr1, "undefined") == 0) { cfg->format = format_construct_undefined(); }
             else { printf("ssl.potential.format: Invalid format\n"); exit(EXIT_FAILURE); }
 
@@ -759,6 +1400,33 @@
                 tmpInt1 = parameters_lookup_int(fileConfig, "ssl.potential.interface.port");
 
                 cfg->interface = interface_construct_socket(tmpStr2, tmpInt1);
+                parameters_lookup_queue(fileConfig, "ssl.potential.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "udp") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "ssl.potential.interface.ip");
+                tmpInt1 = parameters_lookup_int(fileConfig, "ssl.potential.interface.port");
+
+                cfg->interface = interface_construct_udp(tmpStr2, tmpInt1);
+                parameters_lookup_datagram(fileConfig, "ssl.potential.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "shm") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "ssl.potential.interface.name");
+
+                // Ring of 4 MB unless specified
+                if (parameters_exists(fileConfig, "ssl.potential.interface.size") == 1) {
+                    tmpInt1 = parameters_lookup_int(fileConfig, "ssl.potential.interface.size");
+                }
+                else {
+                    tmpInt1 = 4194304;
+                }
+
+                cfg->interface = interface_construct_shm(tmpStr2, tmpInt1);
                 free((void *) tmpStr2);
 
             }
@@ -876,6 +1544,7 @@
         float sigma;
 
         unsigned int iTrack;
+        int nThreads;
         char * tmpStr1;
 
         cfg = mod_sst_cfg_construct();
@@ -930,6 +1599,25 @@
 
             cfg->hopSize = parameters_lookup_int(fileConfig, "general.size.hopSize");
 
+        // +----------------------------------------------------------+
+        // | nThreads (optional, 1 if not specified)                  |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "sst.nThreads") == 1) {
+                nThreads = parameters_lookup_int(fileConfig, "sst.nThreads");
+            }
+            else {
+                nThreads = 1;
+            }
+
+            // Checked before it goes in the unsigned field, where -1 would become a huge count
+            if (nThreads < 1) {
+                printf("sst.nThreads: Invalid number of threads\n");
+                exit(EXIT_FAILURE);
+            }
+
+            cfg->nThreads = (unsigned int) nThreads;
+
         // +----------------------------------------------------------+
         // | Kalman                                                   |
         // +----------------------------------------------------------+
@@ -1110,6 +1798,7 @@
 
             if (strcmp(tmpStr1, "json") == 0) { cfg->format = format_construct_text_json(); }
             else if (strcmp(tmpStr1, "binary") == 0) { cfg->format = format_construct_binary_float(); }
+            else if (strcmp(tmpStr1, "wire") == 0) { cfg->format = format_construct_binary_wire(); }
             else if (strcmp(tmpStr1, "undefined") == 0) { cfg->format = format_construct_undefined(); }            
             else { printf("sst.tracked.format: Invalid format\n"); exit(EXIT_FAILURE); }
 
@@ -1139,6 +1828,33 @@
                 tmpInt1 = parameters_lookup_int(fileConfig, "sst.tracked.interface.port");
 
                 cfg->interface = interface_construct_socket(tmpStr2, tmpInt1);
+                parameters_lookup_queue(fileConfig, "sst.tracked.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "udp") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sst.tracked.interface.ip");
+                tmpInt1 = parameters_lookup_int(fileConfig, "sst.tracked.interface.port");
+
+                cfg->interface = interface_construct_udp(tmpStr2, tmpInt1);
+                parameters_lookup_datagram(fileConfig, "sst.tracked.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "shm") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sst.tracked.interface.name");
+
+                // Ring of 4 MB unless specified
+                if (parameters_exists(fileConfig, "sst.tracked.interface.size") == 1) {
+                    tmpInt1 = parameters_lookup_int(fileConfig, "sst.tracked.interface.size");
+                }
+                else {
+                    tmpInt1 = 4194304;
+                }
+
+                cfg->interface = interface_construct_shm(tmpStr2, tmpInt1);
                 free((void *) tmpStr2);
 
             }
@@ -1168,6 +1884,7 @@
         unsigned int nChannels;
         unsigned int iChannel;
         unsigned int iSample;
+        int nThreads;
 
         char * tmpStr1;
         char * tmpLabel;
@@ -1211,6 +1928,41 @@
 
             free((void *) tmpStr1);
 
+        // +----------------------------------------------------------+
+        // | nThreads (optional, 1 if not specified)                  |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "sss.nThreads") == 1) {
+                nThreads = parameters_lookup_int(fileConfig, "sss.nThreads");
+            }
+            else {
+                nThreads = 1;
+            }
+
+            // Checked before it goes in the unsigned field, where -1 would become a huge count
+            if (nThreads < 1) {
+                printf("sss.nThreads: Invalid number of threads\n");
+                exit(EXIT_FAILURE);
+            }
+
+            cfg->nThreads = (unsigned int) nThreads;
+
+        // +----------------------------------------------------------+
+        // | Steering tolerance (optional, 0 if not specified)        |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "sss.steerTolerance") == 1) {
+                cfg->sep_tolerance = parameters_lookup_float(fileConfig, "sss.steerTolerance");
+            }
+            else {
+                cfg->sep_tolerance = 0.0f;
+            }
+
+            if ((cfg->sep_tolerance < 0.0f) || (cfg->sep_tolerance >= 90.0f)) {
+                printf("sss.steerTolerance: Invalid tolerance, must be between 0 and 90 degrees\n");
+                exit(EXIT_FAILURE);
+            }
+
         // +----------------------------------------------------------+
         // | Number of channels                                       |
         // +----------------------------------------------------------+
@@ -1312,6 +2064,46 @@
 
             cfg->epsilon = parameters_lookup_float(fileConfig, "general.epsilon");
 
+        // +----------------------------------------------------------+
+        // | DS demixing table (optional, computed live if absent)    |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "sss.dds.table") == 1) {
+
+                cfg->sep_ds_tableFile = parameters_lookup_string(fileConfig, "sss.dds.table.path");
+                cfg->sep_ds_tableLevel = parameters_lookup_int(fileConfig, "sss.dds.table.level");
+
+                if (cfg->sep_ds_tableLevel > 4) {
+                    printf("sss.dds.table.level: Invalid level, must be between 0 and 4\n");
+                    exit(EXIT_FAILURE);
+                }
+
+                if (parameters_exists(fileConfig, "sss.dds.table.shape") == 1) {
+
+                    tmpStr1 = parameters_lookup_string(fileConfig, "sss.dds.table.shape");
+
+                    if (strcmp(tmpStr1, "sphere") == 0) {
+                        cfg->sep_ds_tableShape = 's';
+                    }
+                    else if (strcmp(tmpStr1, "halfsphere") == 0) {
+                        cfg->sep_ds_tableShape = 'h';
+                    }
+                    else {
+                        printf("sss.dds.table.shape: Invalid shape\n");
+                        exit(EXIT_FAILURE);
+                    }
+
+                    free((void *) tmpStr1);
+
+                }
+                else {
+
+                    cfg->sep_ds_tableShape = 's';
+
+                }
+
+            }
+
         // +----------------------------------------------------------+
         // | Mu                                                       |
         // +----------------------------------------------------------+
@@ -1414,6 +2206,34 @@
 
             cfg->pf_ms_winSizeFrame = parameters_lookup_int(fileConfig, "sss.ms.winSizeFrame");
 
+        // +----------------------------------------------------------+
+        // | Math (optional, "precise" if not specified)              |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "sss.ms.math") == 1) {
+
+                tmpStr1 = parameters_lookup_string(fileConfig, "sss.ms.math");
+
+                if (strcmp(tmpStr1, "precise") == 0) {
+                    cfg->pf_ms_math = 'p';
+                }
+                else if (strcmp(tmpStr1, "fast") == 0) {
+                    cfg->pf_ms_math = 'f';
+                }
+                else {
+                    printf("sss.ms.math: Invalid math mode\n");
+                    exit(EXIT_FAILURE);
+                }
+
+                free((void *) tmpStr1);
+
+            }
+            else {
+
+                cfg->pf_ms_math = 'p';
+
+            }
+
         // +----------------------------------------------------------+
         // | Gmin                                                     |
         // +----------------------------------------------------------+
@@ -1432,6 +2252,34 @@
 
             cfg->pf_ss_Gslope = parameters_lookup_float(fileConfig, "sss.ss.Gslope");
 
+        // +----------------------------------------------------------+
+        // | Math (optional, "precise" if not specified)              |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "sss.ss.math") == 1) {
+
+                tmpStr1 = parameters_lookup_string(fileConfig, "sss.ss.math");
+
+                if (strcmp(tmpStr1, "precise") == 0) {
+                    cfg->pf_ss_math = 'p';
+                }
+                else if (strcmp(tmpStr1, "fast") == 0) {
+                    cfg->pf_ss_math = 'f';
+                }
+                else {
+                    printf("sss.ss.math: Invalid math mode\n");
+                    exit(EXIT_FAILURE);
+                }
+
+                free((void *) tmpStr1);
+
+            }
+            else {
+
+                cfg->pf_ss_math = 'p';
+
+            }
+
         return cfg;      
 
     }
@@ -1582,6 +2430,7 @@
 
         unsigned int tmpInt1;
         unsigned int tmpInt2;
+        char * tmpStr1;
 
         cfg = mod_resample_cfg_construct();
 
@@ -1595,6 +2444,45 @@
             cfg->fSin = tmpInt1;
             cfg->fSout = tmpInt2;
 
+        // +----------------------------------------------------------+
+        // | Resampler (optional, "spectral" if not specified)        |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "sss.separated.resampler.mode") == 1) {
+
+                tmpStr1 = parameters_lookup_string(fileConfig, "sss.separated.resampler.mode");
+
+                if (strcmp(tmpStr1, "spectral") == 0) {
+                    cfg->mode = 's';
+                }
+                else if (strcmp(tmpStr1, "polyphase") == 0) {
+                    cfg->mode = 'p';
+                }
+                else {
+                    printf("sss.separated.resampler.mode: Invalid resampler mode\n");
+                    exit(EXIT_FAILURE);
+                }
+
+                free((void *) tmpStr1);
+
+            }
+            else {
+
+                cfg->mode = 's';
+
+            }
+
+            if (parameters_exists(fileConfig, "sss.separated.resampler.taps") == 1) {
+
+                cfg->nTaps = parameters_lookup_int(fileConfig, "sss.separated.resampler.taps");
+
+            }
+            else {
+
+                cfg->nTaps = 0;
+
+            }
+
         return cfg;
 
     }
@@ -1605,6 +2493,7 @@
 
         unsigned int tmpInt1;
         unsigned int tmpInt2;
+        char * tmpStr1;
 
         cfg = mod_resample_cfg_construct();
 
@@ -1618,6 +2507,45 @@
             cfg->fSin = tmpInt1;
             cfg->fSout = tmpInt2;
 
+        // +----------------------------------------------------------+
+        // | Resampler (optional, "spectral" if not specified)        |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "sss.postfiltered.resampler.mode") == 1) {
+
+                tmpStr1 = parameters_lookup_string(fileConfig, "sss.postfiltered.resampler.mode");
+
+                if (strcmp(tmpStr1, "spectral") == 0) {
+                    cfg->mode = 's';
+                }
+                else if (strcmp(tmpStr1, "polyphase") == 0) {
+                    cfg->mode = 'p';
+                }
+                else {
+                    printf("sss.postfiltered.resampler.mode: Invalid resampler mode\n");
+                    exit(EXIT_FAILURE);
+                }
+
+                free((void *) tmpStr1);
+
+            }
+            else {
+
+                cfg->mode = 's';
+
+            }
+
+            if (parameters_exists(fileConfig, "sss.postfiltered.resampler.taps") == 1) {
+
+                cfg->nTaps = parameters_lookup_int(fileConfig, "sss.postfiltered.resampler.taps");
+
+            }
+            else {
+
+                cfg->nTaps = 0;
+
+            }
+
         return cfg;
 
     }    
@@ -1772,6 +2700,7 @@
         unsigned int tmpInt1;
         char * tmpStr1;
         char * tmpStr2;
+        char codec;
 
         cfg = snk_hops_cfg_construct();
 
@@ -1788,13 +2717,43 @@
 
             tmpInt1 = parameters_lookup_int(fileConfig, "sss.separated.nBits");
 
-            if ((tmpInt1 == 8) || (tmpInt1 == 16) || (tmpInt1 == 24) || (tmpInt1 == 32)) {
-                cfg->format = format_construct_binary_int(tmpInt1);
+            // Raw samples unless a codec is specified
+            codec = 'r';
+
+            if (parameters_exists(fileConfig, "sss.separated.codec") == 1) {
+
+                tmpStr1 = parameters_lookup_string(fileConfig, "sss.separated.codec");
+
+                if (strcmp(tmpStr1, "raw") == 0) { codec = 'r'; }
+                else if (strcmp(tmpStr1, "lossless") == 0) { codec = 'l'; }
+                else { printf("sss.separated.codec: Invalid codec\n"); exit(EXIT_FAILURE); }
+
+                free((void *) tmpStr1);
+
+            }
+
+            if (codec == 'l') {
+
+                if ((tmpInt1 == 16) || (tmpInt1 == 24)) {
+                    cfg->format = format_construct_lossless_int(tmpInt1);
+                }
+                else {
+                    printf("sss.separated.nBits: The lossless codec needs 16 or 24 bits\n");
+                    exit(EXIT_FAILURE);
+                }
+
             }
             else {
-                printf("raw.nBits: Invalid number of bits\n");
-                exit(EXIT_FAILURE);
-            }    
+
+                if ((tmpInt1 == 8) || (tmpInt1 == 16) || (tmpInt1 == 24) || (tmpInt1 == 32)) {
+                    cfg->format = format_construct_binary_int(tmpInt1);
+                }
+                else {
+                    printf("raw.nBits: Invalid number of bits\n");
+                    exit(EXIT_FAILURE);
+                }    
+
+            }
 
         // +----------------------------------------------------------+
         // | Interface                                                |
@@ -1821,6 +2780,42 @@
                 tmpInt1 = parameters_lookup_int(fileConfig, "sss.separated.interface.port");
 
                 cfg->interface = interface_construct_socket(tmpStr2, tmpInt1);
+                parameters_lookup_queue(fileConfig, "sss.separated.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "udp") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sss.separated.interface.ip");
+                tmpInt1 = parameters_lookup_int(fileConfig, "sss.separated.interface.port");
+
+                cfg->interface = interface_construct_udp(tmpStr2, tmpInt1);
+                parameters_lookup_datagram(fileConfig, "sss.separated.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "shm") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sss.separated.interface.name");
+
+                // Ring of 4 MB unless specified
+                if (parameters_exists(fileConfig, "sss.separated.interface.size") == 1) {
+                    tmpInt1 = parameters_lookup_int(fileConfig, "sss.separated.interface.size");
+                }
+                else {
+                    tmpInt1 = 4194304;
+                }
+
+                cfg->interface = interface_construct_shm(tmpStr2, tmpInt1);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "wav") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sss.separated.interface.path");
+                cfg->interface = interface_construct_wav(tmpStr2);
+                parameters_lookup_queue(fileConfig, "sss.separated.interface", cfg->interface);
+                parameters_lookup_rotation(fileConfig, "sss.separated.interface", cfg->interface);
                 free((void *) tmpStr2);
 
             }
@@ -1838,6 +2833,8 @@
 
             free((void *) tmpStr1);
 
+            parameters_lookup_batch(fileConfig, "sss.separated.interface", cfg->interface);
+
         return cfg;
 
     }
@@ -1848,6 +2845,7 @@
         unsigned int tmpInt1;
         char * tmpStr1;
         char * tmpStr2;
+        char codec;
 
         cfg = snk_hops_cfg_construct();
 
@@ -1863,13 +2861,43 @@
 
             tmpInt1 = parameters_lookup_int(fileConfig, "sss.postfiltered.nBits");
 
-            if ((tmpInt1 == 8) || (tmpInt1 == 16) || (tmpInt1 == 24) || (tmpInt1 == 32)) {
-                cfg->format = format_construct_binary_int(tmpInt1);
+            // Raw samples unless a codec is specified
+            codec = 'r';
+
+            if (parameters_exists(fileConfig, "sss.postfiltered.codec") == 1) {
+
+                tmpStr1 = parameters_lookup_string(fileConfig, "sss.postfiltered.codec");
+
+                if (strcmp(tmpStr1, "raw") == 0) { codec = 'r'; }
+                else if (strcmp(tmpStr1, "lossless") == 0) { codec = 'l'; }
+                else { printf("sss.postfiltered.codec: Invalid codec\n"); exit(EXIT_FAILURE); }
+
+                free((void *) tmpStr1);
+
+            }
+
+            if (codec == 'l') {
+
+                if ((tmpInt1 == 16) || (tmpInt1 == 24)) {
+                    cfg->format = format_construct_lossless_int(tmpInt1);
+                }
+                else {
+                    printf("sss.postfiltered.nBits: The lossless codec needs 16 or 24 bits\n");
+                    exit(EXIT_FAILURE);
+                }
+
             }
             else {
-                printf("raw.nBits: Invalid number of bits\n");
-                exit(EXIT_FAILURE);
-            }    
+
+                if ((tmpInt1 == 8) || (tmpInt1 == 16) || (tmpInt1 == 24) || (tmpInt1 == 32)) {
+                    cfg->format = format_construct_binary_int(tmpInt1);
+                }
+                else {
+                    printf("raw.nBits: Invalid number of bits\n");
+                    exit(EXIT_FAILURE);
+                }    
+
+            }
 
         // +----------------------------------------------------------+
         // | Type                                                     |
@@ -1896,6 +2924,42 @@
                 tmpInt1 = parameters_lookup_int(fileConfig, "sss.postfiltered.interface.port");
 
                 cfg->interface = interface_construct_socket(tmpStr2, tmpInt1);
+                parameters_lookup_queue(fileConfig, "sss.postfiltered.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "udp") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sss.postfiltered.interface.ip");
+                tmpInt1 = parameters_lookup_int(fileConfig, "sss.postfiltered.interface.port");
+
+                cfg->interface = interface_construct_udp(tmpStr2, tmpInt1);
+                parameters_lookup_datagram(fileConfig, "sss.postfiltered.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "shm") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sss.postfiltered.interface.name");
+
+                // Ring of 4 MB unless specified
+                if (parameters_exists(fileConfig, "sss.postfiltered.interface.size") == 1) {
+                    tmpInt1 = parameters_lookup_int(fileConfig, "sss.postfiltered.interface.size");
+                }
+                else {
+                    tmpInt1 = 4194304;
+                }
+
+                cfg->interface = interface_construct_shm(tmpStr2, tmpInt1);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "wav") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "sss.postfiltered.interface.path");
+                cfg->interface = interface_construct_wav(tmpStr2);
+                parameters_lookup_queue(fileConfig, "sss.postfiltered.interface", cfg->interface);
+                parameters_lookup_rotation(fileConfig, "sss.postfiltered.interface", cfg->interface);
                 free((void *) tmpStr2);
 
             }
@@ -1913,6 +2977,134 @@
 
             free((void *) tmpStr1);
 
+            parameters_lookup_batch(fileConfig, "sss.postfiltered.interface", cfg->interface);
+
+        return cfg;
+
+    }
+
+    snk_backend_cfg * parameters_snk_backend_seps_config(const char * fileConfig) {
+
+        snk_backend_cfg * cfg;
+        snk_hops_cfg * snk_hops_config;
+        mod_volume_cfg * mod_volume_config;
+        mod_resample_cfg * mod_resample_config;
+        char * tmpStr1;
+        char fused;
+
+        // +----------------------------------------------------------+
+        // | Back-end (optional, "modular" if not specified)          |
+        // +----------------------------------------------------------+
+
+            fused = 0;
+
+            if (parameters_exists(fileConfig, "sss.backend") == 1) {
+
+                tmpStr1 = parameters_lookup_string(fileConfig, "sss.backend");
+
+                if (strcmp(tmpStr1, "modular") == 0) {
+                    fused = 0;
+                }
+                else if (strcmp(tmpStr1, "fused") == 0) {
+                    fused = 1;
+                }
+                else {
+                    printf("sss.backend: Invalid back-end\n");
+                    exit(EXIT_FAILURE);
+                }
+
+                free((void *) tmpStr1);
+
+            }
+
+            // No configuration means the modular stages are used
+            if (fused == 0) {
+                return (snk_backend_cfg *) NULL;
+            }
+
+        cfg = snk_backend_cfg_construct();
+
+        // +----------------------------------------------------------+
+        // | Sample rate, format, interface, gain and resampler       |
+        // +----------------------------------------------------------+
+
+            snk_hops_config = parameters_snk_hops_seps_vol_config(fileConfig);
+            mod_volume_config = parameters_mod_volume_seps_config(fileConfig);
+            mod_resample_config = parameters_mod_resample_seps_config(fileConfig);
+
+            cfg->fS = snk_hops_config->fS;
+            cfg->format = format_clone(snk_hops_config->format);
+            cfg->interface = interface_clone(snk_hops_config->interface);
+            cfg->gain = mod_volume_config->gain;
+            cfg->nTaps = mod_resample_config->nTaps;
+
+            snk_hops_cfg_destroy(snk_hops_config);
+            mod_volume_cfg_destroy(mod_volume_config);
+            mod_resample_cfg_destroy(mod_resample_config);
+
+        return cfg;
+
+    }
+
+    snk_backend_cfg * parameters_snk_backend_pfs_config(const char * fileConfig) {
+
+        snk_backend_cfg * cfg;
+        snk_hops_cfg * snk_hops_config;
+        mod_volume_cfg * mod_volume_config;
+        mod_resample_cfg * mod_resample_config;
+        char * tmpStr1;
+        char fused;
+
+        // +----------------------------------------------------------+
+        // | Back-end (optional, "modular" if not specified)          |
+        // +----------------------------------------------------------+
+
+            fused = 0;
+
+            if (parameters_exists(fileConfig, "sss.backend") == 1) {
+
+                tmpStr1 = parameters_lookup_string(fileConfig, "sss.backend");
+
+                if (strcmp(tmpStr1, "modular") == 0) {
+                    fused = 0;
+                }
+                else if (strcmp(tmpStr1, "fused") == 0) {
+                    fused = 1;
+                }
+                else {
+                    printf("sss.backend: Invalid back-end\n");
+                    exit(EXIT_FAILURE);
+                }
+
+                free((void *) tmpStr1);
+
+            }
+
+            // No configuration means the modular stages are used
+            if (fused == 0) {
+                return (snk_backend_cfg *) NULL;
+            }
+
+        cfg = snk_backend_cfg_construct();
+
+        // +----------------------------------------------------------+
+        // | Sample rate, format, interface, gain and resampler       |
+        // +----------------------------------------------------------+
+
+            snk_hops_config = parameters_snk_hops_pfs_vol_config(fileConfig);
+            mod_volume_config = parameters_mod_volume_pfs_config(fileConfig);
+            mod_resample_config = parameters_mod_resample_pfs_config(fileConfig);
+
+            cfg->fS = snk_hops_config->fS;
+            cfg->format = format_clone(snk_hops_config->format);
+            cfg->interface = interface_clone(snk_hops_config->interface);
+            cfg->gain = mod_volume_config->gain;
+            cfg->nTaps = mod_resample_config->nTaps;
+
+            snk_hops_cfg_destroy(snk_hops_config);
+            mod_volume_cfg_destroy(mod_volume_config);
+            mod_resample_cfg_destroy(mod_resample_config);
+
         return cfg;
 
     }
@@ -1920,9 +3112,53 @@
     mod_classify_cfg * parameters_mod_classify_config(const char * fileConfig) {
 
         mod_classify_cfg * cfg;
+        char * tmpStr1;
 
         cfg = mod_classify_cfg_construct();
 
+        // +----------------------------------------------------------+
+        // | Mode (optional, "spectral" if not specified)             |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "classify.mode") == 1) {
+
+                tmpStr1 = parameters_lookup_string(fileConfig, "classify.mode");
+
+                if (strcmp(tmpStr1, "spectral") == 0) {
+                    cfg->mode = 's';
+                }
+                else if (strcmp(tmpStr1, "recursive") == 0) {
+                    cfg->mode = 'r';
+                }
+                else {
+                    printf("classify.mode: Invalid classifier mode\n");
+                    exit(EXIT_FAILURE);
+                }
+
+                free((void *) tmpStr1);
+
+            }
+            else {
+
+                cfg->mode = 's';
+
+            }
+
+        // +----------------------------------------------------------+
+        // | Decimation (optional, used by the recursive mode only)   |
+        // +----------------------------------------------------------+
+
+            if (parameters_exists(fileConfig, "classify.decimation") == 1) {
+
+                cfg->decimation = parameters_lookup_int(fileConfig, "classify.decimation");
+
+            }
+            else {
+
+                cfg->decimation = 1;
+
+            }
+
         // +----------------------------------------------------------+
         // | Frame size                                               |
         // +----------------------------------------------------------+
@@ -2025,6 +3261,7 @@
             tmpStr1 = parameters_lookup_string(fileConfig, "classify.category.format");
 
             if (strcmp(tmpStr1, "json") == 0) { cfg->format = format_construct_text_json(); }
+            else if (strcmp(tmpStr1, "wire") == 0) { cfg->format = format_construct_binary_wire(); }
             else if (strcmp(tmpStr1, "undefined") == 0) { cfg->format = format_construct_undefined(); }                       
             else { printf("classify.category.format: Invalid format\n"); exit(EXIT_FAILURE); }
 
@@ -2054,6 +3291,33 @@
                 tmpInt1 = parameters_lookup_int(fileConfig, "classify.category.interface.port");
 
                 cfg->interface = interface_construct_socket(tmpStr2, tmpInt1);
+                parameters_lookup_queue(fileConfig, "classify.category.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "udp") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "classify.category.interface.ip");
+                tmpInt1 = parameters_lookup_int(fileConfig, "classify.category.interface.port");
+
+                cfg->interface = interface_construct_udp(tmpStr2, tmpInt1);
+                parameters_lookup_datagram(fileConfig, "classify.category.interface", cfg->interface);
+                free((void *) tmpStr2);
+
+            }
+            else if (strcmp(tmpStr1, "shm") == 0) { 
+
+                tmpStr2 = parameters_lookup_string(fileConfig, "classify.category.interface.name");
+
+                // Ring of 4 MB unless specified
+                if (parameters_exists(fileConfig, "classify.category.interface.size") == 1) {
+                    tmpInt1 = parameters_lookup_int(fileConfig, "classify.category.interface.size");
+                }
+                else {
+                    tmpInt1 = 4194304;
+                }
+
+                cfg->interface = interface_construct_shm(tmpStr2, tmpInt1);
                 free((void *) tmpStr2);
 
             }
@@ -12,9 +12,21 @@
 
     unsigned int parameters_count(const char * file, const char * path);
 
+    char parameters_exists(const char * file, const char * path);
+
+    void parameters_lookup_queue(const char * file, const char * path, interface_obj * interface);
+
+    void parameters_lookup_datagram(const char * file, const char * path, interface_obj * interface);
+
+    void parameters_lookup_batch(const char * file, const char * path, interface_obj * interface);
+
+    void parameters_lookup_rotation(const char * file, const char * path, interface_obj * interface);
+
 
     src_hops_cfg * parameters_src_hops_mics_config(const char * fileConfig);
 
+    src_frontend_cfg * parameters_src_frontend_mics_config(const char * fileConfig);
+
     msg_hops_cfg * parameters_msg_hops_mics_raw_config(const char * fileConfig);
 
 
@@ -32,11 +44,15 @@
 
     msg_spectra_cfg * parameters_msg_spectra_mics_config(const char * fileConfig);
 
+    snk_spectra_cfg * parameters_snk_spectra_mics_config(const char * fileConfig);
+
 
     mod_noise_cfg * parameters_mod_noise_mics_config(const char * fileConfig);
 
     msg_powers_cfg * parameters_msg_powers_mics_config(const char * fileConfig);
 
+    snk_powers_cfg * parameters_snk_powers_mics_config(const char * fileConfig);
+
 
     mod_ssl_cfg * parameters_mod_ssl_config(const char * fileConfig);
 
@@ -94,6 +110,10 @@
 
     snk_hops_cfg * parameters_snk_hops_pfs_vol_config(const char * fileConfig);
 
+    snk_backend_cfg * parameters_snk_backend_seps_config(const char * fileConfig);
+
+    snk_backend_cfg * parameters_snk_backend_pfs_config(const char * fileConfig);
+
 
     mod_classify_cfg * parameters_mod_classify_config(const char * fileConfig);
 
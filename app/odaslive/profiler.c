@@ -20,9 +20,11 @@
 
         prf->mod_stft_mics_prf = 0.0f;
         prf->con_spectra_mics_prf = 0.0f;
+        prf->snk_spectra_mics_prf = 0.0f;
 
         prf->mod_noise_mics_prf = 0.0f;
         prf->con_powers_mics_prf = 0.0f;
+        prf->snk_powers_mics_prf = 0.0f;
 
         prf->mod_ssl_prf = 0.0f;
         prf->con_pots_ssl_prf = 0.0f;
@@ -77,7 +79,9 @@
 
         source = prf->src_hops_mics_prf;
 
-        sink = prf->snk_pots_ssl_prf +
+        sink = prf->snk_spectra_mics_prf +
+               prf->snk_powers_mics_prf +
+               prf->snk_pots_ssl_prf +
                prf->snk_tracks_sst_prf + 
                prf->snk_hops_seps_vol_prf +
                prf->snk_hops_pfs_vol_prf +
@@ -135,9 +139,11 @@
         printf("| + STFT                                     |\n");
         printf("|    - Module.......... %07.3f (%06.2f%%)    |\n",prf->mod_stft_mics_prf,roundf(10000.0f * prf->mod_stft_mics_prf / prf->duration) / 100.0f);
         printf("|    - Connector....... %07.3f (%06.2f%%)    |\n",prf->con_spectra_mics_prf,roundf(10000.0f * prf->con_spectra_mics_prf / prf->duration) / 100.0f);
+        printf("|    - Sink............ %07.3f (%06.2f%%)    |\n",prf->snk_spectra_mics_prf,roundf(10000.0f * prf->snk_spectra_mics_prf / prf->duration) / 100.0f);
         printf("| + Noise                                    |\n");
         printf("|    - Module.......... %07.3f (%06.2f%%)    |\n",prf->mod_noise_mics_prf,roundf(10000.0f * prf->mod_noise_mics_prf / prf->duration) / 100.0f);
         printf("|    - Connector....... %07.3f (%06.2f%%)    |\n",prf->con_powers_mics_prf,roundf(10000.0f * prf->con_powers_mics_prf / prf->duration) / 100.0f);
+        printf("|    - Sink............ %07.3f (%06.2f%%)    |\n",prf->snk_powers_mics_prf,roundf(10000.0f * prf->snk_powers_mics_prf / prf->duration) / 100.0f);
         printf("| + SSL                                      |\n");
         printf("|    - Module.......... %07.3f (%06.2f%%)    |\n",prf->mod_ssl_prf,roundf(10000.0f * prf->mod_ssl_prf / prf->duration) / 100.0f);
         printf("|    - Connector....... %07.3f (%06.2f%%)    |\n",prf->con_pots_ssl_prf,roundf(10000.0f * prf->con_pots_ssl_prf / prf->duration) / 100.0f);
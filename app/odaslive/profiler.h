@@ -20,9 +20,11 @@
 
         float mod_stft_mics_prf;
         float con_spectra_mics_prf;
+        float snk_spectra_mics_prf;
 
         float mod_noise_mics_prf;
         float con_powers_mics_prf;
+        float snk_powers_mics_prf;
 
         float mod_ssl_prf;
         float con_pots_ssl_prf;
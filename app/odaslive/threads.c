@@ -5,47 +5,76 @@
 
         unsigned int iSink;
 
-        // +----------------------------------------------------------+
-        // | Raw                                                      |
-        // +----------------------------------------------------------+  
+        // The fused front-end replaces the raw, mapping, resample and STFT stages
+
+        if (aobjs->asrc_frontend_mics_object != NULL) {
 
             // +------------------------------------------------------+
-            // | Source                                               |
+            // | Front-end                                            |
             // +------------------------------------------------------+  
 
-                thread_start(aobjs->asrc_hops_mics_object->thread);
+                thread_start(aobjs->asrc_frontend_mics_object->thread);
+
+        }
+        else {
 
             // +------------------------------------------------------+
-            // | Connector                                            |
-            // +------------------------------------------------------+                     
+            // | Raw                                                  |
+            // +------------------------------------------------------+  
+
+                // +--------------------------------------------------+
+                // | Source                                           |
+                // +--------------------------------------------------+  
 
-                thread_start(aobjs->acon_hops_mics_raw_object->thread);
+                    thread_start(aobjs->asrc_hops_mics_object->thread);
 
-        // +----------------------------------------------------------+
-        // | Mapping                                                  |
-        // +----------------------------------------------------------+  
+                // +--------------------------------------------------+
+                // | Connector                                        |
+                // +--------------------------------------------------+                     
+
+                    thread_start(aobjs->acon_hops_mics_raw_object->thread);
 
             // +------------------------------------------------------+
-            // | Module                                               |
+            // | Mapping                                              |
             // +------------------------------------------------------+  
 
-                thread_start(aobjs->amod_mapping_mics_object->thread);
+                // +--------------------------------------------------+
+                // | Module                                           |
+                // +--------------------------------------------------+  
+
+                    thread_start(aobjs->amod_mapping_mics_object->thread);
+
+                // +--------------------------------------------------+
+                // | Connector                                        |
+                // +--------------------------------------------------+                     
+
+                    thread_start(aobjs->acon_hops_mics_map_object->thread);
 
             // +------------------------------------------------------+
-            // | Connector                                            |
-            // +------------------------------------------------------+                     
+            // | Resample                                             |
+            // +------------------------------------------------------+  
 
-                thread_start(aobjs->acon_hops_mics_map_object->thread);
+                // +--------------------------------------------------+
+                // | Module                                           |
+                // +--------------------------------------------------+  
 
-        // +----------------------------------------------------------+
-        // | Resample                                                 |
-        // +----------------------------------------------------------+  
+                    thread_start(aobjs->amod_resample_mics_object->thread);
 
             // +------------------------------------------------------+
-            // | Module                                               |
+            // | STFT                                                 |
             // +------------------------------------------------------+  
 
-                thread_start(aobjs->amod_resample_mics_object->thread);
+                // +--------------------------------------------------+
+                // | Module                                           |
+                // +--------------------------------------------------+  
+
+                    thread_start(aobjs->amod_stft_mics_object->thread);
+
+        }
+
+        // +----------------------------------------------------------+
+        // | Resample                                                 |
+        // +----------------------------------------------------------+  
 
             // +------------------------------------------------------+
             // | Connector                                            |
@@ -57,18 +86,20 @@
         // | STFT                                                     |
         // +----------------------------------------------------------+  
 
-            // +------------------------------------------------------+
-            // | Module                                               |
-            // +------------------------------------------------------+  
-
-                thread_start(aobjs->amod_stft_mics_object->thread);
-
             // +------------------------------------------------------+
             // | Connector                                            |
             // +------------------------------------------------------+                     
 
                 thread_start(aobjs->acon_spectra_mics_object->thread);
 
+            // +------------------------------------------------------+
+            // | Sinks                                                |
+            // +------------------------------------------------------+  
+
+                if (aobjs->asnk_spectra_mics_object != NULL) {
+                    thread_start(aobjs->asnk_spectra_mics_object->thread);
+                }
+
         // +----------------------------------------------------------+
         // | STFT                                                     |
         // +----------------------------------------------------------+  
@@ -85,6 +116,14 @@
 
                 thread_start(aobjs->acon_powers_mics_object->thread);
 
+            // +------------------------------------------------------+
+            // | Sinks                                                |
+            // +------------------------------------------------------+  
+
+                if (aobjs->asnk_powers_mics_object != NULL) {
+                    thread_start(aobjs->asnk_powers_mics_object->thread);
+                }
+
         // +----------------------------------------------------------+
         // | SSL                                                      |
         // +----------------------------------------------------------+  
@@ -162,6 +201,21 @@
                 thread_start(aobjs->acon_spectra_seps_object->thread);
                 thread_start(aobjs->acon_spectra_pfs_object->thread);
 
+        // +----------------------------------------------------------+
+        // | Back-end                                                 |
+        // +----------------------------------------------------------+  
+
+            // +------------------------------------------------------+
+            // | Sinks                                                |
+            // +------------------------------------------------------+  
+
+                if (aobjs->asnk_backend_seps_object != NULL) {
+                    thread_start(aobjs->asnk_backend_seps_object->thread);
+                }
+                if (aobjs->asnk_backend_pfs_object != NULL) {
+                    thread_start(aobjs->asnk_backend_pfs_object->thread);
+                }
+
         // +----------------------------------------------------------+
         // | ISTFT                                                    |
         // +----------------------------------------------------------+  
@@ -171,14 +225,18 @@
             // +------------------------------------------------------+  
 
                 thread_start(aobjs->amod_istft_seps_object->thread);
-                thread_start(aobjs->amod_istft_pfs_object->thread);
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_start(aobjs->amod_istft_pfs_object->thread);
+                }
 
             // +------------------------------------------------------+
             // | Connector                                            |
             // +------------------------------------------------------+  
 
                 thread_start(aobjs->acon_hops_seps_object->thread);
-                thread_start(aobjs->acon_hops_pfs_object->thread);
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_start(aobjs->acon_hops_pfs_object->thread);
+                }
 
         // +------------------------------------------------------+
         // | Resample                                             |
@@ -188,15 +246,23 @@
             // | Module                                           |
             // +--------------------------------------------------+  
 
-                thread_start(aobjs->amod_resample_seps_object->thread);
-                thread_start(aobjs->amod_resample_pfs_object->thread);
+                if (aobjs->asnk_backend_seps_object == NULL) {
+                    thread_start(aobjs->amod_resample_seps_object->thread);
+                }
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_start(aobjs->amod_resample_pfs_object->thread);
+                }
 
             // +--------------------------------------------------+
             // | Connector                                        |
             // +--------------------------------------------------+  
 
-                thread_start(aobjs->acon_hops_seps_rs_object->thread);
-                thread_start(aobjs->acon_hops_pfs_rs_object->thread);
+                if (aobjs->asnk_backend_seps_object == NULL) {
+                    thread_start(aobjs->acon_hops_seps_rs_object->thread);
+                }
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_start(aobjs->acon_hops_pfs_rs_object->thread);
+                }
 
         // +------------------------------------------------------+
         // | Volume                                               |
@@ -206,22 +272,34 @@
             // | Module                                           |
             // +--------------------------------------------------+  
 
-                thread_start(aobjs->amod_volume_seps_object->thread);
-                thread_start(aobjs->amod_volume_pfs_object->thread);
+                if (aobjs->asnk_backend_seps_object == NULL) {
+                    thread_start(aobjs->amod_volume_seps_object->thread);
+                }
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_start(aobjs->amod_volume_pfs_object->thread);
+                }
 
             // +--------------------------------------------------+
             // | Sinks                                            |
             // +--------------------------------------------------+                     
 
-                thread_start(aobjs->asnk_hops_seps_vol_object->thread);
-                thread_start(aobjs->asnk_hops_pfs_vol_object->thread);
+                if (aobjs->asnk_backend_seps_object == NULL) {
+                    thread_start(aobjs->asnk_hops_seps_vol_object->thread);
+                }
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_start(aobjs->asnk_hops_pfs_vol_object->thread);
+                }
 
             // +--------------------------------------------------+
             // | Connector                                        |
             // +--------------------------------------------------+  
 
-                thread_start(aobjs->acon_hops_seps_vol_object->thread);
-                thread_start(aobjs->acon_hops_pfs_vol_object->thread);
+                if (aobjs->asnk_backend_seps_object == NULL) {
+                    thread_start(aobjs->acon_hops_seps_vol_object->thread);
+                }
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_start(aobjs->acon_hops_pfs_vol_object->thread);
+                }
 
         // +------------------------------------------------------+
         // | Classify                                             |
@@ -257,7 +335,12 @@
             // | Source                                               |
             // +------------------------------------------------------+  
 
-                thread_stop(aobjs->asrc_hops_mics_object->thread);
+                if (aobjs->asrc_frontend_mics_object == NULL) {
+                    thread_stop(aobjs->asrc_hops_mics_object->thread);
+                }
+                else {
+                    thread_stop(aobjs->asrc_frontend_mics_object->thread);
+                }
 
                 // Stops the source that generate frames to process.
                 // This will generate a "zero" message that will stop
@@ -269,51 +352,80 @@
 
         unsigned int iSink;
 
-        // +----------------------------------------------------------+
-        // | Raw                                                      |
-        // +----------------------------------------------------------+  
+        // The fused front-end replaces the raw, mapping, resample and STFT stages
+
+        if (aobjs->asrc_frontend_mics_object != NULL) {
 
             // +------------------------------------------------------+
-            // | Source                                               |
+            // | Front-end                                            |
             // +------------------------------------------------------+  
 
-                thread_join(aobjs->asrc_hops_mics_object->thread);
+                thread_join(aobjs->asrc_frontend_mics_object->thread);
+
+        }
+        else {
 
             // +------------------------------------------------------+
-            // | Connector                                            |
+            // | Raw                                                  |
             // +------------------------------------------------------+  
 
-                thread_join(aobjs->acon_hops_mics_raw_object->thread);
+                // +--------------------------------------------------+
+                // | Source                                           |
+                // +--------------------------------------------------+  
 
-        // +----------------------------------------------------------+
-        // | Mapping                                                  |
-        // +----------------------------------------------------------+  
+                    thread_join(aobjs->asrc_hops_mics_object->thread);
+
+                // +--------------------------------------------------+
+                // | Connector                                        |
+                // +--------------------------------------------------+  
+
+                    thread_join(aobjs->acon_hops_mics_raw_object->thread);
 
             // +------------------------------------------------------+
-            // | Module                                               |
+            // | Mapping                                              |
             // +------------------------------------------------------+  
 
-                thread_join(aobjs->amod_mapping_mics_object->thread);
+                // +--------------------------------------------------+
+                // | Module                                           |
+                // +--------------------------------------------------+  
+
+                    thread_join(aobjs->amod_mapping_mics_object->thread);
+
+                // +--------------------------------------------------+
+                // | Connector                                        |
+                // +--------------------------------------------------+  
+
+                    thread_join(aobjs->acon_hops_mics_map_object->thread);
 
             // +------------------------------------------------------+
-            // | Connector                                            |
+            // | Resample                                             |
             // +------------------------------------------------------+  
 
-                thread_join(aobjs->acon_hops_mics_map_object->thread);
+                // +--------------------------------------------------+
+                // | Module                                           |
+                // +--------------------------------------------------+  
 
-        // +----------------------------------------------------------+
-        // | Resample                                                 |
-        // +----------------------------------------------------------+  
+                    thread_join(aobjs->amod_resample_mics_object->thread);               
 
             // +------------------------------------------------------+
-            // | Module                                               |
+            // | STFT                                                 |
             // +------------------------------------------------------+  
 
-                thread_join(aobjs->amod_resample_mics_object->thread);               
+                // +--------------------------------------------------+
+                // | Module                                           |
+                // +--------------------------------------------------+  
+
+                    thread_join(aobjs->amod_stft_mics_object->thread);
+
+        }
+
+        // +----------------------------------------------------------+
+        // | Resample                                                 |
+        // +----------------------------------------------------------+  
 
             // +------------------------------------------------------+
             // | Connector                                            |
-            // +------------------------------------------------------+  
+            // +------------------------------------------------------+                     
 
                 thread_join(aobjs->acon_hops_mics_rs_object->thread);
 
@@ -322,16 +434,18 @@
         // +----------------------------------------------------------+  
 
             // +------------------------------------------------------+
-            // | Module                                               |
+            // | Connector                                            |
             // +------------------------------------------------------+  
 
-                thread_join(aobjs->amod_stft_mics_object->thread);
+                thread_join(aobjs->acon_spectra_mics_object->thread);
 
             // +------------------------------------------------------+
-            // | Connector                                            |
+            // | Sinks                                                |
             // +------------------------------------------------------+  
 
-                thread_join(aobjs->acon_spectra_mics_object->thread);
+                if (aobjs->asnk_spectra_mics_object != NULL) {
+                    thread_join(aobjs->asnk_spectra_mics_object->thread);
+                }
 
         // +----------------------------------------------------------+
         // | Noise                                                    |
@@ -349,6 +463,14 @@
 
                 thread_join(aobjs->acon_powers_mics_object->thread);
 
+            // +------------------------------------------------------+
+            // | Sinks                                                |
+            // +------------------------------------------------------+  
+
+                if (aobjs->asnk_powers_mics_object != NULL) {
+                    thread_join(aobjs->asnk_powers_mics_object->thread);
+                }
+
         // +----------------------------------------------------------+
         // | SSL                                                      |
         // +----------------------------------------------------------+  
@@ -426,6 +548,21 @@
                 thread_join(aobjs->acon_spectra_seps_object->thread);
                 thread_join(aobjs->acon_spectra_pfs_object->thread);
 
+        // +----------------------------------------------------------+
+        // | Back-end                                                 |
+        // +----------------------------------------------------------+  
+
+            // +------------------------------------------------------+
+            // | Sinks                                                |
+            // +------------------------------------------------------+  
+
+                if (aobjs->asnk_backend_seps_object != NULL) {
+                    thread_join(aobjs->asnk_backend_seps_object->thread);
+                }
+                if (aobjs->asnk_backend_pfs_object != NULL) {
+                    thread_join(aobjs->asnk_backend_pfs_object->thread);
+                }
+
         // +----------------------------------------------------------+
         // | ISTFT                                                    |
         // +----------------------------------------------------------+  
@@ -435,14 +572,18 @@
             // +------------------------------------------------------+  
 
                 thread_join(aobjs->amod_istft_seps_object->thread);
-                thread_join(aobjs->amod_istft_pfs_object->thread);
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_join(aobjs->amod_istft_pfs_object->thread);
+                }
 
             // +------------------------------------------------------+
             // | Connector                                            |
             // +------------------------------------------------------+  
 
                 thread_join(aobjs->acon_hops_seps_object->thread);
-                thread_join(aobjs->acon_hops_pfs_object->thread);
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_join(aobjs->acon_hops_pfs_object->thread);
+                }
 
         // +------------------------------------------------------+
         // | Resample                                             |
@@ -452,15 +593,23 @@
             // | Module                                           |
             // +--------------------------------------------------+  
 
-                thread_join(aobjs->amod_resample_seps_object->thread);
-                thread_join(aobjs->amod_resample_pfs_object->thread);
+                if (aobjs->asnk_backend_seps_object == NULL) {
+                    thread_join(aobjs->amod_resample_seps_object->thread);
+                }
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_join(aobjs->amod_resample_pfs_object->thread);
+                }
 
             // +--------------------------------------------------+
             // | Connector                                        |
             // +--------------------------------------------------+  
 
-                thread_join(aobjs->acon_hops_seps_rs_object->thread);
-                thread_join(aobjs->acon_hops_pfs_rs_object->thread);
+                if (aobjs->asnk_backend_seps_object == NULL) {
+                    thread_join(aobjs->acon_hops_seps_rs_object->thread);
+                }
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_join(aobjs->acon_hops_pfs_rs_object->thread);
+                }
 
         // +------------------------------------------------------+
         // | Volume                                               |
@@ -470,22 +619,34 @@
             // | Module                                           |
             // +--------------------------------------------------+  
 
-                thread_join(aobjs->amod_volume_seps_object->thread);
-                thread_join(aobjs->amod_volume_pfs_object->thread);
+                if (aobjs->asnk_backend_seps_object == NULL) {
+                    thread_join(aobjs->amod_volume_seps_object->thread);
+                }
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_join(aobjs->amod_volume_pfs_object->thread);
+                }
 
             // +--------------------------------------------------+
             // | Sinks                                            |
             // +--------------------------------------------------+                     
 
-                thread_join(aobjs->asnk_hops_seps_vol_object->thread);
-                thread_join(aobjs->asnk_hops_pfs_vol_object->thread);
+                if (aobjs->asnk_backend_seps_object == NULL) {
+                    thread_join(aobjs->asnk_hops_seps_vol_object->thread);
+                }
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_join(aobjs->asnk_hops_pfs_vol_object->thread);
+                }
 
             // +--------------------------------------------------+
             // | Connector                                        |
             // +--------------------------------------------------+  
 
-                thread_join(aobjs->acon_hops_seps_vol_object->thread);
-                thread_join(aobjs->acon_hops_pfs_vol_object->thread);
+                if (aobjs->asnk_backend_seps_object == NULL) {
+                    thread_join(aobjs->acon_hops_seps_vol_object->thread);
+                }
+                if (aobjs->asnk_backend_pfs_object == NULL) {
+                    thread_join(aobjs->acon_hops_pfs_vol_object->thread);
+                }
 
         // +------------------------------------------------------+
         // | Classify                                             |
@@ -523,7 +684,36 @@
             // | Source                                               |
             // +------------------------------------------------------+  
 
-                src_hops_open(objs->src_hops_mics_object);
+                if (objs->src_frontend_mics_object == NULL) {
+                    src_hops_open(objs->src_hops_mics_object);
+                }
+                else {
+                    src_frontend_open(objs->src_frontend_mics_object);
+                }
+
+        // +----------------------------------------------------------+
+        // | STFT                                                     |
+        // +----------------------------------------------------------+  
+
+            // +------------------------------------------------------+
+            // | Sinks                                                |
+            // +------------------------------------------------------+                      
+
+                if (objs->snk_spectra_mics_object != NULL) {
+                    snk_spectra_open(objs->snk_spectra_mics_object);
+                }
+
+        // +----------------------------------------------------------+
+        // | Noise                                                    |
+        // +----------------------------------------------------------+  
+
+            // +------------------------------------------------------+
+            // | Sinks                                                |
+            // +------------------------------------------------------+                      
+
+                if (objs->snk_powers_mics_object != NULL) {
+                    snk_powers_open(objs->snk_powers_mics_object);
+                }
 
         // +----------------------------------------------------------+
         // | SSL                                                      |
@@ -553,8 +743,19 @@
             // | Sinks                                                |
             // +------------------------------------------------------+                      
 
-                snk_hops_open(objs->snk_hops_seps_vol_object);
-                snk_hops_open(objs->snk_hops_pfs_vol_object);
+                if (objs->snk_backend_seps_object == NULL) {
+                    snk_hops_open(objs->snk_hops_seps_vol_object);
+                }
+                else {
+                    snk_backend_open(objs->snk_backend_seps_object);
+                }
+
+                if (objs->snk_backend_pfs_object == NULL) {
+                    snk_hops_open(objs->snk_hops_pfs_vol_object);
+                }
+                else {
+                    snk_backend_open(objs->snk_backend_pfs_object);
+                }
 
         // +----------------------------------------------------------+
         // | Classify                                                 |
@@ -580,7 +781,36 @@
             // | Source                                               |
             // +------------------------------------------------------+  
 
-                src_hops_close(objs->src_hops_mics_object);
+                if (objs->src_frontend_mics_object == NULL) {
+                    src_hops_close(objs->src_hops_mics_object);
+                }
+                else {
+                    src_frontend_close(objs->src_frontend_mics_object);
+                }
+
+        // +----------------------------------------------------------+
+        // | STFT                                                     |
+        // +----------------------------------------------------------+  
+
+            // +------------------------------------------------------+
+            // | Sinks                                                |
+            // +------------------------------------------------------+                      
+
+                if (objs->snk_spectra_mics_object != NULL) {
+                    snk_spectra_close(objs->snk_spectra_mics_object);
+                }
+
+        // +----------------------------------------------------------+
+        // | Noise                                                    |
+        // +----------------------------------------------------------+  
+
+            // +------------------------------------------------------+
+            // | Sinks                                                |
+            // +------------------------------------------------------+                      
+
+                if (objs->snk_powers_mics_object != NULL) {
+                    snk_powers_close(objs->snk_powers_mics_object);
+                }
 
         // +----------------------------------------------------------+
         // | SSL                                                      |
@@ -610,8 +840,19 @@
             // | Sinks                                                |
             // +------------------------------------------------------+                      
 
-                snk_hops_close(objs->snk_hops_seps_vol_object);
-                snk_hops_close(objs->snk_hops_pfs_vol_object);                
+                if (objs->snk_backend_seps_object == NULL) {
+                    snk_hops_close(objs->snk_hops_seps_vol_object);
+                }
+                else {
+                    snk_backend_close(objs->snk_backend_seps_object);
+                }
+
+                if (objs->snk_backend_pfs_object == NULL) {
+                    snk_hops_close(objs->snk_hops_pfs_vol_object);
+                }
+                else {
+                    snk_backend_close(objs->snk_backend_pfs_object);
+                }
 
         // +----------------------------------------------------------+
         // | Classify                                                 |
@@ -633,70 +874,93 @@
 
         clock_t begin, end;
 
-        prf->duration += ((float) (objs->src_hops_mics_object->hopSize)) / ((float) (objs->src_hops_mics_object->fS));
+        if (objs->src_frontend_mics_object == NULL) {
+            prf->duration += ((float) (objs->src_hops_mics_object->hopSize)) / ((float) (objs->src_hops_mics_object->fS));
+        }
+        else {
+            prf->duration += ((float) (objs->src_frontend_mics_object->hopSizeIn)) / ((float) (objs->src_frontend_mics_object->fSin));
+        }
 
         // +----------------------------------------------------------+
         // | SECTION I                                                |
         // +-----------------------------------------------------------
 
+        // The fused front-end replaces the raw, mapping and resample stages
+
+        if (objs->src_frontend_mics_object != NULL) {
+
             // +------------------------------------------------------+
-            // | Raw                                                  |
+            // | Front-end                                            |
             // +------------------------------------------------------+  
 
+                begin = clock();
+                rtnValue = src_frontend_process_push(objs->src_frontend_mics_object);
+                end = clock();
+                prf->src_hops_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+        }
+        else {
+
                 // +--------------------------------------------------+
-                // | Source                                           |
+                // | Raw                                              |
                 // +--------------------------------------------------+  
 
-                    begin = clock();
-                    rtnValue = src_hops_process(objs->src_hops_mics_object);
-                    end = clock();
-                    prf->src_hops_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                    // +----------------------------------------------+
+                    // | Source                                       |
+                    // +----------------------------------------------+  
 
-                // +--------------------------------------------------+
-                // | Connector                                        |
-                // +--------------------------------------------------+   
+                        begin = clock();
+                        rtnValue = src_hops_process(objs->src_hops_mics_object);
+                        end = clock();
+                        prf->src_hops_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
 
-                    begin = clock();
-                    con_hops_process(objs->con_hops_mics_raw_object);
-                    end = clock();
-                    prf->con_hops_mics_raw_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                    // +----------------------------------------------+
+                    // | Connector                                    |
+                    // +----------------------------------------------+   
 
-            // +------------------------------------------------------+
-            // | Mapping                                              |
-            // +------------------------------------------------------+  
+                        begin = clock();
+                        con_hops_process(objs->con_hops_mics_raw_object);
+                        end = clock();
+                        prf->con_hops_mics_raw_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
 
                 // +--------------------------------------------------+
-                // | Module                                           |
+                // | Mapping                                          |
                 // +--------------------------------------------------+  
 
-                    begin = clock();
-                    mod_mapping_process(objs->mod_mapping_mics_object);
-                    end = clock();
-                    prf->mod_mapping_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                    // +----------------------------------------------+
+                    // | Module                                       |
+                    // +----------------------------------------------+  
 
-                // +--------------------------------------------------+
-                // | Connector                                        |
-                // +--------------------------------------------------+                     
+                        begin = clock();
+                        mod_mapping_process(objs->mod_mapping_mics_object);
+                        end = clock();
+                        prf->mod_mapping_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
 
-                    begin = clock();
-                    con_hops_process(objs->con_hops_mics_map_object);
-                    end = clock();
-                    prf->con_hops_mics_map_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                    // +----------------------------------------------+
+                    // | Connector                                    |
+                    // +----------------------------------------------+                     
 
-            // +------------------------------------------------------+
-            // | Resample                                             |
-            // +------------------------------------------------------+  
+                        begin = clock();
+                        con_hops_process(objs->con_hops_mics_map_object);
+                        end = clock();
+                        prf->con_hops_mics_map_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
 
                 // +--------------------------------------------------+
-                // | Module                                           |
+                // | Resample                                         |
                 // +--------------------------------------------------+  
 
-                    begin = clock();
-                    mod_resample_process_push(objs->mod_resample_mics_object);
-                    end = clock();
-                    prf->mod_resample_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                    // +----------------------------------------------+
+                    // | Module                                       |
+                    // +----------------------------------------------+  
 
-        // +----------------------------------------------------------+
+                        begin = clock();
+                        mod_resample_process_push(objs->mod_resample_mics_object);
+                        end = clock();
+                        prf->mod_resample_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+        }
+
+        // +------------------------------------------------------+
         // | SECTION II                                               |
         // +-----------------------------------------------------------
 
@@ -711,10 +975,22 @@
                 // | Module                                           |
                 // +--------------------------------------------------+  
 
-                    begin = clock();
-                    rtnResample = mod_resample_process_pop(objs->mod_resample_mics_object);
-                    end = clock();
-                    prf->mod_resample_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                    if (objs->src_frontend_mics_object == NULL) {
+
+                        begin = clock();
+                        rtnResample = mod_resample_process_pop(objs->mod_resample_mics_object);
+                        end = clock();
+                        prf->mod_resample_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+                    }
+                    else {
+
+                        begin = clock();
+                        rtnResample = src_frontend_process_pop(objs->src_frontend_mics_object);
+                        end = clock();
+                        prf->src_hops_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+                    }
 
                     // If there is no frames to process, stop
                     if (rtnResample == -1) {
@@ -738,10 +1014,14 @@
                 // | Module                                           |
                 // +--------------------------------------------------+  
 
-                    begin = clock();
-                    mod_stft_process(objs->mod_stft_mics_object);
-                    end = clock();
-                    prf->mod_stft_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                    if (objs->src_frontend_mics_object == NULL) {
+
+                        begin = clock();
+                        mod_stft_process(objs->mod_stft_mics_object);
+                        end = clock();
+                        prf->mod_stft_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+                    }
 
                 // +--------------------------------------------------+
                 // | Connector                                        |
@@ -752,6 +1032,19 @@
                     end = clock();
                     prf->con_spectra_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);                     
 
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+                      
+
+                    if (objs->snk_spectra_mics_object != NULL) {
+
+                        begin = clock();
+                        snk_spectra_process(objs->snk_spectra_mics_object);
+                        end = clock();
+                        prf->snk_spectra_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+                    }
+
             // +------------------------------------------------------+
             // | Noise                                                |
             // +------------------------------------------------------+  
@@ -774,6 +1067,19 @@
                     end = clock();
                     prf->con_powers_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);     
 
+                // +--------------------------------------------------+
+                // | Sinks                                            |
+                // +--------------------------------------------------+                      
+
+                    if (objs->snk_powers_mics_object != NULL) {
+
+                        begin = clock();
+                        snk_powers_process(objs->snk_powers_mics_object);
+                        end = clock();
+                        prf->snk_powers_mics_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+                    }
+
             // +------------------------------------------------------+
             // | SSL                                                  |
             // +------------------------------------------------------+  
@@ -885,6 +1191,35 @@
                     end = clock();
                     prf->con_spectra_pfs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);                      
 
+            // +------------------------------------------------------+
+            // | Back-end                                             |
+            // +------------------------------------------------------+  
+
+                // +--------------------------------------------------+
+                // | Sink                                             |
+                // +--------------------------------------------------+  
+
+                    // The fused back-ends replace the ISTFT, resample, volume and hops sink
+                    // stages. The separated ISTFT below only keeps feeding the classifier.
+
+                    if (objs->snk_backend_seps_object != NULL) {
+
+                        begin = clock();
+                        snk_backend_process(objs->snk_backend_seps_object);
+                        end = clock();
+                        prf->snk_hops_seps_vol_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+                    }
+
+                    if (objs->snk_backend_pfs_object != NULL) {
+
+                        begin = clock();
+                        snk_backend_process(objs->snk_backend_pfs_object);
+                        end = clock();
+                        prf->snk_hops_pfs_vol_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+                    }
+
             // +------------------------------------------------------+
             // | ISTFT                                                |
             // +------------------------------------------------------+  
@@ -898,10 +1233,14 @@
                     end = clock();
                     prf->mod_istft_seps_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);      
 
-                    begin = clock();
-                    mod_istft_process(objs->mod_istft_pfs_object);
-                    end = clock();
-                    prf->mod_istft_pfs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);      
+                    if (objs->snk_backend_pfs_object == NULL) {
+
+                        begin = clock();
+                        mod_istft_process(objs->mod_istft_pfs_object);
+                        end = clock();
+                        prf->mod_istft_pfs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+                    }
 
                 // +--------------------------------------------------+
                 // | Connector                                        |
@@ -912,10 +1251,14 @@
                     end = clock();
                     prf->con_hops_seps_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);      
 
-                    begin = clock();
-                    con_hops_process(objs->con_hops_pfs_object);
-                    end = clock();
-                    prf->con_hops_pfs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);     
+                    if (objs->snk_backend_pfs_object == NULL) {
+
+                        begin = clock();
+                        con_hops_process(objs->con_hops_pfs_object);
+                        end = clock();
+                        prf->con_hops_pfs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+                    }
 
             // +------------------------------------------------------+
             // | Resample                                             |
@@ -925,130 +1268,146 @@
                 // | Module                                           |
                 // +--------------------------------------------------+  
 
-                    begin = clock();
-                    mod_resample_process_push(objs->mod_resample_seps_object);
-                    end = clock();
-                    prf->mod_resample_seps_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                    if (objs->snk_backend_seps_object == NULL) {
 
-                    begin = clock();
-                    mod_resample_process_push(objs->mod_resample_pfs_object);
-                    end = clock();
-                    prf->mod_resample_pfs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                        begin = clock();
+                        mod_resample_process_push(objs->mod_resample_seps_object);
+                        end = clock();
+                        prf->mod_resample_seps_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+                    }
+
+                    if (objs->snk_backend_pfs_object == NULL) {
+
+                        begin = clock();
+                        mod_resample_process_push(objs->mod_resample_pfs_object);
+                        end = clock();
+                        prf->mod_resample_pfs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+                    }
 
             // +------------------------------------------------------+
             // | SECTION III                                          |
             // +------------------------------------------------------+
 
-                while(1) {
+                if (objs->snk_backend_seps_object == NULL) {
 
-                    // +----------------------------------------------+
-                    // | Module                                       |
-                    // +----------------------------------------------+  
+                    while(1) {
 
-                        begin = clock();
-                        rtnResample = mod_resample_process_pop(objs->mod_resample_seps_object);
-                        end = clock();
-                        prf->mod_resample_seps_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                        // +------------------------------------------+
+                        // | Module                                   |
+                        // +------------------------------------------+  
 
-                        // If there is no frames to process, stop
-                        if (rtnResample == -1) {
-                            break;
-                        }
+                            begin = clock();
+                            rtnResample = mod_resample_process_pop(objs->mod_resample_seps_object);
+                            end = clock();
+                            prf->mod_resample_seps_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
 
-                    // +----------------------------------------------+
-                    // | Connector                                    |
-                    // +----------------------------------------------+  
+                            // If there is no frames to process, stop
+                            if (rtnResample == -1) {
+                                break;
+                            }
 
-                        begin = clock();
-                        con_hops_process(objs->con_hops_seps_rs_object);
-                        end = clock();
-                        prf->con_hops_seps_rs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                        // +------------------------------------------+
+                        // | Connector                                |
+                        // +------------------------------------------+  
 
-                    // +----------------------------------------------+
-                    // | Module                                       |
-                    // +----------------------------------------------+  
+                            begin = clock();
+                            con_hops_process(objs->con_hops_seps_rs_object);
+                            end = clock();
+                            prf->con_hops_seps_rs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
 
-                        begin = clock();
-                        mod_volume_process(objs->mod_volume_seps_object);
-                        end = clock();
-                        prf->mod_volume_seps_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                        // +------------------------------------------+
+                        // | Module                                   |
+                        // +------------------------------------------+  
 
-                    // +----------------------------------------------+
-                    // | Connector                                    |
-                    // +----------------------------------------------+  
+                            begin = clock();
+                            mod_volume_process(objs->mod_volume_seps_object);
+                            end = clock();
+                            prf->mod_volume_seps_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
 
-                        begin = clock();
-                        con_hops_process(objs->con_hops_seps_vol_object);
-                        end = clock();
-                        prf->con_hops_seps_vol_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);                        
+                        // +------------------------------------------+
+                        // | Connector                                |
+                        // +------------------------------------------+  
 
-                    // +----------------------------------------------+
-                    // | Sink                                         |
-                    // +----------------------------------------------+  
+                            begin = clock();
+                            con_hops_process(objs->con_hops_seps_vol_object);
+                            end = clock();
+                            prf->con_hops_seps_vol_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);                        
 
-                        begin = clock();
-                        snk_hops_process(objs->snk_hops_seps_vol_object);
-                        end = clock();
-                        prf->snk_hops_seps_vol_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                        // +------------------------------------------+
+                        // | Sink                                     |
+                        // +------------------------------------------+  
 
-                    }
+                            begin = clock();
+                            snk_hops_process(objs->snk_hops_seps_vol_object);
+                            end = clock();
+                            prf->snk_hops_seps_vol_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
 
+                        }
 
-                while(1) {
+                }
 
-                    // +----------------------------------------------+
-                    // | Module                                       |
-                    // +----------------------------------------------+  
 
-                        begin = clock();
-                        rtnResample = mod_resample_process_pop(objs->mod_resample_pfs_object);
-                        end = clock();
-                        prf->mod_resample_pfs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                if (objs->snk_backend_pfs_object == NULL) {
 
-                        // If there is no frames to process, stop
-                        if (rtnResample == -1) {
-                            break;
-                        }
+                    while(1) {
 
-                    // +----------------------------------------------+
-                    // | Connector                                    |
-                    // +----------------------------------------------+  
+                        // +------------------------------------------+
+                        // | Module                                   |
+                        // +------------------------------------------+  
 
-                        begin = clock();
-                        con_hops_process(objs->con_hops_pfs_rs_object);
-                        end = clock();
-                        prf->con_hops_pfs_rs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                            begin = clock();
+                            rtnResample = mod_resample_process_pop(objs->mod_resample_pfs_object);
+                            end = clock();
+                            prf->mod_resample_pfs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
 
-                    // +----------------------------------------------+
-                    // | Module                                       |
-                    // +----------------------------------------------+  
+                            // If there is no frames to process, stop
+                            if (rtnResample == -1) {
+                                break;
+                            }
 
-                        begin = clock();
-                        mod_volume_process(objs->mod_volume_pfs_object);
-                        end = clock();
-                        prf->mod_volume_pfs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                        // +------------------------------------------+
+                        // | Connector                                |
+                        // +------------------------------------------+  
 
-                    // +----------------------------------------------+
-                    // | Connector                                    |
-                    // +----------------------------------------------+  
+                            begin = clock();
+                            con_hops_process(objs->con_hops_pfs_rs_object);
+                            end = clock();
+                            prf->con_hops_pfs_rs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
 
-                        begin = clock();
-                        con_hops_process(objs->con_hops_pfs_vol_object);
-                        end = clock();
-                        prf->con_hops_pfs_vol_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);       
+                        // +------------------------------------------+
+                        // | Module                                   |
+                        // +------------------------------------------+  
 
-                    // +----------------------------------------------+
-                    // | Sink                                         |
-                    // +----------------------------------------------+  
+                            begin = clock();
+                            mod_volume_process(objs->mod_volume_pfs_object);
+                            end = clock();
+                            prf->mod_volume_pfs_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
 
-                        begin = clock();
-                        snk_hops_process(objs->snk_hops_pfs_vol_object);
-                        end = clock();
-                        prf->snk_hops_pfs_vol_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+                        // +------------------------------------------+
+                        // | Connector                                |
+                        // +------------------------------------------+  
 
-                    }
+                            begin = clock();
+                            con_hops_process(objs->con_hops_pfs_vol_object);
+                            end = clock();
+                            prf->con_hops_pfs_vol_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);       
 
-            // +------------------------------------------------------+
+                        // +------------------------------------------+
+                        // | Sink                                     |
+                        // +------------------------------------------+  
+
+                            begin = clock();
+                            snk_hops_process(objs->snk_hops_pfs_vol_object);
+                            end = clock();
+                            prf->snk_hops_pfs_vol_prf += (float) (((double) (end-begin)) / CLOCKS_PER_SEC);
+
+                        }
+
+                }
+
+            // +--------------------------------------------------+
             // | Classify                                             |
             // +------------------------------------------------------+  
 
@@ -1083,4 +1442,33 @@
 
         return rtnValue;
 
-    }
\ No newline at end of file
+    }
+
+    void threads_batch_check(const char batch, const configs * cfgs) {
+
+        // Batch mode only makes sense when the source is not paced by a soundcard
+        if ((batch == 0x01) && (cfgs->src_hops_mics_config->interface->type != interface_file)) {
+            printf("Batch mode requires a file source (raw.interface.type = \"file\").\n");
+            exit(EXIT_FAILURE);
+        }
+
+    }
+
+    void threads_batch_printf(const src_hops_obj * src_hops, const struct timespec * begin, const struct timespec * end) {
+
+        double durationAudio;
+        double durationWall;
+
+        // Everything read from the file went through the pipeline
+        durationAudio = ((double) (src_hops->position - src_hops->wave->dataOffset)) / ((double) (src_hops->bufferSize / src_hops->hopSize)) / ((double) src_hops->fS);
+        durationWall = ((double) (end->tv_sec - begin->tv_sec)) + 1E-9 * ((double) (end->tv_nsec - begin->tv_nsec));
+
+        printf("Batch: %.1f sec of audio processed in %.1f sec", durationAudio, durationWall);
+
+        if (durationWall > 0.0) {
+            printf(" (%.1fx real time)", durationAudio / durationWall);
+        }
+
+        printf("\n");
+
+    }
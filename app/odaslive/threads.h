@@ -20,4 +20,8 @@
 
     int threads_single_process(objects * objs, profiler * prf);
 
+    void threads_batch_check(const char batch, const configs * cfgs);
+
+    void threads_batch_printf(const src_hops_obj * src_hops, const struct timespec * begin, const struct timespec * end);
+
 #endif
\ No newline at end of file
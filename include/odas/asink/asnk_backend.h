@@ -0,0 +1,50 @@
+#ifndef __ODAS_ASINK_BACKEND
+#define __ODAS_ASINK_BACKEND
+
+    /**
+    * \file     asnk_backend.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include "../amessage/amsg_spectra.h"
+    #include "../sink/snk_backend.h"
+    #include "../general/thread.h"
+
+    #include <stdlib.h>
+
+    typedef struct asnk_backend_obj {
+
+        snk_backend_obj * snk_backend;
+        amsg_spectra_obj * in;
+        thread_obj * thread;
+
+    } asnk_backend_obj;
+
+    asnk_backend_obj * asnk_backend_construct(const snk_backend_cfg * snk_backend_config, const msg_spectra_cfg * msg_spectra_config, const msg_hops_cfg * msg_hops_in_config, const msg_hops_cfg * msg_hops_out_config);
+
+    void asnk_backend_destroy(asnk_backend_obj * obj);
+
+    void asnk_backend_connect(asnk_backend_obj * obj, amsg_spectra_obj * in);
+
+    void asnk_backend_disconnect(asnk_backend_obj * obj);
+
+    void * asnk_backend_thread(void * ptr);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,52 @@
+#ifndef __ODAS_ASOURCE_FRONTEND
+#define __ODAS_ASOURCE_FRONTEND
+
+    /**
+    * \file     asource_frontend.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include "../amessage/amsg_hops.h"
+    #include "../amessage/amsg_spectra.h"
+    #include "../source/src_frontend.h"
+    #include "../general/thread.h"
+
+    #include <stdlib.h>
+
+    typedef struct asrc_frontend_obj {
+
+        src_frontend_obj * src_frontend;
+        amsg_hops_obj * out1;
+        amsg_spectra_obj * out2;
+        thread_obj * thread;
+
+    } asrc_frontend_obj;
+
+    asrc_frontend_obj * asrc_frontend_construct(const src_frontend_cfg * src_frontend_config, const msg_hops_cfg * msg_hops_raw_config, const msg_hops_cfg * msg_hops_config, const msg_spectra_cfg * msg_spectra_config);
+
+    void asrc_frontend_destroy(asrc_frontend_obj * obj);
+
+    void asrc_frontend_connect(asrc_frontend_obj * obj, amsg_hops_obj * out1, amsg_spectra_obj * out2);
+
+    void asrc_frontend_disconnect(asrc_frontend_obj * obj);
+
+    void * asrc_frontend_thread(void * ptr);
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef __ODAS_GENERAL_ARCHIVE
+#define __ODAS_GENERAL_ARCHIVE
+
+   /**
+    * \file     archive.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    // Append-only archive ("mmap" interface) of the spectra and powers sinks. The file is an
+    // archive_header, the channel table (nChannels uint32_t, padded to 8 bytes), and nRecords
+    // records of recordSize bytes, so record i starts at headerSize + i * recordSize and the
+    // file can be mapped and indexed directly. A record is
+    // the time stamp (uint64_t) followed by nChannels x nBins values (float, little-endian),
+    // channel by channel. Spectra hold two values per bin (real, imaginary), powers one.
+    //
+    // The writer updates nRecords after each record, so the file can be read while it grows.
+    // Bins are k = 0, binStep, 2 * binStep, ... below halfFrameSize. Entry j of the channel
+    // table is the input channel stored at position j in the records, in the order listed in
+    // the configuration (a channel may appear more than once).
+
+    #ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+    #endif
+
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <stdint.h>
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+
+    typedef enum archive_constant {
+
+        archive_magic = 0x5241444F,
+        archive_version = 2,
+
+    } archive_constant;
+
+    typedef enum archive_kind {
+
+        archive_kind_spectra = 1,
+        archive_kind_powers = 2,
+
+    } archive_kind;
+
+    typedef struct archive_header {
+
+        uint32_t magic;
+        uint16_t version;
+        uint16_t kind;
+        uint32_t headerSize;
+        uint32_t recordSize;
+        uint64_t nRecords;
+        uint32_t nChannels;
+        uint32_t nBins;
+        uint32_t binStep;
+        uint32_t halfFrameSize;
+        uint32_t fS;
+        uint32_t reserved1;
+        uint32_t reserved2[4];
+
+    } archive_header;
+
+    //! Writer of an archive, mapped in memory and grown by doubling.
+    typedef struct archive_obj {
+
+        char * fileName;                        ///< Path of the file.
+        int fd;                                 ///< File descriptor.
+        char * map;                             ///< Mapping of the whole file.
+        unsigned long long mapSize;             ///< Size of the mapping (and of the file while writing).
+        archive_header * header;                ///< Header, at the beginning of the mapping.
+        unsigned long long headerSize;          ///< Header and channel table, where the records start.
+        unsigned long long nRecords;            ///< Number of records written.
+
+    } archive_obj;
+
+    /** Constructor. Create (or truncate) the file and write the header and the channel table.
+        \param      fileName        Path of the file.
+        \param      header          Header to write (magic, version, headerSize and nRecords are filled in).
+        \param      channels        Input channel of each of the header->nChannels positions of a record.
+        \return                     Pointer to the instantiated object.
+    */
+    archive_obj * archive_construct(const char * fileName, const archive_header * header, const unsigned int * channels);
+
+    /** Destructor. Trim the file to its records and unmap it.
+        \param      obj             Object to be destroyed.
+    */
+    void archive_destroy(archive_obj * obj);
+
+    /** Append a record.
+        \param      obj             Object used.
+        \param      timeStamp       Time stamp of the frame.
+        \param      bytes           Values of the record.
+        \param      nBytes          Size of the values (at most recordSize - 8).
+    */
+    void archive_append(archive_obj * obj, const unsigned long long timeStamp, const char * bytes, const unsigned int nBytes);
+
+#endif
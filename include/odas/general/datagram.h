@@ -0,0 +1,131 @@
+#ifndef __ODAS_GENERAL_DATAGRAM
+#define __ODAS_GENERAL_DATAGRAM
+
+   /**
+    * \file     datagram.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+    #endif
+
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <time.h>
+    #include <unistd.h>
+    #include <sys/socket.h>
+    #include <sys/uio.h>
+    #include <netinet/in.h>
+    #include <arpa/inet.h>
+
+    #include "interface.h"
+    #include "wire.h"
+
+    //! Maximum number of datagrams handed to the kernel in one call.
+    #define DATAGRAM_BATCH 64
+
+    //! Seconds between two reports of the counters.
+    #define DATAGRAM_REPORT_PERIOD 10
+
+    //! Snapshot of the counters of a datagram sender.
+    typedef struct datagram_stats_obj {
+
+        unsigned long long nMessages;           ///< Messages sent.
+        unsigned long long nDatagrams;          ///< Datagrams sent.
+        unsigned long long nDatagramsDropped;   ///< Datagrams the kernel refused.
+
+    } datagram_stats_obj;
+
+    //! UDP sender (unicast or multicast). Messages are cut in datagrams of at most mtu bytes,
+    //! each one prefixed by a wire_datagram, and sent without ever waiting: a datagram the
+    //! kernel cannot take right away is lost, and receivers see the gap in the sequence.
+    typedef struct datagram_obj {
+
+        char * name;                            ///< Prefix of the printed messages (e.g. "Sink tracks").
+        int sid;                                ///< Socket.
+        struct sockaddr_in address;             ///< Destination (unicast or multicast group).
+        char multicast;                         ///< The destination is a multicast group.
+        unsigned int mtu;                       ///< Maximum size of a datagram, header included.
+
+        unsigned int sequence;                  ///< Sequence number of the next message.
+
+        wire_datagram * headers;                ///< Headers of the batch being sent.
+        struct iovec * iovecs;                  ///< Header and payload of each datagram of the batch.
+        struct mmsghdr * messages;              ///< Datagrams of the batch.
+
+        unsigned long long nMessages;           ///< Messages sent.
+        unsigned long long nDatagrams;          ///< Datagrams sent.
+        unsigned long long nDatagramsDropped;   ///< Datagrams the kernel refused.
+        char warned;                            ///< A refused datagram has been reported.
+
+        unsigned long long nReported;           ///< Datagrams dropped at the last report.
+        time_t reportTime;                      ///< When the counters were last checked.
+
+    } datagram_obj;
+
+    /** Constructor. Open a non-blocking socket (senders need no multicast group membership).
+        \param      name            Prefix of the printed messages.
+        \param      interface       UDP interface (ip, port, mtu and ttl).
+        \return                     Pointer to the instantiated object.
+    */
+    datagram_obj * datagram_construct(const char * name, const interface_obj * interface);
+
+    /** Destructor. Print the counters if datagrams were refused.
+        \param      obj             Object to be destroyed.
+    */
+    void datagram_destroy(datagram_obj * obj);
+
+    /** Send a message as one or more datagrams.
+        \param      obj             Object used.
+        \param      timeStamp       Time stamp copied in every header.
+        \param      bytes           Message.
+        \param      nBytes          Size of the message.
+        \param      align           Fragments hold a multiple of this number of bytes (1 for no constraint).
+    */
+    void datagram_send(datagram_obj * obj, const unsigned long long timeStamp, const char * bytes, const unsigned int nBytes, const unsigned int align);
+
+    /** Hand the first nDatagrams of the batch to the kernel.
+        \param      obj             Object used.
+        \param      nDatagrams      Number of datagrams in the batch.
+    */
+    void datagram_flush(datagram_obj * obj, const unsigned int nDatagrams);
+
+    /** Copy the counters.
+        \param      obj             Object used.
+        \param      stats           Destination.
+    */
+    void datagram_stats(const datagram_obj * obj, datagram_stats_obj * stats);
+
+    /** Print the counters every DATAGRAM_REPORT_PERIOD seconds, when datagrams were refused
+        since the last report.
+        \param      obj             Object used.
+    */
+    void datagram_report(datagram_obj * obj);
+
+    /** Print the counters.
+        \param      obj             Object used.
+    */
+    void datagram_printf(const datagram_obj * obj);
+
+#endif
@@ -35,6 +35,9 @@
         format_binary_int32 = 32, 
         format_binary_float = 1, 
         format_text_json = 2,
+        format_binary_wire = 3,
+        format_lossless_int16 = 4,
+        format_lossless_int24 = 5,
 
     } format_type;
 
@@ -54,6 +57,10 @@
 
     format_obj * format_construct_text_json();
 
+    format_obj * format_construct_binary_wire();
+
+    format_obj * format_construct_lossless_int(const unsigned int nBits);
+
     format_obj * format_clone(const format_obj * obj);
 
     void format_destroy(format_obj * obj);
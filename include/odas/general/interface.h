@@ -35,6 +35,10 @@
         interface_socket = 3,
         interface_soundcard = 4,
         interface_terminal = 5,
+        interface_udp = 6,
+        interface_shm = 7,
+        interface_mmap = 8,
+        interface_wav = 9,
 
     } interface_type;
 
@@ -46,6 +50,14 @@
 
         char * ip;
         unsigned int port;
+        unsigned int queueSize;
+        char overflow;
+        unsigned int mtu;
+        unsigned int ttl;
+        unsigned int batch;
+        unsigned int latency;
+        unsigned long long rotateSize;
+        unsigned int rotateTime;
 
         char * deviceName;
 
@@ -57,8 +69,16 @@
 
     interface_obj * interface_construct_file(const char * fileName);
 
+    interface_obj * interface_construct_mmap(const char * fileName);
+
+    interface_obj * interface_construct_wav(const char * fileName);
+
     interface_obj * interface_construct_socket(const char * ip, const unsigned int port);
 
+    interface_obj * interface_construct_udp(const char * ip, const unsigned int port);
+
+    interface_obj * interface_construct_shm(const char * name, const unsigned int size);
+
     interface_obj * interface_construct_soundcard(const unsigned int card, const unsigned int device);
 
     interface_obj * interface_construct_soundcard_by_name(char * deviceName);
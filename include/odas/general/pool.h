@@ -0,0 +1,96 @@
+#ifndef __ODAS_GENERAL_POOL
+#define __ODAS_GENERAL_POOL
+
+   /**
+    * \file     pool.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <pthread.h>
+
+    struct pool_obj;
+
+    //! Worker of the pool (one per helper thread).
+    typedef struct pool_worker_obj {
+
+        struct pool_obj * pool;                 ///< Pool this worker belongs to.
+        unsigned int iWorker;                   ///< Index of the worker (0 is the calling thread).
+        pthread_t thread;                       ///< Helper thread.
+
+    } pool_worker_obj;
+
+    //! Fixed pool of workers. The calling thread acts as worker 0.
+    typedef struct pool_obj {
+
+        unsigned int nWorkers;                  ///< Number of workers, including the calling thread.
+        pool_worker_obj * workers;              ///< Helper workers (indexes 1 to nWorkers-1).
+
+        pthread_mutex_t mutex;                  ///< Protects all the fields below.
+        pthread_cond_t start;                   ///< Signaled when a new batch is posted.
+        pthread_cond_t done;                    ///< Signaled when the last helper completes a batch.
+
+        unsigned int generation;                ///< Batch counter.
+        unsigned int nPending;                  ///< Number of helpers still working on the batch.
+        char stop;                              ///< Ask helpers to terminate.
+
+        void (* task) (void *, const unsigned int, const unsigned int);
+        void * arg;                             ///< Argument passed to the task.
+        unsigned int nTasks;                    ///< Number of tasks in the batch.
+
+    } pool_obj;
+
+    /** Constructor. Spawn nWorkers-1 helper threads.
+        \param      nWorkers        Number of workers (1 means everything runs in the calling thread).
+        \return                     Pointer to the instantiated object.
+    */
+    pool_obj * pool_construct(const unsigned int nWorkers);
+
+    /** Destructor. Stop and join the helper threads, and free memory.
+        \param      obj             Object to be destroyed.
+    */
+    void pool_destroy(pool_obj * obj);
+
+    /** Run task(arg, iTask, iWorker) for iTask = 0 ... nTasks-1 and return once all tasks are completed.
+        Task iTask is always executed by worker (iTask % nWorkers), so a given worker only touches its own scratch.
+        \param      obj             Object used.
+        \param      task            Function to execute.
+        \param      arg             Argument passed to the function.
+        \param      nTasks          Number of tasks.
+    */
+    void pool_run(pool_obj * obj, void (* task) (void *, const unsigned int, const unsigned int), void * arg, const unsigned int nTasks);
+
+    /** Execute the share of the batch that belongs to a given worker.
+        \param      obj             Object used.
+        \param      task            Function to execute.
+        \param      arg             Argument passed to the function.
+        \param      nTasks          Number of tasks.
+        \param      iWorker         Index of the worker.
+    */
+    void pool_share(pool_obj * obj, void (* task) (void *, const unsigned int, const unsigned int), void * arg, const unsigned int nTasks, const unsigned int iWorker);
+
+    /** Loop executed by each helper thread.
+        \param      ptr             Pointer to the pool_worker_obj of the helper.
+        \return                     NULL.
+    */
+    void * pool_thread(void * ptr);
+
+#endif
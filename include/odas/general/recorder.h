@@ -0,0 +1,199 @@
+#ifndef __ODAS_GENERAL_RECORDER
+#define __ODAS_GENERAL_RECORDER
+
+   /**
+    * \file     recorder.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <pthread.h>
+    #include <time.h>
+    #include <unistd.h>
+
+    #include "interface.h"
+
+    typedef enum recorder_constant {
+
+        recorder_headerSize = 80,               ///< RIFF, JUNK (room for ds64), fmt and data chunk headers.
+        recorder_chunkSize = 262144,            ///< Largest write to the file.
+        recorder_maxTries = 10000,              ///< Indexes tried for a rotated file before giving up.
+        recorder_reportPeriod = 10,             ///< Seconds between two reports of the counters.
+
+    } recorder_constant;
+
+    //! Snapshot of the counters of a recorder.
+    typedef struct recorder_stats_obj {
+
+        unsigned long long nBytesWritten;       ///< Audio bytes written, all files included.
+        unsigned int nFiles;                    ///< Number of files opened.
+        unsigned long long nBytesDropped;       ///< Audio bytes lost (overflow or write errors).
+        unsigned long long nPushesDropped;      ///< Pushes lost, fully or partly.
+        unsigned int highWater;                 ///< Largest number of bytes queued so far.
+        unsigned int ringSize;                  ///< Capacity of the queue, in bytes.
+
+    } recorder_stats_obj;
+
+    //! WAV file writer fed through a bounded queue. Sinks push audio without ever waiting
+    //! on the disk, and a helper thread writes it, keeps the header up to date, and starts a
+    //! new file when the current one reaches the size or duration limit. A file that grows
+    //! beyond 4 GB is closed as RF64.
+    typedef struct recorder_obj {
+
+        char * name;                            ///< Prefix of the printed messages (e.g. "Sink hops").
+        char * pattern;                         ///< Path of the files, expanded with strftime.
+        char overflow;                          ///< Full queue: 'o' drops the oldest samples, 'n' the new ones, 'b' blocks.
+
+        unsigned int fS;                        ///< Sample rate.
+        unsigned int nChannels;                 ///< Number of channels.
+        unsigned int nBits;                     ///< Bits per sample.
+        unsigned int formatTag;                 ///< 1 for PCM, 3 for IEEE float.
+        unsigned int blockAlign;                ///< Bytes per sample frame (all channels).
+        unsigned long long rotateBytes;         ///< Audio bytes per file (0 if files never rotate).
+
+        char * ring;                            ///< Queued audio.
+        unsigned int ringSize;                  ///< Capacity of the queue, in bytes (multiple of blockAlign).
+        unsigned int ringHead;                  ///< Index of the oldest byte.
+        unsigned int ringUsed;                  ///< Number of bytes used.
+
+        char * chunk;                           ///< Audio being written by the helper thread.
+        unsigned int chunkSize;                 ///< Capacity of the chunk, in bytes (multiple of blockAlign).
+
+        int fd;                                 ///< Current file, -1 if none.
+        char * fileName;                        ///< Path of the current file.
+        unsigned int iFile;                     ///< Index of the next rotated file.
+        unsigned int nFiles;                    ///< Number of files opened.
+        unsigned long long dataSize;            ///< Audio bytes in the current file.
+        time_t headerTime;                      ///< When the header was last written.
+        char failed;                            ///< The current file could not be opened, or a write to it failed.
+
+        unsigned long long nBytesWritten;       ///< Audio bytes written, all files included.
+        unsigned long long nBytesDropped;       ///< Audio bytes lost (overflow or write errors).
+        unsigned long long nPushesDropped;      ///< Pushes lost, fully or partly.
+        unsigned int highWater;                 ///< Largest number of bytes queued so far.
+
+        recorder_stats_obj reported;            ///< Counters at the last report (helper thread).
+        time_t reportTime;                      ///< When the counters were last checked (helper thread).
+
+        pthread_t thread;                       ///< Helper thread.
+        pthread_mutex_t mutex;                  ///< Protects the queue, the counters and stop.
+        pthread_cond_t filled;                  ///< Signaled when audio is queued, or on stop.
+        pthread_cond_t emptied;                 ///< Signaled when audio leaves the queue, or on stop.
+        char stop;                              ///< Ask the helper thread to write what is left and terminate.
+
+    } recorder_obj;
+
+    /** Constructor. Open the first file and start the helper thread.
+        \param      name            Prefix of the printed messages.
+        \param      interface       Wav interface (fileName, queueSize, overflow, rotateSize and rotateTime).
+        \param      fS              Sample rate.
+        \param      nChannels       Number of channels.
+        \param      nBits           Bits per sample (16, 24 or 32).
+        \param      isFloat         Samples are 32-bit floats.
+        \return                     Pointer to the instantiated object.
+    */
+    recorder_obj * recorder_construct(const char * name, const interface_obj * interface, const unsigned int fS, const unsigned int nChannels, const unsigned int nBits, const char isFloat);
+
+    /** Destructor. Write what is still queued, finalize the file, stop the thread, and print
+        the counters if audio was lost.
+        \param      obj             Object to be destroyed.
+    */
+    void recorder_destroy(recorder_obj * obj);
+
+    /** Queue audio (whole sample frames). Only waits when the overflow policy is 'b' and the queue is full.
+        \param      obj             Object used.
+        \param      bytes           Interleaved samples.
+        \param      nBytes          Number of bytes.
+    */
+    void recorder_push(recorder_obj * obj, const char * bytes, const unsigned int nBytes);
+
+    /** Copy bytes to the end of the ring (with the mutex locked).
+        \param      obj             Object used.
+        \param      bytes           Bytes to copy.
+        \param      nBytes          Number of bytes.
+    */
+    void recorder_ring_write(recorder_obj * obj, const char * bytes, const unsigned int nBytes);
+
+    /** Copy bytes from the beginning of the ring and release them (with the mutex locked).
+        \param      obj             Object used.
+        \param      bytes           Destination, or NULL to discard the bytes.
+        \param      nBytes          Number of bytes.
+    */
+    void recorder_ring_read(recorder_obj * obj, char * bytes, const unsigned int nBytes);
+
+    /** Open the next file and write a provisional header. Rotated files get the next free
+        index and are created with O_EXCL, so no file is ever overwritten.
+        \param      obj             Object used.
+        \return                     0 on success, -1 if no file could be opened (fd is then -1).
+    */
+    int recorder_open(recorder_obj * obj);
+
+    /** Write the final header and close the current file.
+        \param      obj             Object used.
+    */
+    void recorder_close(recorder_obj * obj);
+
+    /** Write the header of the current file for the audio written so far.
+        \param      obj             Object used.
+    */
+    void recorder_header(recorder_obj * obj);
+
+    /** Store a little-endian integer.
+        \param      bytes           Destination.
+        \param      value           Value to store.
+        \param      nBytes          Number of bytes (2, 4 or 8).
+    */
+    void recorder_le(unsigned char * bytes, const unsigned long long value, const unsigned int nBytes);
+
+    /** Write audio to the current file.
+        \param      obj             Object used.
+        \param      bytes           Audio.
+        \param      nBytes          Number of bytes.
+    */
+    void recorder_write(recorder_obj * obj, const char * bytes, const unsigned int nBytes);
+
+    /** Loop executed by the helper thread.
+        \param      ptr             Pointer to the recorder_obj.
+        \return                     NULL.
+    */
+    void * recorder_thread(void * ptr);
+
+    /** Copy the counters.
+        \param      obj             Object used.
+        \param      stats           Destination.
+    */
+    void recorder_stats(recorder_obj * obj, recorder_stats_obj * stats);
+
+    /** Print the counters every recorder_reportPeriod seconds, when audio was dropped or the
+        high-water mark rose since the last report (helper thread).
+        \param      obj             Object used.
+    */
+    void recorder_report(recorder_obj * obj);
+
+    /** Print the counters.
+        \param      obj             Object used.
+    */
+    void recorder_printf(recorder_obj * obj);
+
+#endif
@@ -0,0 +1,176 @@
+#ifndef __ODAS_GENERAL_SENDER
+#define __ODAS_GENERAL_SENDER
+
+   /**
+    * \file     sender.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <pthread.h>
+    #include <time.h>
+    #include <unistd.h>
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <arpa/inet.h>
+
+    #include "interface.h"
+
+    typedef enum sender_constant {
+
+        sender_reportPeriod = 10,               ///< Seconds between two reports of the counters.
+
+    } sender_constant;
+
+    //! Snapshot of the counters of a sender.
+    typedef struct sender_stats_obj {
+
+        unsigned long long nMessagesSent;       ///< Messages written to the socket.
+        unsigned long long nMessagesDropped;    ///< Messages lost (overflow, too large, or connection lost mid-message).
+        unsigned long long nBytesDropped;       ///< Bytes of these messages.
+        unsigned int highWater;                 ///< Largest number of bytes queued so far.
+        unsigned int ringSize;                  ///< Capacity of the queue, in bytes.
+        unsigned int nConnections;              ///< Successful connections, including reconnections.
+
+    } sender_stats_obj;
+
+    //! TCP client fed through a bounded queue. Sinks push whole messages without ever
+    //! waiting on the network, and a helper thread sends them with a non-blocking socket,
+    //! reconnecting with an exponential backoff when the server goes away.
+    typedef struct sender_obj {
+
+        char * name;                            ///< Prefix of the printed messages (e.g. "Sink tracks").
+        struct sockaddr_in sserver;             ///< Address of the server.
+        char overflow;                          ///< Full queue: 'o' drops the oldest messages, 'n' the new one, 'b' blocks.
+
+        char * ring;                            ///< Queued messages, each one prefixed by its size (4 bytes).
+        unsigned int ringSize;                  ///< Capacity of the queue, in bytes.
+        unsigned int ringHead;                  ///< Index of the oldest byte.
+        unsigned int ringUsed;                  ///< Number of bytes used.
+        unsigned int nMessages;                 ///< Number of queued messages.
+
+        char * message;                         ///< Message being sent by the helper thread.
+        unsigned int messageSize;               ///< Size of this message.
+
+        int sid;                                ///< Socket, -1 when disconnected.
+        char warned;                            ///< The current outage has been reported.
+
+        unsigned long long nMessagesSent;       ///< Messages written to the socket.
+        unsigned long long nMessagesDropped;    ///< Messages lost (overflow, too large, or connection lost mid-message).
+        unsigned long long nBytesDropped;       ///< Bytes of these messages.
+        unsigned int highWater;                 ///< Largest number of bytes queued so far.
+        unsigned int nConnections;              ///< Successful connections, including reconnections.
+
+        sender_stats_obj reported;              ///< Counters at the last report (helper thread).
+        time_t reportTime;                      ///< When the counters were last checked (helper thread).
+
+        pthread_t thread;                       ///< Helper thread.
+        pthread_mutex_t mutex;                  ///< Protects the queue, the counters and stop.
+        pthread_cond_t filled;                  ///< Signaled when a message is queued, or on stop.
+        pthread_cond_t emptied;                 ///< Signaled when a message leaves the queue, or on stop.
+        char stop;                              ///< Ask the helper thread to flush what it can and terminate.
+
+    } sender_obj;
+
+    /** Constructor. Start the helper thread, which connects in the background.
+        \param      name            Prefix of the printed messages.
+        \param      interface       Socket interface (ip, port, queueSize and overflow).
+        \return                     Pointer to the instantiated object.
+    */
+    sender_obj * sender_construct(const char * name, const interface_obj * interface);
+
+    /** Destructor. Send what is still queued while the server keeps up, stop the thread, and print
+        the counters if messages were lost or the connection was reestablished.
+        \param      obj             Object to be destroyed.
+    */
+    void sender_destroy(sender_obj * obj);
+
+    /** Queue a message. Only waits when the overflow policy is 'b' and the queue is full.
+        \param      obj             Object used.
+        \param      bytes           Message.
+        \param      nBytes          Size of the message.
+    */
+    void sender_push(sender_obj * obj, const char * bytes, const unsigned int nBytes);
+
+    /** Move the oldest message to obj->message (helper thread, with the mutex locked).
+        \param      obj             Object used.
+    */
+    void sender_pop(sender_obj * obj);
+
+    /** Drop the oldest message (with the mutex locked).
+        \param      obj             Object used.
+    */
+    void sender_drop(sender_obj * obj);
+
+    /** Copy bytes to the end of the ring (with the mutex locked).
+        \param      obj             Object used.
+        \param      bytes           Bytes to copy.
+        \param      nBytes          Number of bytes.
+    */
+    void sender_ring_write(sender_obj * obj, const char * bytes, const unsigned int nBytes);
+
+    /** Copy bytes from the beginning of the ring and release them (with the mutex locked).
+        \param      obj             Object used.
+        \param      bytes           Destination, or NULL to discard the bytes.
+        \param      nBytes          Number of bytes.
+    */
+    void sender_ring_read(sender_obj * obj, char * bytes, const unsigned int nBytes);
+
+    /** Open a non-blocking connection to the server.
+        \param      obj             Object used.
+        \return                     0 once connected, -1 otherwise.
+    */
+    int sender_connect(sender_obj * obj);
+
+    /** Write obj->message to the socket, waiting for room without blocking the pipeline.
+        \param      obj             Object used.
+        \return                     0 if sent, -1 if the connection failed (or stalled during a stop).
+    */
+    int sender_send(sender_obj * obj);
+
+    /** Loop executed by the helper thread.
+        \param      ptr             Pointer to the sender_obj.
+        \return                     NULL.
+    */
+    void * sender_thread(void * ptr);
+
+    /** Copy the counters.
+        \param      obj             Object used.
+        \param      stats           Destination.
+    */
+    void sender_stats(sender_obj * obj, sender_stats_obj * stats);
+
+    /** Print the counters every sender_reportPeriod seconds, when messages were dropped, the
+        connection was reestablished or the high-water mark rose since the last report (helper thread).
+        \param      obj             Object used.
+    */
+    void sender_report(sender_obj * obj);
+
+    /** Print the counters.
+        \param      obj             Object used.
+    */
+    void sender_printf(sender_obj * obj);
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef __ODAS_GENERAL_SHM
+#define __ODAS_GENERAL_SHM
+
+   /**
+    * \file     shm.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    // Shared-memory ring ("shm" interface) between one sink and any number of readers on the
+    // same host. The segment (/dev/shm/<name>) holds a shm_header followed by capacity bytes
+    // of records. A record is a shm_record followed by size bytes of message, padded to 16
+    // bytes. A record with size shm_padding fills the end of the ring, and the next one
+    // starts at offset 0.
+    //
+    // Positions (head, tail, cursors) count bytes since the creation of the ring and never
+    // wrap; the offset of a position in the ring is position % capacity. The writer never
+    // waits: before overwriting old records it moves tail past them, and only then writes.
+    // A reader holding a record at position p knows the bytes were intact if tail <= p once
+    // it is done with them (shm_reader_check), so messages are read in place without copies.
+    //
+    // sequence counts published messages and is used as a futex: readers sleep on it
+    // (FUTEX_WAIT) and the writer wakes them up after each message.
+
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <stdint.h>
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <time.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/syscall.h>
+    #include <linux/futex.h>
+
+    #include "interface.h"
+
+    typedef enum shm_constant {
+
+        shm_magic = 0x5253444F,
+        shm_version = 1,
+        shm_padding = 0xFFFFFFFF,
+
+    } shm_constant;
+
+    //! Header of the segment (64 bytes, the records start right after).
+    typedef struct shm_header {
+
+        uint32_t magic;                         ///< shm_magic, written last once the segment is ready.
+        uint16_t version;                       ///< shm_version.
+        uint16_t closed;                        ///< Set to 1 when the writer goes away.
+        uint64_t capacity;                      ///< Size of the ring, in bytes (multiple of 16).
+        uint64_t head;                          ///< Position right after the last published record.
+        uint64_t tail;                          ///< Position of the oldest record still intact.
+        uint32_t sequence;                      ///< Number of published messages (futex word).
+        uint32_t reserved[7];                   ///< Padding.
+
+    } shm_header;
+
+    //! Header of a record (16 bytes).
+    typedef struct shm_record {
+
+        uint32_t size;                          ///< Size of the message, or shm_padding.
+        uint32_t sequence;                      ///< Sequence number of the message.
+        uint64_t timeStamp;                     ///< Time stamp of the frame the message belongs to.
+
+    } shm_record;
+
+    //! Writer side (used by the sinks).
+    typedef struct shm_writer_obj {
+
+        char * name;                            ///< Name of the segment.
+        shm_header * header;                    ///< Mapped segment.
+        char * records;                         ///< Start of the ring.
+        unsigned long long mapSize;             ///< Size of the mapping.
+
+        unsigned long long nMessages;           ///< Messages published.
+        unsigned long long nMessagesDropped;    ///< Messages larger than half the ring.
+
+    } shm_writer_obj;
+
+    //! Reader side (one per consumer, each with its own cursor).
+    typedef struct shm_reader_obj {
+
+        char * name;                            ///< Name of the segment.
+        const shm_header * header;              ///< Mapped segment.
+        const char * records;                   ///< Start of the ring.
+        unsigned long long mapSize;             ///< Size of the mapping.
+
+        unsigned long long cursor;              ///< Position of the next record to read.
+        unsigned long long position;            ///< Position of the record last returned.
+
+        unsigned int size;                      ///< Size of the message last returned.
+        unsigned int sequence;                  ///< Sequence number of the message last returned.
+        unsigned long long timeStamp;           ///< Time stamp of the message last returned.
+
+        unsigned long long nOverruns;           ///< Times the writer got ahead by a full ring.
+        unsigned long long nMessagesLost;       ///< Messages skipped because of these overruns.
+
+    } shm_reader_obj;
+
+    /** Create the segment, replacing any previous one with the same name.
+        \param      name            Name of the segment (e.g. "/odas_tracks").
+        \param      capacity        Size of the ring, in bytes.
+        \return                     Pointer to the instantiated object.
+    */
+    shm_writer_obj * shm_writer_construct(const char * name, const unsigned int capacity);
+
+    /** Mark the segment as closed, wake up the readers and remove the name.
+        \param      obj             Object to be destroyed.
+    */
+    void shm_writer_destroy(shm_writer_obj * obj);
+
+    /** Publish a message. Never waits: the oldest records are overwritten if needed.
+        \param      obj             Object used.
+        \param      timeStamp       Time stamp of the frame.
+        \param      bytes           Message.
+        \param      nBytes          Size of the message.
+    */
+    void shm_writer_publish(shm_writer_obj * obj, const unsigned long long timeStamp, const char * bytes, const unsigned int nBytes);
+
+    /** Attach to an existing segment. The first message read is the next one published.
+        \param      name            Name of the segment.
+        \return                     Pointer to the instantiated object, or NULL if there is no such segment (yet).
+    */
+    shm_reader_obj * shm_reader_construct(const char * name);
+
+    /** Detach from the segment.
+        \param      obj             Object to be destroyed.
+    */
+    void shm_reader_destroy(shm_reader_obj * obj);
+
+    /** Get the next message, in place. Size, sequence number and time stamp are stored in obj.
+        \param      obj             Object used.
+        \param      timeout         Maximum time to wait, in milliseconds (-1 to wait forever).
+        \return                     Pointer to the message, or NULL on timeout or once the writer is gone.
+    */
+    const char * shm_reader_next(shm_reader_obj * obj, const int timeout);
+
+    /** Tell whether the message last returned was still intact (call once done with it).
+        \param      obj             Object used.
+        \return                     1 if intact, 0 if the writer overwrote it meanwhile.
+    */
+    int shm_reader_check(const shm_reader_obj * obj);
+
+    /** Tell whether the writer closed the segment (attach again to follow a new writer).
+        \param      obj             Object used.
+        \return                     1 if closed, 0 otherwise.
+    */
+    int shm_reader_closed(const shm_reader_obj * obj);
+
+#endif
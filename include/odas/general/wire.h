@@ -0,0 +1,132 @@
+#ifndef __ODAS_GENERAL_WIRE
+#define __ODAS_GENERAL_WIRE
+
+   /**
+    * \file     wire.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    // Binary wire format ("wire" in the configuration) of the pots, tracks and categories sinks.
+    // This header has no other dependency, so consumers can copy it as is.
+    //
+    // A message is a wire_header followed by count records of recordSize bytes. All fields are
+    // little-endian, and every record is aligned on its natural boundary when the message starts
+    // on an 8-byte boundary, so a message is decoded with casts only:
+    //
+    //     const wire_header * header = (const wire_header *) bytes;
+    //     const wire_track * tracks = (const wire_track *) &(bytes[sizeof(wire_header)]);
+    //
+    // Readers should check magic and version, and step through records with recordSize:
+    // a later version may append fields to a record, but never moves the existing ones.
+    //
+    // Tracks refer to their tag by index. Index 0 is the empty tag and index 1 is "dynamic".
+    // Every tracks message that uses other tags comes right after a wire_type_tags message
+    // naming all of them, in the same write (or datagram message, or shm slot). A reader can
+    // thus start anywhere and survive lost messages. The name of an index may change, but
+    // only in a tags message.
+    //
+    // With the udp interface, every message of any sink (wire, json or audio) is cut in one or more
+    // datagrams, each one starting with a wire_datagram. The sequence number grows by one per
+    // message, so a gap means a lost message. A message is complete once nFragments datagrams
+    // with the same sequence number are received, each one holding the bytes at offset to
+    // offset + (datagram size - sizeof(wire_datagram)). Audio fragments always hold whole
+    // samples for all channels, so they can be played even if a sibling is lost.
+
+    #include <stdint.h>
+
+    typedef enum wire_constant {
+
+        wire_magic = 0x5341444F,
+        wire_magic_datagram = 0x4741444F,
+        wire_version = 1,
+
+    } wire_constant;
+
+    typedef enum wire_type {
+
+        wire_type_pots = 1,
+        wire_type_tracks = 2,
+        wire_type_categories = 3,
+        wire_type_tags = 4,
+
+    } wire_type;
+
+    typedef struct wire_header {
+
+        uint32_t magic;
+        uint16_t version;
+        uint16_t type;
+        uint64_t timeStamp;
+        uint32_t count;
+        uint32_t recordSize;
+
+    } wire_header;
+
+    typedef struct wire_datagram {
+
+        uint32_t magic;
+        uint16_t version;
+        uint16_t nFragments;
+        uint32_t sequence;
+        uint16_t fragment;
+        uint16_t reserved;
+        uint64_t timeStamp;
+        uint32_t offset;
+        uint32_t size;
+
+    } wire_datagram;
+
+    typedef struct wire_pot {
+
+        float x;
+        float y;
+        float z;
+        float E;
+
+    } wire_pot;
+
+    typedef struct wire_track {
+
+        uint64_t id;
+        uint32_t tag;
+        float x;
+        float y;
+        float z;
+        float activity;
+        uint32_t reserved;
+
+    } wire_track;
+
+    typedef struct wire_category {
+
+        int8_t category;
+        uint8_t reserved[3];
+
+    } wire_category;
+
+    typedef struct wire_tag {
+
+        uint32_t index;
+        uint32_t reserved;
+        char name[256];
+
+    } wire_tag;
+
+#endif
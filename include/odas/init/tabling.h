@@ -0,0 +1,56 @@
+#ifndef __ODAS_INIT_TABLING
+#define __ODAS_INIT_TABLING
+
+   /**
+    * \file     tabling.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+
+    #include <general/mic.h>
+
+    #include <init/directivity.h>
+
+    #include <signal/beampattern.h>
+    #include <signal/demixing.h>
+    #include <signal/demixtable.h>
+    #include <signal/gain.h>
+    #include <signal/mask.h>
+    #include <signal/point.h>
+    #include <signal/steer.h>
+    #include <signal/track.h>
+
+    #include <system/gain2mask.h>
+    #include <system/steer2demixing.h>
+    #include <system/track2gain.h>
+    #include <system/track2steer.h>
+
+    unsigned long long tabling_hash(const unsigned long long hash, const void * data, const size_t size);
+
+    unsigned long long tabling_key_ds(const mics_obj * mics, const points_obj * points, const unsigned int nThetas, const float c, const unsigned int fS, const unsigned int halfFrameSize, const float gainMin, const float epsilon);
+
+    demixtable_obj * tabling_demixtable_ds(const mics_obj * mics, const points_obj * points, const unsigned int nThetas, const float c, const unsigned int fS, const unsigned int halfFrameSize, const float gainMin, const float epsilon);
+
+    demixtable_obj * tabling_demixtable_ds_file(const char * fileName, const mics_obj * mics, const points_obj * points, const unsigned int nThetas, const float c, const unsigned int fS, const unsigned int halfFrameSize, const float gainMin, const float epsilon);
+
+#endif
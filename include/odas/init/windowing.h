@@ -31,6 +31,8 @@
 
     window_obj * windowing_roothann(const unsigned int frameSize);
 
+    window_obj * windowing_kaiser(const unsigned int frameSize, const float beta);
+
 #endif
 
     
\ No newline at end of file
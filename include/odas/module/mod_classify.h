@@ -25,6 +25,7 @@
 
     #include <stdlib.h>
     #include <stdio.h>
+    #include <math.h>
 
     #include <message/msg_hops.h>
     #include <message/msg_tracks.h>
@@ -40,17 +41,24 @@
     #include <system/acorr2pitch.h>
     #include <system/frame2freq.h>
     #include <system/freq2acorr.h>
+    #include <system/hop2acorr.h>
     #include <system/hop2frame.h>
     #include <system/pitch2category.h>
 
     typedef struct mod_classify_obj {
 
-        frames_obj * frames;
+        char mode;
+
+        unsigned int binMin;
+        unsigned int binMax;
+        float scale;
+
         freqs_obj * freqs;
         acorrs_obj * acorrs;
         pitches_obj * pitches;
 
         hop2frame_obj * hop2frame;
+        hop2acorr_obj * hop2acorr;
         frame2freq_obj * frame2freq;
         freq2acorr_obj * freq2acorr;
         acorr2pitch_obj * acorr2pitch;
@@ -66,8 +74,11 @@
 
     typedef struct mod_classify_cfg {
 
+        char mode;
+
         unsigned int frameSize;
         unsigned int winSize;
+        unsigned int decimation;
 
         float tauMin;
         float tauMax;
@@ -60,9 +60,9 @@
         unsigned int lowPassCut;
 
         hop2hop_buffer_obj * hop2hop;
+        hop2hop_polyphase_obj * hop2hop_polyphase;
 
         hop2frame_obj * hop2frame;
-        frames_obj * framesAnalysis; 
         frame2freq_obj * frame2freq;
         freqs_obj * freqsAnalysis;
         freq2freq_lowpass_obj * freq2freq_lowpass;
@@ -84,6 +84,9 @@
         unsigned int fSin;
         unsigned int fSout;
 
+        char mode;
+        unsigned int nTaps;
+
     } mod_resample_cfg;
 
     mod_resample_obj * mod_resample_construct(const mod_resample_cfg * mod_resample_config, const msg_hops_cfg * msg_hops_in_config, const msg_hops_cfg * msg_hops_out_config);
@@ -106,6 +109,10 @@
 
     int mod_resample_process_pop_same(mod_resample_obj * obj);    
 
+    int mod_resample_process_push_polyphase(mod_resample_obj * obj);
+
+    int mod_resample_process_pop_polyphase(mod_resample_obj * obj);
+
     void mod_resample_connect(mod_resample_obj * obj, msg_hops_obj * in, msg_hops_obj * out);
 
     void mod_resample_disconnect(mod_resample_obj * obj);
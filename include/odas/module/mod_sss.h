@@ -24,10 +24,13 @@
     */
 
     #include "../general/mic.h"
+    #include "../general/pool.h"
     #include "../general/samplerate.h"
     #include "../general/soundspeed.h"
 
     #include "../init/directivity.h"
+    #include "../init/space.h"
+    #include "../init/tabling.h"
 
     #include "../message/msg_powers.h"
     #include "../message/msg_spectra.h"
@@ -37,6 +40,7 @@
     #include "../signal/steer.h"
     #include "../signal/gain.h"
     #include "../signal/demixing.h"
+    #include "../signal/demixtable.h"
     #include "../signal/env.h"
 
     #include "../system/demixing2env.h"
@@ -48,6 +52,7 @@
     #include "../system/track2steer.h"
     #include "../system/track2gain.h"
     #include "../system/steer2demixing.h"
+    #include "../system/track2demixing.h"
 
     #include <stdlib.h>
     #include <string.h>
@@ -61,6 +66,10 @@
         char mode_sep;
         char mode_pf;
 
+        unsigned int nThreads;
+        pool_obj * pool;
+        unsigned int * binStarts;
+
         beampatterns_obj * sep_ds_beampatterns_mics;
         steers_obj * sep_ds_steers;
         gains_obj * sep_ds_gains;
@@ -74,6 +83,8 @@
         demixings_obj * sep_ds_demixingsPrev;
         demixings_obj * sep_ds_demixingsNow;
         demixing2freq_obj * sep_ds_demixing2freq;
+        demixtable_obj * sep_ds_demixtable;
+        track2demixing_obj * sep_ds_track2demixing;
 
         beampatterns_obj * sep_gss_beampatterns_mics;
         steers_obj * sep_gss_steers;
@@ -84,7 +95,7 @@
         track2gain_obj * sep_gss_track2gain;
         gain2mask_obj * sep_gss_gain2mask;
         track2steer_obj * sep_gss_track2steer;
-        steer2demixing_gss_obj * sep_gss_steer2demixing;
+        steer2demixing_gss_obj ** sep_gss_steer2demixing;
         demixings_obj * sep_gss_demixingsPrev;
         demixings_obj * sep_gss_demixingsNow;
         demixing2freq_obj * sep_gss_demixing2freq;
@@ -135,6 +146,8 @@
         char mode_sep;
         char mode_pf;
 
+        unsigned int nThreads;
+
         unsigned int nThetas;
         float gainMin;
 
@@ -144,6 +157,12 @@
         samplerate_obj * samplerate;
         soundspeed_obj * soundspeed;
 
+        float sep_tolerance;
+
+        char * sep_ds_tableFile;
+        unsigned int sep_ds_tableLevel;
+        char sep_ds_tableShape;
+
         float sep_gss_lambda;
         float sep_gss_mu;
 
@@ -163,10 +182,12 @@
         unsigned int pf_ms_winSizeLocal;
         unsigned int pf_ms_winSizeGlobal;
         unsigned int pf_ms_winSizeFrame;
+        char pf_ms_math;
 
         float pf_ss_Gmin;
         float pf_ss_Gmid;
         float pf_ss_Gslope;
+        char pf_ss_math;
 
     } mod_sss_cfg;
 
@@ -178,12 +199,28 @@
 
     int mod_sss_process_dds(mod_sss_obj * obj);
 
+    void mod_sss_process_dds_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker);
+
+    void mod_sss_process_dds_table_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker);
+
     int mod_sss_process_dgss(mod_sss_obj * obj);
 
+    void mod_sss_process_dgss_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker);
+
     int mod_sss_process_sspf(mod_sss_obj * obj);
 
+    void mod_sss_process_sspf_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker);
+
     int mod_sss_process_mspf(mod_sss_obj * obj);
 
+    void mod_sss_process_mspf_envs_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker);
+
+    void mod_sss_process_mspf_gains_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker);
+
+    void mod_sss_process_mspf_probspeech_seps(void * ptr, const unsigned int iTask, const unsigned int iWorker);
+
+    void mod_sss_process_mspf_apply_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker);
+
     void mod_sss_connect(mod_sss_obj * obj, msg_spectra_obj * in1, msg_powers_obj * in2, msg_tracks_obj * in3, msg_spectra_obj * out1, msg_spectra_obj * out2);
 
     void mod_sss_disconnect(mod_sss_obj * obj);
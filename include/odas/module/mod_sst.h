@@ -29,6 +29,7 @@
     #include <math.h>
 
     #include "../general/mic.h"
+    #include "../general/pool.h"
 
     #include "../signal/coherence.h"
     #include "../signal/kalman.h"
@@ -67,21 +68,26 @@
         
         char * type;
 
+        unsigned int nThreads;
+        pool_obj * pool;
+        unsigned int * iTracksMax;
+        float * estimates;
+
         kalman_obj ** kalmans;
-        kalman2kalman_obj * kalman2kalman_prob;
-        kalman2kalman_obj * kalman2kalman_active;
-        kalman2kalman_obj * kalman2kalman_target;
-        kalman2coherence_obj * kalman2coherence_prob;
-        kalman2coherence_obj * kalman2coherence_active;
-        kalman2coherence_obj * kalman2coherence_target;
+        kalman2kalman_obj ** kalman2kalman_prob;
+        kalman2kalman_obj ** kalman2kalman_active;
+        kalman2kalman_obj ** kalman2kalman_target;
+        kalman2coherence_obj ** kalman2coherence_prob;
+        kalman2coherence_obj ** kalman2coherence_active;
+        kalman2coherence_obj ** kalman2coherence_target;
         
         particles_obj ** particles;
-        particle2particle_obj * particle2particle_prob;
-        particle2particle_obj * particle2particle_active;
-        particle2particle_obj * particle2particle_target;
-        particle2coherence_obj * particle2coherence_prob;
-        particle2coherence_obj * particle2coherence_active;
-        particle2coherence_obj * particle2coherence_target;
+        particle2particle_obj ** particle2particle_prob;
+        particle2particle_obj ** particle2particle_active;
+        particle2particle_obj ** particle2particle_target;
+        particle2coherence_obj ** particle2coherence_prob;
+        particle2coherence_obj ** particle2coherence_active;
+        particle2coherence_obj ** particle2coherence_target;
 
         mixture2mixture_obj * mixture2mixture;
         
@@ -114,6 +120,7 @@
 
         unsigned int nTracksMax;
         unsigned int hopSize;
+        unsigned int nThreads;
         
         float sigmaQ;
         
@@ -153,6 +160,10 @@
 
     int mod_sst_process(mod_sst_obj * obj);
 
+    void mod_sst_process_predict(void * ptr, const unsigned int iTrack, const unsigned int iWorker);
+
+    void mod_sst_process_update(void * ptr, const unsigned int iTrack, const unsigned int iWorker);
+
     void mod_sst_connect(mod_sst_obj * obj, msg_pots_obj * in1, msg_targets_obj * in2, msg_tracks_obj * out);
 
     void mod_sst_disconnect(mod_sst_obj * obj);
@@ -32,7 +32,6 @@
     typedef struct mod_stft_obj {
 
         hop2frame_obj * hop2frame;
-        frames_obj * frames;
         frame2freq_obj * frame2freq;
 
         msg_hops_obj * in;
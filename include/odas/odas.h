@@ -29,12 +29,14 @@ extern "C" {
     #include <module/mod_sss.h>
     #include <module/mod_stft.h>
     #include <module/mod_volume.h>
+    #include <sink/snk_backend.h>
     #include <sink/snk_categories.h>
     #include <sink/snk_hops.h>
     #include <sink/snk_pots.h>
     #include <sink/snk_powers.h>
     #include <sink/snk_spectra.h>
     #include <sink/snk_tracks.h>
+    #include <source/src_frontend.h>
     #include <source/src_hops.h>
     #include <aconnector/acon_categories.h>
     #include <aconnector/acon_hops.h>
@@ -61,12 +63,14 @@ extern "C" {
     #include <amodule/amod_sss.h>
     #include <amodule/amod_stft.h>
     #include <amodule/amod_volume.h>
+    #include <asink/asnk_backend.h>
     #include <asink/asnk_categories.h>
     #include <asink/asnk_hops.h>
     #include <asink/asnk_pots.h>
     #include <asink/asnk_powers.h>
     #include <asink/asnk_spectra.h>
     #include <asink/asnk_tracks.h>
+    #include <asource/asrc_frontend.h>
     #include <asource/asrc_hops.h>
 
 #ifdef __cplusplus
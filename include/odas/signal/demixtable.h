@@ -0,0 +1,85 @@
+#ifndef __ODAS_SIGNAL_DEMIXTABLE
+#define __ODAS_SIGNAL_DEMIXTABLE
+
+   /**
+    * \file     demixtable.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdlib.h>
+    #include <string.h>
+    #include <stdio.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+
+    #define DEMIXTABLE_MAGIC        "ODASDMX1"
+
+    // Bumped whenever the layout or the way the weights are computed changes,
+    // so that tables written by an older build are rejected and rebuilt.
+    #define DEMIXTABLE_VERSION      2
+
+    // The table is stored as one block (header, points, masks, demixings), 
+    // in memory as well as on disk, so that a file can be mapped as is.
+
+    typedef struct demixtable_header {
+
+        char magic[8];
+        unsigned long long key;
+        unsigned int nPoints;
+        unsigned int nChannels;
+        unsigned int halfFrameSize;
+        unsigned int version;
+
+    } demixtable_header;
+
+    typedef struct demixtable_obj {
+
+        unsigned int nPoints;
+        unsigned int nChannels;
+        unsigned int halfFrameSize;
+        unsigned long long key;
+
+        float * points;
+        char * masks;
+        float * array;
+
+        char * block;
+        size_t blockSize;
+        char mapped;
+
+    } demixtable_obj;
+
+    demixtable_obj * demixtable_construct_zero(const unsigned int nPoints, const unsigned int nChannels, const unsigned int halfFrameSize, const unsigned long long key);
+
+    demixtable_obj * demixtable_construct_file(const char * fileName, const unsigned int nPoints, const unsigned int nChannels, const unsigned int halfFrameSize, const unsigned long long key);
+
+    void demixtable_destroy(demixtable_obj * obj);
+
+    size_t demixtable_size(const unsigned int nPoints, const unsigned int nChannels, const unsigned int halfFrameSize);
+
+    void demixtable_layout(demixtable_obj * obj);
+
+    int demixtable_save(const demixtable_obj * obj, const char * fileName);
+
+    void demixtable_printf(const demixtable_obj * obj);
+
+#endif
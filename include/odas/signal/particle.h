@@ -32,6 +32,7 @@
         unsigned int nParticles;
         float * array;
         unsigned char * state;
+        unsigned int seed;
 
     } particles_obj;
 
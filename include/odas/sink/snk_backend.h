@@ -0,0 +1,107 @@
+#ifndef __ODAS_SINK_BACKEND
+#define __ODAS_SINK_BACKEND
+
+   /**
+    * \file     snk_backend.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <math.h>
+
+    #include "../general/format.h"
+    #include "../general/interface.h"
+    #include "../message/msg_hops.h"
+    #include "../message/msg_spectra.h"
+    #include "../signal/hop.h"
+    #include "../signal/frame.h"
+    #include "../sink/snk_hops.h"
+    #include "../system/freq2frame.h"
+    #include "../system/frame2hop.h"
+    #include "../system/hop2hop.h"
+
+    typedef struct snk_backend_obj {
+
+        unsigned long long timeStamp;
+
+        unsigned int hopSizeIn;
+        unsigned int hopSizeOut;
+        unsigned int nChannels;
+        unsigned int fSin;
+        unsigned int fSout;
+        unsigned int frameSize;
+        unsigned int halfFrameSize;
+
+        char type;
+        char nHops;
+
+        float gain;
+        unsigned int nBytes;
+
+        freq2frame_obj * freq2frame;
+        frames_obj * frames;
+        frame2hop_obj * frame2hop;
+        hops_obj * hopsIn;
+
+        hop2hop_buffer_obj * hop2hop_buffer;
+        hop2hop_polyphase_obj * hop2hop_polyphase;
+        hops_obj * hopsOut;
+
+        snk_hops_obj * snk_hops;
+
+        msg_spectra_obj * in;
+
+    } snk_backend_obj;
+
+    typedef struct snk_backend_cfg {
+
+        unsigned int fS;
+        format_obj * format;
+        interface_obj * interface;
+        float gain;
+        unsigned int nTaps;
+
+    } snk_backend_cfg;
+
+    snk_backend_obj * snk_backend_construct(const snk_backend_cfg * snk_backend_config, const msg_spectra_cfg * msg_spectra_config, const msg_hops_cfg * msg_hops_in_config, const msg_hops_cfg * msg_hops_out_config);
+
+    void snk_backend_destroy(snk_backend_obj * obj);
+
+    void snk_backend_connect(snk_backend_obj * obj, msg_spectra_obj * in);
+
+    void snk_backend_disconnect(snk_backend_obj * obj);
+
+    void snk_backend_open(snk_backend_obj * obj);
+
+    void snk_backend_close(snk_backend_obj * obj);
+
+    int snk_backend_process(snk_backend_obj * obj);
+
+    void snk_backend_process_encode(snk_backend_obj * obj, const hops_obj * hops);
+
+    void snk_backend_process_write(snk_backend_obj * obj);
+
+    snk_backend_cfg * snk_backend_cfg_construct(void);
+
+    void snk_backend_cfg_destroy(snk_backend_cfg * snk_backend_config);
+
+#endif
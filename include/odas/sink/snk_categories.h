@@ -31,10 +31,15 @@
     #include <netinet/in.h>
     #include <arpa/inet.h>
 
+    #include "../general/datagram.h"
     #include "../general/format.h"
     #include "../general/interface.h"
+    #include "../general/sender.h"
+    #include "../general/shm.h"
+    #include "../general/wire.h"
     #include "../message/msg_categories.h"
     #include "../utils/pcm.h"
+    #include "../utils/json.h"
 
     typedef struct snk_categories_obj {
 
@@ -48,11 +53,13 @@
 
         char * buffer;
         unsigned int bufferSize;
+        unsigned int bufferCapacity;
 
         FILE * fp;
 
-        struct sockaddr_in sserver;
-        int sid;
+        sender_obj * sender;
+        datagram_obj * datagram;
+        shm_writer_obj * shm;
 
         msg_categories_obj * in;
 
@@ -82,6 +89,10 @@
 
     void snk_categories_open_interface_socket(snk_categories_obj * obj);
 
+    void snk_categories_open_interface_udp(snk_categories_obj * obj);
+
+    void snk_categories_open_interface_shm(snk_categories_obj * obj);
+
     void snk_categories_open_interface_terminal(snk_categories_obj * obj);
 
     void snk_categories_close(snk_categories_obj * obj);
@@ -92,6 +103,10 @@
 
     void snk_categories_close_interface_socket(snk_categories_obj * obj);
 
+    void snk_categories_close_interface_udp(snk_categories_obj * obj);
+
+    void snk_categories_close_interface_shm(snk_categories_obj * obj);
+
     void snk_categories_close_interface_terminal(snk_categories_obj * obj);
 
     int snk_categories_process(snk_categories_obj * obj);
@@ -102,10 +117,16 @@
 
     void snk_categories_process_interface_socket(snk_categories_obj * obj);
 
+    void snk_categories_process_interface_udp(snk_categories_obj * obj);
+
+    void snk_categories_process_interface_shm(snk_categories_obj * obj);
+
     void snk_categories_process_interface_terminal(snk_categories_obj * obj);
 
     void snk_categories_process_format_text_json(snk_categories_obj * obj);
 
+    void snk_categories_process_format_binary_wire(snk_categories_obj * obj);
+
     void snk_categories_process_format_undefined(snk_categories_obj * obj);
 
     snk_categories_cfg * snk_categories_cfg_construct(void);
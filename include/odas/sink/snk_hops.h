@@ -26,14 +26,20 @@
     #include <stdlib.h>
     #include <stdio.h>
     #include <string.h>
+    #include <time.h>
     #include <unistd.h>
     #include <sys/socket.h>
     #include <netinet/in.h>
     #include <arpa/inet.h>
 
+    #include "../general/datagram.h"
     #include "../general/format.h"
     #include "../general/interface.h"
+    #include "../general/recorder.h"
+    #include "../general/sender.h"
+    #include "../general/shm.h"
     #include "../message/msg_hops.h"
+    #include "../utils/lossless.h"
     #include "../utils/pcm.h"
 
     typedef struct snk_hops_obj {
@@ -50,12 +56,23 @@
         char * buffer;
         unsigned int bufferSize;
 
+        char * batch;
+        unsigned int batchSize;
+        unsigned int nHopsBatch;
+        unsigned int iHopBatch;
+        unsigned long long batchTimeStamp;
+        unsigned long long batchStart;
+        unsigned long long batchLatency;
+        unsigned long long hopDuration;
+
         FILE * fp;
 
-        struct sockaddr_in sserver;
-        int sid;
+        sender_obj * sender;
+        datagram_obj * datagram;
+        shm_writer_obj * shm;
+        recorder_obj * recorder;
 
-        char bytes[4];
+        lossless_obj * lossless;
 
         msg_hops_obj * in;
 
@@ -85,6 +102,12 @@
 
     void snk_hops_open_interface_socket(snk_hops_obj * obj);
 
+    void snk_hops_open_interface_udp(snk_hops_obj * obj);
+
+    void snk_hops_open_interface_shm(snk_hops_obj * obj);
+
+    void snk_hops_open_interface_wav(snk_hops_obj * obj);
+
     void snk_hops_close(snk_hops_obj * obj);
 
     void snk_hops_close_interface_blackhole(snk_hops_obj * obj);
@@ -93,6 +116,12 @@
 
     void snk_hops_close_interface_socket(snk_hops_obj * obj);
 
+    void snk_hops_close_interface_udp(snk_hops_obj * obj);
+
+    void snk_hops_close_interface_shm(snk_hops_obj * obj);
+
+    void snk_hops_close_interface_wav(snk_hops_obj * obj);
+
     int snk_hops_process(snk_hops_obj * obj);
 
     void snk_hops_process_interface_blackhole(snk_hops_obj * obj);
@@ -101,6 +130,26 @@
 
     void snk_hops_process_interface_socket(snk_hops_obj * obj);
 
+    void snk_hops_process_interface_udp(snk_hops_obj * obj);
+
+    void snk_hops_process_interface_shm(snk_hops_obj * obj);
+
+    void snk_hops_process_interface_wav(snk_hops_obj * obj);
+
+    char snk_hops_process_batch(snk_hops_obj * obj);
+
+    void snk_hops_flush(snk_hops_obj * obj);
+
+    void snk_hops_flush_interface_file(snk_hops_obj * obj);
+
+    void snk_hops_flush_interface_socket(snk_hops_obj * obj);
+
+    void snk_hops_flush_interface_udp(snk_hops_obj * obj);
+
+    void snk_hops_flush_interface_shm(snk_hops_obj * obj);
+
+    void snk_hops_flush_interface_wav(snk_hops_obj * obj);
+
     void snk_hops_process_format_binary_int08(snk_hops_obj * obj);
 
     void snk_hops_process_format_binary_int16(snk_hops_obj * obj);
@@ -109,6 +158,12 @@
 
     void snk_hops_process_format_binary_int32(snk_hops_obj * obj);
 
+    void snk_hops_process_format_binary_float(snk_hops_obj * obj);
+
+    void snk_hops_process_format_lossless_int16(snk_hops_obj * obj);
+
+    void snk_hops_process_format_lossless_int24(snk_hops_obj * obj);
+
     void snk_hops_process_format_undefined(snk_hops_obj * obj);
 
     snk_hops_cfg * snk_hops_cfg_construct(void);
@@ -31,9 +31,14 @@
     #include <arpa/inet.h>
     #include <unistd.h>
 
+    #include "../general/datagram.h"
     #include "../general/format.h"
     #include "../general/interface.h"
+    #include "../general/sender.h"
+    #include "../general/shm.h"
+    #include "../general/wire.h"
     #include "../message/msg_pots.h"
+    #include "../utils/json.h"
 
     typedef struct snk_pots_obj {
 
@@ -47,11 +52,13 @@
 
         char * buffer;
         unsigned int bufferSize;
+        unsigned int bufferCapacity;
 
         FILE * fp;
 
-        struct sockaddr_in sserver;
-        int sid;
+        sender_obj * sender;
+        datagram_obj * datagram;
+        shm_writer_obj * shm;
 
         msg_pots_obj * in;
 
@@ -81,6 +88,10 @@
 
     void snk_pots_open_interface_socket(snk_pots_obj * obj);
 
+    void snk_pots_open_interface_udp(snk_pots_obj * obj);
+
+    void snk_pots_open_interface_shm(snk_pots_obj * obj);
+
     void snk_pots_open_interface_terminal(snk_pots_obj * obj);
 
     void snk_pots_close(snk_pots_obj * obj);
@@ -91,6 +102,10 @@
 
     void snk_pots_close_interface_socket(snk_pots_obj * obj);
 
+    void snk_pots_close_interface_udp(snk_pots_obj * obj);
+
+    void snk_pots_close_interface_shm(snk_pots_obj * obj);
+
     void snk_pots_close_interface_terminal(snk_pots_obj * obj);
 
     int snk_pots_process(snk_pots_obj * obj);
@@ -101,12 +116,18 @@
 
     void snk_pots_process_interface_socket(snk_pots_obj * obj);
 
+    void snk_pots_process_interface_udp(snk_pots_obj * obj);
+
+    void snk_pots_process_interface_shm(snk_pots_obj * obj);
+
     void snk_pots_process_interface_terminal(snk_pots_obj * obj);
 
     void snk_pots_process_format_binary_float(snk_pots_obj * obj);
 
     void snk_pots_process_format_text_json(snk_pots_obj * obj);
 
+    void snk_pots_process_format_binary_wire(snk_pots_obj * obj);
+
     void snk_pots_process_format_undefined(snk_pots_obj * obj);
 
     snk_pots_cfg * snk_pots_cfg_construct(void);
@@ -27,8 +27,12 @@
     #include <stdio.h>
     #include <string.h>
 
+    #include "../general/archive.h"
+    #include "../general/datagram.h"
     #include "../general/format.h"
     #include "../general/interface.h"
+    #include "../general/sender.h"
+    #include "../general/shm.h"
     #include "../message/msg_powers.h"
 
     typedef struct snk_powers_obj {
@@ -39,6 +43,11 @@
         unsigned int nChannels;
         unsigned int fS;
 
+        unsigned int binStep;
+        unsigned int nBins;
+        unsigned int nChannelsSelected;
+        unsigned int * channels;
+
         format_obj * format;
         interface_obj * interface;
 
@@ -47,6 +56,11 @@
 
         FILE * fp;
 
+        sender_obj * sender;
+        datagram_obj * datagram;
+        shm_writer_obj * shm;
+        archive_obj * archive;
+
         msg_powers_obj * in;
 
     } snk_powers_obj;
@@ -57,6 +71,10 @@
         format_obj * format;
         interface_obj * interface;
 
+        unsigned int binStep;
+        unsigned int nChannels;
+        unsigned int * channels;
+
     } snk_powers_cfg;
 
     snk_powers_obj * snk_powers_construct(const snk_powers_cfg * snk_powers_config, const msg_powers_cfg * msg_powers_config);
@@ -71,18 +89,50 @@
 
     void snk_powers_open_interface_blackhole(snk_powers_obj * obj);
 
+    void snk_powers_open_interface_file(snk_powers_obj * obj);
+
+    void snk_powers_open_interface_socket(snk_powers_obj * obj);
+
+    void snk_powers_open_interface_udp(snk_powers_obj * obj);
+
+    void snk_powers_open_interface_shm(snk_powers_obj * obj);
+
+    void snk_powers_open_interface_mmap(snk_powers_obj * obj);
+
     void snk_powers_close(snk_powers_obj * obj);
 
     void snk_powers_close_interface_blackhole(snk_powers_obj * obj);
 
+    void snk_powers_close_interface_file(snk_powers_obj * obj);
+
+    void snk_powers_close_interface_socket(snk_powers_obj * obj);
+
+    void snk_powers_close_interface_udp(snk_powers_obj * obj);
+
+    void snk_powers_close_interface_shm(snk_powers_obj * obj);
+
+    void snk_powers_close_interface_mmap(snk_powers_obj * obj);
+
     int snk_powers_process(snk_powers_obj * obj);
 
     void snk_powers_process_interface_blackhole(snk_powers_obj * obj);
 
+    void snk_powers_process_interface_file(snk_powers_obj * obj);
+
+    void snk_powers_process_interface_socket(snk_powers_obj * obj);
+
+    void snk_powers_process_interface_udp(snk_powers_obj * obj);
+
+    void snk_powers_process_interface_shm(snk_powers_obj * obj);
+
+    void snk_powers_process_interface_mmap(snk_powers_obj * obj);
+
+    void snk_powers_process_format_binary_float(snk_powers_obj * obj);
+
     void snk_powers_process_format_undefined(snk_powers_obj * obj);
 
     snk_powers_cfg * snk_powers_cfg_construct(void);
 
     void snk_powers_cfg_destroy(snk_powers_cfg * snk_powers_config);
 
-#endif
\ No newline at end of file
+#endif
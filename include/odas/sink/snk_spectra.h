@@ -27,8 +27,12 @@
     #include <stdio.h>
     #include <string.h>
 
+    #include "../general/archive.h"
+    #include "../general/datagram.h"
     #include "../general/format.h"
     #include "../general/interface.h"
+    #include "../general/sender.h"
+    #include "../general/shm.h"
     #include "../message/msg_spectra.h"
 
     typedef struct snk_spectra_obj {
@@ -39,11 +43,24 @@
         unsigned int nChannels;
         unsigned int fS;
 
+        unsigned int binStep;
+        unsigned int nBins;
+        unsigned int nChannelsSelected;
+        unsigned int * channels;
+
         format_obj * format;
         interface_obj * interface;
 
+        char * buffer;
+        unsigned int bufferSize;
+
         FILE * fp;
 
+        sender_obj * sender;
+        datagram_obj * datagram;
+        shm_writer_obj * shm;
+        archive_obj * archive;
+
         msg_spectra_obj * in;
 
     } snk_spectra_obj;
@@ -54,6 +71,10 @@
         format_obj * format;
         interface_obj * interface;
 
+        unsigned int binStep;
+        unsigned int nChannels;
+        unsigned int * channels;
+
     } snk_spectra_cfg;
 
     snk_spectra_obj * snk_spectra_construct(const snk_spectra_cfg * snk_spectra_config, const msg_spectra_cfg * msg_spectra_config);
@@ -68,18 +89,50 @@
 
     void snk_spectra_open_interface_blackhole(snk_spectra_obj * obj);
 
+    void snk_spectra_open_interface_file(snk_spectra_obj * obj);
+
+    void snk_spectra_open_interface_socket(snk_spectra_obj * obj);
+
+    void snk_spectra_open_interface_udp(snk_spectra_obj * obj);
+
+    void snk_spectra_open_interface_shm(snk_spectra_obj * obj);
+
+    void snk_spectra_open_interface_mmap(snk_spectra_obj * obj);
+
     void snk_spectra_close(snk_spectra_obj * obj);
 
     void snk_spectra_close_interface_blackhole(snk_spectra_obj * obj);
 
+    void snk_spectra_close_interface_file(snk_spectra_obj * obj);
+
+    void snk_spectra_close_interface_socket(snk_spectra_obj * obj);
+
+    void snk_spectra_close_interface_udp(snk_spectra_obj * obj);
+
+    void snk_spectra_close_interface_shm(snk_spectra_obj * obj);
+
+    void snk_spectra_close_interface_mmap(snk_spectra_obj * obj);
+
     int snk_spectra_process(snk_spectra_obj * obj);
 
     void snk_spectra_process_interface_blackhole(snk_spectra_obj * obj);
 
+    void snk_spectra_process_interface_file(snk_spectra_obj * obj);
+
+    void snk_spectra_process_interface_socket(snk_spectra_obj * obj);
+
+    void snk_spectra_process_interface_udp(snk_spectra_obj * obj);
+
+    void snk_spectra_process_interface_shm(snk_spectra_obj * obj);
+
+    void snk_spectra_process_interface_mmap(snk_spectra_obj * obj);
+
+    void snk_spectra_process_format_binary_float(snk_spectra_obj * obj);
+
     void snk_spectra_process_format_undefined(snk_spectra_obj * obj);
 
     snk_spectra_cfg * snk_spectra_cfg_construct(void);
 
     void snk_spectra_cfg_destroy(snk_spectra_cfg * snk_spectra_config);
 
-#endif
\ No newline at end of file
+#endif
@@ -31,9 +31,14 @@
     #include <arpa/inet.h>
     #include <unistd.h>
 
+    #include "../general/datagram.h"
     #include "../general/format.h"
     #include "../general/interface.h"
+    #include "../general/sender.h"
+    #include "../general/shm.h"
+    #include "../general/wire.h"
     #include "../message/msg_tracks.h"
+    #include "../utils/json.h"
 
     typedef struct snk_tracks_obj {
 
@@ -47,11 +52,18 @@
 
         char * buffer;
         unsigned int bufferSize;
+        unsigned int bufferCapacity;
+
+        char ** wireTags;
+        unsigned int nWireTags;
+        unsigned int nWireTagsMax;
+        unsigned int * wireTagIndexes;
 
         FILE * fp;
 
-        struct sockaddr_in sserver;
-        int sid;
+        sender_obj * sender;
+        datagram_obj * datagram;
+        shm_writer_obj * shm;
 
         msg_tracks_obj * in;
 
@@ -81,6 +93,10 @@
 
     void snk_tracks_open_interface_socket(snk_tracks_obj * obj);
 
+    void snk_tracks_open_interface_udp(snk_tracks_obj * obj);
+
+    void snk_tracks_open_interface_shm(snk_tracks_obj * obj);
+
     void snk_tracks_open_interface_terminal(snk_tracks_obj * obj);
 
     void snk_tracks_close(snk_tracks_obj * obj);
@@ -91,6 +107,10 @@
 
     void snk_tracks_close_interface_socket(snk_tracks_obj * obj);
 
+    void snk_tracks_close_interface_udp(snk_tracks_obj * obj);
+
+    void snk_tracks_close_interface_shm(snk_tracks_obj * obj);
+
     void snk_tracks_close_interface_terminal(snk_tracks_obj * obj);
 
     int snk_tracks_process(snk_tracks_obj * obj);
@@ -101,10 +121,16 @@
 
     void snk_tracks_process_interface_socket(snk_tracks_obj * obj);
 
+    void snk_tracks_process_interface_udp(snk_tracks_obj * obj);
+
+    void snk_tracks_process_interface_shm(snk_tracks_obj * obj);
+
     void snk_tracks_process_interface_terminal(snk_tracks_obj * obj);
 
     void snk_tracks_process_format_text_json(snk_tracks_obj * obj);
 
+    void snk_tracks_process_format_binary_wire(snk_tracks_obj * obj);
+
     void snk_tracks_process_format_undefined(snk_tracks_obj * obj);
 
     snk_tracks_cfg * snk_tracks_cfg_construct(void);
@@ -0,0 +1,115 @@
+#ifndef __ODAS_SOURCE_FRONTEND
+#define __ODAS_SOURCE_FRONTEND
+
+   /**
+    * \file     src_frontend.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+
+    #include "../general/format.h"
+    #include "../general/interface.h"
+    #include "../general/link.h"
+    #include "../message/msg_hops.h"
+    #include "../message/msg_spectra.h"
+    #include "../signal/hop.h"
+    #include "../signal/frame.h"
+    #include "../source/src_hops.h"
+    #include "../system/hop2hop.h"
+    #include "../system/hop2frame.h"
+    #include "../system/frame2freq.h"
+
+    typedef struct src_frontend_obj {
+
+        unsigned long long timeStamp;
+
+        unsigned int hopSizeIn;
+        unsigned int hopSizeOut;
+        unsigned int nChannelsIn;
+        unsigned int nChannels;
+        unsigned int fSin;
+        unsigned int fSout;
+        unsigned int frameSize;
+        unsigned int halfFrameSize;
+
+        char type;
+        char noMorePush;
+        char nHops;
+
+        unsigned long long nFramesSkipped;
+
+        src_hops_obj * src_hops;
+        links_obj * links;
+        unsigned int nBytes;
+        char isFloat;
+
+        hops_obj * hops;
+        hop2hop_buffer_obj * hop2hop_buffer;
+        hop2hop_polyphase_obj * hop2hop_polyphase;
+
+        hop2frame_obj * hop2frame;
+        frame2freq_obj * frame2freq;
+
+        msg_hops_obj * out1;
+        msg_spectra_obj * out2;
+
+    } src_frontend_obj;
+
+    typedef struct src_frontend_cfg {
+
+        format_obj * format;
+        interface_obj * interface;
+        links_obj * links;
+        unsigned int nTaps;
+
+        char access;
+        unsigned int periodSize;
+        unsigned int nPeriods;
+
+    } src_frontend_cfg;
+
+    src_frontend_obj * src_frontend_construct(const src_frontend_cfg * src_frontend_config, const msg_hops_cfg * msg_hops_raw_config, const msg_hops_cfg * msg_hops_config, const msg_spectra_cfg * msg_spectra_config);
+
+    void src_frontend_destroy(src_frontend_obj * obj);
+
+    void src_frontend_connect(src_frontend_obj * obj, msg_hops_obj * out1, msg_spectra_obj * out2);
+
+    void src_frontend_disconnect(src_frontend_obj * obj);
+
+    void src_frontend_open(src_frontend_obj * obj);
+
+    void src_frontend_close(src_frontend_obj * obj);
+
+    int src_frontend_process_push(src_frontend_obj * obj);
+
+    int src_frontend_process_pop(src_frontend_obj * obj);
+
+    void src_frontend_process_decode(src_frontend_obj * obj);
+
+    char src_frontend_isEmpty(src_frontend_obj * obj);
+
+    src_frontend_cfg * src_frontend_cfg_construct(void);
+
+    void src_frontend_cfg_destroy(src_frontend_cfg * src_frontend_config);
+
+#endif
@@ -26,6 +26,7 @@
     #include <stdlib.h>
     #include <stdio.h>
     #include <string.h>
+    #include <errno.h>
     #include <alsa/asoundlib.h>
 
     #include "../general/format.h"
@@ -33,6 +34,7 @@
     #include "../message/msg_hops.h"
     #include "../signal/hop.h"
     #include "../utils/pcm.h"
+    #include "../utils/wave.h"
 
     typedef struct src_hops_obj {
 
@@ -45,13 +47,28 @@
         format_obj * format;
         interface_obj * interface;
 
+        wave_obj * wave;
         FILE * fp;
+        char * map;
+        unsigned long long mapSize;
+        unsigned long long position;
+        unsigned long long dataEnd;
+
         snd_pcm_t * ch;
+        snd_pcm_status_t * status;
+
+        char access;
+        unsigned int periodSize;
+        unsigned int nPeriods;
+        unsigned int ringSize;
+
+        unsigned int nXruns;
+        unsigned long long nFramesDropped;
+        unsigned int nFramesSkipped;
 
         char * buffer;
         unsigned int bufferSize;
-
-        char bytes[4];
+        const char * bytes;
 
         msg_hops_obj * out;
 
@@ -62,6 +79,10 @@
         format_obj * format;
         interface_obj * interface;
 
+        char access;
+        unsigned int periodSize;
+        unsigned int nPeriods;
+
     } src_hops_cfg;
 
     src_hops_obj * src_hops_construct(const src_hops_cfg * src_hops_config, const msg_hops_cfg * msg_hops_config);
@@ -90,6 +111,10 @@
 
     int src_hops_process_interface_soundcard(src_hops_obj * obj);
 
+    snd_pcm_sframes_t src_hops_process_interface_soundcard_mmap(src_hops_obj * obj, const unsigned int nFramesRead);
+
+    int src_hops_process_interface_soundcard_recover(src_hops_obj * obj, const int error, const unsigned int nFramesRead);
+
     void src_hops_process_format_binary_int08(src_hops_obj * obj);
 
     void src_hops_process_format_binary_int16(src_hops_obj * obj);
@@ -98,6 +123,8 @@
 
     void src_hops_process_format_binary_int32(src_hops_obj * obj);
 
+    void src_hops_process_format_binary_float(src_hops_obj * obj);
+
     src_hops_cfg * src_hops_cfg_construct(void);
 
     void src_hops_cfg_destroy(src_hops_cfg * src_hops_config);
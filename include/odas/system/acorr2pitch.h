@@ -25,6 +25,7 @@
 
     #include <signal/acorr.h>
     #include <signal/pitch.h>
+    #include <signal/track.h>
 
     #include <math.h>
 
@@ -43,4 +44,6 @@
 
     void acorr2pitch_process(acorr2pitch_obj * obj, const acorrs_obj * acorrs, pitches_obj * pitches);
 
+    void acorr2pitch_process_range(acorr2pitch_obj * obj, const acorrs_obj * acorrs, const tracks_obj * tracks, pitches_obj * pitches, const unsigned int binMin, const unsigned int binMax, const float scale);
+
 #endif
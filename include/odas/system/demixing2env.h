@@ -47,4 +47,6 @@
 
     void demixing2env_process(demixing2env_obj * obj, const tracks_obj * tracks, const demixings_obj * demixings, const masks_obj * masks, const envs_obj * envsChannel, envs_obj * envsSeparated);
 
+    void demixing2env_process_range(demixing2env_obj * obj, const tracks_obj * tracks, const demixings_obj * demixings, const masks_obj * masks, const envs_obj * envsChannel, envs_obj * envsSeparated, const unsigned int iBinStart, const unsigned int iBinStop);
+
 #endif
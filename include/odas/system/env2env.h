@@ -29,6 +29,7 @@
 
     #include <signal/env.h>
     #include <signal/track.h>
+    #include <utils/fastmath.h>
     #include <utils/fft.h>
     #include <utils/transcendental.h>
 
@@ -45,17 +46,20 @@
 
         unsigned long long * idsPrev;
         unsigned int * l;
+        char * doProcess;
+        char * doReset;
+        char * doRestart;
 
         float * b;
-        float ** S;
-        float ** Smin;
-        float ** SminPrev;
-        float ** SPrev;
-        float ** Stmp;
-        float ** StmpPrev;
-        float ** Sf;
-        float ** lambdaD;
-        float ** lambdaDnext;
+        unsigned int * wraps;
+        unsigned int iBinInnerStart;
+        unsigned int iBinInnerStop;
+
+        float * Sf;
+        float * S;
+        float * Smin;
+        float * Stmp;
+        float * lambdaD;
 
     } env2env_mcra_obj;
 
@@ -114,12 +118,14 @@
         float alpha;
         float maxAbsenceProb;
         float Gmin;
+        char math;
 
         unsigned int winSizeLocal;
         unsigned int winSizeGlobal;
         unsigned int winSizeFrame;       
 
         fft_obj * fft;
+        fft_obj ** ffts;
 
         float * winLocal;
         float * winGlobal;
@@ -168,6 +174,8 @@
         unsigned int halfFrameSize;
 
         float Gmin;
+        float logGmin;
+        char math;
 
     } env2env_gainall_obj;
 
@@ -182,6 +190,7 @@
         float Gslope;
 
         float epsilon;
+        char math;
 
     } env2env_gainratio_obj;
 
@@ -191,6 +200,10 @@
 
     void env2env_mcra_process(env2env_mcra_obj * obj, const tracks_obj * tracks, const envs_obj * noisys, const envs_obj * estNoises, envs_obj * noises);
 
+    void env2env_mcra_process_prepare(env2env_mcra_obj * obj, const tracks_obj * tracks);
+
+    void env2env_mcra_process_range(env2env_mcra_obj * obj, const envs_obj * noisys, const envs_obj * estNoises, envs_obj * noises, const unsigned int iBinStart, const unsigned int iBinStop);
+
     env2env_weight_obj * env2env_weight_construct_zero(const unsigned int nChannels, const unsigned int halfFrameSize, const float alphaD, const float epsilon);
 
     void env2env_weight_destroy(env2env_weight_obj * obj);
@@ -203,28 +216,38 @@
 
     void env2env_interf_process(env2env_interf_obj * obj, const tracks_obj * tracks, const envs_obj * seps, const envs_obj * noises, envs_obj * interfs);
 
+    void env2env_interf_process_range(env2env_interf_obj * obj, const tracks_obj * tracks, const envs_obj * seps, const envs_obj * noises, envs_obj * interfs, const unsigned int iBinStart, const unsigned int iBinStop);
+
     env2env_gainspeech_obj * env2env_gainspeech_construct_zero(const unsigned int nChannels, const unsigned int halfFrameSize, const float alphaPmin, const float epsilon);
 
     void env2env_gainspeech_destroy(env2env_gainspeech_obj * obj);
 
     void env2env_gainspeech_process(env2env_gainspeech_obj * obj, const tracks_obj * tracks, const envs_obj * seps, const envs_obj * noises, envs_obj * gains, envs_obj * snrs, envs_obj * vs);
 
-    env2env_probspeech_obj * env2env_probspeech_construct_zero(const unsigned int nChannels, const unsigned int halfFrameSize, const float theta, const float alpha, const float maxAbsenceProb, const float Gmin, const unsigned int winSizeLocal, const unsigned int winSizeGlobal, const unsigned int winSizeFrame);
+    void env2env_gainspeech_process_range(env2env_gainspeech_obj * obj, const tracks_obj * tracks, const envs_obj * seps, const envs_obj * noises, envs_obj * gains, envs_obj * snrs, envs_obj * vs, const unsigned int iBinStart, const unsigned int iBinStop);
+
+    env2env_probspeech_obj * env2env_probspeech_construct_zero(const unsigned int nChannels, const unsigned int halfFrameSize, const float theta, const float alpha, const float maxAbsenceProb, const float Gmin, const unsigned int winSizeLocal, const unsigned int winSizeGlobal, const unsigned int winSizeFrame, const char math);
 
     void env2env_probspeech_destroy(env2env_probspeech_obj * obj);
 
     void env2env_probspeech_process(env2env_probspeech_obj * obj, const tracks_obj * tracks, const envs_obj * snrs, const envs_obj * vs, envs_obj * probspeechs);
 
-    env2env_gainall_obj * env2env_gainall_construct_zero(const unsigned int nChannels, const unsigned int halfFrameSize, const float Gmin);
+    void env2env_probspeech_process_channel(env2env_probspeech_obj * obj, const tracks_obj * tracks, const envs_obj * snrs, const envs_obj * vs, envs_obj * probspeechs, const unsigned int iChannel);
+
+    env2env_gainall_obj * env2env_gainall_construct_zero(const unsigned int nChannels, const unsigned int halfFrameSize, const float Gmin, const char math);
 
     void env2env_gainall_destroy(env2env_gainall_obj * obj);
 
     void env2env_gainall_process(env2env_gainall_obj * obj, const tracks_obj * tracks, const envs_obj * gainspeeches, const envs_obj * probspeeches, envs_obj * gainalls);
 
-    env2env_gainratio_obj * env2env_gainratio_construct_zero(const unsigned int nInitChannels, const unsigned int nChannels, const unsigned int halfFrameSize, const float Gmin, const float Gmid, const float Gslope, const float epsilon);
+    void env2env_gainall_process_range(env2env_gainall_obj * obj, const tracks_obj * tracks, const envs_obj * gainspeeches, const envs_obj * probspeeches, envs_obj * gainalls, const unsigned int iBinStart, const unsigned int iBinStop);
+
+    env2env_gainratio_obj * env2env_gainratio_construct_zero(const unsigned int nInitChannels, const unsigned int nChannels, const unsigned int halfFrameSize, const float Gmin, const float Gmid, const float Gslope, const float epsilon, const char math);
 
     void env2env_gainratio_destroy(env2env_gainratio_obj * obj);
 
     void env2env_gainratio_process(env2env_gainratio_obj * obj, const tracks_obj * tracks, const envs_obj * seps, const envs_obj * diffuse, envs_obj * gainratio);
 
+    void env2env_gainratio_process_range(env2env_gainratio_obj * obj, const tracks_obj * tracks, const envs_obj * seps, const envs_obj * diffuse, envs_obj * gainratio, const unsigned int iBinStart, const unsigned int iBinStop);
+
 #endif
@@ -29,6 +29,7 @@
     #include <signal/frame.h>
     #include <signal/freq.h>
     #include <signal/window.h>
+    #include <system/hop2frame.h>
     #include <utils/fft.h>
 
     typedef struct frame2freq_obj {
@@ -49,4 +50,6 @@
 
     void frame2freq_process(frame2freq_obj * obj, const frames_obj * frames, freqs_obj * freqs);
 
+    void frame2freq_process_ring(frame2freq_obj * obj, const hop2frame_obj * hop2frame, freqs_obj * freqs);
+
 #endif
@@ -40,4 +40,6 @@
 
     void freq2env_process(freq2env_obj * obj, const freqs_obj * freqs, envs_obj * envs);
 
+    void freq2env_process_range(freq2env_obj * obj, const freqs_obj * freqs, envs_obj * envs, const unsigned int iBinStart, const unsigned int iBinStop);
+
 #endif
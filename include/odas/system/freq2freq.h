@@ -107,4 +107,6 @@
 
     void freq2freq_gain_process(freq2freq_gain_obj * obj, const freqs_obj * freqsIn, const envs_obj * envsIn, freqs_obj * freqsOut);
 
+    void freq2freq_gain_process_range(freq2freq_gain_obj * obj, const freqs_obj * freqsIn, const envs_obj * envsIn, freqs_obj * freqsOut, const unsigned int iBinStart, const unsigned int iBinStop);
+
 #endif
@@ -43,4 +43,6 @@
 
     void gain2mask_process(gain2mask_obj * obj, const gains_obj * gains, masks_obj * masks);
 
+    void gain2mask_process_partial(gain2mask_obj * obj, const gains_obj * gains, const char * updates, masks_obj * masks);
+
 #endif
@@ -0,0 +1,55 @@
+#ifndef __ODAS_SYSTEM_HOP2ACORR
+#define __ODAS_SYSTEM_HOP2ACORR
+
+   /**
+    * \file     hop2acorr.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdlib.h>
+    #include <string.h>
+    #include <stdio.h>
+
+    #include <signal/acorr.h>
+    #include <signal/hop.h>
+    #include <signal/track.h>
+
+    typedef struct hop2acorr_obj {
+
+        unsigned int nSignals;
+        unsigned int hopSize;
+        unsigned int decimation;
+        unsigned int hopSizeDec;
+
+        unsigned int lagMin;
+        unsigned int lagMax;
+        float lambda;
+
+        float ** array;
+
+    } hop2acorr_obj;
+
+    hop2acorr_obj * hop2acorr_construct_zero(const unsigned int nSignals, const unsigned int hopSize, const unsigned int frameSize, const unsigned int decimation, const unsigned int lagMin, const unsigned int lagMax);
+
+    void hop2acorr_destroy(hop2acorr_obj * obj);
+
+    void hop2acorr_process(hop2acorr_obj * obj, const hops_obj * hops, const tracks_obj * tracks, acorrs_obj * acorrs);
+
+#endif
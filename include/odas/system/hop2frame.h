@@ -35,6 +35,7 @@
         unsigned int frameSize;
         unsigned int nSignals;
 
+        unsigned int iSample;
         float ** array;
 
     } hop2frame_obj;
@@ -43,6 +44,8 @@
 
     void hop2frame_destroy(hop2frame_obj * obj);
 
+    void hop2frame_push(hop2frame_obj * obj, const hops_obj * hops);
+
     void hop2frame_process(hop2frame_obj * obj, const hops_obj * hops, frames_obj * frames);
 
 #endif
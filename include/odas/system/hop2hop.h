@@ -29,6 +29,7 @@
 
     #include <signal/hop.h>
     #include <general/link.h>
+    #include <init/windowing.h>
 
     typedef struct hop2hop_multiplex_obj {
 
@@ -55,6 +56,34 @@
 
     } hop2hop_buffer_obj;
 
+    typedef struct hop2hop_polyphase_obj {
+
+        unsigned int nSignals;
+        unsigned int hopSizeIn;
+        unsigned int hopSizeOut;
+        unsigned int L;
+        unsigned int M;
+        unsigned int nTaps;
+        unsigned int nHistory;
+        float delay;
+
+        float * coeffs;
+        unsigned int * phaseNext;
+        unsigned int * phaseStep;
+
+        unsigned int phase;
+        unsigned int iInput;
+        float ** history;
+
+        unsigned int nSamplesPush;
+        unsigned int bufferSize;
+        unsigned int iWrite;
+        unsigned int iRead;
+        unsigned int nSamples;
+        float ** array;
+
+    } hop2hop_polyphase_obj;
+
     typedef struct hop2hop_gain_obj {
 
         unsigned int hopSize;
@@ -80,6 +109,18 @@
 
     char hop2hop_buffer_isEmpty(hop2hop_buffer_obj * obj);
 
+    hop2hop_polyphase_obj * hop2hop_polyphase_construct_zero(const unsigned int nSignals, const unsigned int hopSizeIn, const unsigned int hopSizeOut, const unsigned int fSin, const unsigned int fSout, const unsigned int nTaps);
+
+    void hop2hop_polyphase_destroy(hop2hop_polyphase_obj * obj);
+
+    void hop2hop_polyphase_push(hop2hop_polyphase_obj * obj, const hops_obj * hops);
+
+    void hop2hop_polyphase_pop(hop2hop_polyphase_obj * obj, hops_obj * hops);
+
+    char hop2hop_polyphase_isFull(hop2hop_polyphase_obj * obj);
+
+    char hop2hop_polyphase_isEmpty(hop2hop_polyphase_obj * obj);
+
     hop2hop_gain_obj * hop2hop_gain_construct_zero(const unsigned int hopSize, const float gain);
 
     void hop2hop_gain_destroy(hop2hop_gain_obj * obj);
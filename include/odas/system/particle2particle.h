@@ -56,6 +56,7 @@
         float * realisation_normal;
         double epsilon;
         normaloff_obj * normaloff;
+        char normaloffOwned;
 
         float * sum_P_p_x_O;
         particles_obj * particles;
@@ -66,6 +67,8 @@
                   
     particle2particle_obj * particle2particle_construct(const unsigned int nParticles, const float deltaT, const float st_alpha, const float st_beta, const float st_ratio, const float ve_alpha, const float ve_beta, const float ve_ratio, const float ac_alpha, const float ac_beta, const float ac_ratio, const double epsilon, const float sigmaR, const float Nmin);
 
+    particle2particle_obj * particle2particle_construct_clone(const particle2particle_obj * src);
+
     void particle2particle_destroy(particle2particle_obj * obj);
 
     void particle2particle_init_pots(particle2particle_obj * obj, const pots_obj * pots, const unsigned int iPot, particles_obj * particles);
@@ -35,6 +35,10 @@
     #include <signal/track.h>
 
     #include <utils/cmatrix.h>
+
+    // Largest problem handled by the fused GSS update (larger ones use the generic cmatrix path)
+    #define STEER2DEMIXING_GSS_NSEPSMAX         4
+    #define STEER2DEMIXING_GSS_NCHANNELSMAX     16
     
     typedef struct steer2demixing_ds_obj {
 
@@ -99,6 +103,8 @@
 
     void steer2demixing_ds_process(steer2demixing_ds_obj * obj, const tracks_obj * tracks, const steers_obj * steers, const masks_obj * masks, demixings_obj * demixings);
 
+    void steer2demixing_ds_process_range(steer2demixing_ds_obj * obj, const tracks_obj * tracks, const steers_obj * steers, const masks_obj * masks, demixings_obj * demixings, const unsigned int iBinStart, const unsigned int iBinStop);
+
 
     steer2demixing_gss_obj * steer2demixing_gss_construct_zero(const unsigned int nSeps, const unsigned int nChannels, const unsigned int halfFrameSize, const float mu, const float lambda, const float epsilon);
 
@@ -106,6 +112,12 @@
 
     void steer2demixing_gss_process(steer2demixing_gss_obj * obj, const tracks_obj * tracksPrev, const tracks_obj * tracks, const steers_obj * steers, const masks_obj * masks, const freqs_obj * freqs, const demixings_obj * demixingsPrev, demixings_obj * demixings);
 
+    void steer2demixing_gss_process_range(steer2demixing_gss_obj * obj, const tracks_obj * tracksPrev, const tracks_obj * tracks, const steers_obj * steers, const masks_obj * masks, const freqs_obj * freqs, const demixings_obj * demixingsPrev, demixings_obj * demixings, const unsigned int iBinStart, const unsigned int iBinStop);
+
+    void steer2demixing_gss_process_cmatrix(steer2demixing_gss_obj * obj, const tracks_obj * tracksPrev, const tracks_obj * tracks, const steers_obj * steers, const masks_obj * masks, const freqs_obj * freqs, const demixings_obj * demixingsPrev, demixings_obj * demixings, const unsigned int iBinStart, const unsigned int iBinStop);
+
+    void steer2demixing_gss_process_fused(steer2demixing_gss_obj * obj, const tracks_obj * tracksPrev, const tracks_obj * tracks, const steers_obj * steers, const masks_obj * masks, const freqs_obj * freqs, const demixings_obj * demixingsPrev, demixings_obj * demixings, const unsigned int iBinStart, const unsigned int iBinStop);
+
     
     steer2demixing_mvdr_obj * steer2demixing_mvdr_construct_zero(const unsigned int nSeps, const unsigned int nChannels, const unsigned int halfFrameSize, const float alpha, const float sigma, const unsigned int deltaK);
 
@@ -0,0 +1,57 @@
+#ifndef __ODAS_SYSTEM_TRACK2DEMIXING
+#define __ODAS_SYSTEM_TRACK2DEMIXING
+
+   /**
+    * \file     track2demixing.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdlib.h>
+    #include <string.h>
+    #include <stdio.h>
+    #include <math.h>
+
+    #include <signal/demixing.h>
+    #include <signal/demixtable.h>
+    #include <signal/mask.h>
+    #include <signal/track.h>
+
+    typedef struct track2demixing_obj {
+
+        unsigned int nSeps;
+        unsigned int nChannels;
+        unsigned int halfFrameSize;
+
+        const demixtable_obj * table;
+        unsigned int * indexes;
+
+    } track2demixing_obj;
+
+    track2demixing_obj * track2demixing_construct_zero(const unsigned int nSeps, const unsigned int nChannels, const unsigned int halfFrameSize, const demixtable_obj * table);
+
+    void track2demixing_destroy(track2demixing_obj * obj);
+
+    void track2demixing_update(track2demixing_obj * obj, const tracks_obj * tracks, masks_obj * masks);
+
+    void track2demixing_process(track2demixing_obj * obj, const tracks_obj * tracks, masks_obj * masks, demixings_obj * demixings);
+
+    void track2demixing_process_range(track2demixing_obj * obj, const tracks_obj * tracks, demixings_obj * demixings, const unsigned int iBinStart, const unsigned int iBinStop);
+
+#endif
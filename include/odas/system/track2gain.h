@@ -46,5 +46,7 @@
 
     void track2gain_process(track2gain_obj * obj, const beampatterns_obj * beampatterns_mics, const tracks_obj * tracks, gains_obj * gains);
 
+    void track2gain_process_partial(track2gain_obj * obj, const beampatterns_obj * beampatterns_mics, const tracks_obj * tracks, const char * updates, gains_obj * gains);
+
 
 #endif
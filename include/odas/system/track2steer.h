@@ -32,6 +32,9 @@
     #include <signal/mask.h>
     #include <signal/track.h>
     #include <signal/steer.h>
+
+    // Steering vectors are computed exactly every TRACK2STEER_ANCHOR bins, and with a phase rotation in between
+    #define TRACK2STEER_ANCHOR      32
     
     typedef struct track2steer_obj {
 
@@ -45,12 +48,23 @@
         float * factor;
         float speed;
 
+        float tolerance;
+        float cosTolerance;
+        char * cached;
+        unsigned long long * ids;
+        float * directions;
+        char * updates;
+
     } track2steer_obj;    
 
-    track2steer_obj * track2steer_construct_zero(const unsigned int nSeps, const unsigned int nChannels, const unsigned int halfFrameSize, const float c, const unsigned int fS, const float * mics);
+    track2steer_obj * track2steer_construct_zero(const unsigned int nSeps, const unsigned int nChannels, const unsigned int halfFrameSize, const float c, const unsigned int fS, const float * mics, const float tolerance);
 
     void track2steer_destroy(track2steer_obj * obj);
 
+    void track2steer_update(track2steer_obj * obj, const tracks_obj * tracks);
+
     void track2steer_process(track2steer_obj * obj, const tracks_obj * tracks, const gains_obj * gains, const masks_obj * masks, steers_obj * steers);    
 
+    void track2steer_process_range(track2steer_obj * obj, const tracks_obj * tracks, const gains_obj * gains, const masks_obj * masks, steers_obj * steers, const unsigned int iBinStart, const unsigned int iBinStop);
+
 #endif
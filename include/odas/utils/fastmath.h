@@ -0,0 +1,51 @@
+#ifndef __ODAS_UTILS_FASTMATH
+#define __ODAS_UTILS_FASTMATH
+
+   /**
+    * \file     fastmath.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdlib.h>
+    #include <string.h>
+    #include <stdio.h>
+    #include <math.h>
+    #include <float.h>
+
+    // Approximations of exp, log, pow and the logistic sigmoid, computed over arrays so that
+    // the loops can be vectorized by the compiler. Each function may be called in place 
+    // (out == in). Maximum errors, measured against double precision:
+    //
+    //   fastmath_exp      relative error < 2.6e-7 for x in [-87.3, 88.7]
+    //                     (x is clamped to this range, and results below 2.4e-38 flush to 0)
+    //   fastmath_log      absolute error < 6e-8 for x in [0.5, 2], relative error < 8e-8 elsewhere
+    //                     (x below FLT_MIN, including 0 and negative values, is treated as FLT_MIN)
+    //   fastmath_pow      relative error < 2.6e-7 + 1.2e-7 * |exponent * ln(base)|, for base > 0
+    //   fastmath_sigmoid  absolute error < 1.1e-7
+    
+    void fastmath_exp(const float * in, float * out, const unsigned int N);
+
+    void fastmath_log(const float * in, float * out, const unsigned int N);
+
+    void fastmath_pow(const float * base, const float * exponent, float * out, const unsigned int N);
+
+    void fastmath_sigmoid(const float * in, float * out, const unsigned int N);
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef __ODAS_UTILS_JSON
+#define __ODAS_UTILS_JSON
+
+   /**
+    * \file     json.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdio.h>
+    #include <string.h>
+    #include <math.h>
+
+    // Streaming text writer: each call appends at the cursor, keeps the text null-terminated,
+    // and returns the new cursor (on the terminator). The caller sizes the buffer for the
+    // longest message: an integer takes at most 20 characters, and a float at most 48.
+
+    char * json_text(char * cursor, const char * text);
+
+    char * json_uint64(char * cursor, const unsigned long long value);
+
+    char * json_float3(char * cursor, const float value);
+
+#endif
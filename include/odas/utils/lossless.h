@@ -0,0 +1,158 @@
+#ifndef __ODAS_UTILS_LOSSLESS
+#define __ODAS_UTILS_LOSSLESS
+
+   /**
+    * \file     lossless.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+
+    // A frame holds one hop and can be decoded on its own (little-endian):
+    //
+    //   u32 magic, u32 frameSize (header included), u16 hopSize, u8 nChannels, u8 nBits
+    //
+    // followed by each channel, starting on a byte boundary:
+    //
+    //   u8 mode = lossless_mode_constant:  one sample
+    //   u8 mode = lossless_mode_verbatim:  hopSize samples
+    //   u8 mode = lossless_mode_fixed + p: u8 k, p warm-up samples, then hopSize - p
+    //                                      residuals of the order p fixed predictor,
+    //                                      zigzagged and Rice coded with parameter k
+    //
+    // Samples are nBits / 8 bytes wide. A Rice code is q zeros, a one, and the k low bits,
+    // with q = u >> k. When q reaches lossless_escape, the code is lossless_escape zeros,
+    // a one, and the whole value on nBits + 5 bits.
+
+    typedef enum lossless_constant {
+
+        lossless_magic = 0x4C4C444F,            ///< "ODLL".
+        lossless_headerSize = 12,               ///< Size of the frame header.
+        lossless_maxOrder = 4,                  ///< Highest order of the fixed predictors.
+        lossless_escape = 24,                   ///< Quotient that announces an escaped value.
+        lossless_mode_constant = 0,             ///< All samples of the channel are equal.
+        lossless_mode_verbatim = 1,             ///< Samples are stored as is.
+        lossless_mode_fixed = 2,                ///< Fixed predictor (order added to the mode).
+
+    } lossless_constant;
+
+    //! Bit writer and reader (most significant bit first).
+    typedef struct lossless_bits_obj {
+
+        unsigned char * bytes;                  ///< Next byte to write or read.
+        const unsigned char * end;              ///< End of the bytes that can be read.
+        unsigned long long acc;                 ///< Bits not written or not read yet (nAcc lowest bits).
+        unsigned int nAcc;                      ///< Number of bits in acc.
+        char overrun;                           ///< A read went past the end.
+
+    } lossless_bits_obj;
+
+    //! Lossless codec for hops of integer samples (16 or 24 bits): fixed linear predictors
+    //! chosen per channel and per hop, and Rice coding of the residuals.
+    typedef struct lossless_obj {
+
+        unsigned int nChannels;                 ///< Number of channels.
+        unsigned int hopSize;                   ///< Samples per channel in a frame.
+        unsigned int nBits;                     ///< Bits per sample.
+        unsigned int nBytes;                    ///< Bytes per sample.
+
+        int * samples;                          ///< Samples of the hop, one block of hopSize per channel.
+        unsigned int * residuals;               ///< Zigzagged residuals of the channel being coded.
+
+        lossless_bits_obj bits;                 ///< Bit writer or reader.
+
+    } lossless_obj;
+
+    /** Constructor.
+        \param      nChannels       Number of channels (at most 255).
+        \param      hopSize         Samples per channel in a frame (at most 65535).
+        \param      nBits           Bits per sample (16 or 24).
+        \return                     Pointer to the instantiated object.
+    */
+    lossless_obj * lossless_construct(const unsigned int nChannels, const unsigned int hopSize, const unsigned int nBits);
+
+    /** Destructor.
+        \param      obj             Object to be destroyed.
+    */
+    void lossless_destroy(lossless_obj * obj);
+
+    /** Largest frame the encoder can produce.
+        \param      obj             Object used.
+        \return                     Size in bytes.
+    */
+    unsigned int lossless_bound(const lossless_obj * obj);
+
+    /** Encode the samples of the object as one frame.
+        \param      obj             Object used.
+        \param      bytes           Frame (at least lossless_bound bytes).
+        \return                     Size of the frame in bytes.
+    */
+    unsigned int lossless_encode(lossless_obj * obj, char * bytes);
+
+    /** Encode one channel.
+        \param      obj             Object used.
+        \param      iChannel        Index of the channel.
+        \param      bytes           Where the channel starts.
+        \return                     Number of bytes written.
+    */
+    unsigned int lossless_encode_channel(lossless_obj * obj, const unsigned int iChannel, unsigned char * bytes);
+
+    /** Read the header of a frame.
+        \param      bytes           Start of the frame.
+        \param      nBytes          Number of bytes available.
+        \param      hopSize         Samples per channel (may be NULL).
+        \param      nChannels       Number of channels (may be NULL).
+        \param      nBits           Bits per sample (may be NULL).
+        \return                     Size of the frame, 0 if the header is incomplete, -1 if it is invalid.
+    */
+    int lossless_peek(const char * bytes, const unsigned int nBytes, unsigned int * hopSize, unsigned int * nChannels, unsigned int * nBits);
+
+    /** Decode one frame in the samples of the object.
+        \param      obj             Object used (same number of channels, hop size and bits as the encoder).
+        \param      bytes           Start of the frame.
+        \param      nBytes          Number of bytes available.
+        \return                     Size of the frame, 0 if it is incomplete, -1 if it is invalid.
+    */
+    int lossless_decode(lossless_obj * obj, const char * bytes, const unsigned int nBytes);
+
+    /** Decode one channel.
+        \param      obj             Object used.
+        \param      iChannel        Index of the channel.
+        \param      bytes           Where the channel starts.
+        \param      end             End of the frame.
+        \return                     Where the next channel starts, NULL if the channel is invalid.
+    */
+    const unsigned char * lossless_decode_channel(lossless_obj * obj, const unsigned int iChannel, const unsigned char * bytes, const unsigned char * end);
+
+    void lossless_bits_put(lossless_bits_obj * bits, const unsigned int value, const unsigned int nBits);
+
+    void lossless_bits_align(lossless_bits_obj * bits);
+
+    unsigned int lossless_bits_get(lossless_bits_obj * bits, const unsigned int nBits);
+
+    unsigned int lossless_bits_unary(lossless_bits_obj * bits, const unsigned int nMax);
+
+    void lossless_sample_put(unsigned char * bytes, const int sample, const unsigned int nBytes);
+
+    int lossless_sample_get(const unsigned char * bytes, const unsigned int nBytes);
+
+#endif
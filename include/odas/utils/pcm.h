@@ -23,6 +23,7 @@
     *
     */
 
+    #include <string.h>
     #include <math.h>
     #include <limits.h>
 
@@ -32,4 +33,23 @@
 
     void pcm_normalized2signedXXbits(const float sample, const unsigned int nBytes, char * bytes);
 
+    // Conversions between a whole interleaved buffer (nSamples frames of nChannels samples)
+    // and one array per channel. Channels are handled four at a time, so each pass over the
+    // buffer reads or writes contiguous bytes. Decoding gives the same values as
+    // pcm_signedXXbits2normalized. Encoding applies the gain, rounds like
+    // pcm_normalized2signedXXbits, and saturates instead of wrapping around.
+
+    void pcm_signedXXbits2normalized_interleaved(const char * bytes, const unsigned int nBytes, const unsigned int nChannels, const unsigned int nSamples, float ** array);
+
+    void pcm_float2normalized_interleaved(const char * bytes, const unsigned int nChannels, const unsigned int nSamples, float ** array);
+
+    void pcm_normalized2signedXXbits_interleaved(float ** array, const float gain, const unsigned int nBytes, const unsigned int nChannels, const unsigned int nSamples, char * bytes);
+
+    void pcm_normalized2float_interleaved(float ** array, const float gain, const unsigned int nChannels, const unsigned int nSamples, char * bytes);
+
+    // Same quantization as pcm_normalized2signedXXbits_interleaved, but the integers are
+    // kept in one block of nSamples per channel (e.g. for the lossless encoder).
+
+    void pcm_normalized2signedXXbits_planar(float ** array, const float gain, const unsigned int nBytes, const unsigned int nChannels, const unsigned int nSamples, int * samples);
+
 #endif
\ No newline at end of file
@@ -77,6 +77,14 @@
     */
     void random_generate(const random_obj * obj, const unsigned int nSamples, unsigned int * indexes);
 
+    /** Pick element randomly according to the PDF, and return the index (reentrant version).
+        \param      nSamples        Number of elements to pick.
+        \param      indexes         Array that contains the returned indexes.
+        \param      seed            State of the random stream (updated).
+        \param      obj             Object to be used.
+    */
+    void random_generate_r(const random_obj * obj, const unsigned int nSamples, unsigned int * indexes, unsigned int * seed);
+
     /** Constructor.
         \param      epsilon         Small value to perform the Box-Muller transform.
         \return                     Pointer of the instantiated object.
@@ -114,5 +122,13 @@
     */
     void normaloff_generate(const normaloff_obj * obj, const unsigned int nSamples, float * values);
 
+    /** Generate a random number according to a standard normal distribution (reentrant version).
+        \param      nSamples        Number of random numbers to generate.
+        \param      values          Array that contains the generated random numbers.
+        \param      seed            State of the random stream (updated).
+        \param      obj             Object to be used.
+    */
+    void normaloff_generate_r(const normaloff_obj * obj, const unsigned int nSamples, float * values, unsigned int * seed);
+
 
 #endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+#ifndef __ODAS_UTILS_WAVE
+#define __ODAS_UTILS_WAVE
+
+   /**
+    * \file     wave.h
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <stdlib.h>
+    #include <stdio.h>
+    #include <string.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+
+    // Header of a recording: RIFF/WAVE, RF64/WAVE (64-bit sizes for files over 4 GB),
+    // or none for a raw headerless file, in which case the whole file is data. Pipes and
+    // devices are always raw.
+
+    typedef struct wave_obj {
+
+        char container;
+        
+        unsigned int nChannels;
+        unsigned int fS;
+        unsigned int nBits;
+        char isFloat;
+
+        unsigned long long dataOffset;
+        unsigned long long dataSize;
+
+    } wave_obj;
+
+    wave_obj * wave_construct_zero(void);
+
+    wave_obj * wave_construct_file(const char * fileName);
+
+    void wave_destroy(wave_obj * obj);
+
+    int wave_parse(wave_obj * obj, const char * bytes, const unsigned long long nBytes);
+
+    unsigned int wave_uint16(const char * bytes);
+
+    unsigned int wave_uint32(const char * bytes);
+
+    unsigned long long wave_uint64(const char * bytes);
+
+    void wave_printf(const wave_obj * obj);
+
+#endif
@@ -0,0 +1,92 @@
+
+    /**
+    * \file     asnk_backend.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+    
+    #include <asink/asnk_backend.h>
+
+    asnk_backend_obj * asnk_backend_construct(const snk_backend_cfg * snk_backend_config, const msg_spectra_cfg * msg_spectra_config, const msg_hops_cfg * msg_hops_in_config, const msg_hops_cfg * msg_hops_out_config) {
+
+        asnk_backend_obj * obj;
+
+        obj = (asnk_backend_obj *) malloc(sizeof(asnk_backend_obj));
+
+        obj->snk_backend = snk_backend_construct(snk_backend_config, msg_spectra_config, msg_hops_in_config, msg_hops_out_config);
+        obj->in = (amsg_spectra_obj *) NULL;
+
+        obj->thread = thread_construct(&asnk_backend_thread, (void *) obj);
+
+        return obj;
+
+    }
+
+    void asnk_backend_destroy(asnk_backend_obj * obj) {
+
+        snk_backend_destroy(obj->snk_backend);
+        thread_destroy(obj->thread);
+
+        free((void *) obj);
+
+    }
+
+    void asnk_backend_connect(asnk_backend_obj * obj, amsg_spectra_obj * in) {
+
+        obj->in = in;
+
+    }
+
+    void asnk_backend_disconnect(asnk_backend_obj * obj) {
+
+        obj->in = (amsg_spectra_obj *) NULL;
+
+    }
+
+    void * asnk_backend_thread(void * ptr) {
+
+        asnk_backend_obj * obj;
+        msg_spectra_obj * msg_spectra_in;
+        int rtnValue;
+
+        obj = (asnk_backend_obj *) ptr;
+
+        // Open the sink
+        snk_backend_open(obj->snk_backend);
+
+        while(1) {
+
+            // Pop a message, process, and push back
+            msg_spectra_in = amsg_spectra_filled_pop(obj->in);
+            snk_backend_connect(obj->snk_backend, msg_spectra_in);
+            rtnValue = snk_backend_process(obj->snk_backend);
+            snk_backend_disconnect(obj->snk_backend);
+            amsg_spectra_empty_push(obj->in, msg_spectra_in);
+
+            // If this is the last frame, rtnValue = -1
+            if (rtnValue == -1) {
+                break;
+            }
+
+        }
+
+        // Close the sink
+        snk_backend_close(obj->snk_backend);
+
+    }
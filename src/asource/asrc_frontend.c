@@ -0,0 +1,120 @@
+
+    /**
+    * \file     asrc_frontend.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <asource/asrc_frontend.h>
+
+    asrc_frontend_obj * asrc_frontend_construct(const src_frontend_cfg * src_frontend_config, const msg_hops_cfg * msg_hops_raw_config, const msg_hops_cfg * msg_hops_config, const msg_spectra_cfg * msg_spectra_config) {
+
+        asrc_frontend_obj * obj;
+
+        obj = (asrc_frontend_obj *) malloc(sizeof(asrc_frontend_obj));
+
+        obj->src_frontend = src_frontend_construct(src_frontend_config, msg_hops_raw_config, msg_hops_config, msg_spectra_config);
+        obj->out1 = (amsg_hops_obj *) NULL;
+        obj->out2 = (amsg_spectra_obj *) NULL;
+
+        obj->thread = thread_construct(&asrc_frontend_thread, (void *) obj);
+
+        return obj;
+
+    }
+
+    void asrc_frontend_destroy(asrc_frontend_obj * obj) {
+
+        src_frontend_destroy(obj->src_frontend);
+        thread_destroy(obj->thread);
+
+        free((void *) obj);
+
+    }
+
+    void asrc_frontend_connect(asrc_frontend_obj * obj, amsg_hops_obj * out1, amsg_spectra_obj * out2) {
+
+        obj->out1 = out1;
+        obj->out2 = out2;
+
+    }
+
+    void asrc_frontend_disconnect(asrc_frontend_obj * obj) {
+
+        obj->out1 = (amsg_hops_obj *) NULL;
+        obj->out2 = (amsg_spectra_obj *) NULL;
+
+    }
+
+    void * asrc_frontend_thread(void * ptr) {
+
+        asrc_frontend_obj * obj;
+        msg_hops_obj * msg_hops_out;
+        msg_spectra_obj * msg_spectra_out;
+        int rtnValue;
+
+        obj = (asrc_frontend_obj *) ptr;
+
+        // Open the source
+        src_frontend_open(obj->src_frontend);
+
+        while(1) {
+
+            // Read one hop from the interface
+            rtnValue = src_frontend_process_push(obj->src_frontend);
+
+            // Emit every hop (and spectra) it completes
+            while (src_frontend_isEmpty(obj->src_frontend) == 0) {
+
+                msg_hops_out = amsg_hops_empty_pop(obj->out1);
+                msg_spectra_out = amsg_spectra_empty_pop(obj->out2);
+                src_frontend_connect(obj->src_frontend, msg_hops_out, msg_spectra_out);
+                src_frontend_process_pop(obj->src_frontend);
+                src_frontend_disconnect(obj->src_frontend);
+                amsg_hops_filled_push(obj->out1, msg_hops_out);
+                amsg_spectra_filled_push(obj->out2, msg_spectra_out);
+
+            }
+
+            // If this is the last frame, rtnValue = -1
+            if (rtnValue == -1) {
+                break;
+            }
+
+            // Some other process may ask to stop the thread
+            if (thread_askedToStop(obj->thread) == 1) {
+                break;
+            }
+
+        }
+
+        // Close the source
+        src_frontend_close(obj->src_frontend);
+
+        // Send the "0" messages, that kill all connected threads
+        // that will consume these messages
+        msg_hops_out = amsg_hops_empty_pop(obj->out1);
+        msg_hops_zero(msg_hops_out);
+        amsg_hops_filled_push(obj->out1, msg_hops_out);
+
+        msg_spectra_out = amsg_spectra_empty_pop(obj->out2);
+        msg_spectra_zero(msg_spectra_out);
+        amsg_spectra_filled_push(obj->out2, msg_spectra_out);
+
+    }
@@ -0,0 +1,167 @@
+
+   /**
+    * \file     archive.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <general/archive.h>
+
+    archive_obj * archive_construct(const char * fileName, const archive_header * header, const unsigned int * channels) {
+
+        archive_obj * obj;
+        unsigned int one;
+        unsigned int iChannel;
+        uint32_t * table;
+
+        obj = (archive_obj *) malloc(sizeof(archive_obj));
+
+        obj->fileName = (char *) malloc(sizeof(char) * (strlen(fileName) + 1));
+        strcpy(obj->fileName, fileName);
+
+        // Records are written as is, in host order
+        one = 1;
+
+        if (*((unsigned char *) &one) != 1) {
+            printf("Archive %s: The mmap interface requires a little-endian host.\n", obj->fileName);
+            exit(EXIT_FAILURE);
+        }
+
+        if ((header->recordSize < sizeof(uint64_t)) || ((header->recordSize % sizeof(uint64_t)) != 0)) {
+            printf("Archive %s: Invalid record size.\n", obj->fileName);
+            exit(EXIT_FAILURE);
+        }
+
+        obj->fd = open(obj->fileName, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+        if (obj->fd < 0) {
+            printf("Archive %s: Cannot open file (%s).\n", obj->fileName, strerror(errno));
+            exit(EXIT_FAILURE);
+        }
+
+        // Records stay 8-byte aligned after the channel table
+        obj->headerSize = sizeof(archive_header) + sizeof(uint32_t) * header->nChannels;
+        obj->headerSize = ((obj->headerSize + sizeof(uint64_t) - 1) / sizeof(uint64_t)) * sizeof(uint64_t);
+
+        // Room for the header and at least 1 MB of records to start with
+        obj->mapSize = obj->headerSize + (unsigned long long) header->recordSize * (1 + 1048576 / header->recordSize);
+
+        if (ftruncate(obj->fd, (off_t) obj->mapSize) < 0) {
+            printf("Archive %s: Cannot resize file (%s).\n", obj->fileName, strerror(errno));
+            exit(EXIT_FAILURE);
+        }
+
+        obj->map = (char *) mmap(NULL, obj->mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, obj->fd, 0);
+
+        if (obj->map == MAP_FAILED) {
+            printf("Archive %s: Cannot map file (%s).\n", obj->fileName, strerror(errno));
+            exit(EXIT_FAILURE);
+        }
+
+        obj->header = (archive_header *) obj->map;
+        memcpy(obj->header, header, sizeof(archive_header));
+
+        obj->header->magic = archive_magic;
+        obj->header->version = archive_version;
+        obj->header->headerSize = (uint32_t) obj->headerSize;
+        obj->header->nRecords = 0;
+
+        table = (uint32_t *) &(obj->map[sizeof(archive_header)]);
+
+        for (iChannel = 0; iChannel < header->nChannels; iChannel++) {
+            table[iChannel] = (uint32_t) channels[iChannel];
+        }
+
+        obj->nRecords = 0;
+
+        return obj;
+
+    }
+
+    void archive_destroy(archive_obj * obj) {
+
+        unsigned long long fileSize;
+
+        fileSize = obj->headerSize + obj->nRecords * ((unsigned long long) obj->header->recordSize);
+
+        munmap((void *) obj->map, obj->mapSize);
+
+        if (ftruncate(obj->fd, (off_t) fileSize) < 0) {
+            printf("Archive %s: Cannot trim file (%s).\n", obj->fileName, strerror(errno));
+        }
+
+        close(obj->fd);
+
+        free((void *) obj->fileName);
+        free((void *) obj);
+
+    }
+
+    void archive_append(archive_obj * obj, const unsigned long long timeStamp, const char * bytes, const unsigned int nBytes) {
+
+        unsigned long long recordSize;
+        unsigned long long offset;
+        unsigned long long mapSize;
+        char * map;
+        uint64_t stamp;
+
+        recordSize = obj->header->recordSize;
+
+        if ((nBytes + sizeof(uint64_t)) > recordSize) {
+            printf("Archive %s: Record too large.\n", obj->fileName);
+            exit(EXIT_FAILURE);
+        }
+
+        offset = obj->headerSize + obj->nRecords * recordSize;
+
+        // Double the file when full, so appends stay amortized constant time
+        if ((offset + recordSize) > obj->mapSize) {
+
+            mapSize = 2 * obj->mapSize;
+
+            if (ftruncate(obj->fd, (off_t) mapSize) < 0) {
+                printf("Archive %s: Cannot resize file (%s).\n", obj->fileName, strerror(errno));
+                exit(EXIT_FAILURE);
+            }
+
+            map = (char *) mremap((void *) obj->map, obj->mapSize, mapSize, MREMAP_MAYMOVE);
+
+            if (map == MAP_FAILED) {
+                printf("Archive %s: Cannot map file (%s).\n", obj->fileName, strerror(errno));
+                exit(EXIT_FAILURE);
+            }
+
+            obj->map = map;
+            obj->mapSize = mapSize;
+            obj->header = (archive_header *) obj->map;
+
+        }
+
+        stamp = timeStamp;
+
+        memcpy(&(obj->map[offset]), &stamp, sizeof(uint64_t));
+        memcpy(&(obj->map[offset + sizeof(uint64_t)]), bytes, nBytes);
+        memset(&(obj->map[offset + sizeof(uint64_t) + nBytes]), 0x00, recordSize - sizeof(uint64_t) - nBytes);
+
+        obj->nRecords++;
+
+        // Readers of the growing file only look at records below nRecords
+        __atomic_store_n(&(obj->header->nRecords), (uint64_t) obj->nRecords, __ATOMIC_RELEASE);
+
+    }
@@ -0,0 +1,281 @@
+
+   /**
+    * \file     datagram.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <general/datagram.h>
+
+    datagram_obj * datagram_construct(const char * name, const interface_obj * interface) {
+
+        datagram_obj * obj;
+        unsigned int one;
+        unsigned char ttl;
+        unsigned char loop;
+        int bufferSize;
+
+        obj = (datagram_obj *) malloc(sizeof(datagram_obj));
+
+        obj->name = (char *) malloc(sizeof(char) * (strlen(name) + 1));
+        strcpy(obj->name, name);
+
+        // The header is written as is, in host order
+        one = 1;
+
+        if (*((unsigned char *) &one) != 1) {
+            printf("%s: The udp interface requires a little-endian host.\n", obj->name);
+            exit(EXIT_FAILURE);
+        }
+
+        if (interface->mtu <= sizeof(wire_datagram)) {
+            printf("%s: Invalid mtu.\n", obj->name);
+            exit(EXIT_FAILURE);
+        }
+
+        obj->mtu = interface->mtu;
+
+        memset(&(obj->address), 0x00, sizeof(struct sockaddr_in));
+
+        obj->address.sin_family = AF_INET;
+        obj->address.sin_port = htons(interface->port);
+
+        if (inet_pton(AF_INET, interface->ip, &(obj->address.sin_addr)) != 1) {
+            printf("%s: Invalid ip address %s.\n", obj->name, interface->ip);
+            exit(EXIT_FAILURE);
+        }
+
+        obj->multicast = IN_MULTICAST(ntohl(obj->address.sin_addr.s_addr)) ? 1 : 0;
+
+        obj->sid = socket(AF_INET, SOCK_DGRAM, 0);
+
+        if (obj->sid < 0) {
+            printf("%s: Cannot create socket.\n", obj->name);
+            exit(EXIT_FAILURE);
+        }
+
+        fcntl(obj->sid, F_SETFL, fcntl(obj->sid, F_GETFL, 0) | O_NONBLOCK);
+
+        // Leave room for a full hop of fragments
+        bufferSize = 1048576;
+        setsockopt(obj->sid, SOL_SOCKET, SO_SNDBUF, &bufferSize, sizeof(bufferSize));
+
+        if (obj->multicast == 1) {
+
+            ttl = (unsigned char) interface->ttl;
+            loop = 1;
+
+            if ((setsockopt(obj->sid, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl)) < 0) ||
+                (setsockopt(obj->sid, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop)) < 0)) {
+                printf("%s: Cannot configure multicast.\n", obj->name);
+                exit(EXIT_FAILURE);
+            }
+
+        }
+
+        obj->sequence = 0;
+
+        obj->headers = (wire_datagram *) malloc(sizeof(wire_datagram) * DATAGRAM_BATCH);
+        obj->iovecs = (struct iovec *) malloc(sizeof(struct iovec) * 2 * DATAGRAM_BATCH);
+        obj->messages = (struct mmsghdr *) malloc(sizeof(struct mmsghdr) * DATAGRAM_BATCH);
+        memset(obj->messages, 0x00, sizeof(struct mmsghdr) * DATAGRAM_BATCH);
+
+        obj->nMessages = 0;
+        obj->nDatagrams = 0;
+        obj->nDatagramsDropped = 0;
+        obj->warned = 0;
+
+        obj->nReported = 0;
+        obj->reportTime = time(NULL);
+
+        return obj;
+
+    }
+
+    void datagram_destroy(datagram_obj * obj) {
+
+        if (obj->nDatagramsDropped > 0) {
+            datagram_printf(obj);
+        }
+
+        close(obj->sid);
+
+        free((void *) obj->headers);
+        free((void *) obj->iovecs);
+        free((void *) obj->messages);
+        free((void *) obj->name);
+        free((void *) obj);
+
+    }
+
+    void datagram_send(datagram_obj * obj, const unsigned long long timeStamp, const char * bytes, const unsigned int nBytes, const unsigned int align) {
+
+        unsigned int payloadMax;
+        unsigned int nFragments;
+        unsigned int iFragment;
+        unsigned int iDatagram;
+        unsigned int offset;
+        unsigned int size;
+
+        payloadMax = obj->mtu - sizeof(wire_datagram);
+        payloadMax -= payloadMax % align;
+
+        if (payloadMax == 0) {
+            printf("%s: The mtu is too small for one sample per channel.\n", obj->name);
+            exit(EXIT_FAILURE);
+        }
+
+        nFragments = (nBytes + payloadMax - 1) / payloadMax;
+
+        if (nFragments == 0) {
+            nFragments = 1;
+        }
+
+        if (nFragments > 65535) {
+            obj->sequence++;
+            obj->nDatagramsDropped += nFragments;
+            datagram_report(obj);
+            return;
+        }
+
+        iDatagram = 0;
+
+        for (iFragment = 0; iFragment < nFragments; iFragment++) {
+
+            offset = iFragment * payloadMax;
+            size = ((nBytes - offset) < payloadMax) ? (nBytes - offset) : payloadMax;
+
+            obj->headers[iDatagram].magic = wire_magic_datagram;
+            obj->headers[iDatagram].version = wire_version;
+            obj->headers[iDatagram].nFragments = (uint16_t) nFragments;
+            obj->headers[iDatagram].sequence = obj->sequence;
+            obj->headers[iDatagram].fragment = (uint16_t) iFragment;
+            obj->headers[iDatagram].reserved = 0;
+            obj->headers[iDatagram].timeStamp = timeStamp;
+            obj->headers[iDatagram].offset = offset;
+            obj->headers[iDatagram].size = nBytes;
+
+            // The payload is not copied: the iovec points into the message
+            obj->iovecs[2 * iDatagram + 0].iov_base = (void *) &(obj->headers[iDatagram]);
+            obj->iovecs[2 * iDatagram + 0].iov_len = sizeof(wire_datagram);
+            obj->iovecs[2 * iDatagram + 1].iov_base = (void *) &(bytes[offset]);
+            obj->iovecs[2 * iDatagram + 1].iov_len = size;
+
+            obj->messages[iDatagram].msg_hdr.msg_name = (void *) &(obj->address);
+            obj->messages[iDatagram].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+            obj->messages[iDatagram].msg_hdr.msg_iov = &(obj->iovecs[2 * iDatagram]);
+            obj->messages[iDatagram].msg_hdr.msg_iovlen = 2;
+
+            iDatagram++;
+
+            if (iDatagram == DATAGRAM_BATCH) {
+                datagram_flush(obj, iDatagram);
+                iDatagram = 0;
+            }
+
+        }
+
+        if (iDatagram > 0) {
+            datagram_flush(obj, iDatagram);
+        }
+
+        obj->sequence++;
+        obj->nMessages++;
+
+        datagram_report(obj);
+
+    }
+
+    void datagram_flush(datagram_obj * obj, const unsigned int nDatagrams) {
+
+        unsigned int iDatagram;
+        int nSent;
+
+        iDatagram = 0;
+
+        while (iDatagram < nDatagrams) {
+
+            nSent = sendmmsg(obj->sid, &(obj->messages[iDatagram]), nDatagrams - iDatagram, MSG_DONTWAIT);
+
+            if (nSent > 0) {
+
+                obj->nDatagrams += nSent;
+                iDatagram += nSent;
+
+            }
+            else if ((nSent < 0) && (errno == EINTR)) {
+
+                continue;
+
+            }
+            else {
+
+                // Full buffer, no route, or nobody listening (unicast): skip this datagram and go on
+                if (obj->warned == 0) {
+                    printf("%s: Datagram refused (%s), dropping until the destination recovers.\n", obj->name, strerror(errno));
+                    obj->warned = 1;
+                }
+
+                obj->nDatagramsDropped++;
+                iDatagram++;
+
+            }
+
+        }
+
+    }
+
+    void datagram_stats(const datagram_obj * obj, datagram_stats_obj * stats) {
+
+        stats->nMessages = obj->nMessages;
+        stats->nDatagrams = obj->nDatagrams;
+        stats->nDatagramsDropped = obj->nDatagramsDropped;
+
+    }
+
+    void datagram_report(datagram_obj * obj) {
+
+        time_t now;
+
+        now = time(NULL);
+
+        if ((now - obj->reportTime) < DATAGRAM_REPORT_PERIOD) {
+            return;
+        }
+
+        obj->reportTime = now;
+
+        // Only the first refused datagram is announced, so the losses that follow show up here
+        if (obj->nDatagramsDropped != obj->nReported) {
+            datagram_printf(obj);
+            obj->nReported = obj->nDatagramsDropped;
+        }
+
+    }
+
+    void datagram_printf(const datagram_obj * obj) {
+
+        datagram_stats_obj stats;
+
+        datagram_stats(obj, &stats);
+
+        printf("%s: %llu message(s) sent in %llu datagram(s), %llu datagram(s) dropped.\n",
+               obj->name, stats.nMessages, stats.nDatagrams, stats.nDatagramsDropped);
+
+    }
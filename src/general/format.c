@@ -116,6 +116,51 @@
 
     }
 
+    format_obj * format_construct_binary_wire() {
+
+        format_obj * obj;
+
+        obj = (format_obj *) malloc(sizeof(format_obj));
+
+        obj->type = format_binary_wire;
+
+        return obj;
+
+    }
+
+    format_obj * format_construct_lossless_int(const unsigned int nBits) {
+
+        format_obj * obj;
+
+        obj = (format_obj *) malloc(sizeof(format_obj));
+
+        switch(nBits) {
+
+            case 16:
+
+                obj->type = format_lossless_int16;
+
+            break;
+
+            case 24:
+
+                obj->type = format_lossless_int24;
+
+            break;
+
+            default:
+
+                printf("Wrong number of bits.\n");
+                exit(EXIT_FAILURE);
+
+            break;
+
+        }
+
+        return obj;
+
+    }
+
     format_obj * format_clone(const format_obj * obj) {
 
         format_obj * clone;
@@ -164,6 +209,18 @@
                     printf("type = text_json\n");
                 break;
 
+                case format_binary_wire:
+                    printf("type = binary_wire\n");
+                break;
+
+                case format_lossless_int16:
+                    printf("type = lossless_int16\n");
+                break;
+
+                case format_lossless_int24:
+                    printf("type = lossless_int24\n");
+                break;
+
             }
 
         }
@@ -53,6 +53,14 @@
 
             obj->ip = (char *) NULL;
             obj->port = 0;
+            obj->queueSize = 0;
+            obj->overflow = 0x00;
+            obj->mtu = 0;
+            obj->ttl = 0;
+            obj->batch = 1;
+            obj->latency = 0;
+            obj->rotateSize = 0;
+            obj->rotateTime = 0;
 
         // +----------------------------------------------------------+
         // | Soundcard                                                |
@@ -100,6 +108,14 @@
 
             obj->ip = (char *) NULL;
             obj->port = 0;
+            obj->queueSize = 0;
+            obj->overflow = 0x00;
+            obj->mtu = 0;
+            obj->ttl = 0;
+            obj->batch = 1;
+            obj->latency = 0;
+            obj->rotateSize = 0;
+            obj->rotateTime = 0;
 
         // +----------------------------------------------------------+
         // | Soundcard                                                |
@@ -148,6 +164,127 @@
 
             obj->ip = (char *) NULL;
             obj->port = 0;
+            obj->queueSize = 0;
+            obj->overflow = 0x00;
+            obj->mtu = 0;
+            obj->ttl = 0;
+            obj->batch = 1;
+            obj->latency = 0;
+            obj->rotateSize = 0;
+            obj->rotateTime = 0;
+
+        // +----------------------------------------------------------+
+        // | Soundcard                                                |
+        // +----------------------------------------------------------+
+
+        obj->deviceName = (char *) NULL;
+
+        // +----------------------------------------------------------+
+        // | Terminal                                                 |
+        // +----------------------------------------------------------+
+
+            // (Empty)
+
+        return obj;
+
+    }
+
+    interface_obj * interface_construct_mmap(const char * fileName) {
+
+        interface_obj * obj;
+
+        obj = (interface_obj *) malloc(sizeof(interface_obj));
+
+        // +----------------------------------------------------------+
+        // | Type                                                     |
+        // +----------------------------------------------------------+
+
+            obj->type = interface_mmap;
+
+        // +----------------------------------------------------------+
+        // | Blackhole                                                |
+        // +----------------------------------------------------------+
+
+            // (Empty)
+
+        // +----------------------------------------------------------+
+        // | File                                                     |
+        // +----------------------------------------------------------+
+
+            obj->fileName = (char *) malloc(sizeof(char) * (strlen(fileName)+1));
+            strcpy(obj->fileName, fileName);
+
+        // +----------------------------------------------------------+
+        // | Socket                                                   |
+        // +----------------------------------------------------------+
+
+            obj->ip = (char *) NULL;
+            obj->port = 0;
+            obj->queueSize = 0;
+            obj->overflow = 0x00;
+            obj->mtu = 0;
+            obj->ttl = 0;
+            obj->batch = 1;
+            obj->latency = 0;
+            obj->rotateSize = 0;
+            obj->rotateTime = 0;
+
+        // +----------------------------------------------------------+
+        // | Soundcard                                                |
+        // +----------------------------------------------------------+
+
+        obj->deviceName = (char *) NULL;
+
+        // +----------------------------------------------------------+
+        // | Terminal                                                 |
+        // +----------------------------------------------------------+
+
+            // (Empty)
+
+        return obj;
+
+    }
+
+    interface_obj * interface_construct_wav(const char * fileName) {
+
+        interface_obj * obj;
+
+        obj = (interface_obj *) malloc(sizeof(interface_obj));
+
+        // +----------------------------------------------------------+
+        // | Type                                                     |
+        // +----------------------------------------------------------+
+
+            obj->type = interface_wav;
+
+        // +----------------------------------------------------------+
+        // | Blackhole                                                |
+        // +----------------------------------------------------------+
+
+            // (Empty)
+
+        // +----------------------------------------------------------+
+        // | File                                                     |
+        // +----------------------------------------------------------+
+
+            obj->fileName = (char *) malloc(sizeof(char) * (strlen(fileName)+1));
+            strcpy(obj->fileName, fileName);
+
+        // +----------------------------------------------------------+
+        // | Socket                                                   |
+        // +----------------------------------------------------------+
+
+            obj->ip = (char *) NULL;
+            obj->port = 0;
+            // Audio waits in a 4 MB queue for the writer thread, and new hops are dropped when it fills up
+            obj->queueSize = 4194304;
+            obj->overflow = 'n';
+            obj->mtu = 0;
+            obj->ttl = 0;
+            obj->batch = 1;
+            obj->latency = 0;
+            obj->rotateSize = 0;
+            obj->rotateTime = 0;
 
         // +----------------------------------------------------------+
         // | Soundcard                                                |
@@ -197,6 +334,16 @@
             strcpy(obj->ip, ip);
             obj->port = port;
 
+            // Messages wait in a 1 MB queue, and the oldest ones are dropped when it fills up
+            obj->queueSize = 1048576;
+            obj->overflow = 'o';
+            obj->mtu = 0;
+            obj->ttl = 0;
+            obj->batch = 1;
+            obj->latency = 0;
+            obj->rotateSize = 0;
+            obj->rotateTime = 0;
+
         // +----------------------------------------------------------+
         // | Soundcard                                                |
         // +----------------------------------------------------------+
@@ -213,6 +360,122 @@
 
     }
 
+    interface_obj * interface_construct_udp(const char * ip, const unsigned int port) {
+
+        interface_obj * obj;
+
+        obj = (interface_obj *) malloc(sizeof(interface_obj));
+
+        // +----------------------------------------------------------+
+        // | Type                                                     |
+        // +----------------------------------------------------------+
+
+            obj->type = interface_udp;
+
+        // +----------------------------------------------------------+
+        // | Blackhole                                                |
+        // +----------------------------------------------------------+
+
+            // (Empty)
+
+        // +----------------------------------------------------------+
+        // | File                                                     |
+        // +----------------------------------------------------------+
+
+            obj->fileName = (char *) NULL;
+
+        // +----------------------------------------------------------+
+        // | Socket                                                   |
+        // +----------------------------------------------------------+
+
+            obj->ip = (char *) malloc(sizeof(char) * (strlen(ip)+1));
+            strcpy(obj->ip, ip);
+            obj->port = port;
+
+            obj->queueSize = 0;
+            obj->overflow = 0x00;
+
+            // Datagrams fit in an Ethernet frame (1500 - 20 for IP - 8 for UDP), and multicast stays on the local network
+            obj->mtu = 1472;
+            obj->ttl = 1;
+            obj->batch = 1;
+            obj->latency = 0;
+            obj->rotateSize = 0;
+            obj->rotateTime = 0;
+
+        // +----------------------------------------------------------+
+        // | Soundcard                                                |
+        // +----------------------------------------------------------+
+
+        obj->deviceName = (char *) NULL;
+
+        // +----------------------------------------------------------+
+        // | Terminal                                                 |
+        // +----------------------------------------------------------+
+
+            // (Empty)
+
+        return obj;        
+
+    }
+
+    interface_obj * interface_construct_shm(const char * name, const unsigned int size) {
+
+        interface_obj * obj;
+
+        obj = (interface_obj *) malloc(sizeof(interface_obj));
+
+        // +----------------------------------------------------------+
+        // | Type                                                     |
+        // +----------------------------------------------------------+
+
+            obj->type = interface_shm;
+
+        // +----------------------------------------------------------+
+        // | Blackhole                                                |
+        // +----------------------------------------------------------+
+
+            // (Empty)
+
+        // +----------------------------------------------------------+
+        // | File                                                     |
+        // +----------------------------------------------------------+
+
+            // The segment name (e.g. /odas_tracks) lives in /dev/shm, like a file
+            obj->fileName = (char *) malloc(sizeof(char) * (strlen(name)+1));
+            strcpy(obj->fileName, name);
+
+        // +----------------------------------------------------------+
+        // | Socket                                                   |
+        // +----------------------------------------------------------+
+
+            obj->ip = (char *) NULL;
+            obj->port = 0;
+            obj->queueSize = size;
+            obj->overflow = 0x00;
+            obj->mtu = 0;
+            obj->ttl = 0;
+            obj->batch = 1;
+            obj->latency = 0;
+            obj->rotateSize = 0;
+            obj->rotateTime = 0;
+
+        // +----------------------------------------------------------+
+        // | Soundcard                                                |
+        // +----------------------------------------------------------+
+
+        obj->deviceName = (char *) NULL;
+
+        // +----------------------------------------------------------+
+        // | Terminal                                                 |
+        // +----------------------------------------------------------+
+
+            // (Empty)
+
+        return obj;
+
+    }
+
    interface_obj * interface_construct_soundcard(const unsigned int card, const unsigned int device) {
 
        char * deviceName = (char *) malloc(sizeof(char) * 1024);
@@ -253,6 +516,14 @@
 
        obj->ip = (char *) NULL;
        obj->port = 0;
+       obj->queueSize = 0;
+       obj->overflow = 0x00;
+       obj->mtu = 0;
+       obj->ttl = 0;
+       obj->batch = 1;
+       obj->latency = 0;
+       obj->rotateSize = 0;
+       obj->rotateTime = 0;
 
        // +----------------------------------------------------------+
        // | Soundcard                                                |
@@ -300,6 +571,14 @@
 
             obj->ip = (char *) NULL;
             obj->port = 0;
+            obj->queueSize = 0;
+            obj->overflow = 0x00;
+            obj->mtu = 0;
+            obj->ttl = 0;
+            obj->batch = 1;
+            obj->latency = 0;
+            obj->rotateSize = 0;
+            obj->rotateTime = 0;
 
         // +----------------------------------------------------------+
         // | Soundcard                                                |
@@ -346,6 +625,32 @@
 
             }
 
+            if (obj->type == interface_mmap) {
+                
+                clone->fileName = (char *) malloc(sizeof(char) * (strlen(obj->fileName) + 1));
+                strcpy(clone->fileName, obj->fileName);
+
+            }
+
+            if (obj->type == interface_wav) {
+                
+                clone->fileName = (char *) malloc(sizeof(char) * (strlen(obj->fileName) + 1));
+                strcpy(clone->fileName, obj->fileName);
+                clone->queueSize = obj->queueSize;
+                clone->overflow = obj->overflow;
+                clone->rotateSize = obj->rotateSize;
+                clone->rotateTime = obj->rotateTime;
+
+            }
+
+            if (obj->type == interface_shm) {
+                
+                clone->fileName = (char *) malloc(sizeof(char) * (strlen(obj->fileName) + 1));
+                strcpy(clone->fileName, obj->fileName);
+                clone->queueSize = obj->queueSize;
+
+            }
+
         // +----------------------------------------------------------+
         // | Socket                                                   |
         // +----------------------------------------------------------+                
@@ -355,9 +660,25 @@
                 clone->ip = (char *) malloc(sizeof(char) * (strlen(obj->ip) + 1));
                 strcpy(clone->ip, obj->ip);
                 clone->port = obj->port;
+                clone->queueSize = obj->queueSize;
+                clone->overflow = obj->overflow;
+
+            }
+
+            if (obj->type == interface_udp) {
+                
+                clone->ip = (char *) malloc(sizeof(char) * (strlen(obj->ip) + 1));
+                strcpy(clone->ip, obj->ip);
+                clone->port = obj->port;
+                clone->mtu = obj->mtu;
+                clone->ttl = obj->ttl;
 
             }
 
+            // Any interface a sink writes to
+            clone->batch = obj->batch;
+            clone->latency = obj->latency;
+
         // +----------------------------------------------------------+
         // | Soundcard                                                |
         // +----------------------------------------------------------+
@@ -420,9 +741,33 @@
 
                 break;
 
+                case interface_mmap:
+
+                    printf("type = mmap, fileName = %s\n",obj->fileName);
+
+                break;
+
+                case interface_wav:
+
+                    printf("type = wav, fileName = %s, queueSize = %u, overflow = %c, rotateSize = %llu, rotateTime = %u\n",obj->fileName,obj->queueSize,obj->overflow,obj->rotateSize,obj->rotateTime);
+
+                break;
+
                 case interface_socket:
 
-                    printf("type = socket, ip = %s, port = %u\n",obj->ip,obj->port);
+                    printf("type = socket, ip = %s, port = %u, queueSize = %u, overflow = %c\n",obj->ip,obj->port,obj->queueSize,obj->overflow);
+
+                break;
+
+                case interface_udp:
+
+                    printf("type = udp, ip = %s, port = %u, mtu = %u, ttl = %u\n",obj->ip,obj->port,obj->mtu,obj->ttl);
+
+                break;
+
+                case interface_shm:
+
+                    printf("type = shm, name = %s, size = %u\n",obj->fileName,obj->queueSize);
 
                 break;
 
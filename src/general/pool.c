@@ -0,0 +1,186 @@
+
+   /**
+    * \file     pool.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <general/pool.h>
+
+    void pool_share(pool_obj * obj, void (* task) (void *, const unsigned int, const unsigned int), void * arg, const unsigned int nTasks, const unsigned int iWorker) {
+
+        unsigned int iTask;
+
+        for (iTask = iWorker; iTask < nTasks; iTask += obj->nWorkers) {
+
+            task(arg, iTask, iWorker);
+
+        }
+
+    }
+
+    void * pool_thread(void * ptr) {
+
+        pool_worker_obj * worker;
+        pool_obj * obj;
+        unsigned int generation;
+        void (* task) (void *, const unsigned int, const unsigned int);
+        void * arg;
+        unsigned int nTasks;
+
+        worker = (pool_worker_obj *) ptr;
+        obj = worker->pool;
+
+        // Helpers are spawned by the constructor, before any batch is posted
+        generation = 0;
+
+        while(1) {
+
+            pthread_mutex_lock(&(obj->mutex));
+
+            while ((obj->generation == generation) && (obj->stop == 0)) {
+                pthread_cond_wait(&(obj->start), &(obj->mutex));
+            }
+
+            if (obj->stop == 1) {
+                pthread_mutex_unlock(&(obj->mutex));
+                break;
+            }
+
+            generation = obj->generation;
+            task = obj->task;
+            arg = obj->arg;
+            nTasks = obj->nTasks;
+
+            pthread_mutex_unlock(&(obj->mutex));
+
+            pool_share(obj, task, arg, nTasks, worker->iWorker);
+
+            pthread_mutex_lock(&(obj->mutex));
+
+            obj->nPending--;
+
+            if (obj->nPending == 0) {
+                pthread_cond_signal(&(obj->done));
+            }
+
+            pthread_mutex_unlock(&(obj->mutex));
+
+        }
+
+        return NULL;
+
+    }
+
+    pool_obj * pool_construct(const unsigned int nWorkers) {
+
+        pool_obj * obj;
+        unsigned int iWorker;
+
+        obj = (pool_obj *) malloc(sizeof(pool_obj));
+
+        obj->nWorkers = (nWorkers > 0) ? nWorkers : 1;
+
+        pthread_mutex_init(&(obj->mutex), NULL);
+        pthread_cond_init(&(obj->start), NULL);
+        pthread_cond_init(&(obj->done), NULL);
+
+        obj->generation = 0;
+        obj->nPending = 0;
+        obj->stop = 0;
+
+        obj->task = NULL;
+        obj->arg = NULL;
+        obj->nTasks = 0;
+
+        obj->workers = (pool_worker_obj *) malloc(sizeof(pool_worker_obj) * obj->nWorkers);
+
+        for (iWorker = 1; iWorker < obj->nWorkers; iWorker++) {
+
+            obj->workers[iWorker].pool = obj;
+            obj->workers[iWorker].iWorker = iWorker;
+
+            if (pthread_create(&(obj->workers[iWorker].thread), NULL, pool_thread, &(obj->workers[iWorker])) != 0) {
+
+                printf("Cannot create worker thread.\n");
+                exit(EXIT_FAILURE);
+
+            }
+
+        }
+
+        return obj;
+
+    }
+
+    void pool_destroy(pool_obj * obj) {
+
+        unsigned int iWorker;
+
+        pthread_mutex_lock(&(obj->mutex));
+        obj->stop = 1;
+        pthread_cond_broadcast(&(obj->start));
+        pthread_mutex_unlock(&(obj->mutex));
+
+        for (iWorker = 1; iWorker < obj->nWorkers; iWorker++) {
+
+            pthread_join(obj->workers[iWorker].thread, NULL);
+
+        }
+
+        pthread_mutex_destroy(&(obj->mutex));
+        pthread_cond_destroy(&(obj->start));
+        pthread_cond_destroy(&(obj->done));
+
+        free((void *) obj->workers);
+        free((void *) obj);
+
+    }
+
+    void pool_run(pool_obj * obj, void (* task) (void *, const unsigned int, const unsigned int), void * arg, const unsigned int nTasks) {
+
+        if ((obj->nWorkers == 1) || (nTasks <= 1)) {
+
+            pool_share(obj, task, arg, nTasks, 0);
+            return;
+
+        }
+
+        pthread_mutex_lock(&(obj->mutex));
+
+        obj->task = task;
+        obj->arg = arg;
+        obj->nTasks = nTasks;
+        obj->nPending = obj->nWorkers - 1;
+        obj->generation++;
+
+        pthread_cond_broadcast(&(obj->start));
+        pthread_mutex_unlock(&(obj->mutex));
+
+        pool_share(obj, task, arg, nTasks, 0);
+
+        pthread_mutex_lock(&(obj->mutex));
+
+        while (obj->nPending > 0) {
+            pthread_cond_wait(&(obj->done), &(obj->mutex));
+        }
+
+        pthread_mutex_unlock(&(obj->mutex));
+
+    }
@@ -0,0 +1,640 @@
+
+   /**
+    * \file     recorder.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <general/recorder.h>
+
+    recorder_obj * recorder_construct(const char * name, const interface_obj * interface, const unsigned int fS, const unsigned int nChannels, const unsigned int nBits, const char isFloat) {
+
+        recorder_obj * obj;
+        unsigned long long rotateTimeBytes;
+
+        obj = (recorder_obj *) malloc(sizeof(recorder_obj));
+
+        obj->name = (char *) malloc(sizeof(char) * (strlen(name) + 1));
+        strcpy(obj->name, name);
+
+        obj->pattern = (char *) malloc(sizeof(char) * (strlen(interface->fileName) + 1));
+        strcpy(obj->pattern, interface->fileName);
+
+        obj->overflow = interface->overflow;
+
+        if ((obj->overflow != 'o') && (obj->overflow != 'n') && (obj->overflow != 'b')) {
+            printf("%s: Invalid overflow policy.\n", obj->name);
+            exit(EXIT_FAILURE);
+        }
+
+        if ((nBits != 16) && (nBits != 24) && (nBits != 32)) {
+            printf("%s: Invalid number of bits for a wav file.\n", obj->name);
+            exit(EXIT_FAILURE);
+        }
+
+        obj->fS = fS;
+        obj->nChannels = nChannels;
+        obj->nBits = nBits;
+        obj->formatTag = (isFloat == 1) ? 3 : 1;
+        obj->blockAlign = nChannels * (nBits / 8);
+
+        // Files end on a sample frame, after rotateSize bytes or rotateTime seconds of audio,
+        // whichever comes first
+        obj->rotateBytes = 0;
+
+        if (interface->rotateSize != 0) {
+
+            obj->rotateBytes = (interface->rotateSize / obj->blockAlign) * obj->blockAlign;
+
+            if (obj->rotateBytes == 0) {
+                obj->rotateBytes = obj->blockAlign;
+            }
+
+        }
+
+        if (interface->rotateTime != 0) {
+
+            rotateTimeBytes = ((unsigned long long) interface->rotateTime) * ((unsigned long long) fS) * ((unsigned long long) obj->blockAlign);
+
+            if ((obj->rotateBytes == 0) || (rotateTimeBytes < obj->rotateBytes)) {
+                obj->rotateBytes = rotateTimeBytes;
+            }
+
+        }
+
+        obj->ringSize = (interface->queueSize / obj->blockAlign) * obj->blockAlign;
+
+        if (obj->ringSize == 0) {
+            printf("%s: Invalid queue size.\n", obj->name);
+            exit(EXIT_FAILURE);
+        }
+
+        obj->ring = (char *) malloc(sizeof(char) * obj->ringSize);
+        obj->ringHead = 0;
+        obj->ringUsed = 0;
+
+        obj->chunkSize = (recorder_chunkSize / obj->blockAlign) * obj->blockAlign;
+
+        if (obj->chunkSize == 0) {
+            obj->chunkSize = obj->blockAlign;
+        }
+
+        obj->chunk = (char *) malloc(sizeof(char) * obj->chunkSize);
+
+        obj->fd = -1;
+        obj->fileName = (char *) malloc(sizeof(char) * 4096);
+        obj->fileName[0] = 0x00;
+        obj->iFile = 0;
+        obj->nFiles = 0;
+        obj->dataSize = 0;
+        obj->headerTime = 0;
+        obj->failed = 0;
+
+        obj->nBytesWritten = 0;
+        obj->nBytesDropped = 0;
+        obj->nPushesDropped = 0;
+        obj->highWater = 0;
+
+        memset(&(obj->reported), 0x00, sizeof(recorder_stats_obj));
+        obj->reportTime = time(NULL);
+
+        pthread_mutex_init(&(obj->mutex), NULL);
+        pthread_cond_init(&(obj->filled), NULL);
+        pthread_cond_init(&(obj->emptied), NULL);
+        obj->stop = 0;
+
+        // The first file is opened here, so a wrong path is reported right away
+        if (recorder_open(obj) != 0) {
+            exit(EXIT_FAILURE);
+        }
+
+        if (pthread_create(&(obj->thread), NULL, recorder_thread, (void *) obj) != 0) {
+            printf("%s: Cannot create recorder thread.\n", obj->name);
+            exit(EXIT_FAILURE);
+        }
+
+        return obj;
+
+    }
+
+    void recorder_destroy(recorder_obj * obj) {
+
+        pthread_mutex_lock(&(obj->mutex));
+        obj->stop = 1;
+        pthread_cond_broadcast(&(obj->filled));
+        pthread_cond_broadcast(&(obj->emptied));
+        pthread_mutex_unlock(&(obj->mutex));
+
+        pthread_join(obj->thread, NULL);
+
+        recorder_close(obj);
+
+        // Losses are otherwise silent
+        if (obj->nBytesDropped > 0) {
+            recorder_printf(obj);
+        }
+
+        pthread_mutex_destroy(&(obj->mutex));
+        pthread_cond_destroy(&(obj->filled));
+        pthread_cond_destroy(&(obj->emptied));
+
+        free((void *) obj->fileName);
+        free((void *) obj->chunk);
+        free((void *) obj->ring);
+        free((void *) obj->pattern);
+        free((void *) obj->name);
+        free((void *) obj);
+
+    }
+
+    void recorder_push(recorder_obj * obj, const char * bytes, const unsigned int nBytes) {
+
+        unsigned int nBytesMissing;
+
+        pthread_mutex_lock(&(obj->mutex));
+
+        // Audio that can never fit is lost whatever the policy
+        if (nBytes > obj->ringSize) {
+
+            obj->nPushesDropped++;
+            obj->nBytesDropped += nBytes;
+
+            pthread_mutex_unlock(&(obj->mutex));
+            return;
+
+        }
+
+        switch (obj->overflow) {
+
+            case 'o':
+
+                // Both the queue and the pushes hold whole sample frames
+                if ((obj->ringSize - obj->ringUsed) < nBytes) {
+
+                    nBytesMissing = nBytes - (obj->ringSize - obj->ringUsed);
+                    nBytesMissing = ((nBytesMissing + obj->blockAlign - 1) / obj->blockAlign) * obj->blockAlign;
+
+                    recorder_ring_read(obj, NULL, nBytesMissing);
+
+                    obj->nPushesDropped++;
+                    obj->nBytesDropped += nBytesMissing;
+
+                }
+
+            break;
+
+            case 'n':
+
+                if ((obj->ringSize - obj->ringUsed) < nBytes) {
+
+                    obj->nPushesDropped++;
+                    obj->nBytesDropped += nBytes;
+
+                    pthread_mutex_unlock(&(obj->mutex));
+                    return;
+
+                }
+
+            break;
+
+            case 'b':
+
+                while (((obj->ringSize - obj->ringUsed) < nBytes) && (obj->stop == 0)) {
+                    pthread_cond_wait(&(obj->emptied), &(obj->mutex));
+                }
+
+                if (obj->stop == 1) {
+                    pthread_mutex_unlock(&(obj->mutex));
+                    return;
+                }
+
+            break;
+
+        }
+
+        recorder_ring_write(obj, bytes, nBytes);
+
+        if (obj->ringUsed > obj->highWater) {
+            obj->highWater = obj->ringUsed;
+        }
+
+        pthread_cond_signal(&(obj->filled));
+        pthread_mutex_unlock(&(obj->mutex));
+
+    }
+
+    void recorder_ring_write(recorder_obj * obj, const char * bytes, const unsigned int nBytes) {
+
+        unsigned int tail;
+        unsigned int nBytesFirst;
+
+        tail = (obj->ringHead + obj->ringUsed) % obj->ringSize;
+        nBytesFirst = obj->ringSize - tail;
+
+        if (nBytesFirst >= nBytes) {
+
+            memcpy(&(obj->ring[tail]), bytes, nBytes);
+
+        }
+        else {
+
+            memcpy(&(obj->ring[tail]), bytes, nBytesFirst);
+            memcpy(obj->ring, &(bytes[nBytesFirst]), nBytes - nBytesFirst);
+
+        }
+
+        obj->ringUsed += nBytes;
+
+    }
+
+    void recorder_ring_read(recorder_obj * obj, char * bytes, const unsigned int nBytes) {
+
+        unsigned int nBytesFirst;
+
+        if (bytes != NULL) {
+
+            nBytesFirst = obj->ringSize - obj->ringHead;
+
+            if (nBytesFirst >= nBytes) {
+
+                memcpy(bytes, &(obj->ring[obj->ringHead]), nBytes);
+
+            }
+            else {
+
+                memcpy(bytes, &(obj->ring[obj->ringHead]), nBytesFirst);
+                memcpy(&(bytes[nBytesFirst]), obj->ring, nBytes - nBytesFirst);
+
+            }
+
+        }
+
+        obj->ringHead = (obj->ringHead + nBytes) % obj->ringSize;
+        obj->ringUsed -= nBytes;
+
+    }
+
+    int recorder_open(recorder_obj * obj) {
+
+        char expanded[4096];
+        char * extension;
+        char * slash;
+        time_t now;
+        struct tm local;
+        unsigned int iTry;
+
+        now = time(NULL);
+        localtime_r(&now, &local);
+
+        obj->dataSize = 0;
+        obj->headerTime = now;
+
+        if (strftime(expanded, sizeof(expanded), obj->pattern, &local) == 0) {
+            printf("%s: Invalid file name %s\n", obj->name, obj->pattern);
+            obj->fd = -1;
+            obj->failed = 1;
+            return -1;
+        }
+
+        if (obj->rotateBytes == 0) {
+
+            strcpy(obj->fileName, expanded);
+            obj->fd = open(obj->fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+        }
+        else {
+
+            // Rotated files are always numbered, and an existing file is never overwritten:
+            // the index moves past files left by an earlier run or with the same expanded name
+            slash = strrchr(expanded, '/');
+            extension = strrchr(expanded, '.');
+
+            if ((extension != NULL) && (slash != NULL) && (extension < slash)) {
+                extension = NULL;
+            }
+
+            obj->fd = -1;
+
+            for (iTry = 0; iTry < recorder_maxTries; iTry++) {
+
+                if (extension != NULL) {
+                    snprintf(obj->fileName, 4096, "%.*s-%04u%s", (int) (extension - expanded), expanded, obj->iFile, extension);
+                }
+                else {
+                    snprintf(obj->fileName, 4096, "%s-%04u", expanded, obj->iFile);
+                }
+
+                obj->iFile++;
+
+                obj->fd = open(obj->fileName, O_WRONLY | O_CREAT | O_EXCL, 0644);
+
+                if ((obj->fd >= 0) || (errno != EEXIST)) {
+                    break;
+                }
+
+            }
+
+        }
+
+        if (obj->fd < 0) {
+            printf("%s: Cannot open file %s (%s).\n", obj->name, obj->fileName, strerror(errno));
+            obj->failed = 1;
+            return -1;
+        }
+
+        pthread_mutex_lock(&(obj->mutex));
+        obj->nFiles++;
+        pthread_mutex_unlock(&(obj->mutex));
+
+        obj->failed = 0;
+
+        // The header is rewritten as the file grows, so even a file that is never closed can be read
+        recorder_header(obj);
+
+        return 0;
+
+    }
+
+    void recorder_close(recorder_obj * obj) {
+
+        char pad;
+
+        if (obj->fd < 0) {
+            return;
+        }
+
+        // Chunks have an even size
+        if ((obj->dataSize % 2) == 1) {
+            pad = 0x00;
+            if (pwrite(obj->fd, &pad, 1, recorder_headerSize + obj->dataSize) != 1) {
+                printf("%s: Cannot write to %s (%s).\n", obj->name, obj->fileName, strerror(errno));
+            }
+        }
+
+        recorder_header(obj);
+
+        close(obj->fd);
+        obj->fd = -1;
+
+    }
+
+    void recorder_header(recorder_obj * obj) {
+
+        unsigned char header[recorder_headerSize];
+        unsigned long long riffSize;
+
+        if (obj->fd < 0) {
+            return;
+        }
+
+        riffSize = (recorder_headerSize - 8) + obj->dataSize + (obj->dataSize % 2);
+
+        memset(header, 0x00, recorder_headerSize);
+
+        // RIFF sizes are 32 bits: larger files become RF64, and the JUNK chunk reserved
+        // for this purpose becomes the ds64 chunk with the 64-bit sizes (EBU Tech 3306)
+        if (riffSize > 0xFFFFFFFFull) {
+
+            memcpy(&(header[0]), "RF64", 4);
+            recorder_le(&(header[4]), 0xFFFFFFFFull, 4);
+            memcpy(&(header[12]), "ds64", 4);
+            recorder_le(&(header[16]), 28, 4);
+            recorder_le(&(header[20]), riffSize, 8);
+            recorder_le(&(header[28]), obj->dataSize, 8);
+            recorder_le(&(header[36]), obj->dataSize / obj->blockAlign, 8);
+            recorder_le(&(header[44]), 0, 4);
+            recorder_le(&(header[76]), 0xFFFFFFFFull, 4);
+
+        }
+        else {
+
+            memcpy(&(header[0]), "RIFF", 4);
+            recorder_le(&(header[4]), riffSize, 4);
+            memcpy(&(header[12]), "JUNK", 4);
+            recorder_le(&(header[16]), 28, 4);
+            recorder_le(&(header[76]), obj->dataSize, 4);
+
+        }
+
+        memcpy(&(header[8]), "WAVE", 4);
+
+        memcpy(&(header[48]), "fmt ", 4);
+        recorder_le(&(header[52]), 16, 4);
+        recorder_le(&(header[56]), obj->formatTag, 2);
+        recorder_le(&(header[58]), obj->nChannels, 2);
+        recorder_le(&(header[60]), obj->fS, 4);
+        recorder_le(&(header[64]), obj->fS * obj->blockAlign, 4);
+        recorder_le(&(header[68]), obj->blockAlign, 2);
+        recorder_le(&(header[70]), obj->nBits, 2);
+
+        memcpy(&(header[72]), "data", 4);
+
+        if (pwrite(obj->fd, header, recorder_headerSize, 0) != recorder_headerSize) {
+            printf("%s: Cannot write the header of %s (%s).\n", obj->name, obj->fileName, strerror(errno));
+        }
+
+    }
+
+    void recorder_le(unsigned char * bytes, const unsigned long long value, const unsigned int nBytes) {
+
+        unsigned int iByte;
+
+        for (iByte = 0; iByte < nBytes; iByte++) {
+            bytes[iByte] = (unsigned char) ((value >> (8 * iByte)) & 0xFF);
+        }
+
+    }
+
+    void recorder_write(recorder_obj * obj, const char * bytes, const unsigned int nBytes) {
+
+        unsigned int nBytesWritten;
+        ssize_t rtnValue;
+
+        nBytesWritten = 0;
+
+        // No file (it could not be opened): the audio is lost, but still counts towards the
+        // rotation, so another file is tried at the next one
+        if (obj->fd < 0) {
+            obj->dataSize += nBytes;
+        }
+
+        while ((obj->fd >= 0) && (nBytesWritten < nBytes)) {
+
+            rtnValue = pwrite(obj->fd, &(bytes[nBytesWritten]), nBytes - nBytesWritten, recorder_headerSize + obj->dataSize + nBytesWritten);
+
+            if (rtnValue < 0) {
+
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                // Reported once per file, the audio is lost but the pipeline keeps going
+                if (obj->failed == 0) {
+                    printf("%s: Cannot write to %s (%s).\n", obj->name, obj->fileName, strerror(errno));
+                    obj->failed = 1;
+                }
+
+                break;
+
+            }
+
+            nBytesWritten += (unsigned int) rtnValue;
+
+        }
+
+        // Only whole sample frames count, so the file stays aligned
+        nBytesWritten = (nBytesWritten / obj->blockAlign) * obj->blockAlign;
+
+        if (obj->fd >= 0) {
+            obj->dataSize += nBytesWritten;
+        }
+
+        pthread_mutex_lock(&(obj->mutex));
+
+        obj->nBytesWritten += nBytesWritten;
+
+        if (nBytesWritten < nBytes) {
+            obj->nPushesDropped++;
+            obj->nBytesDropped += nBytes - nBytesWritten;
+        }
+
+        pthread_mutex_unlock(&(obj->mutex));
+
+    }
+
+    void * recorder_thread(void * ptr) {
+
+        recorder_obj * obj;
+        unsigned int nBytes;
+        time_t now;
+
+        obj = (recorder_obj *) ptr;
+
+        while (1) {
+
+            pthread_mutex_lock(&(obj->mutex));
+
+            while ((obj->ringUsed == 0) && (obj->stop == 0)) {
+                pthread_cond_wait(&(obj->filled), &(obj->mutex));
+            }
+
+            // Everything queued before the stop is written
+            if (obj->ringUsed == 0) {
+                pthread_mutex_unlock(&(obj->mutex));
+                break;
+            }
+
+            // The current file is full: switch files without holding the queue
+            if ((obj->rotateBytes != 0) && (obj->dataSize >= obj->rotateBytes)) {
+
+                pthread_mutex_unlock(&(obj->mutex));
+
+                // A failed open only loses audio until the next rotation
+                recorder_close(obj);
+                recorder_open(obj);
+
+                continue;
+
+            }
+
+            nBytes = obj->ringUsed;
+
+            if (nBytes > obj->chunkSize) {
+                nBytes = obj->chunkSize;
+            }
+
+            if ((obj->rotateBytes != 0) && (nBytes > (obj->rotateBytes - obj->dataSize))) {
+                nBytes = (unsigned int) (obj->rotateBytes - obj->dataSize);
+            }
+
+            recorder_ring_read(obj, obj->chunk, nBytes);
+
+            pthread_cond_signal(&(obj->emptied));
+            pthread_mutex_unlock(&(obj->mutex));
+
+            recorder_write(obj, obj->chunk, nBytes);
+
+            // Keep the header at most a second behind the audio
+            now = time(NULL);
+
+            if (now != obj->headerTime) {
+                recorder_header(obj);
+                obj->headerTime = now;
+            }
+
+            recorder_report(obj);
+
+        }
+
+        return NULL;
+
+    }
+
+    void recorder_stats(recorder_obj * obj, recorder_stats_obj * stats) {
+
+        pthread_mutex_lock(&(obj->mutex));
+
+        stats->nBytesWritten = obj->nBytesWritten;
+        stats->nFiles = obj->nFiles;
+        stats->nBytesDropped = obj->nBytesDropped;
+        stats->nPushesDropped = obj->nPushesDropped;
+        stats->highWater = obj->highWater;
+        stats->ringSize = obj->ringSize;
+
+        pthread_mutex_unlock(&(obj->mutex));
+
+    }
+
+    void recorder_report(recorder_obj * obj) {
+
+        recorder_stats_obj stats;
+        time_t now;
+
+        now = time(NULL);
+
+        if ((now - obj->reportTime) < recorder_reportPeriod) {
+            return;
+        }
+
+        obj->reportTime = now;
+
+        recorder_stats(obj, &stats);
+
+        // A disk that keeps up stays quiet
+        if ((stats.nBytesDropped != obj->reported.nBytesDropped) ||
+            (stats.highWater != obj->reported.highWater)) {
+
+            recorder_printf(obj);
+
+        }
+
+        obj->reported = stats;
+
+    }
+
+    void recorder_printf(recorder_obj * obj) {
+
+        recorder_stats_obj stats;
+
+        recorder_stats(obj, &stats);
+
+        printf("%s: %llu byte(s) written in %u file(s), %llu dropped in %llu push(es), queue high-water mark %u/%u bytes.\n",
+               obj->name, stats.nBytesWritten, stats.nFiles, stats.nBytesDropped, stats.nPushesDropped, stats.highWater, stats.ringSize);
+
+    }
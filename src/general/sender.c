@@ -0,0 +1,550 @@
+
+   /**
+    * \file     sender.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <general/sender.h>
+
+    sender_obj * sender_construct(const char * name, const interface_obj * interface) {
+
+        sender_obj * obj;
+
+        obj = (sender_obj *) malloc(sizeof(sender_obj));
+
+        obj->name = (char *) malloc(sizeof(char) * (strlen(name) + 1));
+        strcpy(obj->name, name);
+
+        memset(&(obj->sserver), 0x00, sizeof(struct sockaddr_in));
+
+        obj->sserver.sin_family = AF_INET;
+        obj->sserver.sin_addr.s_addr = inet_addr(interface->ip);
+        obj->sserver.sin_port = htons(interface->port);
+
+        obj->overflow = interface->overflow;
+
+        if ((obj->overflow != 'o') && (obj->overflow != 'n') && (obj->overflow != 'b')) {
+            printf("%s: Invalid overflow policy.\n", obj->name);
+            exit(EXIT_FAILURE);
+        }
+
+        if (interface->queueSize < 4) {
+            printf("%s: Invalid queue size.\n", obj->name);
+            exit(EXIT_FAILURE);
+        }
+
+        obj->ringSize = interface->queueSize;
+        obj->ring = (char *) malloc(sizeof(char) * obj->ringSize);
+        obj->ringHead = 0;
+        obj->ringUsed = 0;
+        obj->nMessages = 0;
+
+        obj->message = (char *) malloc(sizeof(char) * obj->ringSize);
+        obj->messageSize = 0;
+
+        obj->sid = -1;
+        obj->warned = 0;
+
+        obj->nMessagesSent = 0;
+        obj->nMessagesDropped = 0;
+        obj->nBytesDropped = 0;
+        obj->highWater = 0;
+        obj->nConnections = 0;
+
+        memset(&(obj->reported), 0x00, sizeof(sender_stats_obj));
+        obj->reportTime = time(NULL);
+
+        pthread_mutex_init(&(obj->mutex), NULL);
+        pthread_cond_init(&(obj->filled), NULL);
+        pthread_cond_init(&(obj->emptied), NULL);
+        obj->stop = 0;
+
+        if (pthread_create(&(obj->thread), NULL, sender_thread, (void *) obj) != 0) {
+            printf("%s: Cannot create sender thread.\n", obj->name);
+            exit(EXIT_FAILURE);
+        }
+
+        return obj;
+
+    }
+
+    void sender_destroy(sender_obj * obj) {
+
+        pthread_mutex_lock(&(obj->mutex));
+        obj->stop = 1;
+        pthread_cond_broadcast(&(obj->filled));
+        pthread_cond_broadcast(&(obj->emptied));
+        pthread_mutex_unlock(&(obj->mutex));
+
+        pthread_join(obj->thread, NULL);
+
+        // Losses and reconnections are otherwise silent
+        if ((obj->nMessagesDropped > 0) || (obj->nConnections > 1)) {
+            sender_printf(obj);
+        }
+
+        if (obj->sid >= 0) {
+            close(obj->sid);
+        }
+
+        pthread_mutex_destroy(&(obj->mutex));
+        pthread_cond_destroy(&(obj->filled));
+        pthread_cond_destroy(&(obj->emptied));
+
+        free((void *) obj->message);
+        free((void *) obj->ring);
+        free((void *) obj->name);
+        free((void *) obj);
+
+    }
+
+    void sender_push(sender_obj * obj, const char * bytes, const unsigned int nBytes) {
+
+        unsigned int nBytesTotal;
+        unsigned char size[4];
+
+        nBytesTotal = 4 + nBytes;
+
+        pthread_mutex_lock(&(obj->mutex));
+
+        // A message that can never fit is lost whatever the policy
+        if (nBytesTotal > obj->ringSize) {
+
+            obj->nMessagesDropped++;
+            obj->nBytesDropped += nBytes;
+
+            pthread_mutex_unlock(&(obj->mutex));
+            return;
+
+        }
+
+        switch (obj->overflow) {
+
+            case 'o':
+
+                while ((obj->ringSize - obj->ringUsed) < nBytesTotal) {
+                    sender_drop(obj);
+                }
+
+            break;
+
+            case 'n':
+
+                if ((obj->ringSize - obj->ringUsed) < nBytesTotal) {
+
+                    obj->nMessagesDropped++;
+                    obj->nBytesDropped += nBytes;
+
+                    pthread_mutex_unlock(&(obj->mutex));
+                    return;
+
+                }
+
+            break;
+
+            case 'b':
+
+                while (((obj->ringSize - obj->ringUsed) < nBytesTotal) && (obj->stop == 0)) {
+                    pthread_cond_wait(&(obj->emptied), &(obj->mutex));
+                }
+
+                if (obj->stop == 1) {
+                    pthread_mutex_unlock(&(obj->mutex));
+                    return;
+                }
+
+            break;
+
+        }
+
+        size[0] = (unsigned char) (nBytes & 0xFF);
+        size[1] = (unsigned char) ((nBytes >> 8) & 0xFF);
+        size[2] = (unsigned char) ((nBytes >> 16) & 0xFF);
+        size[3] = (unsigned char) ((nBytes >> 24) & 0xFF);
+
+        sender_ring_write(obj, (const char *) size, 4);
+        sender_ring_write(obj, bytes, nBytes);
+        obj->nMessages++;
+
+        if (obj->ringUsed > obj->highWater) {
+            obj->highWater = obj->ringUsed;
+        }
+
+        pthread_cond_signal(&(obj->filled));
+        pthread_mutex_unlock(&(obj->mutex));
+
+    }
+
+    void sender_pop(sender_obj * obj) {
+
+        unsigned char size[4];
+
+        sender_ring_read(obj, (char *) size, 4);
+
+        obj->messageSize = ((unsigned int) size[0]) |
+                           (((unsigned int) size[1]) << 8) |
+                           (((unsigned int) size[2]) << 16) |
+                           (((unsigned int) size[3]) << 24);
+
+        sender_ring_read(obj, obj->message, obj->messageSize);
+        obj->nMessages--;
+
+        pthread_cond_broadcast(&(obj->emptied));
+
+    }
+
+    void sender_drop(sender_obj * obj) {
+
+        unsigned char size[4];
+        unsigned int nBytes;
+
+        sender_ring_read(obj, (char *) size, 4);
+
+        nBytes = ((unsigned int) size[0]) |
+                 (((unsigned int) size[1]) << 8) |
+                 (((unsigned int) size[2]) << 16) |
+                 (((unsigned int) size[3]) << 24);
+
+        sender_ring_read(obj, (char *) NULL, nBytes);
+        obj->nMessages--;
+
+        obj->nMessagesDropped++;
+        obj->nBytesDropped += nBytes;
+
+    }
+
+    void sender_ring_write(sender_obj * obj, const char * bytes, const unsigned int nBytes) {
+
+        unsigned int tail;
+        unsigned int nBytesFirst;
+
+        tail = (obj->ringHead + obj->ringUsed) % obj->ringSize;
+        nBytesFirst = obj->ringSize - tail;
+
+        if (nBytesFirst >= nBytes) {
+
+            memcpy(&(obj->ring[tail]), bytes, nBytes);
+
+        }
+        else {
+
+            memcpy(&(obj->ring[tail]), bytes, nBytesFirst);
+            memcpy(obj->ring, &(bytes[nBytesFirst]), nBytes - nBytesFirst);
+
+        }
+
+        obj->ringUsed += nBytes;
+
+    }
+
+    void sender_ring_read(sender_obj * obj, char * bytes, const unsigned int nBytes) {
+
+        unsigned int nBytesFirst;
+
+        if (bytes != NULL) {
+
+            nBytesFirst = obj->ringSize - obj->ringHead;
+
+            if (nBytesFirst >= nBytes) {
+
+                memcpy(bytes, &(obj->ring[obj->ringHead]), nBytes);
+
+            }
+            else {
+
+                memcpy(bytes, &(obj->ring[obj->ringHead]), nBytesFirst);
+                memcpy(&(bytes[nBytesFirst]), obj->ring, nBytes - nBytesFirst);
+
+            }
+
+        }
+
+        obj->ringHead = (obj->ringHead + nBytes) % obj->ringSize;
+        obj->ringUsed -= nBytes;
+
+    }
+
+    int sender_connect(sender_obj * obj) {
+
+        struct pollfd pfd;
+        int err;
+        socklen_t errSize;
+
+        obj->sid = socket(AF_INET, SOCK_STREAM, 0);
+
+        if (obj->sid < 0) {
+            return -1;
+        }
+
+        fcntl(obj->sid, F_SETFL, fcntl(obj->sid, F_GETFL, 0) | O_NONBLOCK);
+
+        if (connect(obj->sid, (struct sockaddr *) &(obj->sserver), sizeof(obj->sserver)) < 0) {
+
+            if (errno != EINPROGRESS) {
+                close(obj->sid);
+                obj->sid = -1;
+                return -1;
+            }
+
+            // The connection completes in the background: wait up to one second
+            pfd.fd = obj->sid;
+            pfd.events = POLLOUT;
+
+            err = 0;
+            errSize = sizeof(err);
+
+            if ((poll(&pfd, 1, 1000) != 1) || 
+                (getsockopt(obj->sid, SOL_SOCKET, SO_ERROR, &err, &errSize) < 0) || 
+                (err != 0)) {
+
+                close(obj->sid);
+                obj->sid = -1;
+                return -1;
+
+            }
+
+        }
+
+        return 0;
+
+    }
+
+    int sender_send(sender_obj * obj) {
+
+        unsigned int nBytesSent;
+        ssize_t nBytes;
+        struct pollfd pfd;
+        char stop;
+
+        nBytesSent = 0;
+
+        pfd.fd = obj->sid;
+        pfd.events = POLLOUT;
+
+        while (nBytesSent < obj->messageSize) {
+
+            nBytes = send(obj->sid, &(obj->message[nBytesSent]), obj->messageSize - nBytesSent, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+            if (nBytes > 0) {
+                nBytesSent += (unsigned int) nBytes;
+                continue;
+            }
+
+            if ((nBytes < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)) {
+                return -1;
+            }
+
+            // The server is slow: wait for room, and give up if a stop is pending
+            if (poll(&pfd, 1, 100) == 0) {
+
+                // This is when the queue overflows, so the drops are reported while it lasts
+                sender_report(obj);
+
+                pthread_mutex_lock(&(obj->mutex));
+                stop = obj->stop;
+                pthread_mutex_unlock(&(obj->mutex));
+
+                if (stop == 1) {
+                    return -1;
+                }
+
+            }
+
+        }
+
+        return 0;
+
+    }
+
+    void * sender_thread(void * ptr) {
+
+        sender_obj * obj;
+        unsigned int backoff;
+        struct timespec deadline;
+
+        obj = (sender_obj *) ptr;
+
+        backoff = 100;
+
+        while(1) {
+
+            sender_report(obj);
+
+            // +--------------------------------------------------+
+            // | Connect (with an exponential backoff)            |
+            // +--------------------------------------------------+
+
+            if (obj->sid < 0) {
+
+                if (sender_connect(obj) < 0) {
+
+                    if (obj->warned == 0) {
+                        printf("%s: Cannot connect to server, retrying in the background.\n", obj->name);
+                        obj->warned = 1;
+                    }
+
+                    clock_gettime(CLOCK_REALTIME, &deadline);
+                    deadline.tv_sec += backoff / 1000;
+                    deadline.tv_nsec += (backoff % 1000) * 1000000;
+
+                    if (deadline.tv_nsec >= 1000000000) {
+                        deadline.tv_sec++;
+                        deadline.tv_nsec -= 1000000000;
+                    }
+
+                    backoff = (backoff < 2500) ? (2 * backoff) : 5000;
+
+                    // Messages keep being queued (and dropped according to the policy) meanwhile
+                    pthread_mutex_lock(&(obj->mutex));
+
+                    while (obj->stop == 0) {
+
+                        if (pthread_cond_timedwait(&(obj->filled), &(obj->mutex), &deadline) == ETIMEDOUT) {
+                            break;
+                        }
+
+                    }
+
+                    if (obj->stop == 1) {
+                        pthread_mutex_unlock(&(obj->mutex));
+                        break;
+                    }
+
+                    pthread_mutex_unlock(&(obj->mutex));
+
+                    continue;
+
+                }
+
+                if (obj->warned == 1) {
+                    printf("%s: Connected to server.\n", obj->name);
+                    obj->warned = 0;
+                }
+
+                pthread_mutex_lock(&(obj->mutex));
+                obj->nConnections++;
+                pthread_mutex_unlock(&(obj->mutex));
+
+                backoff = 100;
+
+            }
+
+            // +--------------------------------------------------+
+            // | Send the oldest message                          |
+            // +--------------------------------------------------+
+
+            pthread_mutex_lock(&(obj->mutex));
+
+            while ((obj->nMessages == 0) && (obj->stop == 0)) {
+                pthread_cond_wait(&(obj->filled), &(obj->mutex));
+            }
+
+            // On a stop, whatever is still queued gets flushed first
+            if (obj->nMessages == 0) {
+                pthread_mutex_unlock(&(obj->mutex));
+                break;
+            }
+
+            sender_pop(obj);
+
+            pthread_mutex_unlock(&(obj->mutex));
+
+            if (sender_send(obj) == 0) {
+
+                pthread_mutex_lock(&(obj->mutex));
+                obj->nMessagesSent++;
+                pthread_mutex_unlock(&(obj->mutex));
+
+            }
+            else {
+
+                // The server will not see the rest of this message, so it is lost
+                close(obj->sid);
+                obj->sid = -1;
+
+                pthread_mutex_lock(&(obj->mutex));
+                obj->nMessagesDropped++;
+                obj->nBytesDropped += obj->messageSize;
+                pthread_mutex_unlock(&(obj->mutex));
+
+                printf("%s: Connection to server lost.\n", obj->name);
+                obj->warned = 1;
+
+            }
+
+        }
+
+        return NULL;
+
+    }
+
+    void sender_stats(sender_obj * obj, sender_stats_obj * stats) {
+
+        pthread_mutex_lock(&(obj->mutex));
+
+        stats->nMessagesSent = obj->nMessagesSent;
+        stats->nMessagesDropped = obj->nMessagesDropped;
+        stats->nBytesDropped = obj->nBytesDropped;
+        stats->highWater = obj->highWater;
+        stats->ringSize = obj->ringSize;
+        stats->nConnections = obj->nConnections;
+
+        pthread_mutex_unlock(&(obj->mutex));
+
+    }
+
+    void sender_report(sender_obj * obj) {
+
+        sender_stats_obj stats;
+        time_t now;
+
+        now = time(NULL);
+
+        if ((now - obj->reportTime) < sender_reportPeriod) {
+            return;
+        }
+
+        obj->reportTime = now;
+
+        sender_stats(obj, &stats);
+
+        // A steady stream that loses nothing stays quiet
+        if ((stats.nMessagesDropped != obj->reported.nMessagesDropped) ||
+            (stats.nConnections != obj->reported.nConnections) ||
+            (stats.highWater != obj->reported.highWater)) {
+
+            sender_printf(obj);
+
+        }
+
+        obj->reported = stats;
+
+    }
+
+    void sender_printf(sender_obj * obj) {
+
+        sender_stats_obj stats;
+
+        sender_stats(obj, &stats);
+
+        printf("%s: %llu message(s) sent, %llu dropped (%llu bytes), queue high-water mark %u/%u bytes, %u connection(s).\n",
+               obj->name, stats.nMessagesSent, stats.nMessagesDropped, stats.nBytesDropped, stats.highWater, stats.ringSize, stats.nConnections);
+
+    }
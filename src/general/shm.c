@@ -0,0 +1,331 @@
+
+   /**
+    * \file     shm.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <general/shm.h>
+
+    shm_writer_obj * shm_writer_construct(const char * name, const unsigned int capacity) {
+
+        shm_writer_obj * obj;
+        int fd;
+
+        obj = (shm_writer_obj *) malloc(sizeof(shm_writer_obj));
+
+        obj->name = (char *) malloc(sizeof(char) * (strlen(name) + 1));
+        strcpy(obj->name, name);
+
+        if ((capacity < 4096) || ((capacity % 16) != 0)) {
+            printf("Shared memory %s: Size must be a multiple of 16 bytes, and at least 4096 bytes.\n", obj->name);
+            exit(EXIT_FAILURE);
+        }
+
+        // Readers still attached to a previous segment keep it, and see it closed
+        shm_unlink(obj->name);
+
+        fd = shm_open(obj->name, O_CREAT | O_EXCL | O_RDWR, 0644);
+
+        if (fd < 0) {
+            printf("Shared memory %s: Cannot create segment (%s).\n", obj->name, strerror(errno));
+            exit(EXIT_FAILURE);
+        }
+
+        obj->mapSize = sizeof(shm_header) + (unsigned long long) capacity;
+
+        if (ftruncate(fd, (off_t) obj->mapSize) < 0) {
+            printf("Shared memory %s: Cannot resize segment (%s).\n", obj->name, strerror(errno));
+            exit(EXIT_FAILURE);
+        }
+
+        obj->header = (shm_header *) mmap(NULL, obj->mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if (obj->header == MAP_FAILED) {
+            printf("Shared memory %s: Cannot map segment (%s).\n", obj->name, strerror(errno));
+            exit(EXIT_FAILURE);
+        }
+
+        obj->records = ((char *) obj->header) + sizeof(shm_header);
+
+        memset(obj->header, 0x00, sizeof(shm_header));
+
+        obj->header->version = shm_version;
+        obj->header->closed = 0;
+        obj->header->capacity = capacity;
+        obj->header->head = 0;
+        obj->header->tail = 0;
+        obj->header->sequence = 0;
+
+        // Readers only trust the header once the magic number is there
+        __atomic_store_n(&(obj->header->magic), (uint32_t) shm_magic, __ATOMIC_RELEASE);
+
+        obj->nMessages = 0;
+        obj->nMessagesDropped = 0;
+
+        return obj;
+
+    }
+
+    void shm_writer_destroy(shm_writer_obj * obj) {
+
+        if (obj->nMessagesDropped > 0) {
+            printf("Shared memory %s: %llu message(s) published, %llu too large for the ring.\n", obj->name, obj->nMessages, obj->nMessagesDropped);
+        }
+
+        __atomic_store_n(&(obj->header->closed), (uint16_t) 1, __ATOMIC_RELEASE);
+        __atomic_add_fetch(&(obj->header->sequence), 1, __ATOMIC_RELEASE);
+        syscall(SYS_futex, &(obj->header->sequence), FUTEX_WAKE, 0x7FFFFFFF, NULL, NULL, 0);
+
+        shm_unlink(obj->name);
+        munmap((void *) obj->header, obj->mapSize);
+
+        free((void *) obj->name);
+        free((void *) obj);
+
+    }
+
+    void shm_writer_publish(shm_writer_obj * obj, const unsigned long long timeStamp, const char * bytes, const unsigned int nBytes) {
+
+        unsigned long long capacity;
+        unsigned long long head;
+        unsigned long long tail;
+        unsigned long long offset;
+        unsigned long long nBytesPadding;
+        unsigned long long nBytesRecord;
+        unsigned long long end;
+        shm_record * record;
+
+        capacity = obj->header->capacity;
+        head = obj->header->head;
+        tail = obj->header->tail;
+
+        nBytesRecord = sizeof(shm_record) + ((((unsigned long long) nBytes) + 15) & ~((unsigned long long) 15));
+
+        if (nBytesRecord > (capacity / 2)) {
+            obj->nMessagesDropped++;
+            return;
+        }
+
+        // Records never wrap around the end of the ring, so readers get contiguous messages
+        offset = head % capacity;
+        nBytesPadding = ((capacity - offset) < nBytesRecord) ? (capacity - offset) : 0;
+        end = head + nBytesPadding + nBytesRecord;
+
+        // Release the oldest records, and let readers know before their bytes get overwritten
+        while ((end - tail) > capacity) {
+
+            record = (shm_record *) &(obj->records[tail % capacity]);
+
+            if (record->size == shm_padding) {
+                tail += capacity - (tail % capacity);
+            }
+            else {
+                tail += sizeof(shm_record) + ((((unsigned long long) record->size) + 15) & ~((unsigned long long) 15));
+            }
+
+        }
+
+        __atomic_store_n(&(obj->header->tail), tail, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+
+        if (nBytesPadding > 0) {
+
+            record = (shm_record *) &(obj->records[offset]);
+            record->size = shm_padding;
+            record->sequence = 0;
+            record->timeStamp = 0;
+
+        }
+
+        record = (shm_record *) &(obj->records[(head + nBytesPadding) % capacity]);
+        record->size = nBytes;
+        record->sequence = obj->header->sequence;
+        record->timeStamp = timeStamp;
+        memcpy(((char *) record) + sizeof(shm_record), bytes, nBytes);
+
+        __atomic_store_n(&(obj->header->head), end, __ATOMIC_RELEASE);
+        __atomic_add_fetch(&(obj->header->sequence), 1, __ATOMIC_RELEASE);
+
+        syscall(SYS_futex, &(obj->header->sequence), FUTEX_WAKE, 0x7FFFFFFF, NULL, NULL, 0);
+
+        obj->nMessages++;
+
+    }
+
+    shm_reader_obj * shm_reader_construct(const char * name) {
+
+        shm_reader_obj * obj;
+        int fd;
+        struct stat status;
+        void * map;
+
+        fd = shm_open(name, O_RDONLY, 0);
+
+        if (fd < 0) {
+            return (shm_reader_obj *) NULL;
+        }
+
+        if ((fstat(fd, &status) < 0) || (status.st_size < (off_t) (sizeof(shm_header) + 4096))) {
+            close(fd);
+            return (shm_reader_obj *) NULL;
+        }
+
+        map = mmap(NULL, (size_t) status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if (map == MAP_FAILED) {
+            return (shm_reader_obj *) NULL;
+        }
+
+        // The writer may still be initializing the segment
+        if ((__atomic_load_n(&(((const shm_header *) map)->magic), __ATOMIC_ACQUIRE) != shm_magic) ||
+            (((const shm_header *) map)->version != shm_version) ||
+            ((sizeof(shm_header) + ((const shm_header *) map)->capacity) > (unsigned long long) status.st_size)) {
+
+            munmap(map, (size_t) status.st_size);
+            return (shm_reader_obj *) NULL;
+
+        }
+
+        obj = (shm_reader_obj *) malloc(sizeof(shm_reader_obj));
+
+        obj->name = (char *) malloc(sizeof(char) * (strlen(name) + 1));
+        strcpy(obj->name, name);
+
+        obj->header = (const shm_header *) map;
+        obj->records = ((const char *) map) + sizeof(shm_header);
+        obj->mapSize = (unsigned long long) status.st_size;
+
+        obj->cursor = __atomic_load_n(&(obj->header->head), __ATOMIC_ACQUIRE);
+        obj->position = obj->cursor;
+
+        obj->size = 0;
+        obj->sequence = __atomic_load_n(&(obj->header->sequence), __ATOMIC_ACQUIRE) - 1;
+        obj->timeStamp = 0;
+
+        obj->nOverruns = 0;
+        obj->nMessagesLost = 0;
+
+        return obj;
+
+    }
+
+    void shm_reader_destroy(shm_reader_obj * obj) {
+
+        munmap((void *) obj->header, obj->mapSize);
+
+        free((void *) obj->name);
+        free((void *) obj);
+
+    }
+
+    const char * shm_reader_next(shm_reader_obj * obj, const int timeout) {
+
+        unsigned long long capacity;
+        unsigned long long head;
+        unsigned long long tail;
+        unsigned int sequence;
+        shm_record record;
+        struct timespec duration;
+
+        capacity = obj->header->capacity;
+
+        while(1) {
+
+            sequence = __atomic_load_n(&(obj->header->sequence), __ATOMIC_ACQUIRE);
+            head = __atomic_load_n(&(obj->header->head), __ATOMIC_ACQUIRE);
+
+            if (obj->cursor == head) {
+
+                if (__atomic_load_n(&(obj->header->closed), __ATOMIC_ACQUIRE) == 1) {
+                    return (const char *) NULL;
+                }
+
+                // Sleep until the writer moves sequence (returns at once if it already did)
+                if (timeout < 0) {
+
+                    syscall(SYS_futex, &(obj->header->sequence), FUTEX_WAIT, sequence, NULL, NULL, 0);
+
+                }
+                else {
+
+                    duration.tv_sec = timeout / 1000;
+                    duration.tv_nsec = (timeout % 1000) * 1000000;
+
+                    if ((syscall(SYS_futex, &(obj->header->sequence), FUTEX_WAIT, sequence, &duration, NULL, 0) < 0) && (errno == ETIMEDOUT)) {
+                        return (const char *) NULL;
+                    }
+
+                }
+
+                continue;
+
+            }
+
+            tail = __atomic_load_n(&(obj->header->tail), __ATOMIC_ACQUIRE);
+
+            if (obj->cursor < tail) {
+                obj->cursor = tail;
+                obj->nOverruns++;
+            }
+
+            memcpy(&record, &(obj->records[obj->cursor % capacity]), sizeof(shm_record));
+
+            // The record header is only valid if the writer did not reclaim it while we read it
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+            if (__atomic_load_n(&(obj->header->tail), __ATOMIC_ACQUIRE) > obj->cursor) {
+                continue;
+            }
+
+            if (record.size == shm_padding) {
+                obj->cursor += capacity - (obj->cursor % capacity);
+                continue;
+            }
+
+            obj->position = obj->cursor;
+            obj->cursor += sizeof(shm_record) + ((((unsigned long long) record.size) + 15) & ~((unsigned long long) 15));
+
+            obj->nMessagesLost += (unsigned int) (record.sequence - obj->sequence - 1);
+
+            obj->size = record.size;
+            obj->sequence = record.sequence;
+            obj->timeStamp = record.timeStamp;
+
+            return &(obj->records[(obj->position % capacity) + sizeof(shm_record)]);
+
+        }
+
+    }
+
+    int shm_reader_check(const shm_reader_obj * obj) {
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        return (__atomic_load_n(&(obj->header->tail), __ATOMIC_ACQUIRE) <= obj->position) ? 1 : 0;
+
+    }
+
+    int shm_reader_closed(const shm_reader_obj * obj) {
+
+        return (__atomic_load_n(&(obj->header->closed), __ATOMIC_ACQUIRE) == 1) ? 1 : 0;
+
+    }
@@ -0,0 +1,181 @@
+
+   /**
+    * \file     tabling.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <init/tabling.h>
+
+    unsigned long long tabling_hash(const unsigned long long hash, const void * data, const size_t size) {
+
+        // 64-bit FNV-1a
+
+        const unsigned char * bytes;
+        unsigned long long rtnValue;
+        size_t iByte;
+
+        bytes = (const unsigned char *) data;
+        rtnValue = hash;
+
+        for (iByte = 0; iByte < size; iByte++) {
+
+            rtnValue ^= (unsigned long long) bytes[iByte];
+            rtnValue *= 0x100000001b3ULL;
+
+        }
+
+        return rtnValue;
+
+    }
+
+    unsigned long long tabling_key_ds(const mics_obj * mics, const points_obj * points, const unsigned int nThetas, const float c, const unsigned int fS, const unsigned int halfFrameSize, const float gainMin, const float epsilon) {
+
+        // Covers everything the demixing weights depend on, so a stale table is never reused.
+        // The table version and the steering anchor spacing change the weights without changing any parameter, so they are hashed too.
+
+        unsigned long long key;
+        unsigned int version;
+        unsigned int anchor;
+
+        version = DEMIXTABLE_VERSION;
+        anchor = TRACK2STEER_ANCHOR;
+
+        key = 0xcbf29ce484222325ULL;
+
+        key = tabling_hash(key, DEMIXTABLE_MAGIC, strlen(DEMIXTABLE_MAGIC));
+        key = tabling_hash(key, &version, sizeof(unsigned int));
+        key = tabling_hash(key, &anchor, sizeof(unsigned int));
+        key = tabling_hash(key, &(mics->nChannels), sizeof(unsigned int));
+        key = tabling_hash(key, mics->mu, sizeof(float) * mics->nChannels * 3);
+        key = tabling_hash(key, mics->direction, sizeof(float) * mics->nChannels * 3);
+        key = tabling_hash(key, mics->thetaAllPass, sizeof(float) * mics->nChannels);
+        key = tabling_hash(key, mics->thetaNoPass, sizeof(float) * mics->nChannels);
+        key = tabling_hash(key, &(points->nPoints), sizeof(unsigned int));
+        key = tabling_hash(key, points->array, sizeof(float) * points->nPoints * 3);
+        key = tabling_hash(key, &nThetas, sizeof(unsigned int));
+        key = tabling_hash(key, &c, sizeof(float));
+        key = tabling_hash(key, &fS, sizeof(unsigned int));
+        key = tabling_hash(key, &halfFrameSize, sizeof(unsigned int));
+        key = tabling_hash(key, &gainMin, sizeof(float));
+        key = tabling_hash(key, &epsilon, sizeof(float));
+
+        return key;
+
+    }
+
+    demixtable_obj * tabling_demixtable_ds(const mics_obj * mics, const points_obj * points, const unsigned int nThetas, const float c, const unsigned int fS, const unsigned int halfFrameSize, const float gainMin, const float epsilon) {
+
+        // Each point goes through the same blocks as the dds separation, one point at a time
+
+        demixtable_obj * obj;
+
+        unsigned int nChannels;
+        unsigned int iPoint;
+
+        beampatterns_obj * beampatterns_mics;
+        tracks_obj * tracks;
+        gains_obj * gains;
+        masks_obj * masks;
+        steers_obj * steers;
+        demixings_obj * demixings;
+
+        track2gain_obj * track2gain;
+        gain2mask_obj * gain2mask;
+        track2steer_obj * track2steer;
+        steer2demixing_ds_obj * steer2demixing;
+
+        nChannels = mics->nChannels;
+
+        obj = demixtable_construct_zero(points->nPoints, 
+                                        nChannels, 
+                                        halfFrameSize, 
+                                        tabling_key_ds(mics, points, nThetas, c, fS, halfFrameSize, gainMin, epsilon));
+
+        beampatterns_mics = directivity_beampattern_mics(mics, nThetas);
+        tracks = tracks_construct_zero(1);
+        gains = gains_construct_zero(1, nChannels);
+        masks = masks_construct_zero(1, nChannels);
+        steers = steers_construct_zero(halfFrameSize, 1, nChannels);
+        demixings = demixings_construct_zero(halfFrameSize, 1, nChannels);
+
+        track2gain = track2gain_construct_zero(1, nChannels, mics->direction);
+        gain2mask = gain2mask_construct_zero(1, nChannels, gainMin);
+        track2steer = track2steer_construct_zero(1, nChannels, halfFrameSize, c, fS, mics->mu, 0.0f);
+        steer2demixing = steer2demixing_ds_construct_zero(1, nChannels, halfFrameSize, epsilon);
+
+        memcpy(obj->points, points->array, sizeof(float) * points->nPoints * 3);
+
+        for (iPoint = 0; iPoint < points->nPoints; iPoint++) {
+
+            tracks->ids[0] = iPoint + 1;
+            memcpy(tracks->array, &(points->array[iPoint * 3]), sizeof(float) * 3);
+
+            track2gain_process(track2gain, beampatterns_mics, tracks, gains);
+            gain2mask_process(gain2mask, gains, masks);
+            track2steer_process(track2steer, tracks, gains, masks, steers);
+            steer2demixing_ds_process(steer2demixing, tracks, steers, masks, demixings);
+
+            memcpy(&(obj->masks[iPoint * nChannels]), masks->array, sizeof(char) * nChannels);
+            memcpy(&(obj->array[iPoint * halfFrameSize * nChannels * 2]), demixings->array[0], sizeof(float) * halfFrameSize * nChannels * 2);
+
+        }
+
+        beampatterns_destroy(beampatterns_mics);
+        tracks_destroy(tracks);
+        gains_destroy(gains);
+        masks_destroy(masks);
+        steers_destroy(steers);
+        demixings_destroy(demixings);
+
+        track2gain_destroy(track2gain);
+        gain2mask_destroy(gain2mask);
+        track2steer_destroy(track2steer);
+        steer2demixing_ds_destroy(steer2demixing);
+
+        return obj;
+
+    }
+
+    demixtable_obj * tabling_demixtable_ds_file(const char * fileName, const mics_obj * mics, const points_obj * points, const unsigned int nThetas, const float c, const unsigned int fS, const unsigned int halfFrameSize, const float gainMin, const float epsilon) {
+
+        // Maps the file if it matches the current setup, otherwise computes the table and writes it for the next run
+
+        demixtable_obj * obj;
+        unsigned long long key;
+
+        key = tabling_key_ds(mics, points, nThetas, c, fS, halfFrameSize, gainMin, epsilon);
+
+        obj = demixtable_construct_file(fileName, points->nPoints, mics->nChannels, halfFrameSize, key);
+
+        if (obj == NULL) {
+
+            obj = tabling_demixtable_ds(mics, points, nThetas, c, fS, halfFrameSize, gainMin, epsilon);
+
+            if (demixtable_save(obj, fileName) != 0) {
+
+                printf("Cannot write demixing table \"%s\", using it from memory.\n", fileName);
+
+            }
+
+        }
+
+        return obj;
+
+    }
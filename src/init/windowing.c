@@ -75,3 +75,60 @@
         return obj;
 
     }
+
+    window_obj * windowing_kaiser(const unsigned int frameSize, const float beta) {
+
+        window_obj * obj;
+        unsigned int iSample;
+        unsigned int iTerm;
+        double x;
+        double term;
+        double num;
+        double den;
+
+        obj = window_construct_zero(frameSize);
+
+        if ( frameSize == 1 ) {
+
+            obj->array[0] = 1.0f;
+
+        }
+        else {
+
+            // Modified Bessel function of the first kind (order 0) evaluated
+            // with its power series, for the window and its normalization
+
+            den = 0.0;
+            term = 1.0;
+
+            for ( iTerm = 1; term > 1E-12; iTerm++ ) {
+
+                den += term;
+                term *= ( (double) beta * (double) beta ) / ( 4.0 * (double) iTerm * (double) iTerm );
+
+            }
+
+            for ( iSample = 0; iSample < frameSize; iSample++ ) {
+
+                x = 2.0 * ( (double) iSample ) / ( (double) ( frameSize - 1 ) ) - 1.0;
+                x = (double) beta * sqrt( 1.0 - x * x );
+
+                num = 0.0;
+                term = 1.0;
+
+                for ( iTerm = 1; term > 1E-12 * num; iTerm++ ) {
+
+                    num += term;
+                    term *= ( x * x ) / ( 4.0 * (double) iTerm * (double) iTerm );
+
+                }
+
+                obj->array[iSample] = (float) ( num / den );
+
+            }
+
+        }
+
+        return obj;
+
+    }
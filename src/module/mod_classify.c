@@ -26,31 +26,86 @@
     mod_classify_obj * mod_classify_construct(const mod_classify_cfg * mod_classify_config, const msg_hops_cfg * msg_hops_config, const msg_tracks_cfg * msg_tracks_config, const msg_categories_cfg * msg_categories_config) {
 
         mod_classify_obj * obj;
+        unsigned int margin;
 
         obj = (mod_classify_obj *) malloc(sizeof(mod_classify_obj));
 
-        obj->hop2frame = hop2frame_construct_zero(msg_hops_config->hopSize, 
-                                                  mod_classify_config->frameSize,
-                                                  msg_hops_config->nChannels);
+        obj->mode = mod_classify_config->mode;
 
-        obj->frames = frames_construct_zero(msg_hops_config->nChannels, 
-                                            mod_classify_config->frameSize);
+        if (obj->mode == 's') {
 
-        obj->frame2freq = frame2freq_construct_zero(mod_classify_config->frameSize, 
-                                                    (mod_classify_config->frameSize)/2+1);
+            obj->hop2frame = hop2frame_construct_zero(msg_hops_config->hopSize, 
+                                                      mod_classify_config->frameSize,
+                                                      msg_hops_config->nChannels);
 
-        obj->freqs = freqs_construct_zero(msg_hops_config->nChannels, 
-                                          (mod_classify_config->frameSize)/2+1);
+            obj->frame2freq = frame2freq_construct_zero(mod_classify_config->frameSize, 
+                                                        (mod_classify_config->frameSize)/2+1);
 
-        obj->freq2acorr = freq2acorr_construct_zero(msg_hops_config->nChannels, 
-                                                    (mod_classify_config->frameSize)/2+1);
+            obj->freqs = freqs_construct_zero(msg_hops_config->nChannels, 
+                                              (mod_classify_config->frameSize)/2+1);
 
-        obj->acorrs = acorrs_construct_zero(msg_hops_config->nChannels, 
-                                            (mod_classify_config->frameSize)/2+1);
+            obj->freq2acorr = freq2acorr_construct_zero(msg_hops_config->nChannels, 
+                                                        (mod_classify_config->frameSize)/2+1);
 
-        obj->acorr2pitch = acorr2pitch_construct_zero(msg_hops_config->nChannels, 
-                                                      (mod_classify_config->frameSize)/2+1, 
-                                                      mod_classify_config->winSize);
+            obj->acorrs = acorrs_construct_zero(msg_hops_config->nChannels, 
+                                                (mod_classify_config->frameSize)/2+1);
+
+            obj->acorr2pitch = acorr2pitch_construct_zero(msg_hops_config->nChannels, 
+                                                          (mod_classify_config->frameSize)/2+1, 
+                                                          mod_classify_config->winSize);
+
+            obj->hop2acorr = (hop2acorr_obj *) NULL;
+
+            obj->binMin = 0;
+            obj->binMax = 0;
+            obj->scale = 1.0f;
+
+        }
+        else if (obj->mode == 'r') {
+
+            // Pitch lags tauMin...tauMax expressed at the decimated rate
+            obj->binMin = (unsigned int) ceilf(mod_classify_config->tauMin / ((float) mod_classify_config->decimation));
+            obj->binMax = (unsigned int) floorf(mod_classify_config->tauMax / ((float) mod_classify_config->decimation));
+            obj->scale = (float) mod_classify_config->decimation;
+
+            // Peak picking looks winSize lags (and at least one) on each side
+            margin = (mod_classify_config->winSize > 0) ? mod_classify_config->winSize : 1;
+
+            if (obj->binMin < margin) {
+                obj->binMin = margin;
+            }
+
+            if (obj->binMax < obj->binMin) {
+                printf("Classify: Invalid pitch lag range.\n");
+                exit(EXIT_FAILURE);
+            }
+
+            obj->hop2acorr = hop2acorr_construct_zero(msg_hops_config->nChannels,
+                                                      msg_hops_config->hopSize,
+                                                      mod_classify_config->frameSize,
+                                                      mod_classify_config->decimation,
+                                                      obj->binMin - margin,
+                                                      obj->binMax + margin);
+
+            obj->acorrs = acorrs_construct_zero(msg_hops_config->nChannels, 
+                                                obj->binMax + margin + 1);
+
+            obj->acorr2pitch = acorr2pitch_construct_zero(msg_hops_config->nChannels, 
+                                                          obj->binMax + margin + 1, 
+                                                          mod_classify_config->winSize);
+
+            obj->hop2frame = (hop2frame_obj *) NULL;
+            obj->frame2freq = (frame2freq_obj *) NULL;
+            obj->freqs = (freqs_obj *) NULL;
+            obj->freq2acorr = (freq2acorr_obj *) NULL;
+
+        }
+        else {
+
+            printf("Classify: Invalid mode.\n");
+            exit(EXIT_FAILURE);
+
+        }
 
         obj->pitches = pitches_construct_zero(msg_hops_config->nChannels);
 
@@ -75,11 +130,20 @@
 
     void mod_classify_destroy(mod_classify_obj * obj) {
 
-        hop2frame_destroy(obj->hop2frame);
-        frames_destroy(obj->frames);
-        frame2freq_destroy(obj->frame2freq);
-        freqs_destroy(obj->freqs);
-        freq2acorr_destroy(obj->freq2acorr);
+        if (obj->mode == 's') {
+
+            hop2frame_destroy(obj->hop2frame);
+            frame2freq_destroy(obj->frame2freq);
+            freqs_destroy(obj->freqs);
+            freq2acorr_destroy(obj->freq2acorr);
+
+        }
+        else {
+
+            hop2acorr_destroy(obj->hop2acorr);
+
+        }
+
         acorrs_destroy(obj->acorrs);
         acorr2pitch_destroy(obj->acorr2pitch);
         pitches_destroy(obj->pitches);
@@ -102,10 +166,21 @@
 
             if (obj->enabled == 1) {
 
-                hop2frame_process(obj->hop2frame, obj->in1->hops, obj->frames);
-                frame2freq_process(obj->frame2freq, obj->frames, obj->freqs);
-                freq2acorr_process(obj->freq2acorr, obj->freqs, obj->acorrs);
-                acorr2pitch_process(obj->acorr2pitch, obj->acorrs, obj->pitches);
+                if (obj->mode == 's') {
+
+                    hop2frame_push(obj->hop2frame, obj->in1->hops);
+                    frame2freq_process_ring(obj->frame2freq, obj->hop2frame, obj->freqs);
+                    freq2acorr_process(obj->freq2acorr, obj->freqs, obj->acorrs);
+                    acorr2pitch_process(obj->acorr2pitch, obj->acorrs, obj->pitches);
+
+                }
+                else {
+
+                    hop2acorr_process(obj->hop2acorr, obj->in1->hops, obj->in2->tracks, obj->acorrs);
+                    acorr2pitch_process_range(obj->acorr2pitch, obj->acorrs, obj->in2->tracks, obj->pitches, obj->binMin, obj->binMax, obj->scale);
+
+                }
+
                 pitch2category_process(obj->pitch2category, obj->pitches, obj->in2->tracks, obj->out->categories);
 
             }
@@ -166,6 +241,9 @@
 
         cfg = (mod_classify_cfg *) malloc(sizeof(mod_classify_cfg));
 
+        cfg->mode = 's';
+        cfg->decimation = 1;
+
         return cfg;
 
     }
@@ -41,6 +41,9 @@
         if (mod_resample_config->fSin < mod_resample_config->fSout) {
             obj->type = 'u';
         }
+        if ((mod_resample_config->fSin != mod_resample_config->fSout) && (mod_resample_config->mode == 'p')) {
+            obj->type = 'p';
+        }
 
         obj->nChannels = msg_hops_in_config->nChannels;
         obj->fSin = mod_resample_config->fSin;
@@ -58,9 +61,9 @@
                 obj->lowPassCut = (unsigned int) floorf(((float) (obj->frameSize/2)) * obj->ratio);
 
                 obj->hop2hop = hop2hop_buffer_construct_zero(obj->nChannels, obj->hopSizeIn, obj->hopSizeOut, obj->ratio);
+                obj->hop2hop_polyphase = (hop2hop_polyphase_obj *) NULL;
 
                 obj->hop2frame = hop2frame_construct_zero(obj->hopSizeIn, obj->frameSize, obj->nChannels);
-                obj->framesAnalysis = frames_construct_zero(obj->nChannels, obj->frameSize);
                 obj->frame2freq = frame2freq_construct_zero(obj->frameSize, obj->halfFrameSize);
                 obj->freqsAnalysis = freqs_construct_zero(obj->nChannels, obj->halfFrameSize);
                 obj->freq2freq_lowpass = freq2freq_lowpass_construct_zero(obj->halfFrameSize, obj->lowPassCut);
@@ -79,9 +82,9 @@
                 obj->lowPassCut = (unsigned int) floorf(((float) (obj->frameSize/2)) / obj->ratio);
 
                 obj->hop2hop = hop2hop_buffer_construct_zero(obj->nChannels, obj->hopSizeIn, obj->hopSizeOut, obj->ratio);
+                obj->hop2hop_polyphase = (hop2hop_polyphase_obj *) NULL;
                 
                 obj->hop2frame = hop2frame_construct_zero(obj->hopSizeOut, obj->frameSize, obj->nChannels);
-                obj->framesAnalysis = frames_construct_zero(obj->nChannels, obj->frameSize);
                 obj->frame2freq = frame2freq_construct_zero(obj->frameSize, obj->halfFrameSize);
                 obj->freqsAnalysis = freqs_construct_zero(obj->nChannels, obj->halfFrameSize);
                 obj->freq2freq_lowpass = freq2freq_lowpass_construct_zero(obj->halfFrameSize, obj-> lowPassCut);
@@ -100,9 +103,30 @@
                 obj->lowPassCut = 0;
 
                 obj->hop2hop = hop2hop_buffer_construct_zero(obj->nChannels, obj->hopSizeIn, obj->hopSizeOut, obj->ratio);
+                obj->hop2hop_polyphase = (hop2hop_polyphase_obj *) NULL;
+
+                obj->hop2frame = (hop2frame_obj *) NULL;
+                obj->frame2freq = (frame2freq_obj *) NULL;
+                obj->freqsAnalysis = (freqs_obj *) NULL;
+                obj->freq2freq_lowpass = (freq2freq_lowpass_obj *) NULL;
+                obj->freqsSynthesis = (freqs_obj *) NULL;
+                obj->freq2frame = (freq2frame_obj *) NULL;
+                obj->framesSynthesis = (frames_obj *) NULL;
+                obj->frame2hop = (frame2hop_obj *) NULL;
+                obj->hops = (hops_obj *) NULL;
+
+            break;
+
+            case 'p':
+
+                obj->frameSize = 0;
+                obj->halfFrameSize = 0;
+                obj->lowPassCut = 0;
+
+                obj->hop2hop = (hop2hop_buffer_obj *) NULL;
+                obj->hop2hop_polyphase = hop2hop_polyphase_construct_zero(obj->nChannels, obj->hopSizeIn, obj->hopSizeOut, obj->fSin, obj->fSout, mod_resample_config->nTaps);
 
                 obj->hop2frame = (hop2frame_obj *) NULL;
-                obj->framesAnalysis = (frames_obj *) NULL;
                 obj->frame2freq = (frame2freq_obj *) NULL;
                 obj->freqsAnalysis = (freqs_obj *) NULL;
                 obj->freq2freq_lowpass = (freq2freq_lowpass_obj *) NULL;
@@ -131,12 +155,12 @@
             hop2hop_buffer_destroy(obj->hop2hop);
         }
 
-        if (obj->hop2frame != NULL) {
-            hop2frame_destroy(obj->hop2frame);
+        if (obj->hop2hop_polyphase != NULL) {
+            hop2hop_polyphase_destroy(obj->hop2hop_polyphase);
         }
 
-        if (obj->framesAnalysis != NULL) {
-            frames_destroy(obj->framesAnalysis);
+        if (obj->hop2frame != NULL) {
+            hop2frame_destroy(obj->hop2frame);
         }
 
         if (obj->frame2freq != NULL) {
@@ -199,6 +223,12 @@
 
             break;
 
+            case 'p':
+
+                rtnValue = mod_resample_process_push_polyphase(obj);
+
+            break;
+
         }
 
         return rtnValue;
@@ -229,6 +259,12 @@
 
             break;
 
+            case 'p':
+
+                rtnValue = mod_resample_process_pop_polyphase(obj);
+
+            break;
+
         }
 
         return rtnValue;
@@ -245,13 +281,12 @@
 
                 if (obj->enabled == 1) {
 
-                    hop2frame_process(obj->hop2frame, 
-                                      obj->in->hops,
-                                      obj->framesAnalysis);
+                    hop2frame_push(obj->hop2frame,
+                                   obj->in->hops);
 
-                    frame2freq_process(obj->frame2freq,
-                                       obj->framesAnalysis,
-                                       obj->freqsAnalysis);
+                    frame2freq_process_ring(obj->frame2freq,
+                                            obj->hop2frame,
+                                            obj->freqsAnalysis);
 
                     freq2freq_lowpass_process(obj->freq2freq_lowpass,
                                               obj->freqsAnalysis,
@@ -412,13 +447,12 @@
                 hop2hop_buffer_pop(obj->hop2hop,
                                    obj->hops);
 
-                hop2frame_process(obj->hop2frame, 
-                                  obj->hops,
-                                  obj->framesAnalysis);
+                hop2frame_push(obj->hop2frame,
+                               obj->hops);
 
-                frame2freq_process(obj->frame2freq,
-                                   obj->framesAnalysis,
-                                   obj->freqsAnalysis);
+                frame2freq_process_ring(obj->frame2freq,
+                                        obj->hop2frame,
+                                        obj->freqsAnalysis);
 
                 freq2freq_lowpass_process(obj->freq2freq_lowpass,
                                           obj->freqsAnalysis,
@@ -497,6 +531,80 @@
 
     }
 
+    int mod_resample_process_push_polyphase(mod_resample_obj * obj) {
+
+        int rtnValue;
+
+        if (msg_hops_isZero(obj->in) == 0) {
+
+            if (hop2hop_polyphase_isFull(obj->hop2hop_polyphase) == 0) {
+
+                if (obj->enabled == 1) {
+
+                    hop2hop_polyphase_push(obj->hop2hop_polyphase,
+                                           obj->in->hops);
+
+                }
+
+                rtnValue = 0;
+
+            }
+            else {
+
+                rtnValue = -1;
+
+            }
+
+        }
+        else {
+
+            obj->noMorePush = 1;
+            rtnValue = -1;
+
+        }
+
+        return rtnValue;
+
+    }
+
+    int mod_resample_process_pop_polyphase(mod_resample_obj * obj) {
+
+        int rtnValue;
+
+        if (hop2hop_polyphase_isEmpty(obj->hop2hop_polyphase) == 0) {
+
+            if (obj->enabled == 1) {
+
+                hop2hop_polyphase_pop(obj->hop2hop_polyphase,
+                                      obj->out->hops);
+
+            }
+            else {
+
+                hops_zero(obj->out->hops);
+
+            }
+
+            obj->timeStamp++;
+            obj->out->timeStamp = obj->timeStamp;
+
+            rtnValue = 0;
+
+        }
+        else {
+
+            if (obj->noMorePush == 1) {
+                msg_hops_zero(obj->out);
+            }
+
+            rtnValue = -1;
+
+        }
+
+        return rtnValue;
+
+    }
+
     void mod_resample_connect(mod_resample_obj * obj, msg_hops_obj * in, msg_hops_obj * out) {
 
         obj->in = in;
@@ -532,6 +640,9 @@
         cfg->fSin = 0;
         cfg->fSout = 0;
 
+        cfg->mode = 's';
+        cfg->nTaps = 0;
+
         return cfg;
 
     }
@@ -546,5 +657,7 @@
 
         printf("fSin = %u\n", cfg->fSin);
         printf("fSout = %u\n", cfg->fSout);
+        printf("mode = %c\n", cfg->mode);
+        printf("nTaps = %u\n", cfg->nTaps);
 
     }
@@ -31,6 +31,8 @@
     mod_sss_obj * mod_sss_construct(const mod_sss_cfg * mod_sss_config, const msg_tracks_cfg * msg_tracks_config, const msg_spectra_cfg * msg_spectra_config) {
 
         mod_sss_obj * obj;
+        unsigned int iThread;
+        points_obj * points;
         
         obj = (mod_sss_obj *) malloc(sizeof(mod_sss_obj));
 
@@ -40,6 +42,22 @@
         obj->mode_sep = mod_sss_config->mode_sep;
         obj->mode_pf = mod_sss_config->mode_pf;
 
+        // Each worker processes a contiguous range of frequency bins
+
+        obj->nThreads = (mod_sss_config->nThreads > 0) ? mod_sss_config->nThreads : 1;
+
+        if (obj->nThreads > obj->halfFrameSize) {
+            obj->nThreads = obj->halfFrameSize;
+        }
+
+        obj->pool = pool_construct(obj->nThreads);
+
+        obj->binStarts = (unsigned int *) malloc(sizeof(unsigned int) * (obj->nThreads + 1));
+
+        for (iThread = 0; iThread <= obj->nThreads; iThread++) {
+            obj->binStarts[iThread] = (iThread * obj->halfFrameSize) / obj->nThreads;
+        }
+
         obj->sep_ds_beampatterns_mics = (beampatterns_obj *) NULL;
         obj->sep_ds_steers = (steers_obj *) NULL;
         obj->sep_ds_gains = (gains_obj *) NULL;
@@ -53,6 +71,8 @@
         obj->sep_ds_demixingsPrev = (demixings_obj *) NULL;
         obj->sep_ds_demixingsNow = (demixings_obj *) NULL;
         obj->sep_ds_demixing2freq = (demixing2freq_obj *) NULL;
+        obj->sep_ds_demixtable = (demixtable_obj *) NULL;
+        obj->sep_ds_track2demixing = (track2demixing_obj *) NULL;
 
         obj->sep_gss_beampatterns_mics = (beampatterns_obj *) NULL;
         obj->sep_gss_steers = (steers_obj *) NULL;
@@ -63,7 +83,7 @@
         obj->sep_gss_track2gain = (track2gain_obj *) NULL;
         obj->sep_gss_gain2mask = (gain2mask_obj *) NULL;
         obj->sep_gss_track2steer = (track2steer_obj *) NULL;
-        obj->sep_gss_steer2demixing = (steer2demixing_gss_obj *) NULL;
+        obj->sep_gss_steer2demixing = (steer2demixing_gss_obj **) NULL;
         obj->sep_gss_demixingsPrev = (demixings_obj *) NULL;
         obj->sep_gss_demixingsNow = (demixings_obj *) NULL;
         obj->sep_gss_demixing2freq = (demixing2freq_obj *) NULL;        
@@ -102,7 +122,8 @@
                                                                      msg_spectra_config->halfFrameSize, 
                                                                      mod_sss_config->soundspeed->mu,
                                                                      mod_sss_config->samplerate->mu,
-                                                                     mod_sss_config->mics->mu);
+                                                                     mod_sss_config->mics->mu,
+                                                                     mod_sss_config->sep_tolerance);
 
                 obj->sep_ds_steer2demixing = steer2demixing_ds_construct_zero(msg_tracks_config->nTracks, 
                                                                               msg_spectra_config->nChannels, 
@@ -121,6 +142,36 @@
                                                                          msg_spectra_config->nChannels,
                                                                          msg_spectra_config->halfFrameSize);
 
+                // Optional table of demixings over a grid, loaded from (or saved to) a file
+
+                if (mod_sss_config->sep_ds_tableFile != NULL) {
+
+                    if (mod_sss_config->sep_ds_tableShape == 'h') {
+                        points = space_halfsphere(mod_sss_config->sep_ds_tableLevel);
+                    }
+                    else {
+                        points = space_sphere(mod_sss_config->sep_ds_tableLevel);
+                    }
+
+                    obj->sep_ds_demixtable = tabling_demixtable_ds_file(mod_sss_config->sep_ds_tableFile,
+                                                                        mod_sss_config->mics,
+                                                                        points,
+                                                                        mod_sss_config->nThetas,
+                                                                        mod_sss_config->soundspeed->mu,
+                                                                        mod_sss_config->samplerate->mu,
+                                                                        msg_spectra_config->halfFrameSize,
+                                                                        mod_sss_config->gainMin,
+                                                                        mod_sss_config->epsilon);
+
+                    points_destroy(points);
+
+                    obj->sep_ds_track2demixing = track2demixing_construct_zero(msg_tracks_config->nTracks,
+                                                                               msg_spectra_config->nChannels,
+                                                                               msg_spectra_config->halfFrameSize,
+                                                                               obj->sep_ds_demixtable);
+
+                }
+
             break;
 
             case 'g':
@@ -155,14 +206,23 @@
                                                                       msg_spectra_config->halfFrameSize, 
                                                                       mod_sss_config->soundspeed->mu,
                                                                       mod_sss_config->samplerate->mu,
-                                                                      mod_sss_config->mics->mu);
+                                                                      mod_sss_config->mics->mu,
+                                                                      mod_sss_config->sep_tolerance);
 
-                obj->sep_gss_steer2demixing = steer2demixing_gss_construct_zero(msg_tracks_config->nTracks, 
-                                                                                msg_spectra_config->nChannels, 
-                                                                                msg_spectra_config->halfFrameSize, 
-                                                                                mod_sss_config->sep_gss_mu, 
-                                                                                mod_sss_config->sep_gss_lambda,
-                                                                                mod_sss_config->epsilon);
+                // The generic GSS update uses scratch matrices, so each worker gets its own
+
+                obj->sep_gss_steer2demixing = (steer2demixing_gss_obj **) malloc(sizeof(steer2demixing_gss_obj *) * obj->nThreads);
+
+                for (iThread = 0; iThread < obj->nThreads; iThread++) {
+
+                    obj->sep_gss_steer2demixing[iThread] = steer2demixing_gss_construct_zero(msg_tracks_config->nTracks, 
+                                                                                             msg_spectra_config->nChannels, 
+                                                                                             msg_spectra_config->halfFrameSize, 
+                                                                                             mod_sss_config->sep_gss_mu, 
+                                                                                             mod_sss_config->sep_gss_lambda,
+                                                                                             mod_sss_config->epsilon);
+
+                }
 
                 obj->sep_gss_demixingsPrev = demixings_construct_zero(msg_spectra_config->halfFrameSize, 
                                                                       msg_tracks_config->nTracks, 
@@ -279,14 +339,16 @@
                                                                                   mod_sss_config->pf_ms_Gmin, 
                                                                                   mod_sss_config->pf_ms_winSizeLocal, 
                                                                                   mod_sss_config->pf_ms_winSizeGlobal, 
-                                                                                  mod_sss_config->pf_ms_winSizeFrame);
+                                                                                  mod_sss_config->pf_ms_winSizeFrame,
+                                                                                  mod_sss_config->pf_ms_math);
 
                 obj->pf_ms_probspeeches = envs_construct_zero(msg_tracks_config->nTracks,
                                                               msg_spectra_config->halfFrameSize);
 
                 obj->pf_ms_env2env_gainall = env2env_gainall_construct_zero(msg_tracks_config->nTracks,
                                                                             msg_spectra_config->halfFrameSize,
-                                                                            mod_sss_config->pf_ms_Gmin);
+                                                                            mod_sss_config->pf_ms_Gmin,
+                                                                            mod_sss_config->pf_ms_math);
 
                 obj->pf_ms_gainalls = envs_construct_zero(msg_tracks_config->nTracks,
                                                           msg_spectra_config->halfFrameSize);
@@ -320,7 +382,8 @@
                                                                                 mod_sss_config->pf_ss_Gmin, 
                                                                                 mod_sss_config->pf_ss_Gmid, 
                                                                                 mod_sss_config->pf_ss_Gslope,
-                                                                                mod_sss_config->epsilon);
+                                                                                mod_sss_config->epsilon,
+                                                                                mod_sss_config->pf_ss_math);
 
                 obj->pf_ss_gainratio = envs_construct_zero(msg_tracks_config->nTracks,
                                                            msg_spectra_config->halfFrameSize);
@@ -352,6 +415,8 @@
 
     void mod_sss_destroy(mod_sss_obj * obj) {
 
+        unsigned int iThread;
+
         switch(obj->mode_sep) {
 
             case 'd':
@@ -370,6 +435,11 @@
                 demixings_destroy(obj->sep_ds_demixingsNow);
                 demixing2freq_destroy(obj->sep_ds_demixing2freq);
 
+                if (obj->sep_ds_demixtable != NULL) {
+                    track2demixing_destroy(obj->sep_ds_track2demixing);
+                    demixtable_destroy(obj->sep_ds_demixtable);
+                }
+
             break;
 
             case 'g':
@@ -383,7 +453,10 @@
                 track2gain_destroy(obj->sep_gss_track2gain);
                 gain2mask_destroy(obj->sep_gss_gain2mask);
                 track2steer_destroy(obj->sep_gss_track2steer);
-                steer2demixing_gss_destroy(obj->sep_gss_steer2demixing);
+                for (iThread = 0; iThread < obj->nThreads; iThread++) {
+                    steer2demixing_gss_destroy(obj->sep_gss_steer2demixing[iThread]);
+                }
+                free((void *) obj->sep_gss_steer2demixing);
                 demixings_destroy(obj->sep_gss_demixingsPrev);
                 demixings_destroy(obj->sep_gss_demixingsNow);
                 demixing2freq_destroy(obj->sep_gss_demixing2freq);
@@ -449,6 +522,9 @@
 
         }
 
+        pool_destroy(obj->pool);
+        free((void *) obj->binStarts);
+
         free((void *) obj);
 
     }
@@ -539,36 +615,40 @@
                 tracks_copy(obj->sep_ds_tracksNow,
                             obj->in3->tracks);
 
-                track2gain_process(obj->sep_ds_track2gain, 
-                                   obj->sep_ds_beampatterns_mics, 
-                                   obj->sep_ds_tracksNow,
-                                   obj->sep_ds_gains);
-  
-                gain2mask_process(obj->sep_ds_gain2mask, 
-                                  obj->sep_ds_gains, 
-                                  obj->sep_ds_masks);
+                if (obj->sep_ds_demixtable != NULL) {
 
-                track2steer_process(obj->sep_ds_track2steer, 
-                                    obj->sep_ds_tracksNow,
-                                    obj->sep_ds_gains,
-                                    obj->sep_ds_masks,
-                                    obj->sep_ds_steers);
+                    track2demixing_update(obj->sep_ds_track2demixing,
+                                          obj->sep_ds_tracksNow,
+                                          obj->sep_ds_masks);
 
-                demixings_copy(obj->sep_ds_demixingsPrev, 
-                               obj->sep_ds_demixingsNow);
+                    demixings_copy(obj->sep_ds_demixingsPrev, 
+                                   obj->sep_ds_demixingsNow);
 
-                steer2demixing_ds_process(obj->sep_ds_steer2demixing, 
-                                          obj->sep_ds_tracksNow,
-                                          obj->sep_ds_steers, 
-                                          obj->sep_ds_masks, 
-                                          obj->sep_ds_demixingsNow);
+                    pool_run(obj->pool, mod_sss_process_dds_table_bins, (void *) obj, obj->nThreads);
 
-                demixing2freq_process(obj->sep_ds_demixing2freq, 
-                                      obj->sep_ds_tracksNow,
-                                      obj->sep_ds_demixingsNow, 
-                                      obj->sep_ds_masks, 
-                                      obj->in1->freqs, 
-                                      obj->out1->freqs);
+                }
+                else {
+
+                    track2steer_update(obj->sep_ds_track2steer,
+                                       obj->sep_ds_tracksNow);
+
+                    track2gain_process_partial(obj->sep_ds_track2gain, 
+                                               obj->sep_ds_beampatterns_mics,
+                                               obj->sep_ds_tracksNow,
+                                               obj->sep_ds_track2steer->updates,
+                                               obj->sep_ds_gains);
+      
+                    gain2mask_process_partial(obj->sep_ds_gain2mask, 
+                                              obj->sep_ds_gains, 
+                                              obj->sep_ds_track2steer->updates,
+                                              obj->sep_ds_masks);
+
+                    demixings_copy(obj->sep_ds_demixingsPrev, 
+                                   obj->sep_ds_demixingsNow);
+
+                    pool_run(obj->pool, mod_sss_process_dds_bins, (void *) obj, obj->nThreads);
+
+                }
 
                 demixings_copy(obj->sep_demixings,
                                obj->sep_ds_demixingsNow);
@@ -600,6 +680,65 @@
 
     }
 
+    void mod_sss_process_dds_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker) {
+
+        mod_sss_obj * obj;
+        unsigned int iBinStart;
+        unsigned int iBinStop;
+
+        obj = (mod_sss_obj *) ptr;
+        iBinStart = obj->binStarts[iTask];
+        iBinStop = obj->binStarts[iTask+1];
+
+        track2steer_process_range(obj->sep_ds_track2steer, 
+                                  obj->sep_ds_tracksNow,
+                                  obj->sep_ds_gains,
+                                  obj->sep_ds_masks,
+                                  obj->sep_ds_steers,
+                                  iBinStart, iBinStop);
+
+        steer2demixing_ds_process_range(obj->sep_ds_steer2demixing, 
+                                        obj->sep_ds_tracksNow,
+                                        obj->sep_ds_steers, 
+                                        obj->sep_ds_masks, 
+                                        obj->sep_ds_demixingsNow,
+                                        iBinStart, iBinStop);
+
+        demixing2freq_process_range(obj->sep_ds_demixing2freq, 
+                                    obj->sep_ds_tracksNow,
+                                    obj->sep_ds_demixingsNow, 
+                                    obj->sep_ds_masks, 
+                                    obj->in1->freqs, 
+                                    obj->out1->freqs,
+                                    iBinStart, iBinStop);
+
+    }
+
+    void mod_sss_process_dds_table_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker) {
+
+        mod_sss_obj * obj;
+        unsigned int iBinStart;
+        unsigned int iBinStop;
+
+        obj = (mod_sss_obj *) ptr;
+        iBinStart = obj->binStarts[iTask];
+        iBinStop = obj->binStarts[iTask+1];
+
+        track2demixing_process_range(obj->sep_ds_track2demixing,
+                                     obj->sep_ds_tracksNow,
+                                     obj->sep_ds_demixingsNow,
+                                     iBinStart, iBinStop);
+
+        demixing2freq_process_range(obj->sep_ds_demixing2freq, 
+                                    obj->sep_ds_tracksNow,
+                                    obj->sep_ds_demixingsNow, 
+                                    obj->sep_ds_masks, 
+                                    obj->in1->freqs, 
+                                    obj->out1->freqs,
+                                    iBinStart, iBinStop);
+
+    }
+
     int mod_sss_process_dgss(mod_sss_obj * obj) {
 
         int rtnValue;
@@ -622,39 +761,24 @@
                 tracks_copy(obj->sep_gss_tracksNow,
                             obj->in3->tracks);
 
-                track2gain_process(obj->sep_gss_track2gain, 
-                                   obj->sep_gss_beampatterns_mics,
-                                   obj->sep_gss_tracksNow,
-                                   obj->sep_gss_gains);
+                track2steer_update(obj->sep_gss_track2steer,
+                                   obj->sep_gss_tracksNow);
 
-                gain2mask_process(obj->sep_gss_gain2mask, 
-                                  obj->sep_gss_gains, 
-                                  obj->sep_gss_masks);
+                track2gain_process_partial(obj->sep_gss_track2gain, 
+                                           obj->sep_gss_beampatterns_mics,
+                                           obj->sep_gss_tracksNow,
+                                           obj->sep_gss_track2steer->updates,
+                                           obj->sep_gss_gains);
 
-                track2steer_process(obj->sep_gss_track2steer, 
-                                    obj->sep_gss_tracksNow,
-                                    obj->sep_gss_gains,
-                                    obj->sep_gss_masks,
-                                    obj->sep_gss_steers);
+                gain2mask_process_partial(obj->sep_gss_gain2mask, 
+                                          obj->sep_gss_gains, 
+                                          obj->sep_gss_track2steer->updates,
+                                          obj->sep_gss_masks);
 
                 demixings_copy(obj->sep_gss_demixingsPrev,
                                obj->sep_gss_demixingsNow);
 
-                steer2demixing_gss_process(obj->sep_gss_steer2demixing, 
-                                           obj->sep_gss_tracksPrev, 
-                                           obj->sep_gss_tracksNow, 
-                                           obj->sep_gss_steers, 
-                                           obj->sep_gss_masks, 
-                                           obj->in1->freqs,
-                                           obj->sep_gss_demixingsPrev,
-                                           obj->sep_gss_demixingsNow);
-
-                demixing2freq_process(obj->sep_gss_demixing2freq, 
-                                      obj->sep_gss_tracksNow,
-                                      obj->sep_gss_demixingsNow, 
-                                      obj->sep_gss_masks, 
-                                      obj->in1->freqs, 
-                                      obj->out1->freqs);        
+                pool_run(obj->pool, mod_sss_process_dgss_bins, (void *) obj, obj->nThreads);
 
                 demixings_copy(obj->sep_demixings,
                                obj->sep_gss_demixingsNow);
@@ -686,6 +810,43 @@
 
     }
 
+    void mod_sss_process_dgss_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker) {
+
+        mod_sss_obj * obj;
+        unsigned int iBinStart;
+        unsigned int iBinStop;
+
+        obj = (mod_sss_obj *) ptr;
+        iBinStart = obj->binStarts[iTask];
+        iBinStop = obj->binStarts[iTask+1];
+
+        track2steer_process_range(obj->sep_gss_track2steer, 
+                                  obj->sep_gss_tracksNow,
+                                  obj->sep_gss_gains,
+                                  obj->sep_gss_masks,
+                                  obj->sep_gss_steers,
+                                  iBinStart, iBinStop);
+
+        steer2demixing_gss_process_range(obj->sep_gss_steer2demixing[iWorker], 
+                                         obj->sep_gss_tracksPrev, 
+                                         obj->sep_gss_tracksNow, 
+                                         obj->sep_gss_steers, 
+                                         obj->sep_gss_masks, 
+                                         obj->in1->freqs,
+                                         obj->sep_gss_demixingsPrev,
+                                         obj->sep_gss_demixingsNow,
+                                         iBinStart, iBinStop);
+
+        demixing2freq_process_range(obj->sep_gss_demixing2freq, 
+                                    obj->sep_gss_tracksNow,
+                                    obj->sep_gss_demixingsNow, 
+                                    obj->sep_gss_masks, 
+                                    obj->in1->freqs, 
+                                    obj->out1->freqs,
+                                    iBinStart, iBinStop);
+
+    }
+
     int mod_sss_process_mspf(mod_sss_obj * obj) {
 
         int rtnValue;
@@ -702,53 +863,21 @@
 
             if (obj->enabled == 1) {
 
-                freq2env_process(obj->pf_ms_freq2env,
-                                 obj->out1->freqs,
-                                 obj->pf_ms_noisys);
+                // Envelopes, then noise, interference and speech gain (MCRA smooths 
+                // across neighbouring bins, so all envelopes must be ready first)
 
-                demixing2env_process(obj->pf_ms_demixing2env,
-                                     obj->in3->tracks, 
-                                     obj->sep_demixings, 
-                                     obj->sep_masks, 
-                                     obj->in2->envs,
-                                     obj->pf_ms_noisesEst);
+                pool_run(obj->pool, mod_sss_process_mspf_envs_bins, (void *) obj, obj->nThreads);
 
-                env2env_mcra_process(obj->pf_ms_env2env_mcra, 
-                                     obj->in3->tracks, 
-                                     obj->pf_ms_noisys, 
-                                     obj->pf_ms_noisesEst,
-                                     obj->pf_ms_noisesSep);
-
-                env2env_interf_process(obj->pf_ms_env2env_interf, 
-                                       obj->in3->tracks, 
-                                       obj->pf_ms_noisys, 
-                                       obj->pf_ms_noisesSep, 
-                                       obj->pf_ms_interfs);           
-
-                env2env_gainspeech_process(obj->pf_ms_env2env_gainspeech, 
-                                           obj->in3->tracks, 
-                                           obj->pf_ms_noisys, 
-                                           obj->pf_ms_interfs, 
-                                           obj->pf_ms_gainspeeches, 
-                                           obj->pf_ms_snrs, 
-                                           obj->pf_ms_vs);
+                env2env_mcra_process_prepare(obj->pf_ms_env2env_mcra, 
+                                             obj->in3->tracks);
 
-                env2env_probspeech_process(obj->pf_ms_env2env_probspeech, 
-                                           obj->in3->tracks,
-                                           obj->pf_ms_snrs, 
-                                           obj->pf_ms_vs, 
-                                           obj->pf_ms_probspeeches);
+                pool_run(obj->pool, mod_sss_process_mspf_gains_bins, (void *) obj, obj->nThreads);
 
-                env2env_gainall_process(obj->pf_ms_env2env_gainall, 
-                                        obj->in3->tracks, 
-                                        obj->pf_ms_gainspeeches, 
-                                        obj->pf_ms_probspeeches, 
-                                        obj->pf_ms_gainalls);
+                // Speech presence probability is smoothed over all bins, so it is split across sources instead
+
+                pool_run(obj->pool, mod_sss_process_mspf_probspeech_seps, (void *) obj, obj->nSeps);
 
-                freq2freq_gain_process(obj->pf_ms_freq2freq_gain, 
-                                       obj->out1->freqs, 
-                                       obj->pf_ms_gainalls,
-                                       obj->out2->freqs);
+                pool_run(obj->pool, mod_sss_process_mspf_apply_bins, (void *) obj, obj->nThreads);
 
             }
             else {
@@ -774,6 +903,105 @@
 
     }
 
+    void mod_sss_process_mspf_envs_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker) {
+
+        mod_sss_obj * obj;
+        unsigned int iBinStart;
+        unsigned int iBinStop;
+
+        obj = (mod_sss_obj *) ptr;
+        iBinStart = obj->binStarts[iTask];
+        iBinStop = obj->binStarts[iTask+1];
+
+        freq2env_process_range(obj->pf_ms_freq2env,
+                               obj->out1->freqs,
+                               obj->pf_ms_noisys,
+                               iBinStart, iBinStop);
+
+        demixing2env_process_range(obj->pf_ms_demixing2env,
+                                   obj->in3->tracks, 
+                                   obj->sep_demixings, 
+                                   obj->sep_masks, 
+                                   obj->in2->envs,
+                                   obj->pf_ms_noisesEst,
+                                   iBinStart, iBinStop);
+
+    }
+
+    void mod_sss_process_mspf_gains_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker) {
+
+        mod_sss_obj * obj;
+        unsigned int iBinStart;
+        unsigned int iBinStop;
+
+        obj = (mod_sss_obj *) ptr;
+        iBinStart = obj->binStarts[iTask];
+        iBinStop = obj->binStarts[iTask+1];
+
+        env2env_mcra_process_range(obj->pf_ms_env2env_mcra, 
+                                   obj->pf_ms_noisys, 
+                                   obj->pf_ms_noisesEst,
+                                   obj->pf_ms_noisesSep,
+                                   iBinStart, iBinStop);
+
+        env2env_interf_process_range(obj->pf_ms_env2env_interf, 
+                                     obj->in3->tracks, 
+                                     obj->pf_ms_noisys, 
+                                     obj->pf_ms_noisesSep, 
+                                     obj->pf_ms_interfs,
+                                     iBinStart, iBinStop);           
+
+        env2env_gainspeech_process_range(obj->pf_ms_env2env_gainspeech, 
+                                         obj->in3->tracks, 
+                                         obj->pf_ms_noisys, 
+                                         obj->pf_ms_interfs, 
+                                         obj->pf_ms_gainspeeches, 
+                                         obj->pf_ms_snrs, 
+                                         obj->pf_ms_vs,
+                                         iBinStart, iBinStop);
+
+    }
+
+    void mod_sss_process_mspf_probspeech_seps(void * ptr, const unsigned int iTask, const unsigned int iWorker) {
+
+        mod_sss_obj * obj;
+
+        obj = (mod_sss_obj *) ptr;
+
+        env2env_probspeech_process_channel(obj->pf_ms_env2env_probspeech, 
+                                           obj->in3->tracks,
+                                           obj->pf_ms_snrs, 
+                                           obj->pf_ms_vs, 
+                                           obj->pf_ms_probspeeches,
+                                           iTask);
+
+    }
+
+    void mod_sss_process_mspf_apply_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker) {
+
+        mod_sss_obj * obj;
+        unsigned int iBinStart;
+        unsigned int iBinStop;
+
+        obj = (mod_sss_obj *) ptr;
+        iBinStart = obj->binStarts[iTask];
+        iBinStop = obj->binStarts[iTask+1];
+
+        env2env_gainall_process_range(obj->pf_ms_env2env_gainall, 
+                                      obj->in3->tracks, 
+                                      obj->pf_ms_gainspeeches, 
+                                      obj->pf_ms_probspeeches, 
+                                      obj->pf_ms_gainalls,
+                                      iBinStart, iBinStop);
+
+        freq2freq_gain_process_range(obj->pf_ms_freq2freq_gain, 
+                                     obj->out1->freqs, 
+                                     obj->pf_ms_gainalls,
+                                     obj->out2->freqs,
+                                     iBinStart, iBinStop);
+
+    }
+
     int mod_sss_process_sspf(mod_sss_obj * obj) {
 
         int rtnValue;
@@ -790,31 +1018,7 @@
  
             if (obj->enabled == 1) {
 
-                freq2env_process(obj->pf_ss_freq2env_channels,
-                                 obj->in1->freqs,
-                                 obj->pf_ss_env_channels);
-
-                demixing2env_process(obj->pf_ss_demixing2env,
-                                     obj->in3->tracks, 
-                                     obj->sep_demixings, 
-                                     obj->sep_masks, 
-                                     obj->pf_ss_env_channels,
-                                     obj->pf_ss_env_channelseps);   
-
-                freq2env_process(obj->pf_ss_freq2env_seps,
-                                 obj->out1->freqs,
-                                 obj->pf_ss_env_seps);         
-
-                env2env_gainratio_process(obj->pf_ss_env2env_gainratio, 
-                                          obj->in3->tracks, 
-                                          obj->pf_ss_env_seps, 
-                                          obj->pf_ss_env_channelseps,
-                                          obj->pf_ss_gainratio);
-
-                freq2freq_gain_process(obj->pf_ss_freq2freq_gain, 
-                                       obj->out1->freqs, 
-                                       obj->pf_ss_gainratio,
-                                       obj->out2->freqs);
+                pool_run(obj->pool, mod_sss_process_sspf_bins, (void *) obj, obj->nThreads);
 
             }
             else {
@@ -840,6 +1044,49 @@
 
     }
 
+    void mod_sss_process_sspf_bins(void * ptr, const unsigned int iTask, const unsigned int iWorker) {
+
+        mod_sss_obj * obj;
+        unsigned int iBinStart;
+        unsigned int iBinStop;
+
+        obj = (mod_sss_obj *) ptr;
+        iBinStart = obj->binStarts[iTask];
+        iBinStop = obj->binStarts[iTask+1];
+
+        freq2env_process_range(obj->pf_ss_freq2env_channels,
+                               obj->in1->freqs,
+                               obj->pf_ss_env_channels,
+                               iBinStart, iBinStop);
+
+        demixing2env_process_range(obj->pf_ss_demixing2env,
+                                   obj->in3->tracks, 
+                                   obj->sep_demixings, 
+                                   obj->sep_masks, 
+                                   obj->pf_ss_env_channels,
+                                   obj->pf_ss_env_channelseps,
+                                   iBinStart, iBinStop);   
+
+        freq2env_process_range(obj->pf_ss_freq2env_seps,
+                               obj->out1->freqs,
+                               obj->pf_ss_env_seps,
+                               iBinStart, iBinStop);         
+
+        env2env_gainratio_process_range(obj->pf_ss_env2env_gainratio, 
+                                        obj->in3->tracks, 
+                                        obj->pf_ss_env_seps, 
+                                        obj->pf_ss_env_channelseps,
+                                        obj->pf_ss_gainratio,
+                                        iBinStart, iBinStop);
+
+        freq2freq_gain_process_range(obj->pf_ss_freq2freq_gain, 
+                                     obj->out1->freqs, 
+                                     obj->pf_ss_gainratio,
+                                     obj->out2->freqs,
+                                     iBinStart, iBinStop);
+
+    }
+
     void mod_sss_connect(mod_sss_obj * obj, msg_spectra_obj * in1, msg_powers_obj * in2, msg_tracks_obj * in3, msg_spectra_obj * out1, msg_spectra_obj * out2) {
 
         obj->in1 = in1;
@@ -881,6 +1128,17 @@
         cfg->mode_sep = 0x00;
         cfg->mode_pf = 0x00;
 
+        cfg->nThreads = 1;
+
+        cfg->sep_tolerance = 0.0f;
+
+        cfg->sep_ds_tableFile = (char *) NULL;
+        cfg->sep_ds_tableLevel = 0;
+        cfg->sep_ds_tableShape = 's';
+
+        cfg->pf_ms_math = 'p';
+        cfg->pf_ss_math = 'p';
+
         cfg->nThetas = 0;
         cfg->gainMin = 0.0f;
 
@@ -906,6 +1164,10 @@
             soundspeed_destroy(cfg->soundspeed);
         }
 
+        if (cfg->sep_ds_tableFile != NULL) {
+            free((void *) cfg->sep_ds_tableFile);
+        }
+
         free((void *) cfg);
 
     }
@@ -28,6 +28,7 @@
         mod_sst_obj * obj;
         
         unsigned int iTrackMax;
+        unsigned int iThread;
         points_obj * points;
         beampatterns_obj * beampatterns_mics;
         beampatterns_obj * beampatterns_spatialfilters;
@@ -160,109 +161,161 @@
         spatialindexes_destroy(spatialindexes);
 
         deltaT = ((float) mod_sst_config->hopSize) / ((float) msg_pots_config->fS);
+
+        obj->nThreads = (mod_sst_config->nThreads > 0) ? mod_sst_config->nThreads : 1;
+        obj->pool = pool_construct(obj->nThreads);
+
+        obj->iTracksMax = (unsigned int *) malloc(sizeof(unsigned int) * obj->nTracksMax);
+        memset(obj->iTracksMax, 0x00, sizeof(unsigned int) * obj->nTracksMax);
+        obj->estimates = (float *) malloc(sizeof(float) * obj->nTracksMax * 3);
+        memset(obj->estimates, 0x00, sizeof(float) * obj->nTracksMax * 3);
+
+        // Each worker owns its filter objects since they hold scratch memory
         
-        switch(obj->mode) {
+        obj->kalman2kalman_prob = (kalman2kalman_obj **) malloc(sizeof(kalman2kalman_obj *) * obj->nThreads);
+        obj->kalman2kalman_active = (kalman2kalman_obj **) malloc(sizeof(kalman2kalman_obj *) * obj->nThreads);
+        obj->kalman2kalman_target = (kalman2kalman_obj **) malloc(sizeof(kalman2kalman_obj *) * obj->nThreads);
+        obj->kalman2coherence_prob = (kalman2coherence_obj **) malloc(sizeof(kalman2coherence_obj *) * obj->nThreads);
+        obj->kalman2coherence_active = (kalman2coherence_obj **) malloc(sizeof(kalman2coherence_obj *) * obj->nThreads);
+        obj->kalman2coherence_target = (kalman2coherence_obj **) malloc(sizeof(kalman2coherence_obj *) * obj->nThreads);
+
+        obj->particle2particle_prob = (particle2particle_obj **) malloc(sizeof(particle2particle_obj *) * obj->nThreads);
+        obj->particle2particle_active = (particle2particle_obj **) malloc(sizeof(particle2particle_obj *) * obj->nThreads);
+        obj->particle2particle_target = (particle2particle_obj **) malloc(sizeof(particle2particle_obj *) * obj->nThreads);
+        obj->particle2coherence_prob = (particle2coherence_obj **) malloc(sizeof(particle2coherence_obj *) * obj->nThreads);
+        obj->particle2coherence_active = (particle2coherence_obj **) malloc(sizeof(particle2coherence_obj *) * obj->nThreads);
+        obj->particle2coherence_target = (particle2coherence_obj **) malloc(sizeof(particle2coherence_obj *) * obj->nThreads);
+
+        for (iThread = 0; iThread < obj->nThreads; iThread++) {
 
-            case 'k':
+            switch(obj->mode) {
 
-                obj->kalman2kalman_prob = kalman2kalman_construct(deltaT,
-                                                                  mod_sst_config->sigmaQ,
-                                                                  mod_sst_config->sigmaR_prob,
-                                                                  mod_sst_config->epsilon);    
+                case 'k':
 
-                obj->kalman2kalman_active = kalman2kalman_construct(deltaT,
-                                                                    mod_sst_config->sigmaQ,
-                                                                    mod_sst_config->sigmaR_active,
-                                                                    mod_sst_config->epsilon);   
+                    obj->kalman2kalman_prob[iThread] = kalman2kalman_construct(deltaT,
+                                                                               mod_sst_config->sigmaQ,
+                                                                               mod_sst_config->sigmaR_prob,
+                                                                               mod_sst_config->epsilon);    
 
-                obj->kalman2kalman_target = kalman2kalman_construct(deltaT,
-                                                                    mod_sst_config->sigmaQ,
-                                                                    mod_sst_config->sigmaR_target,
-                                                                    mod_sst_config->epsilon);
+                    obj->kalman2kalman_active[iThread] = kalman2kalman_construct(deltaT,
+                                                                                 mod_sst_config->sigmaQ,
+                                                                                 mod_sst_config->sigmaR_active,
+                                                                                 mod_sst_config->epsilon);   
 
-                obj->kalman2coherence_prob = kalman2coherence_construct(mod_sst_config->epsilon, 
-                                                                        mod_sst_config->sigmaR_prob);
+                    obj->kalman2kalman_target[iThread] = kalman2kalman_construct(deltaT,
+                                                                                 mod_sst_config->sigmaQ,
+                                                                                 mod_sst_config->sigmaR_target,
+                                                                                 mod_sst_config->epsilon);
 
-                obj->kalman2coherence_active = kalman2coherence_construct(mod_sst_config->epsilon, 
-                                                                          mod_sst_config->sigmaR_active);
+                    obj->kalman2coherence_prob[iThread] = kalman2coherence_construct(mod_sst_config->epsilon, 
+                                                                                     mod_sst_config->sigmaR_prob);
 
-                obj->kalman2coherence_target = kalman2coherence_construct(mod_sst_config->epsilon,
-                                                                          mod_sst_config->sigmaR_target);
+                    obj->kalman2coherence_active[iThread] = kalman2coherence_construct(mod_sst_config->epsilon, 
+                                                                                       mod_sst_config->sigmaR_active);
 
-                obj->particle2particle_prob = NULL;
-                obj->particle2particle_active = NULL;
-                obj->particle2particle_target = NULL;
-                obj->particle2coherence_prob = NULL;
-                obj->particle2coherence_active = NULL;                
-                obj->particle2coherence_target = NULL;
+                    obj->kalman2coherence_target[iThread] = kalman2coherence_construct(mod_sst_config->epsilon,
+                                                                                       mod_sst_config->sigmaR_target);
 
-            break;
+                    obj->particle2particle_prob[iThread] = NULL;
+                    obj->particle2particle_active[iThread] = NULL;
+                    obj->particle2particle_target[iThread] = NULL;
+                    obj->particle2coherence_prob[iThread] = NULL;
+                    obj->particle2coherence_active[iThread] = NULL;                
+                    obj->particle2coherence_target[iThread] = NULL;
 
-            case 'p':
+                break;
 
-                obj->kalman2kalman_prob = NULL;
-                obj->kalman2kalman_active = NULL;
-                obj->kalman2kalman_target = NULL;
-                obj->kalman2coherence_prob = NULL;
-                obj->kalman2coherence_active = NULL;
-                obj->kalman2coherence_target = NULL;
-
-                obj->particle2particle_prob = particle2particle_construct(mod_sst_config->nParticles,
-                                                                          deltaT,
-                                                                          mod_sst_config->st_alpha,
-                                                                          mod_sst_config->st_beta,
-                                                                          mod_sst_config->st_ratio,
-                                                                          mod_sst_config->ve_alpha,
-                                                                          mod_sst_config->ve_beta,
-                                                                          mod_sst_config->ve_ratio,
-                                                                          mod_sst_config->ac_alpha,
-                                                                          mod_sst_config->ac_beta,
-                                                                          mod_sst_config->ac_ratio,
-                                                                          (double) mod_sst_config->epsilon,
-                                                                          mod_sst_config->sigmaR_prob,
-                                                                          mod_sst_config->Nmin);
-
-                obj->particle2particle_active = particle2particle_construct(mod_sst_config->nParticles,
-                                                                            deltaT,
-                                                                            mod_sst_config->st_alpha,
-                                                                            mod_sst_config->st_beta,
-                                                                            mod_sst_config->st_ratio,
-                                                                            mod_sst_config->ve_alpha,
-                                                                            mod_sst_config->ve_beta,
-                                                                            mod_sst_config->ve_ratio,
-                                                                            mod_sst_config->ac_alpha,
-                                                                            mod_sst_config->ac_beta,
-                                                                            mod_sst_config->ac_ratio,
-                                                                            (double) mod_sst_config->epsilon,
-                                                                            mod_sst_config->sigmaR_active,
-                                                                            mod_sst_config->Nmin);   
-
-                obj->particle2particle_target = particle2particle_construct(mod_sst_config->nParticles,
-                                                                            deltaT,
-                                                                            mod_sst_config->st_alpha,
-                                                                            mod_sst_config->st_beta,
-                                                                            mod_sst_config->st_ratio,
-                                                                            mod_sst_config->ve_alpha,
-                                                                            mod_sst_config->ve_beta,
-                                                                            mod_sst_config->ve_ratio,
-                                                                            mod_sst_config->ac_alpha,
-                                                                            mod_sst_config->ac_beta,
-                                                                            mod_sst_config->ac_ratio,
-                                                                            (double) mod_sst_config->epsilon,
-                                                                            mod_sst_config->sigmaR_target,
-                                                                            mod_sst_config->Nmin);  
-
-                obj->particle2coherence_prob = particle2coherence_construct(mod_sst_config->sigmaR_prob);
-
-                obj->particle2coherence_active = particle2coherence_construct(mod_sst_config->sigmaR_active);
-
-                obj->particle2coherence_target = particle2coherence_construct(mod_sst_config->sigmaR_target);
+                case 'p':
 
-            break;
+                    obj->kalman2kalman_prob[iThread] = NULL;
+                    obj->kalman2kalman_active[iThread] = NULL;
+                    obj->kalman2kalman_target[iThread] = NULL;
+                    obj->kalman2coherence_prob[iThread] = NULL;
+                    obj->kalman2coherence_active[iThread] = NULL;
+                    obj->kalman2coherence_target[iThread] = NULL;
+
+                    if (iThread == 0) {
+
+                        obj->particle2particle_prob[iThread] = particle2particle_construct(mod_sst_config->nParticles,
+                                                                                           deltaT,
+                                                                                           mod_sst_config->st_alpha,
+                                                                                           mod_sst_config->st_beta,
+                                                                                           mod_sst_config->st_ratio,
+                                                                                           mod_sst_config->ve_alpha,
+                                                                                           mod_sst_config->ve_beta,
+                                                                                           mod_sst_config->ve_ratio,
+                                                                                           mod_sst_config->ac_alpha,
+                                                                                           mod_sst_config->ac_beta,
+                                                                                           mod_sst_config->ac_ratio,
+                                                                                           (double) mod_sst_config->epsilon,
+                                                                                           mod_sst_config->sigmaR_prob,
+                                                                                           mod_sst_config->Nmin);
+
+                        obj->particle2particle_active[iThread] = particle2particle_construct(mod_sst_config->nParticles,
+                                                                                             deltaT,
+                                                                                             mod_sst_config->st_alpha,
+                                                                                             mod_sst_config->st_beta,
+                                                                                             mod_sst_config->st_ratio,
+                                                                                             mod_sst_config->ve_alpha,
+                                                                                             mod_sst_config->ve_beta,
+                                                                                             mod_sst_config->ve_ratio,
+                                                                                             mod_sst_config->ac_alpha,
+                                                                                             mod_sst_config->ac_beta,
+                                                                                             mod_sst_config->ac_ratio,
+                                                                                             (double) mod_sst_config->epsilon,
+                                                                                             mod_sst_config->sigmaR_active,
+                                                                                             mod_sst_config->Nmin);   
+
+                        obj->particle2particle_target[iThread] = particle2particle_construct(mod_sst_config->nParticles,
+                                                                                             deltaT,
+                                                                                             mod_sst_config->st_alpha,
+                                                                                             mod_sst_config->st_beta,
+                                                                                             mod_sst_config->st_ratio,
+                                                                                             mod_sst_config->ve_alpha,
+                                                                                             mod_sst_config->ve_beta,
+                                                                                             mod_sst_config->ve_ratio,
+                                                                                             mod_sst_config->ac_alpha,
+                                                                                             mod_sst_config->ac_beta,
+                                                                                             mod_sst_config->ac_ratio,
+                                                                                             (double) mod_sst_config->epsilon,
+                                                                                             mod_sst_config->sigmaR_target,
+                                                                                             mod_sst_config->Nmin);  
 
-            default:
+                    }
+                    else {
 
-            break;
+                        // Clones share the normal realisations table with the first worker
+                        obj->particle2particle_prob[iThread] = particle2particle_construct_clone(obj->particle2particle_prob[0]);
+                        obj->particle2particle_active[iThread] = particle2particle_construct_clone(obj->particle2particle_active[0]);
+                        obj->particle2particle_target[iThread] = particle2particle_construct_clone(obj->particle2particle_target[0]);
+
+                    }
+
+                    obj->particle2coherence_prob[iThread] = particle2coherence_construct(mod_sst_config->sigmaR_prob);
+
+                    obj->particle2coherence_active[iThread] = particle2coherence_construct(mod_sst_config->sigmaR_active);
+
+                    obj->particle2coherence_target[iThread] = particle2coherence_construct(mod_sst_config->sigmaR_target);
+
+                break;
+
+                default:
+
+                break;
+
+            }
+
+        }
+
+        // Each track draws from its own random stream, so results do not depend on the number of workers
+
+        for (iTrackMax = 0; iTrackMax < obj->nTracksMax; iTrackMax++) {
+
+            if (obj->particles[iTrackMax] != NULL) {
+
+                obj->particles[iTrackMax]->seed = (unsigned int) rand();
+
+            }
 
         }
 
@@ -289,6 +342,7 @@
     void mod_sst_destroy(mod_sst_obj * obj) {
 
         unsigned int iTrackMax;
+        unsigned int iThread;
 
         for (iTrackMax = 0; iTrackMax <= obj->nTracksMax; iTrackMax++) {
 
@@ -339,43 +393,65 @@
         free((void *) obj->mean_prob);
         free((void *) obj->n_inactive);
 
-        if (obj->kalman2kalman_prob != NULL) {
-            kalman2kalman_destroy(obj->kalman2kalman_prob);
-        }
-        if (obj->kalman2kalman_active != NULL) {
-            kalman2kalman_destroy(obj->kalman2kalman_active);
-        }
-        if (obj->kalman2kalman_target != NULL) {
-            kalman2kalman_destroy(obj->kalman2kalman_target);
-        }
-        if (obj->kalman2coherence_prob != NULL) {
-            kalman2coherence_destroy(obj->kalman2coherence_prob);
-        }
-        if (obj->kalman2coherence_active != NULL) {
-            kalman2coherence_destroy(obj->kalman2coherence_active);
-        }
-        if (obj->kalman2coherence_target != NULL) {
-            kalman2coherence_destroy(obj->kalman2coherence_target);
-        }
-        if (obj->particle2particle_prob != NULL) {
-            particle2particle_destroy(obj->particle2particle_prob);
-        }
-        if (obj->particle2particle_active != NULL) {
-            particle2particle_destroy(obj->particle2particle_active);
-        }
-        if (obj->particle2particle_target != NULL) {
-            particle2particle_destroy(obj->particle2particle_target);
-        }
-        if (obj->particle2coherence_prob != NULL)  {
-            particle2coherence_destroy(obj->particle2coherence_prob);
-        }
-        if (obj->particle2coherence_active != NULL) {
-            particle2coherence_destroy(obj->particle2coherence_active);
-        }
-        if (obj->particle2coherence_target != NULL) {
-            particle2coherence_destroy(obj->particle2coherence_target);
+        for (iThread = 0; iThread < obj->nThreads; iThread++) {
+
+            if (obj->kalman2kalman_prob[iThread] != NULL) {
+                kalman2kalman_destroy(obj->kalman2kalman_prob[iThread]);
+            }
+            if (obj->kalman2kalman_active[iThread] != NULL) {
+                kalman2kalman_destroy(obj->kalman2kalman_active[iThread]);
+            }
+            if (obj->kalman2kalman_target[iThread] != NULL) {
+                kalman2kalman_destroy(obj->kalman2kalman_target[iThread]);
+            }
+            if (obj->kalman2coherence_prob[iThread] != NULL) {
+                kalman2coherence_destroy(obj->kalman2coherence_prob[iThread]);
+            }
+            if (obj->kalman2coherence_active[iThread] != NULL) {
+                kalman2coherence_destroy(obj->kalman2coherence_active[iThread]);
+            }
+            if (obj->kalman2coherence_target[iThread] != NULL) {
+                kalman2coherence_destroy(obj->kalman2coherence_target[iThread]);
+            }
+            if (obj->particle2particle_prob[iThread] != NULL) {
+                particle2particle_destroy(obj->particle2particle_prob[iThread]);
+            }
+            if (obj->particle2particle_active[iThread] != NULL) {
+                particle2particle_destroy(obj->particle2particle_active[iThread]);
+            }
+            if (obj->particle2particle_target[iThread] != NULL) {
+                particle2particle_destroy(obj->particle2particle_target[iThread]);
+            }
+            if (obj->particle2coherence_prob[iThread] != NULL) {
+                particle2coherence_destroy(obj->particle2coherence_prob[iThread]);
+            }
+            if (obj->particle2coherence_active[iThread] != NULL) {
+                particle2coherence_destroy(obj->particle2coherence_active[iThread]);
+            }
+            if (obj->particle2coherence_target[iThread] != NULL) {
+                particle2coherence_destroy(obj->particle2coherence_target[iThread]);
+            }
+
         }
 
+        free((void *) obj->kalman2kalman_prob);
+        free((void *) obj->kalman2kalman_active);
+        free((void *) obj->kalman2kalman_target);
+        free((void *) obj->kalman2coherence_prob);
+        free((void *) obj->kalman2coherence_active);
+        free((void *) obj->kalman2coherence_target);
+        free((void *) obj->particle2particle_prob);
+        free((void *) obj->particle2particle_active);
+        free((void *) obj->particle2particle_target);
+        free((void *) obj->particle2coherence_prob);
+        free((void *) obj->particle2coherence_active);
+        free((void *) obj->particle2coherence_target);
+
+        free((void *) obj->iTracksMax);
+        free((void *) obj->estimates);
+
+        pool_destroy(obj->pool);
+
         mixture2mixture_destroy(obj->mixture2mixture);
 
         free((void *) obj);
@@ -439,7 +515,7 @@
 
                                     case 'k':
 
-                                        kalman2kalman_init_targets(obj->kalman2kalman_prob, 
+                                        kalman2kalman_init_targets(obj->kalman2kalman_prob[0], 
                                                                    obj->in2->targets,
                                                                    iTargetMax, 
                                                                    obj->kalmans[iTrackMax]); 
@@ -448,7 +524,7 @@
 
                                     case 'p':
 
-                                        particle2particle_init_targets(obj->particle2particle_prob, 
+                                        particle2particle_init_targets(obj->particle2particle_prob[0], 
                                                                        obj->in2->targets,
                                                                        iTargetMax, 
                                                                        obj->particles[iTrackMax]);
@@ -528,103 +604,7 @@
                 }
 
                 // +----------------------------------------------------------------------+
-                // | Predict                                                              |
-                // +----------------------------------------------------------------------+
-
-                for (iTrackMax = 0; iTrackMax < obj->nTracksMax; iTrackMax++) {
-
-                    if (obj->ids[iTrackMax] != 0) {
-
-                        switch(obj->mode) {
-
-                            case 'k':
-
-                                switch (obj->type[iTrackMax]) {
-                                    
-                                    case 'P':                    
-
-                                        kalman2kalman_predict(obj->kalman2kalman_prob,
-                                                              obj->kalmans[iTrackMax]);         
-
-                                    break;
-
-                                    case 'A':
-
-                                        kalman2kalman_predict(obj->kalman2kalman_active,
-                                                              obj->kalmans[iTrackMax]);  
-
-                                    break;
-
-                                    case 'T':
-
-                                        kalman2kalman_predict_static(obj->kalman2kalman_target,
-                                                                     obj->kalmans[iTrackMax]);
-
-                                    break;
-
-                                    default:
-
-                                        printf("Predict: Unknown state.\n");
-                                        printf("%u, %c\n",iTrackMax,obj->type[iTrackMax]);
-                                        exit(EXIT_FAILURE);                        
-
-                                    break;
-
-                                }
-
-                            break;
-
-                            case 'p':
-
-                                switch (obj->type[iTrackMax]) {
-                                    
-                                    case 'P':    
-
-                                        particle2particle_predict(obj->particle2particle_prob,
-                                                                  obj->particles[iTrackMax]);                        
-
-                                    break;
-
-                                    case 'A':
-
-                                        particle2particle_predict(obj->particle2particle_active,
-                                                                  obj->particles[iTrackMax]);                        
-
-                                    break;
-
-                                    case 'T':
-
-                                        particle2particle_predict_static(obj->particle2particle_target,
-                                                                         obj->particles[iTrackMax]);
-
-                                    break;
-
-                                    default:
-
-                                        printf("Predict: Unknown state.\n");
-                                        exit(EXIT_FAILURE);                        
-
-                                    break;
-
-                                }    
-
-                            break;
-
-                            default:
-
-                                printf("Invalid filter type.\n");
-                                exit(EXIT_FAILURE);
-
-                            break;
-
-                        }
-
-                    }
-
-                }
-
-                // +----------------------------------------------------------------------+
-                // | Coherence                                                            |
+                // | Predict and coherence                                                |
                 // +----------------------------------------------------------------------+
 
                 iTrack = 0;
@@ -633,113 +613,15 @@
 
                     if (obj->ids[iTrackMax] != 0) {
 
-                        switch(obj->mode) {
-
-                            case 'k':
-
-                                switch (obj->type[iTrackMax]) {
-                                    
-                                    case 'P':  
-
-                                        kalman2coherence_process(obj->kalman2coherence_prob,
-                                                                 obj->kalmans[iTrackMax],
-                                                                 obj->in1->pots,
-                                                                 iTrack,
-                                                                 obj->coherences[obj->nTracks]);
-
-                                    break;
-
-                                    case 'A':
-
-                                        kalman2coherence_process(obj->kalman2coherence_active,
-                                                                 obj->kalmans[iTrackMax],
-                                                                 obj->in1->pots,
-                                                                 iTrack,
-                                                                 obj->coherences[obj->nTracks]);
-
-                                    break;
-
-                                    case 'T':
-
-                                        kalman2coherence_process(obj->kalman2coherence_target,
-                                                                 obj->kalmans[iTrackMax],
-                                                                 obj->in1->pots,
-                                                                 iTrack,
-                                                                 obj->coherences[obj->nTracks]);
-
-                                    break;
-
-                                    default:
-
-                                        printf("Coherence: Unknown state.\n");
-                                        exit(EXIT_FAILURE);                            
-
-                                    break;
-
-                                }
-
-                            break;
-
-                            case 'p':
-
-                                switch (obj->type[iTrackMax]) {
-                                    
-                                    case 'P':                      
-
-                                        particle2coherence_process(obj->particle2coherence_prob,
-                                                                   obj->particles[iTrackMax],
-                                                                   obj->in1->pots,
-                                                                   iTrack,
-                                                                   obj->coherences[obj->nTracks]);
-
-                                    break;
-
-                                    case 'A':                      
-
-                                        particle2coherence_process(obj->particle2coherence_active,
-                                                                   obj->particles[iTrackMax],
-                                                                   obj->in1->pots,
-                                                                   iTrack,
-                                                                   obj->coherences[obj->nTracks]);
-
-                                    break;
-
-                                    case 'T':
-
-                                        particle2coherence_process(obj->particle2coherence_target,
-                                                                   obj->particles[iTrackMax],
-                                                                   obj->in1->pots,
-                                                                   iTrack,
-                                                                   obj->coherences[obj->nTracks]);                                
-
-                                    break;
-
-                                    default:
-
-                                        printf("Coherence: Unknown state.\n");
-                                        exit(EXIT_FAILURE);                            
-
-                                    break;                        
-
-                                }
-
-                            break;
-
-                            default:
-
-                                printf("Invalid filter type.\n");
-                                exit(EXIT_FAILURE);
-
-                            break;
-
-                        }
-
+                        obj->iTracksMax[iTrack] = iTrackMax;
                         iTrack++;
 
                     }
 
                 }
 
+                pool_run(obj->pool, mod_sst_process_predict, (void *) obj, obj->nTracks);
+
                 // +----------------------------------------------------------------------+
                 // | Mixture                                                              |
                 // +----------------------------------------------------------------------+
@@ -751,121 +633,10 @@
                 	                    obj->postprobs[obj->nTracks]);
 
                 // +----------------------------------------------------------------------+
-                // | Update                                                               |
+                // | Update and estimate                                                  |
                 // +----------------------------------------------------------------------+
 
-                iTrack = 0;
-
-                for (iTrackMax = 0; iTrackMax < obj->nTracksMax; iTrackMax++) {
-
-                    if (obj->ids[iTrackMax] != 0) {
-
-                        switch(obj->mode) {
-
-                            case 'k':
-
-                                switch (obj->type[iTrackMax]) {
-                                    
-                                    case 'P':                                                  
-
-                                        kalman2kalman_update(obj->kalman2kalman_prob,
-                                                             obj->postprobs[obj->nTracks],
-                                                             iTrack,
-                                                             obj->in1->pots,
-                                                             obj->kalmans[iTrackMax]);
-
-                                    break;
-
-                                    case 'A':                      
-
-                                        kalman2kalman_update(obj->kalman2kalman_active,
-                                                             obj->postprobs[obj->nTracks],
-                                                             iTrack,
-                                                             obj->in1->pots,
-                                                             obj->kalmans[iTrackMax]);
-
-                                    break;
-
-                                    case 'T':
-
-                                        kalman2kalman_update_static(obj->kalman2kalman_target,
-                                                                    obj->postprobs[obj->nTracks],
-                                                                    iTrack,
-                                                                    obj->in1->pots,
-                                                                    obj->kalmans[iTrackMax]);
-
-                                    break;
-
-                                    default:
-
-                                        printf("Update: Unknown state.\n");
-                                        exit(EXIT_FAILURE); 
-
-                                    break;
-
-                                }
-
-                            break;
-
-                            case 'p':
-
-                                switch (obj->type[iTrackMax]) {
-                                    
-                                    case 'P':                      
-
-                                        particle2particle_update(obj->particle2particle_prob,
-                                                                 obj->postprobs[obj->nTracks],
-                                                                 iTrack,
-                                                                 obj->in1->pots,
-                                                                 obj->particles[iTrackMax]);
-
-                                    break;
-
-                                    case 'A':
-
-                                        particle2particle_update(obj->particle2particle_active,
-                                                                 obj->postprobs[obj->nTracks],
-                                                                 iTrack,
-                                                                 obj->in1->pots,
-                                                                 obj->particles[iTrackMax]);
-
-                                    break;
-
-                                    case 'T':
-
-                                        particle2particle_update_static(obj->particle2particle_target,
-                                                                        obj->postprobs[obj->nTracks],
-                                                                        iTrack,
-                                                                        obj->in1->pots,
-                                                                        obj->particles[iTrackMax]);
-
-                                    break;
-
-                                    default:
-
-                                        printf("Update: Unknown state.\n");
-                                        exit(EXIT_FAILURE);                         
-
-                                    break;
-
-                                }
-
-                            break;
-
-                            default:
-
-                                printf("Invalid filter type.\n");
-                                exit(EXIT_FAILURE);
-
-                            break;
-
-                        }
-
-                        iTrack++;
-
-                    }
-
-                }
+                pool_run(obj->pool, mod_sst_process_update, (void *) obj, obj->nTracks);
 
                 // +----------------------------------------------------------------------+
                 // | Activity                                                             |
@@ -980,7 +751,7 @@
 
                                         case 'k':
 
-                                            kalman2kalman_init_pots(obj->kalman2kalman_prob, 
+                                            kalman2kalman_init_pots(obj->kalman2kalman_prob[0], 
                                                                     obj->in1->pots,
                                                                     iPot, 
                                                                     obj->kalmans[iTrackMax]); 
@@ -989,7 +760,7 @@
 
                                         case 'p':
 
-                                            particle2particle_init_pots(obj->particle2particle_prob, 
+                                            particle2particle_init_pots(obj->particle2particle_prob[0], 
                                                                         obj->in1->pots,
                                                                         iPot, 
                                                                         obj->particles[iTrackMax]);
@@ -1108,36 +879,9 @@
 
                         if ((obj->type[iTrackMax] == 'A') || (obj->type[iTrackMax] == 'T')) {
 
-                            switch(obj->mode) {
-
-                                case 'k':
-
-                                    kalman2kalman_estimate(obj->kalman2kalman_active, 
-                                                           obj->kalmans[iTrackMax], 
-                                                           &x, 
-                                                           &y, 
-                                                           &z);
-
-                                break;
-
-                                case 'p':
-
-                                    particle2particle_estimate(obj->particle2particle_active, 
-                                                               obj->particles[iTrackMax], 
-                                                               &x,
-                                                               &y,
-                                                               &z);
-
-                                break;
-
-                                default:
-
-                                    printf("Invalid filter type.\n");
-                                    exit(EXIT_FAILURE);
-
-                                break;
-
-                            }
+                            x = obj->estimates[iTrackMax * 3 + 0];
+                            y = obj->estimates[iTrackMax * 3 + 1];
+                            z = obj->estimates[iTrackMax * 3 + 2];
 
                             obj->out->tracks->array[iTrackMax * 3 + 0] = x;
                             obj->out->tracks->array[iTrackMax * 3 + 1] = y;
@@ -1176,6 +920,351 @@
 
     }
 
+    void mod_sst_process_predict(void * ptr, const unsigned int iTrack, const unsigned int iWorker) {
+
+        mod_sst_obj * obj;
+        unsigned int iTrackMax;
+
+        obj = (mod_sst_obj *) ptr;
+        iTrackMax = obj->iTracksMax[iTrack];
+
+        // Predict
+
+        switch(obj->mode) {
+
+            case 'k':
+
+                switch (obj->type[iTrackMax]) {
+                    
+                    case 'P':                    
+
+                        kalman2kalman_predict(obj->kalman2kalman_prob[iWorker],
+                                              obj->kalmans[iTrackMax]);         
+
+                    break;
+
+                    case 'A':
+
+                        kalman2kalman_predict(obj->kalman2kalman_active[iWorker],
+                                              obj->kalmans[iTrackMax]);  
+
+                    break;
+
+                    case 'T':
+
+                        kalman2kalman_predict_static(obj->kalman2kalman_target[iWorker],
+                                                     obj->kalmans[iTrackMax]);
+
+                    break;
+
+                    default:
+
+                        printf("Predict: Unknown state.\n");
+                        printf("%u, %c\n",iTrackMax,obj->type[iTrackMax]);
+                        exit(EXIT_FAILURE);                        
+
+                    break;
+
+                }
+
+            break;
+
+            case 'p':
+
+                switch (obj->type[iTrackMax]) {
+                    
+                    case 'P':    
+
+                        particle2particle_predict(obj->particle2particle_prob[iWorker],
+                                                  obj->particles[iTrackMax]);                        
+
+                    break;
+
+                    case 'A':
+
+                        particle2particle_predict(obj->particle2particle_active[iWorker],
+                                                  obj->particles[iTrackMax]);                        
+
+                    break;
+
+                    case 'T':
+
+                        particle2particle_predict_static(obj->particle2particle_target[iWorker],
+                                                         obj->particles[iTrackMax]);
+
+                    break;
+
+                    default:
+
+                        printf("Predict: Unknown state.\n");
+                        exit(EXIT_FAILURE);                        
+
+                    break;
+
+                }    
+
+            break;
+
+            default:
+
+                printf("Invalid filter type.\n");
+                exit(EXIT_FAILURE);
+
+            break;
+
+        }
+
+        // Coherence
+
+        switch(obj->mode) {
+
+            case 'k':
+
+                switch (obj->type[iTrackMax]) {
+                    
+                    case 'P':  
+
+                        kalman2coherence_process(obj->kalman2coherence_prob[iWorker],
+                                                 obj->kalmans[iTrackMax],
+                                                 obj->in1->pots,
+                                                 iTrack,
+                                                 obj->coherences[obj->nTracks]);
+
+                    break;
+
+                    case 'A':
+
+                        kalman2coherence_process(obj->kalman2coherence_active[iWorker],
+                                                 obj->kalmans[iTrackMax],
+                                                 obj->in1->pots,
+                                                 iTrack,
+                                                 obj->coherences[obj->nTracks]);
+
+                    break;
+
+                    case 'T':
+
+                        kalman2coherence_process(obj->kalman2coherence_target[iWorker],
+                                                 obj->kalmans[iTrackMax],
+                                                 obj->in1->pots,
+                                                 iTrack,
+                                                 obj->coherences[obj->nTracks]);
+
+                    break;
+
+                    default:
+
+                        printf("Coherence: Unknown state.\n");
+                        exit(EXIT_FAILURE);                            
+
+                    break;
+
+                }
+
+            break;
+
+            case 'p':
+
+                switch (obj->type[iTrackMax]) {
+                    
+                    case 'P':                      
+
+                        particle2coherence_process(obj->particle2coherence_prob[iWorker],
+                                                   obj->particles[iTrackMax],
+                                                   obj->in1->pots,
+                                                   iTrack,
+                                                   obj->coherences[obj->nTracks]);
+
+                    break;
+
+                    case 'A':                      
+
+                        particle2coherence_process(obj->particle2coherence_active[iWorker],
+                                                   obj->particles[iTrackMax],
+                                                   obj->in1->pots,
+                                                   iTrack,
+                                                   obj->coherences[obj->nTracks]);
+
+                    break;
+
+                    case 'T':
+
+                        particle2coherence_process(obj->particle2coherence_target[iWorker],
+                                                   obj->particles[iTrackMax],
+                                                   obj->in1->pots,
+                                                   iTrack,
+                                                   obj->coherences[obj->nTracks]);                                
+
+                    break;
+
+                    default:
+
+                        printf("Coherence: Unknown state.\n");
+                        exit(EXIT_FAILURE);                            
+
+                    break;                        
+
+                }
+
+            break;
+
+            default:
+
+                printf("Invalid filter type.\n");
+                exit(EXIT_FAILURE);
+
+            break;
+
+        }
+
+    }
+
+    void mod_sst_process_update(void * ptr, const unsigned int iTrack, const unsigned int iWorker) {
+
+        mod_sst_obj * obj;
+        unsigned int iTrackMax;
+
+        obj = (mod_sst_obj *) ptr;
+        iTrackMax = obj->iTracksMax[iTrack];
+
+        // Predict
+
+        switch(obj->mode) {
+
+            case 'k':
+
+                switch (obj->type[iTrackMax]) {
+                    
+                    case 'P':                                                  
+
+                        kalman2kalman_update(obj->kalman2kalman_prob[iWorker],
+                                             obj->postprobs[obj->nTracks],
+                                             iTrack,
+                                             obj->in1->pots,
+                                             obj->kalmans[iTrackMax]);
+
+                    break;
+
+                    case 'A':                      
+
+                        kalman2kalman_update(obj->kalman2kalman_active[iWorker],
+                                             obj->postprobs[obj->nTracks],
+                                             iTrack,
+                                             obj->in1->pots,
+                                             obj->kalmans[iTrackMax]);
+
+                    break;
+
+                    case 'T':
+
+                        kalman2kalman_update_static(obj->kalman2kalman_target[iWorker],
+                                                    obj->postprobs[obj->nTracks],
+                                                    iTrack,
+                                                    obj->in1->pots,
+                                                    obj->kalmans[iTrackMax]);
+
+                    break;
+
+                    default:
+
+                        printf("Update: Unknown state.\n");
+                        exit(EXIT_FAILURE); 
+
+                    break;
+
+                }
+
+            break;
+
+            case 'p':
+
+                switch (obj->type[iTrackMax]) {
+                    
+                    case 'P':                      
+
+                        particle2particle_update(obj->particle2particle_prob[iWorker],
+                                                 obj->postprobs[obj->nTracks],
+                                                 iTrack,
+                                                 obj->in1->pots,
+                                                 obj->particles[iTrackMax]);
+
+                    break;
+
+                    case 'A':
+
+                        particle2particle_update(obj->particle2particle_active[iWorker],
+                                                 obj->postprobs[obj->nTracks],
+                                                 iTrack,
+                                                 obj->in1->pots,
+                                                 obj->particles[iTrackMax]);
+
+                    break;
+
+                    case 'T':
+
+                        particle2particle_update_static(obj->particle2particle_target[iWorker],
+                                                        obj->postprobs[obj->nTracks],
+                                                        iTrack,
+                                                        obj->in1->pots,
+                                                        obj->particles[iTrackMax]);
+
+                    break;
+
+                    default:
+
+                        printf("Update: Unknown state.\n");
+                        exit(EXIT_FAILURE);                         
+
+                    break;
+
+                }
+
+            break;
+
+            default:
+
+                printf("Invalid filter type.\n");
+                exit(EXIT_FAILURE);
+
+            break;
+
+        }
+
+        // Estimate right after the update: the result is only used if the track is still active or target
+
+        switch(obj->mode) {
+
+            case 'k':
+
+                kalman2kalman_estimate(obj->kalman2kalman_active[iWorker], 
+                                       obj->kalmans[iTrackMax], 
+                                       &(obj->estimates[iTrackMax * 3 + 0]), 
+                                       &(obj->estimates[iTrackMax * 3 + 1]), 
+                                       &(obj->estimates[iTrackMax * 3 + 2]));
+
+            break;
+
+            case 'p':
+
+                particle2particle_estimate(obj->particle2particle_active[iWorker], 
+                                           obj->particles[iTrackMax], 
+                                           &(obj->estimates[iTrackMax * 3 + 0]), 
+                                           &(obj->estimates[iTrackMax * 3 + 1]), 
+                                           &(obj->estimates[iTrackMax * 3 + 2]));
+
+            break;
+
+            default:
+
+                printf("Invalid filter type.\n");
+                exit(EXIT_FAILURE);
+
+            break;
+
+        }
+
+    }
+
     void mod_sst_connect(mod_sst_obj * obj, msg_pots_obj * in1, msg_targets_obj * in2, msg_tracks_obj * out) {
 
         obj->in1 = in1;
@@ -1213,6 +1302,7 @@
         cfg->mode = 0x00;
 
         cfg->hopSize = 0;
+        cfg->nThreads = 1;
         cfg->sigmaQ = 0.0f;
         
         cfg->nParticles = 0;
@@ -1271,6 +1361,7 @@
         printf("mode = %c\n", cfg->mode);
         printf("nTracksMax = %u\n", cfg->nTracksMax);
         printf("hopSize = %u\n", cfg->hopSize);
+        printf("nThreads = %u\n", cfg->nThreads);
         printf("sigmaQ = %f\n", cfg->sigmaQ);
         printf("nParticles = %u\n", cfg->nParticles);
         printf("st_alpha = %f\n", cfg->st_alpha);
@@ -30,7 +30,6 @@
         obj = (mod_stft_obj *) malloc(sizeof(mod_stft_obj));
 
         obj->hop2frame =  hop2frame_construct_zero(msg_hops_config->hopSize, 2*(msg_spectra_config->halfFrameSize-1),msg_hops_config->nChannels);
-        obj->frames = frames_construct_zero(msg_hops_config->nChannels,2*(msg_spectra_config->halfFrameSize-1));
         obj->frame2freq = frame2freq_construct_zero(2*(msg_spectra_config->halfFrameSize-1), msg_spectra_config->halfFrameSize);
 
         obj->in = (msg_hops_obj *) NULL;
@@ -45,7 +44,6 @@
     void mod_stft_destroy(mod_stft_obj * obj) {
 
         hop2frame_destroy(obj->hop2frame);
-        frames_destroy(obj->frames);
         frame2freq_destroy(obj->frame2freq);
 
         free((void *) obj);
@@ -60,8 +58,8 @@
 
             if (obj->enabled == 1) {
 
-                hop2frame_process(obj->hop2frame, obj->in->hops, obj->frames);
-                frame2freq_process(obj->frame2freq, obj->frames, obj->out->freqs);
+                hop2frame_push(obj->hop2frame, obj->in->hops);
+                frame2freq_process_ring(obj->frame2freq, obj->hop2frame, obj->out->freqs);
 
             }
             else {
@@ -0,0 +1,227 @@
+
+   /**
+    * \file     demixtable.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+    
+    #include <signal/demixtable.h>
+
+    demixtable_obj * demixtable_construct_zero(const unsigned int nPoints, const unsigned int nChannels, const unsigned int halfFrameSize, const unsigned long long key) {
+
+        demixtable_obj * obj;
+        demixtable_header * header;
+
+        obj = (demixtable_obj *) malloc(sizeof(demixtable_obj));
+
+        obj->nPoints = nPoints;
+        obj->nChannels = nChannels;
+        obj->halfFrameSize = halfFrameSize;
+        obj->key = key;
+
+        obj->blockSize = demixtable_size(nPoints, nChannels, halfFrameSize);
+        obj->block = (char *) malloc(obj->blockSize);
+        memset(obj->block, 0x00, obj->blockSize);
+        obj->mapped = 0x00;
+
+        header = (demixtable_header *) obj->block;
+        memcpy(header->magic, DEMIXTABLE_MAGIC, sizeof(header->magic));
+        header->key = key;
+        header->nPoints = nPoints;
+        header->nChannels = nChannels;
+        header->halfFrameSize = halfFrameSize;
+        header->version = DEMIXTABLE_VERSION;
+
+        demixtable_layout(obj);
+
+        return obj;
+
+    }
+
+    demixtable_obj * demixtable_construct_file(const char * fileName, const unsigned int nPoints, const unsigned int nChannels, const unsigned int halfFrameSize, const unsigned long long key) {
+
+        // Returns NULL if the file does not exist or was generated for another setup
+
+        demixtable_obj * obj;
+        const demixtable_header * header;
+        struct stat fileStat;
+        size_t blockSize;
+        void * block;
+        int fd;
+
+        blockSize = demixtable_size(nPoints, nChannels, halfFrameSize);
+
+        fd = open(fileName, O_RDONLY);
+
+        if (fd < 0) {
+            return NULL;
+        }
+
+        if ((fstat(fd, &fileStat) != 0) || ((size_t) fileStat.st_size != blockSize)) {
+            close(fd);
+            return NULL;
+        }
+
+        block = mmap(NULL, blockSize, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if (block == MAP_FAILED) {
+            return NULL;
+        }
+
+        header = (const demixtable_header *) block;
+
+        if ((memcmp(header->magic, DEMIXTABLE_MAGIC, sizeof(header->magic)) != 0) ||
+            (header->version != DEMIXTABLE_VERSION) ||
+            (header->key != key) ||
+            (header->nPoints != nPoints) ||
+            (header->nChannels != nChannels) ||
+            (header->halfFrameSize != halfFrameSize)) {
+
+            munmap(block, blockSize);
+            return NULL;
+
+        }
+
+        obj = (demixtable_obj *) malloc(sizeof(demixtable_obj));
+
+        obj->nPoints = nPoints;
+        obj->nChannels = nChannels;
+        obj->halfFrameSize = halfFrameSize;
+        obj->key = key;
+
+        obj->block = (char *) block;
+        obj->blockSize = blockSize;
+        obj->mapped = 0x01;
+
+        demixtable_layout(obj);
+
+        return obj;
+
+    }
+
+    void demixtable_destroy(demixtable_obj * obj) {
+
+        if (obj->mapped == 0x01) {
+            munmap((void *) obj->block, obj->blockSize);
+        }
+        else {
+            free((void *) obj->block);
+        }
+
+        free((void *) obj);
+
+    }
+
+    size_t demixtable_size(const unsigned int nPoints, const unsigned int nChannels, const unsigned int halfFrameSize) {
+
+        size_t size;
+
+        size = sizeof(demixtable_header);
+        size += sizeof(float) * nPoints * 3;
+        size += ((size_t) nPoints * nChannels + 3) & ~((size_t) 3);
+        size += sizeof(float) * nPoints * halfFrameSize * nChannels * 2;
+
+        return size;
+
+    }
+
+    void demixtable_layout(demixtable_obj * obj) {
+
+        // Masks are padded to a multiple of 4 bytes to keep the demixings aligned
+
+        size_t offset;
+
+        offset = sizeof(demixtable_header);
+        obj->points = (float *) &(obj->block[offset]);
+
+        offset += sizeof(float) * obj->nPoints * 3;
+        obj->masks = &(obj->block[offset]);
+
+        offset += ((size_t) obj->nPoints * obj->nChannels + 3) & ~((size_t) 3);
+        obj->array = (float *) &(obj->block[offset]);
+
+    }
+
+    int demixtable_save(const demixtable_obj * obj, const char * fileName) {
+
+        // Written to a temporary file first, then renamed, so that a reader never maps a partial table
+
+        char * tmpName;
+        FILE * fp;
+        int rtnValue;
+
+        tmpName = (char *) malloc(sizeof(char) * (strlen(fileName) + 5));
+        sprintf(tmpName, "%s.tmp", fileName);
+
+        rtnValue = -1;
+
+        fp = fopen(tmpName, "wb");
+
+        if (fp != NULL) {
+
+            if (fwrite(obj->block, sizeof(char), obj->blockSize, fp) == obj->blockSize) {
+                rtnValue = 0;
+            }
+
+            if (fclose(fp) != 0) {
+                rtnValue = -1;
+            }
+
+            if (rtnValue == 0) {
+                
+                if (rename(tmpName, fileName) != 0) {
+                    rtnValue = -1;
+                }
+
+            }
+
+            if (rtnValue != 0) {
+                remove(tmpName);
+            }
+
+        }
+
+        free((void *) tmpName);
+
+        return rtnValue;
+
+    }
+
+    void demixtable_printf(const demixtable_obj * obj) {
+
+        unsigned int iPoint;
+        unsigned int iChannel;
+
+        printf("Key: %016llx (%s)\n", obj->key, (obj->mapped == 0x01) ? "mapped" : "computed");
+
+        for (iPoint = 0; iPoint < obj->nPoints; iPoint++) {
+
+            printf("(%04u): (%+1.3f, %+1.3f, %+1.3f) ", iPoint, 
+                   obj->points[iPoint * 3 + 0], obj->points[iPoint * 3 + 1], obj->points[iPoint * 3 + 2]);
+
+            for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+                printf("%u", (unsigned int) obj->masks[iPoint * obj->nChannels + iChannel]);
+            }
+
+            printf("\n");
+
+        }
+
+    }
@@ -37,6 +37,8 @@
         obj->state = (unsigned char *) malloc(sizeof(unsigned char) * nParticles);
         memset(obj->state, 0x00, sizeof(unsigned char) * nParticles);
 
+        obj->seed = 0;
+
         return obj;
 
     }
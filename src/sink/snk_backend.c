@@ -0,0 +1,326 @@
+   
+   /**
+    * \file     snk_backend.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <sink/snk_backend.h>
+
+    snk_backend_obj * snk_backend_construct(const snk_backend_cfg * snk_backend_config, const msg_spectra_cfg * msg_spectra_config, const msg_hops_cfg * msg_hops_in_config, const msg_hops_cfg * msg_hops_out_config) {
+
+        snk_backend_obj * obj;
+        snk_hops_cfg * snk_hops_config;
+
+        obj = (snk_backend_obj *) malloc(sizeof(snk_backend_obj));
+
+        obj->timeStamp = 0;
+
+        obj->hopSizeIn = msg_hops_in_config->hopSize;
+        obj->hopSizeOut = msg_hops_out_config->hopSize;
+        obj->nChannels = msg_hops_in_config->nChannels;
+        obj->fSin = msg_spectra_config->fS;
+        obj->fSout = snk_backend_config->fS;
+        obj->halfFrameSize = msg_spectra_config->halfFrameSize;
+        obj->frameSize = 2 * (obj->halfFrameSize - 1);
+
+        obj->gain = snk_backend_config->gain;
+
+        // Output goes through a hops sink, only its raw buffer is used here
+
+        snk_hops_config = snk_hops_cfg_construct();
+        snk_hops_config->fS = snk_backend_config->fS;
+        snk_hops_config->format = format_clone(snk_backend_config->format);
+        snk_hops_config->interface = interface_clone(snk_backend_config->interface);
+        obj->snk_hops = snk_hops_construct(snk_hops_config, msg_hops_out_config);
+        snk_hops_cfg_destroy(snk_hops_config);
+
+        switch (obj->snk_hops->format->type) {
+
+            case format_binary_int08: obj->nBytes = 1; break;
+            case format_binary_int16: obj->nBytes = 2; break;
+            case format_binary_int24: obj->nBytes = 3; break;
+            case format_binary_int32: obj->nBytes = 4; break;
+            case format_lossless_int16: obj->nBytes = 2; break;
+            case format_lossless_int24: obj->nBytes = 3; break;
+            case format_undefined: obj->nBytes = 0; break;
+
+            default:
+
+                printf("Sink backend: Invalid format type.\n");
+                exit(EXIT_FAILURE);
+
+            break;
+
+        }
+
+        // Synthesized hop at the spectra sample rate
+        obj->freq2frame = freq2frame_construct_zero(obj->frameSize, obj->halfFrameSize);
+        obj->frames = frames_construct_zero(obj->nChannels, obj->frameSize);
+        obj->frame2hop = frame2hop_construct_zero(obj->hopSizeIn, obj->frameSize, obj->nChannels);
+        obj->hopsIn = hops_construct_zero(obj->nChannels, obj->hopSizeIn);
+        obj->nHops = 0;
+
+        obj->hop2hop_buffer = (hop2hop_buffer_obj *) NULL;
+        obj->hop2hop_polyphase = (hop2hop_polyphase_obj *) NULL;
+        obj->hopsOut = (hops_obj *) NULL;
+
+        if ((obj->fSin == obj->fSout) && (obj->hopSizeIn == obj->hopSizeOut)) {
+
+            obj->type = 'c';
+
+        }
+        else if (obj->fSin == obj->fSout) {
+
+            obj->type = 'b';
+            obj->hop2hop_buffer = hop2hop_buffer_construct_zero(obj->nChannels, obj->hopSizeIn, obj->hopSizeOut, 1.0f);
+            obj->hopsOut = hops_construct_zero(obj->nChannels, obj->hopSizeOut);
+
+        }
+        else {
+
+            obj->type = 'p';
+            obj->hop2hop_polyphase = hop2hop_polyphase_construct_zero(obj->nChannels, obj->hopSizeIn, obj->hopSizeOut, obj->fSin, obj->fSout, snk_backend_config->nTaps);
+            obj->hopsOut = hops_construct_zero(obj->nChannels, obj->hopSizeOut);
+
+        }
+
+        obj->in = (msg_spectra_obj *) NULL;
+
+        return obj;
+
+    }
+
+    void snk_backend_destroy(snk_backend_obj * obj) {
+
+        freq2frame_destroy(obj->freq2frame);
+        frames_destroy(obj->frames);
+        frame2hop_destroy(obj->frame2hop);
+        hops_destroy(obj->hopsIn);
+
+        if (obj->hop2hop_buffer != NULL) {
+            hop2hop_buffer_destroy(obj->hop2hop_buffer);
+        }
+        if (obj->hop2hop_polyphase != NULL) {
+            hop2hop_polyphase_destroy(obj->hop2hop_polyphase);
+        }
+        if (obj->hopsOut != NULL) {
+            hops_destroy(obj->hopsOut);
+        }
+
+        snk_hops_destroy(obj->snk_hops);
+
+        free((void *) obj);
+
+    }
+
+    void snk_backend_connect(snk_backend_obj * obj, msg_spectra_obj * in) {
+
+        obj->in = in;
+
+    }
+
+    void snk_backend_disconnect(snk_backend_obj * obj) {
+
+        obj->in = (msg_spectra_obj *) NULL;
+
+    }
+
+    void snk_backend_open(snk_backend_obj * obj) {
+
+        snk_hops_open(obj->snk_hops);
+
+    }
+
+    void snk_backend_close(snk_backend_obj * obj) {
+
+        snk_hops_close(obj->snk_hops);
+
+    }
+
+    int snk_backend_process(snk_backend_obj * obj) {
+
+        int rtnValue;
+
+        if (msg_spectra_isZero(obj->in) == 0) {
+
+            obj->timeStamp = obj->in->timeStamp;
+
+            // Nothing is synthesized when the output goes nowhere
+            if (obj->snk_hops->interface->type != interface_blackhole) {
+
+                freq2frame_process(obj->freq2frame, obj->in->freqs, obj->frames);
+                frame2hop_process(obj->frame2hop, obj->frames, obj->hopsIn);
+
+                switch(obj->type) {
+
+                    case 'c':
+
+                        // Same rate and hop size: encode the synthesized hop directly
+                        snk_backend_process_encode(obj, obj->hopsIn);
+                        snk_backend_process_write(obj);
+
+                    break;
+
+                    case 'b':
+
+                        hop2hop_buffer_push(obj->hop2hop_buffer, obj->hopsIn);
+
+                        while (hop2hop_buffer_isEmpty(obj->hop2hop_buffer) == 0) {
+
+                            hop2hop_buffer_pop(obj->hop2hop_buffer, obj->hopsOut);
+                            snk_backend_process_encode(obj, obj->hopsOut);
+                            snk_backend_process_write(obj);
+
+                        }
+
+                    break;
+
+                    case 'p':
+
+                        hop2hop_polyphase_push(obj->hop2hop_polyphase, obj->hopsIn);
+
+                        while (hop2hop_polyphase_isEmpty(obj->hop2hop_polyphase) == 0) {
+
+                            hop2hop_polyphase_pop(obj->hop2hop_polyphase, obj->hopsOut);
+                            snk_backend_process_encode(obj, obj->hopsOut);
+                            snk_backend_process_write(obj);
+
+                        }
+
+                    break;
+
+                }
+
+            }
+
+            rtnValue = 0;
+
+        }
+        else {
+
+            rtnValue = -1;
+
+        }
+
+        return rtnValue;
+
+    }
+
+    void snk_backend_process_encode(snk_backend_obj * obj, const hops_obj * hops) {
+
+        // The hops sink sized its buffer with lossless_bound, and cuts udp fragments anywhere in a frame
+        if (obj->snk_hops->lossless != NULL) {
+
+            pcm_normalized2signedXXbits_planar(hops->array, obj->gain, obj->nBytes, obj->nChannels, obj->hopSizeOut, obj->snk_hops->lossless->samples);
+
+            obj->snk_hops->bufferSize = lossless_encode(obj->snk_hops->lossless, obj->snk_hops->buffer);
+
+            return;
+
+        }
+
+        // Gain and packing are done in the same pass over the hop
+        pcm_normalized2signedXXbits_interleaved(hops->array, obj->gain, obj->nBytes, obj->nChannels, obj->hopSizeOut, obj->snk_hops->buffer);
+
+        obj->snk_hops->bufferSize = obj->hopSizeOut * obj->nChannels * obj->nBytes;
+
+    }
+
+    void snk_backend_process_write(snk_backend_obj * obj) {
+
+        switch(obj->snk_hops->interface->type) {
+
+            case interface_blackhole:
+
+                snk_hops_process_interface_blackhole(obj->snk_hops);
+
+            break;
+
+            case interface_file:
+
+                snk_hops_process_interface_file(obj->snk_hops);
+
+            break;
+
+            case interface_socket:
+
+                snk_hops_process_interface_socket(obj->snk_hops);
+
+            break;
+
+            case interface_udp:
+
+                obj->snk_hops->timeStamp = obj->timeStamp;
+                snk_hops_process_interface_udp(obj->snk_hops);
+
+            break;
+
+            case interface_shm:
+
+                obj->snk_hops->timeStamp = obj->timeStamp;
+                snk_hops_process_interface_shm(obj->snk_hops);
+
+            break;
+
+            case interface_wav:
+
+                snk_hops_process_interface_wav(obj->snk_hops);
+
+            break;
+
+            default:
+
+                printf("Sink backend: Invalid interface type.\n");
+                exit(EXIT_FAILURE);
+
+            break;
+
+        }
+
+    }
+
+    snk_backend_cfg * snk_backend_cfg_construct(void) {
+
+        snk_backend_cfg * cfg;
+
+        cfg = (snk_backend_cfg *) malloc(sizeof(snk_backend_cfg));
+
+        cfg->fS = 0;
+        cfg->format = (format_obj *) NULL;
+        cfg->interface = (interface_obj *) NULL;
+        cfg->gain = 1.0f;
+        cfg->nTaps = 0;
+
+        return cfg;
+
+    }
+
+    void snk_backend_cfg_destroy(snk_backend_cfg * snk_backend_config) {
+
+        if (snk_backend_config->format != NULL) {
+            format_destroy(snk_backend_config->format);
+        }
+        if (snk_backend_config->interface != NULL) {
+            interface_destroy(snk_backend_config->interface);
+        }
+
+        free((void *) snk_backend_config);
+
+    }
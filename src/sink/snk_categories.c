@@ -26,6 +26,7 @@
     snk_categories_obj * snk_categories_construct(const snk_categories_cfg * snk_categories_config, const msg_categories_cfg * msg_categories_config) {
 
         snk_categories_obj * obj;
+        unsigned int one;
 
         obj = (snk_categories_obj *) malloc(sizeof(snk_categories_obj));
 
@@ -40,6 +41,12 @@
         if (!(((obj->interface->type == interface_blackhole)  && (obj->format->type == format_undefined)) ||
               ((obj->interface->type == interface_file)  && (obj->format->type == format_text_json)) ||
               ((obj->interface->type == interface_socket) && (obj->format->type == format_text_json)) ||
+              ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_wire)) ||
+              ((obj->interface->type == interface_socket)  && (obj->format->type == format_binary_wire)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_text_json)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_binary_wire)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_text_json)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_binary_wire)) ||
               ((obj->interface->type == interface_terminal) && (obj->format->type == format_text_json)))) {
             
             printf("Sink categories: Invalid interface and/or format.\n");
@@ -47,8 +54,24 @@
 
         }
 
-        obj->buffer = (char *) malloc(sizeof(char) * 1024);
-        memset(obj->buffer, 0x00, sizeof(char) * 1024);
+        // The wire format is little-endian, and records are written with the host byte order
+        if (obj->format->type == format_binary_wire) {
+
+            one = 1;
+
+            if (*((unsigned char *) &one) != 1) {
+                printf("Sink categories: The wire format requires a little-endian host.\n");
+                exit(EXIT_FAILURE);
+            }
+
+        }
+
+        // Longest JSON message: 64 bytes around the list, and 40 bytes per channel
+        // (the wire format needs less)
+        obj->bufferCapacity = 64 + 40 * obj->nChannels;
+
+        obj->buffer = (char *) malloc(sizeof(char) * obj->bufferCapacity);
+        memset(obj->buffer, 0x00, sizeof(char) * obj->bufferCapacity);
         obj->bufferSize = 0;
 
         obj->in = (msg_categories_obj *) NULL;
@@ -102,6 +125,18 @@
 
             break;
 
+            case interface_udp:
+
+                snk_categories_open_interface_udp(obj);
+
+            break;
+
+            case interface_shm:
+
+                snk_categories_open_interface_shm(obj);
+
+            break;
+
             case interface_terminal:
 
                 snk_categories_open_interface_terminal(obj);
@@ -138,19 +173,19 @@
 
     void snk_categories_open_interface_socket(snk_categories_obj * obj) {
 
-        memset(&(obj->sserver), 0x00, sizeof(struct sockaddr_in));
+        obj->sender = sender_construct("Sink categories", obj->interface);
 
-        obj->sserver.sin_family = AF_INET;
-        obj->sserver.sin_addr.s_addr = inet_addr(obj->interface->ip);
-        obj->sserver.sin_port = htons(obj->interface->port);
-        obj->sid = socket(AF_INET, SOCK_STREAM, 0);
+    }
 
-        if ( (connect(obj->sid, (struct sockaddr *) &(obj->sserver), sizeof(obj->sserver))) < 0 ) {
+    void snk_categories_open_interface_udp(snk_categories_obj * obj) {
 
-            printf("Sink categories: Cannot connect to server\n");
-            exit(EXIT_FAILURE);
+        obj->datagram = datagram_construct("Sink categories", obj->interface);
+
+    }
 
-        }          
+    void snk_categories_open_interface_shm(snk_categories_obj * obj) {
+
+        obj->shm = shm_writer_construct(obj->interface->fileName, obj->interface->queueSize);
 
     }
 
@@ -182,6 +217,18 @@
 
             break;
 
+            case interface_udp:
+
+                snk_categories_close_interface_udp(obj);
+
+            break;
+
+            case interface_shm:
+
+                snk_categories_close_interface_shm(obj);
+
+            break;
+
             case interface_terminal:
 
                 snk_categories_close_interface_terminal(obj);
@@ -213,7 +260,19 @@
 
     void snk_categories_close_interface_socket(snk_categories_obj * obj) {
 
-        close(obj->sid);
+        sender_destroy(obj->sender);
+
+    }
+
+    void snk_categories_close_interface_udp(snk_categories_obj * obj) {
+
+        datagram_destroy(obj->datagram);
+
+    }
+
+    void snk_categories_close_interface_shm(snk_categories_obj * obj) {
+
+        shm_writer_destroy(obj->shm);
 
     }
 
@@ -237,6 +296,12 @@
 
                 break;
 
+                case format_binary_wire:
+
+                    snk_categories_process_format_binary_wire(obj);
+
+                break;
+
                 case format_undefined:                
 
                     snk_categories_process_format_undefined(obj);
@@ -272,6 +337,18 @@
 
                 break;
 
+                case interface_udp:
+
+                    snk_categories_process_interface_udp(obj);
+
+                break;
+
+                case interface_shm:
+
+                    snk_categories_process_interface_shm(obj);
+
+                break;
+
                 case interface_terminal:
 
                     snk_categories_process_interface_terminal(obj);
@@ -314,10 +391,19 @@
 
     void snk_categories_process_interface_socket(snk_categories_obj * obj) {
 
-        if (send(obj->sid, obj->buffer, obj->bufferSize, 0) < 0) {
-            printf("Sink categories: Could not send message.\n");
-            exit(EXIT_FAILURE);
-        }
+        sender_push(obj->sender, obj->buffer, obj->bufferSize);
+
+    }
+
+    void snk_categories_process_interface_udp(snk_categories_obj * obj) {
+
+        datagram_send(obj->datagram, obj->in->timeStamp, obj->buffer, obj->bufferSize, 1);
+
+    }
+
+    void snk_categories_process_interface_shm(snk_categories_obj * obj) {
+
+        shm_writer_publish(obj->shm, obj->in->timeStamp, obj->buffer, obj->bufferSize);
 
     }
 
@@ -330,12 +416,15 @@
     void snk_categories_process_format_text_json(snk_categories_obj * obj) {
 
         unsigned int iChannel;
+        char * cursor;
 
-        obj->buffer[0] = 0x00;
+        cursor = obj->buffer;
 
-        sprintf(obj->buffer,"%s{\n",obj->buffer);
-        sprintf(obj->buffer,"%s    \"timeStamp\": %llu,\n",obj->buffer,obj->in->timeStamp);
-        sprintf(obj->buffer,"%s    \"src\": [\n",obj->buffer);
+        cursor = json_text(cursor, "{\n");
+        cursor = json_text(cursor, "    \"timeStamp\": ");
+        cursor = json_uint64(cursor, obj->in->timeStamp);
+        cursor = json_text(cursor, ",\n");
+        cursor = json_text(cursor, "    \"src\": [\n");
 
         for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
 
@@ -343,19 +432,19 @@
 
                 case 0x01:
 
-                    sprintf(obj->buffer,"%s        { \"category\": \"speech\" }",obj->buffer);
+                    cursor = json_text(cursor, "        { \"category\": \"speech\" }");
 
                 break;
 
                 case 0x00:
 
-                    sprintf(obj->buffer,"%s        { \"category\": \"nonspeech\" }",obj->buffer);
+                    cursor = json_text(cursor, "        { \"category\": \"nonspeech\" }");
 
                 break;
 
                 default:
 
-                    sprintf(obj->buffer,"%s        { \"category\": \"undefined\" }",obj->buffer);
+                    cursor = json_text(cursor, "        { \"category\": \"undefined\" }");
 
                 break;
 
@@ -363,18 +452,53 @@
 
             if (iChannel != (obj->nChannels - 1)) {
 
-                sprintf(obj->buffer,"%s,",obj->buffer);
+                cursor = json_text(cursor, ",");
 
             }
 
-            sprintf(obj->buffer,"%s\n",obj->buffer);
+            cursor = json_text(cursor, "\n");
 
         }
         
-        sprintf(obj->buffer,"%s    ]\n",obj->buffer);
-        sprintf(obj->buffer,"%s}\n",obj->buffer);
+        cursor = json_text(cursor, "    ]\n");
+        cursor = json_text(cursor, "}\n");
+
+        obj->bufferSize = cursor - obj->buffer;
+
+    }
+
+    void snk_categories_process_format_binary_wire(snk_categories_obj * obj) {
+
+        unsigned int iChannel;
+        wire_header * header;
+        wire_category * categories;
+
+        header = (wire_header *) obj->buffer;
+        categories = (wire_category *) &(obj->buffer[sizeof(wire_header)]);
+
+        header->magic = wire_magic;
+        header->version = wire_version;
+        header->type = wire_type_categories;
+        header->timeStamp = obj->in->timeStamp;
+        header->count = obj->nChannels;
+        header->recordSize = sizeof(wire_category);
+
+        // Same values as the JSON output: 1 for speech, 0 for nonspeech, anything else undefined
+        for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+
+            switch(obj->in->categories->array[iChannel]) {
+
+                case 0x01: categories[iChannel].category = 1; break;
+                case 0x00: categories[iChannel].category = 0; break;
+                default: categories[iChannel].category = -1; break;
+
+            }
+
+            memset(categories[iChannel].reserved, 0x00, sizeof(categories[iChannel].reserved));
+
+        }
 
-        obj->bufferSize = strlen(obj->buffer);
+        obj->bufferSize = sizeof(wire_header) + sizeof(wire_category) * obj->nChannels;
 
     }
 
@@ -26,6 +26,7 @@
     snk_hops_obj * snk_hops_construct(const snk_hops_cfg * snk_hops_config, const msg_hops_cfg * msg_hops_config) {
 
         snk_hops_obj * obj;
+        unsigned int hopBytes;
 
         obj = (snk_hops_obj *) malloc(sizeof(snk_hops_obj));
 
@@ -38,25 +39,91 @@
         obj->format = format_clone(snk_hops_config->format);
         obj->interface = interface_clone(snk_hops_config->interface);
 
-        memset(obj->bytes, 0x00, 4 * sizeof(char));
-
         if (!(((obj->interface->type == interface_blackhole)  && (obj->format->type == format_undefined)) ||
               ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_int08)) ||
               ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_int16)) ||
               ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_int24)) ||
               ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_int32)) ||
+              ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_float)) ||
+              ((obj->interface->type == interface_file)  && (obj->format->type == format_lossless_int16)) ||
+              ((obj->interface->type == interface_file)  && (obj->format->type == format_lossless_int24)) ||
               ((obj->interface->type == interface_socket)  && (obj->format->type == format_binary_int08)) ||
               ((obj->interface->type == interface_socket)  && (obj->format->type == format_binary_int16)) ||
               ((obj->interface->type == interface_socket)  && (obj->format->type == format_binary_int24)) ||
-              ((obj->interface->type == interface_socket)  && (obj->format->type == format_binary_int32)))) {
+              ((obj->interface->type == interface_socket)  && (obj->format->type == format_binary_int32)) ||
+              ((obj->interface->type == interface_socket)  && (obj->format->type == format_binary_float)) ||
+              ((obj->interface->type == interface_socket)  && (obj->format->type == format_lossless_int16)) ||
+              ((obj->interface->type == interface_socket)  && (obj->format->type == format_lossless_int24)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_binary_int08)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_binary_int16)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_binary_int24)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_binary_int32)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_binary_float)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_lossless_int16)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_lossless_int24)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_binary_int08)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_binary_int16)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_binary_int24)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_binary_int32)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_binary_float)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_lossless_int16)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_lossless_int24)) ||
+              ((obj->interface->type == interface_wav)  && (obj->format->type == format_binary_int16)) ||
+              ((obj->interface->type == interface_wav)  && (obj->format->type == format_binary_int24)) ||
+              ((obj->interface->type == interface_wav)  && (obj->format->type == format_binary_int32)) ||
+              ((obj->interface->type == interface_wav)  && (obj->format->type == format_binary_float)))) {
             
             printf("Sink hops: Invalid interface and/or format.\n");
             exit(EXIT_FAILURE);
 
         }
 
-        obj->buffer = (char *) malloc(sizeof(char) * msg_hops_config->nChannels * msg_hops_config->hopSize * 4);
-        memset(obj->buffer, 0x00, sizeof(char) * msg_hops_config->nChannels * msg_hops_config->hopSize * 4);
+        if (obj->interface->batch == 0) {
+            printf("Sink hops: Invalid batch size.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        // Each hop is compressed on its own, so a frame never waits for the next hop
+        switch(obj->format->type) {
+
+            case format_lossless_int16:
+
+                obj->lossless = lossless_construct(obj->nChannels, obj->hopSize, 16);
+
+            break;
+
+            case format_lossless_int24:
+
+                obj->lossless = lossless_construct(obj->nChannels, obj->hopSize, 24);
+
+            break;
+
+            default:
+
+                obj->lossless = (lossless_obj *) NULL;
+
+            break;
+
+        }
+
+        hopBytes = msg_hops_config->nChannels * msg_hops_config->hopSize * 4;
+
+        if ((obj->lossless != NULL) && (lossless_bound(obj->lossless) > hopBytes)) {
+            hopBytes = lossless_bound(obj->lossless);
+        }
+
+        // Hops are encoded one after the other in the batch, and written out together
+        obj->nHopsBatch = obj->interface->batch;
+        obj->iHopBatch = 0;
+        obj->batch = (char *) malloc(sizeof(char) * obj->nHopsBatch * hopBytes);
+        memset(obj->batch, 0x00, sizeof(char) * obj->nHopsBatch * hopBytes);
+        obj->batchSize = 0;
+        obj->batchTimeStamp = 0;
+        obj->batchStart = 0;
+        obj->batchLatency = ((unsigned long long) obj->interface->latency) * 1000000ull;
+        obj->hopDuration = (msg_hops_config->fS != 0) ? ((((unsigned long long) obj->hopSize) * 1000000000ull) / ((unsigned long long) msg_hops_config->fS)) : 0;
+
+        obj->buffer = obj->batch;
         obj->bufferSize = 0;
 
         obj->in = (msg_hops_obj *) NULL;
@@ -69,7 +136,11 @@
 
         format_destroy(obj->format);
         interface_destroy(obj->interface);
-        free((void *) obj->buffer);
+        free((void *) obj->batch);
+
+        if (obj->lossless != NULL) {
+            lossless_destroy(obj->lossless);
+        }
 
         free((void *) obj);
 
@@ -109,6 +180,24 @@
 
             break;
 
+            case interface_udp:
+
+                snk_hops_open_interface_udp(obj);
+
+            break;
+
+            case interface_shm:
+
+                snk_hops_open_interface_shm(obj);
+
+            break;
+
+            case interface_wav:
+
+                snk_hops_open_interface_wav(obj);
+
+            break;
+
             default:
 
                 printf("Sink hops: Invalid interface type.\n");
@@ -135,28 +224,77 @@
             exit(EXIT_FAILURE);
         }
 
+        // Batches are already large: one write per batch, with no copy through the stdio buffer
+        if (obj->nHopsBatch > 1) {
+            setvbuf(obj->fp, NULL, _IONBF, 0);
+        }
+
     }
 
     void snk_hops_open_interface_socket(snk_hops_obj * obj) {
 
-        memset(&(obj->sserver), 0x00, sizeof(struct sockaddr_in));
+        obj->sender = sender_construct("Sink hops", obj->interface);
 
-        obj->sserver.sin_family = AF_INET;
-        obj->sserver.sin_addr.s_addr = inet_addr(obj->interface->ip);
-        obj->sserver.sin_port = htons(obj->interface->port);
-        obj->sid = socket(AF_INET, SOCK_STREAM, 0);
+    }
 
-        if ( (connect(obj->sid, (struct sockaddr *) &(obj->sserver), sizeof(obj->sserver))) < 0 ) {
+    void snk_hops_open_interface_udp(snk_hops_obj * obj) {
 
-            printf("Sink hops: Cannot connect to server\n");
-            exit(EXIT_FAILURE);
+        obj->datagram = datagram_construct("Sink hops", obj->interface);
+
+    }
+
+    void snk_hops_open_interface_shm(snk_hops_obj * obj) {
 
-        }          
+        obj->shm = shm_writer_construct(obj->interface->fileName, obj->interface->queueSize);
+
+    }
+
+    void snk_hops_open_interface_wav(snk_hops_obj * obj) {
+
+        switch(obj->format->type) {
+
+            case format_binary_int16:
+
+                obj->recorder = recorder_construct("Sink hops", obj->interface, obj->fS, obj->nChannels, 16, 0);
+
+            break;
+
+            case format_binary_int24:
+
+                obj->recorder = recorder_construct("Sink hops", obj->interface, obj->fS, obj->nChannels, 24, 0);
+
+            break;
+
+            case format_binary_int32:
+
+                obj->recorder = recorder_construct("Sink hops", obj->interface, obj->fS, obj->nChannels, 32, 0);
+
+            break;
+
+            case format_binary_float:
+
+                obj->recorder = recorder_construct("Sink hops", obj->interface, obj->fS, obj->nChannels, 32, 1);
+
+            break;
+
+            default:
+
+                printf("Sink hops: Invalid format type.\n");
+                exit(EXIT_FAILURE);
+
+            break;
+
+        }
 
     }
 
     void snk_hops_close(snk_hops_obj * obj) {
 
+        // Hops waiting in a partial batch
+        if (obj->iHopBatch > 0) {
+            snk_hops_flush(obj);
+        }
+
         switch(obj->interface->type) {
 
             case interface_blackhole:
@@ -177,6 +315,24 @@
 
             break;
 
+            case interface_udp:
+
+                snk_hops_close_interface_udp(obj);
+
+            break;
+
+            case interface_shm:
+
+                snk_hops_close_interface_shm(obj);
+
+            break;
+
+            case interface_wav:
+
+                snk_hops_close_interface_wav(obj);
+
+            break;
+
             default:
 
                 printf("Sink hops: Invalid interface type.\n");
@@ -202,7 +358,25 @@
 
     void snk_hops_close_interface_socket(snk_hops_obj * obj) {
 
-        close(obj->sid);
+        sender_destroy(obj->sender);
+
+    }
+
+    void snk_hops_close_interface_udp(snk_hops_obj * obj) {
+
+        datagram_destroy(obj->datagram);
+
+    }
+
+    void snk_hops_close_interface_shm(snk_hops_obj * obj) {
+
+        shm_writer_destroy(obj->shm);
+
+    }
+
+    void snk_hops_close_interface_wav(snk_hops_obj * obj) {
+
+        recorder_destroy(obj->recorder);
 
     }
 
@@ -212,6 +386,8 @@
 
         if (obj->in->timeStamp != 0) {
 
+            obj->timeStamp = obj->in->timeStamp;
+
             switch(obj->format->type) {
 
                 case format_binary_int08:
@@ -238,6 +414,24 @@
 
                 break;
 
+                case format_binary_float:
+
+                    snk_hops_process_format_binary_float(obj);
+
+                break;
+
+                case format_lossless_int16:
+
+                    snk_hops_process_format_lossless_int16(obj);
+
+                break;
+
+                case format_lossless_int24:
+
+                    snk_hops_process_format_lossless_int24(obj);
+
+                break;
+
                 case format_undefined:
 
                     snk_hops_process_format_undefined(obj);
@@ -273,6 +467,24 @@
 
                 break;
 
+                case interface_udp:
+
+                    snk_hops_process_interface_udp(obj);
+
+                break;
+
+                case interface_shm:
+
+                    snk_hops_process_interface_shm(obj);
+
+                break;
+
+                case interface_wav:
+
+                    snk_hops_process_interface_wav(obj);
+
+                break;
+
                 default:
 
                     printf("Sink hops: Invalid interface type.\n");
@@ -303,133 +515,243 @@
 
     void snk_hops_process_interface_file(snk_hops_obj * obj) {
 
-        fwrite(obj->buffer, sizeof(char), obj->bufferSize, obj->fp);
+        if (snk_hops_process_batch(obj) == 1) {
+            snk_hops_flush_interface_file(obj);
+        }
 
     }
 
     void snk_hops_process_interface_socket(snk_hops_obj * obj) {
 
-        if (send(obj->sid, obj->buffer, obj->bufferSize, 0) < 0) {
-            printf("Sink hops: Could not send message.\n");
-            exit(EXIT_FAILURE);
+        if (snk_hops_process_batch(obj) == 1) {
+            snk_hops_flush_interface_socket(obj);
         }
 
     }
 
-    void snk_hops_process_format_binary_int08(snk_hops_obj * obj) {
+    void snk_hops_process_interface_udp(snk_hops_obj * obj) {
+
+        if (snk_hops_process_batch(obj) == 1) {
+            snk_hops_flush_interface_udp(obj);
+        }
+
+    }
+
+    void snk_hops_process_interface_shm(snk_hops_obj * obj) {
+
+        if (snk_hops_process_batch(obj) == 1) {
+            snk_hops_flush_interface_shm(obj);
+        }
 
-        unsigned int iChannel;
-        unsigned int iSample;
-        float sample;
-        unsigned int nBytes;
-        unsigned int nBytesTotal;
+    }
 
-        nBytes = 1;
-        nBytesTotal = 0;
+    void snk_hops_process_interface_wav(snk_hops_obj * obj) {
 
-        for (iSample = 0; iSample < obj->hopSize; iSample++) {
+        if (snk_hops_process_batch(obj) == 1) {
+            snk_hops_flush_interface_wav(obj);
+        }
 
-            for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+    }
 
-                sample = obj->in->hops->array[iChannel][iSample];
-                pcm_normalized2signedXXbits(sample, nBytes, obj->bytes);
-                memcpy(&(obj->buffer[nBytesTotal]), &(obj->bytes[4-nBytes]), sizeof(char) * nBytes);
+    char snk_hops_process_batch(snk_hops_obj * obj) {
 
-                nBytesTotal += nBytes;
+        struct timespec now;
+        unsigned long long elapsed;
+        char rtnValue;
 
+        if (obj->iHopBatch == 0) {
+
+            obj->batchTimeStamp = obj->timeStamp;
+
+            if (obj->batchLatency != 0) {
+                clock_gettime(CLOCK_MONOTONIC, &now);
+                obj->batchStart = ((unsigned long long) now.tv_sec) * 1000000000ull + ((unsigned long long) now.tv_nsec);
             }
 
         }
 
-        obj->bufferSize = nBytesTotal;
+        obj->batchSize += obj->bufferSize;
+        obj->iHopBatch++;
+
+        rtnValue = 0;
+
+        if (obj->iHopBatch == obj->nHopsBatch) {
+
+            rtnValue = 1;
+
+        }
+        else if (obj->batchLatency != 0) {
+
+            // Write now if waiting for the next hop would break the latency bound
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            elapsed = ((unsigned long long) now.tv_sec) * 1000000000ull + ((unsigned long long) now.tv_nsec) - obj->batchStart;
+
+            if ((elapsed + obj->hopDuration) > obj->batchLatency) {
+                rtnValue = 1;
+            }
+
+        }
+
+        // The next hop is encoded right after this one
+        obj->buffer = &(obj->batch[obj->batchSize]);
+
+        return rtnValue;
 
     }
 
-    void snk_hops_process_format_binary_int16(snk_hops_obj * obj) {
+    void snk_hops_flush(snk_hops_obj * obj) {
 
-        unsigned int iChannel;
-        unsigned int iSample;
-        float sample;
-        unsigned int nBytes;
-        unsigned int nBytesTotal;
+        switch(obj->interface->type) {
 
-        nBytes = 2;
-        nBytesTotal = 0;
+            case interface_file:
 
-        for (iSample = 0; iSample < obj->hopSize; iSample++) {
+                snk_hops_flush_interface_file(obj);
 
-            for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+            break;
 
-                sample = obj->in->hops->array[iChannel][iSample];
-                pcm_normalized2signedXXbits(sample, nBytes, obj->bytes);
-                memcpy(&(obj->buffer[nBytesTotal]), &(obj->bytes[4-nBytes]), sizeof(char) * nBytes);
+            case interface_socket:
 
-                nBytesTotal += nBytes;
+                snk_hops_flush_interface_socket(obj);
 
+            break;
 
-            }
+            case interface_udp:
 
-        }
+                snk_hops_flush_interface_udp(obj);
+
+            break;
+
+            case interface_shm:
+
+                snk_hops_flush_interface_shm(obj);
+
+            break;
+
+            case interface_wav:
 
-        obj->bufferSize = nBytesTotal;
+                snk_hops_flush_interface_wav(obj);
+
+            break;
+
+            default:
+
+                // Nothing is batched
+
+            break;
+
+        }
 
     }
 
-    void snk_hops_process_format_binary_int24(snk_hops_obj * obj) {
+    void snk_hops_flush_interface_file(snk_hops_obj * obj) {
 
-        unsigned int iChannel;
-        unsigned int iSample;
-        float sample;
-        unsigned int nBytes;
-        unsigned int nBytesTotal;
+        fwrite(obj->batch, sizeof(char), obj->batchSize, obj->fp);
 
-        nBytes = 3;
-        nBytesTotal = 0;
+        obj->batchSize = 0;
+        obj->iHopBatch = 0;
+        obj->buffer = obj->batch;
 
-        for (iSample = 0; iSample < obj->hopSize; iSample++) {
+    }
 
-            for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+    void snk_hops_flush_interface_socket(snk_hops_obj * obj) {
 
-                sample = obj->in->hops->array[iChannel][iSample];
-                pcm_normalized2signedXXbits(sample, nBytes, obj->bytes);
-                memcpy(&(obj->buffer[nBytesTotal]), &(obj->bytes[4-nBytes]), sizeof(char) * nBytes);
+        sender_push(obj->sender, obj->batch, obj->batchSize);
 
-                nBytesTotal += nBytes;
+        obj->batchSize = 0;
+        obj->iHopBatch = 0;
+        obj->buffer = obj->batch;
 
-            }
+    }
+
+    void snk_hops_flush_interface_udp(snk_hops_obj * obj) {
 
+        // Fragments hold whole samples for all channels (compressed frames have no such boundary)
+        if (obj->lossless != NULL) {
+            datagram_send(obj->datagram, obj->batchTimeStamp, obj->batch, obj->batchSize, 1);
         }
+        else {
+            datagram_send(obj->datagram, obj->batchTimeStamp, obj->batch, obj->batchSize, obj->bufferSize / obj->hopSize);
+        }
+
+        obj->batchSize = 0;
+        obj->iHopBatch = 0;
+        obj->buffer = obj->batch;
+
+    }
+
+    void snk_hops_flush_interface_shm(snk_hops_obj * obj) {
+
+        shm_writer_publish(obj->shm, obj->batchTimeStamp, obj->batch, obj->batchSize);
 
-        obj->bufferSize = nBytesTotal;
+        obj->batchSize = 0;
+        obj->iHopBatch = 0;
+        obj->buffer = obj->batch;
 
-    }    
+    }
+
+    void snk_hops_flush_interface_wav(snk_hops_obj * obj) {
+
+        recorder_push(obj->recorder, obj->batch, obj->batchSize);
+
+        obj->batchSize = 0;
+        obj->iHopBatch = 0;
+        obj->buffer = obj->batch;
+
+    }
+
+    void snk_hops_process_format_binary_int08(snk_hops_obj * obj) {
+
+        pcm_normalized2signedXXbits_interleaved(obj->in->hops->array, 1.0f, 1, obj->nChannels, obj->hopSize, obj->buffer);
+
+        obj->bufferSize = obj->hopSize * obj->nChannels * 1;
+
+    }
+
+    void snk_hops_process_format_binary_int16(snk_hops_obj * obj) {
+
+        pcm_normalized2signedXXbits_interleaved(obj->in->hops->array, 1.0f, 2, obj->nChannels, obj->hopSize, obj->buffer);
+
+        obj->bufferSize = obj->hopSize * obj->nChannels * 2;
+
+    }
+
+    void snk_hops_process_format_binary_int24(snk_hops_obj * obj) {
+
+        pcm_normalized2signedXXbits_interleaved(obj->in->hops->array, 1.0f, 3, obj->nChannels, obj->hopSize, obj->buffer);
+
+        obj->bufferSize = obj->hopSize * obj->nChannels * 3;
+
+    }
 
     void snk_hops_process_format_binary_int32(snk_hops_obj * obj) {
 
-        unsigned int iChannel;
-        unsigned int iSample;
-        float sample;
-        unsigned int nBytes;
-        unsigned int nBytesTotal;
+        pcm_normalized2signedXXbits_interleaved(obj->in->hops->array, 1.0f, 4, obj->nChannels, obj->hopSize, obj->buffer);
 
-        nBytes = 4;
-        nBytesTotal = 0;
+        obj->bufferSize = obj->hopSize * obj->nChannels * 4;
 
-        for (iSample = 0; iSample < obj->hopSize; iSample++) {
+    }
 
-            for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+    void snk_hops_process_format_binary_float(snk_hops_obj * obj) {
 
-                sample = obj->in->hops->array[iChannel][iSample];
-                pcm_normalized2signedXXbits(sample, nBytes, obj->bytes);
-                memcpy(&(obj->buffer[nBytesTotal]), &(obj->bytes[4-nBytes]), sizeof(char) * nBytes);
+        pcm_normalized2float_interleaved(obj->in->hops->array, 1.0f, obj->nChannels, obj->hopSize, obj->buffer);
 
-                nBytesTotal += nBytes;
+        obj->bufferSize = obj->hopSize * obj->nChannels * 4;
 
-            }
+    }
 
-        }
+    void snk_hops_process_format_lossless_int16(snk_hops_obj * obj) {
+
+        pcm_normalized2signedXXbits_planar(obj->in->hops->array, 1.0f, 2, obj->nChannels, obj->hopSize, obj->lossless->samples);
+
+        obj->bufferSize = lossless_encode(obj->lossless, obj->buffer);
+
+    }
+
+    void snk_hops_process_format_lossless_int24(snk_hops_obj * obj) {
+
+        pcm_normalized2signedXXbits_planar(obj->in->hops->array, 1.0f, 3, obj->nChannels, obj->hopSize, obj->lossless->samples);
 
-        obj->bufferSize = nBytesTotal;
+        obj->bufferSize = lossless_encode(obj->lossless, obj->buffer);
 
     }
 
@@ -26,6 +26,7 @@
     snk_pots_obj * snk_pots_construct(const snk_pots_cfg * snk_pots_config, const msg_pots_cfg * msg_pots_config) {
 
         snk_pots_obj * obj;
+        unsigned int one;
 
         obj = (snk_pots_obj *) malloc(sizeof(snk_pots_obj));
 
@@ -41,6 +42,12 @@
               ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_float)) ||
               ((obj->interface->type == interface_file)  && (obj->format->type == format_text_json)) ||
               ((obj->interface->type == interface_socket)  && (obj->format->type == format_text_json)) ||
+              ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_wire)) ||
+              ((obj->interface->type == interface_socket)  && (obj->format->type == format_binary_wire)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_text_json)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_binary_wire)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_text_json)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_binary_wire)) ||
               ((obj->interface->type == interface_terminal) && (obj->format->type == format_text_json)))) {
             
             printf("Sink pots: Invalid interface and/or format.\n");
@@ -48,10 +55,27 @@
 
         }
 
+        // The wire format is little-endian, and records are written with the host byte order
+        if (obj->format->type == format_binary_wire) {
+
+            one = 1;
+
+            if (*((unsigned char *) &one) != 1) {
+                printf("Sink pots: The wire format requires a little-endian host.\n");
+                exit(EXIT_FAILURE);
+            }
+
+        }
+
         obj->fp = (FILE *) NULL;
 
-        obj->buffer = (char *) malloc(sizeof(char) * 1024);
-        memset(obj->buffer, 0x00, sizeof(char) * 1024);
+        // Longest JSON message: 64 bytes around the list, and 232 bytes per pot
+        // (40 characters of text and 4 floats of at most 48 characters each)
+        // (the binary formats need less)
+        obj->bufferCapacity = 64 + 232 * obj->nPots;
+
+        obj->buffer = (char *) malloc(sizeof(char) * obj->bufferCapacity);
+        memset(obj->buffer, 0x00, sizeof(char) * obj->bufferCapacity);
         obj->bufferSize = 0;
 
         obj->in = (msg_pots_obj *) NULL;
@@ -105,6 +129,18 @@
 
             break;
 
+            case interface_udp:
+
+                snk_pots_open_interface_udp(obj);
+
+            break;
+
+            case interface_shm:
+
+                snk_pots_open_interface_shm(obj);
+
+            break;
+
             case interface_terminal:
 
                 snk_pots_open_interface_terminal(obj);
@@ -141,19 +177,19 @@
 
     void snk_pots_open_interface_socket(snk_pots_obj * obj) {
 
-        memset(&(obj->sserver), 0x00, sizeof(struct sockaddr_in));
+        obj->sender = sender_construct("Sink pots", obj->interface);
 
-        obj->sserver.sin_family = AF_INET;
-        obj->sserver.sin_addr.s_addr = inet_addr(obj->interface->ip);
-        obj->sserver.sin_port = htons(obj->interface->port);
-        obj->sid = socket(AF_INET, SOCK_STREAM, 0);
+    }
 
-        if ( (connect(obj->sid, (struct sockaddr *) &(obj->sserver), sizeof(obj->sserver))) < 0 ) {
+    void snk_pots_open_interface_udp(snk_pots_obj * obj) {
 
-            printf("Sink pots: Cannot connect to server\n");
-            exit(EXIT_FAILURE);
+        obj->datagram = datagram_construct("Sink pots", obj->interface);
 
-        }  
+    }
+
+    void snk_pots_open_interface_shm(snk_pots_obj * obj) {
+
+        obj->shm = shm_writer_construct(obj->interface->fileName, obj->interface->queueSize);
 
     }
 
@@ -185,6 +221,18 @@
                 
             break;
 
+            case interface_udp:
+
+                snk_pots_close_interface_udp(obj);
+
+            break;
+
+            case interface_shm:
+
+                snk_pots_close_interface_shm(obj);
+
+            break;
+
             case interface_terminal:
 
                 snk_pots_close_interface_terminal(obj);
@@ -216,7 +264,19 @@
 
     void snk_pots_close_interface_socket(snk_pots_obj * obj) {
 
-        close(obj->sid);
+        sender_destroy(obj->sender);
+
+    }
+
+    void snk_pots_close_interface_udp(snk_pots_obj * obj) {
+
+        datagram_destroy(obj->datagram);
+
+    }
+
+    void snk_pots_close_interface_shm(snk_pots_obj * obj) {
+
+        shm_writer_destroy(obj->shm);
 
     }
 
@@ -246,6 +306,12 @@
 
                 break;
 
+                case format_binary_wire:
+
+                    snk_pots_process_format_binary_wire(obj);
+
+                break;
+
                 case format_undefined:                
 
                     snk_pots_process_format_undefined(obj);
@@ -281,6 +347,18 @@
 
                 break;
 
+                case interface_udp:
+
+                    snk_pots_process_interface_udp(obj);
+
+                break;
+
+                case interface_shm:
+
+                    snk_pots_process_interface_shm(obj);
+
+                break;
+
                 case interface_terminal:
 
                     snk_pots_process_interface_terminal(obj);
@@ -323,10 +401,19 @@
 
     void snk_pots_process_interface_socket(snk_pots_obj * obj) {
 
-        if (send(obj->sid, obj->buffer, obj->bufferSize, 0) < 0) {
-            printf("Sink pots: Could not send message.\n");
-            exit(EXIT_FAILURE);
-        }        
+        sender_push(obj->sender, obj->buffer, obj->bufferSize);
+
+    }
+
+    void snk_pots_process_interface_udp(snk_pots_obj * obj) {
+
+        datagram_send(obj->datagram, obj->in->timeStamp, obj->buffer, obj->bufferSize, 1);
+
+    }
+
+    void snk_pots_process_interface_shm(snk_pots_obj * obj) {
+
+        shm_writer_publish(obj->shm, obj->in->timeStamp, obj->buffer, obj->bufferSize);
 
     }
 
@@ -346,32 +433,71 @@
     void snk_pots_process_format_text_json(snk_pots_obj * obj) {
 
         unsigned int iPot;
+        char * cursor;
 
-        obj->buffer[0] = 0x00;
+        cursor = obj->buffer;
 
-        sprintf(obj->buffer,"%s{\n",obj->buffer);
-        sprintf(obj->buffer,"%s    \"timeStamp\": %llu,\n",obj->buffer,obj->in->timeStamp);
-        sprintf(obj->buffer,"%s    \"src\": [\n",obj->buffer);
+        cursor = json_text(cursor, "{\n");
+        cursor = json_text(cursor, "    \"timeStamp\": ");
+        cursor = json_uint64(cursor, obj->in->timeStamp);
+        cursor = json_text(cursor, ",\n");
+        cursor = json_text(cursor, "    \"src\": [\n");
 
         for (iPot = 0; iPot < obj->nPots; iPot++) {
 
-            sprintf(obj->buffer,"%s        { \"x\": %1.3f, \"y\": %1.3f, \"z\": %1.3f, \"E\": %1.3f }", obj->buffer, 
-                    obj->in->pots->array[iPot*4+0], obj->in->pots->array[iPot*4+1], obj->in->pots->array[iPot*4+2], obj->in->pots->array[iPot*4+3]);
+            cursor = json_text(cursor, "        { \"x\": ");
+            cursor = json_float3(cursor, obj->in->pots->array[iPot*4+0]);
+            cursor = json_text(cursor, ", \"y\": ");
+            cursor = json_float3(cursor, obj->in->pots->array[iPot*4+1]);
+            cursor = json_text(cursor, ", \"z\": ");
+            cursor = json_float3(cursor, obj->in->pots->array[iPot*4+2]);
+            cursor = json_text(cursor, ", \"E\": ");
+            cursor = json_float3(cursor, obj->in->pots->array[iPot*4+3]);
+            cursor = json_text(cursor, " }");
 
             if (iPot != (obj->nPots - 1)) {
 
-                sprintf(obj->buffer,"%s,",obj->buffer);
+                cursor = json_text(cursor, ",");
 
             }
 
-            sprintf(obj->buffer,"%s\n",obj->buffer);
+            cursor = json_text(cursor, "\n");
 
         }
         
-        sprintf(obj->buffer,"%s    ]\n",obj->buffer);
-        sprintf(obj->buffer,"%s}\n",obj->buffer);        
+        cursor = json_text(cursor, "    ]\n");
+        cursor = json_text(cursor, "}\n");
+
+        obj->bufferSize = cursor - obj->buffer;
+
+    }
+
+    void snk_pots_process_format_binary_wire(snk_pots_obj * obj) {
+
+        unsigned int iPot;
+        wire_header * header;
+        wire_pot * pots;
+
+        header = (wire_header *) obj->buffer;
+        pots = (wire_pot *) &(obj->buffer[sizeof(wire_header)]);
+
+        header->magic = wire_magic;
+        header->version = wire_version;
+        header->type = wire_type_pots;
+        header->timeStamp = obj->in->timeStamp;
+        header->count = obj->nPots;
+        header->recordSize = sizeof(wire_pot);
+
+        for (iPot = 0; iPot < obj->nPots; iPot++) {
+
+            pots[iPot].x = obj->in->pots->array[iPot*4+0];
+            pots[iPot].y = obj->in->pots->array[iPot*4+1];
+            pots[iPot].z = obj->in->pots->array[iPot*4+2];
+            pots[iPot].E = obj->in->pots->array[iPot*4+3];
+
+        }
 
-        obj->bufferSize = strlen(obj->buffer);
+        obj->bufferSize = sizeof(wire_header) + sizeof(wire_pot) * obj->nPots;
 
     }
 
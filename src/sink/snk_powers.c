@@ -26,9 +26,12 @@
     snk_powers_obj * snk_powers_construct(const snk_powers_cfg * snk_powers_config, const msg_powers_cfg * msg_powers_config) {
 
         snk_powers_obj * obj;
+        unsigned int iChannel;
 
         obj = (snk_powers_obj *) malloc(sizeof(snk_powers_obj));
 
+        obj->timeStamp = 0;
+
         obj->halfFrameSize = msg_powers_config->halfFrameSize;
         obj->nChannels = msg_powers_config->nChannels;
         obj->fS = msg_powers_config->fS;
@@ -36,13 +39,62 @@
         obj->format = format_clone(snk_powers_config->format);
         obj->interface = interface_clone(snk_powers_config->interface);
 
-        if (!((obj->interface->type == interface_blackhole)  && (obj->format->type == format_undefined))) {
-            
+        if (!(((obj->interface->type == interface_blackhole)  && (obj->format->type == format_undefined)) ||
+              ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_float)) ||
+              ((obj->interface->type == interface_socket)  && (obj->format->type == format_binary_float)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_binary_float)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_binary_float)) ||
+              ((obj->interface->type == interface_mmap)  && (obj->format->type == format_binary_float)))) {
+
             printf("Sink powers: Invalid interface and/or format.\n");
             exit(EXIT_FAILURE);
 
         }
 
+        // Keep bins 0, binStep, 2*binStep, ... (a step of 0 or 1 keeps them all)
+        obj->binStep = snk_powers_config->binStep;
+
+        if (obj->binStep == 0) {
+            obj->binStep = 1;
+        }
+
+        obj->nBins = (obj->halfFrameSize + obj->binStep - 1) / obj->binStep;
+
+        // Keep the listed channels, in this order (no list keeps them all)
+        if (snk_powers_config->nChannels == 0) {
+
+            obj->nChannelsSelected = obj->nChannels;
+            obj->channels = (unsigned int *) malloc(sizeof(unsigned int) * obj->nChannelsSelected);
+
+            for (iChannel = 0; iChannel < obj->nChannelsSelected; iChannel++) {
+                obj->channels[iChannel] = iChannel;
+            }
+
+        }
+        else {
+
+            obj->nChannelsSelected = snk_powers_config->nChannels;
+            obj->channels = (unsigned int *) malloc(sizeof(unsigned int) * obj->nChannelsSelected);
+
+            for (iChannel = 0; iChannel < obj->nChannelsSelected; iChannel++) {
+
+                if (snk_powers_config->channels[iChannel] >= obj->nChannels) {
+                    printf("Sink powers: Invalid channel %u.\n", snk_powers_config->channels[iChannel]);
+                    exit(EXIT_FAILURE);
+                }
+
+                obj->channels[iChannel] = snk_powers_config->channels[iChannel];
+
+            }
+
+        }
+
+        obj->fp = (FILE *) NULL;
+
+        obj->buffer = (char *) malloc(sizeof(float) * 1 * obj->nBins * obj->nChannelsSelected);
+        memset(obj->buffer, 0x00, sizeof(float) * 1 * obj->nBins * obj->nChannelsSelected);
+        obj->bufferSize = 0;
+
         obj->in = (msg_powers_obj *) NULL;
 
         return obj;
@@ -51,6 +103,9 @@
 
     void snk_powers_destroy(snk_powers_obj * obj) {
 
+        free((void *) obj->buffer);
+        free((void *) obj->channels);
+
         format_destroy(obj->format);
         interface_destroy(obj->interface);
 
@@ -80,6 +135,36 @@
 
             break;
 
+            case interface_file:
+
+                snk_powers_open_interface_file(obj);
+
+            break;
+
+            case interface_socket:
+
+                snk_powers_open_interface_socket(obj);
+
+            break;
+
+            case interface_udp:
+
+                snk_powers_open_interface_udp(obj);
+
+            break;
+
+            case interface_shm:
+
+                snk_powers_open_interface_shm(obj);
+
+            break;
+
+            case interface_mmap:
+
+                snk_powers_open_interface_mmap(obj);
+
+            break;
+
             default:
 
                 printf("Sink powers: Invalid interface type.\n");
@@ -97,6 +182,55 @@
 
     }
 
+    void snk_powers_open_interface_file(snk_powers_obj * obj) {
+
+        obj->fp = fopen(obj->interface->fileName, "wb");
+
+        if (obj->fp == NULL) {
+            printf("Cannot open file %s\n",obj->interface->fileName);
+            exit(EXIT_FAILURE);
+        }
+
+    }
+
+    void snk_powers_open_interface_socket(snk_powers_obj * obj) {
+
+        obj->sender = sender_construct("Sink powers", obj->interface);
+
+    }
+
+    void snk_powers_open_interface_udp(snk_powers_obj * obj) {
+
+        obj->datagram = datagram_construct("Sink powers", obj->interface);
+
+    }
+
+    void snk_powers_open_interface_shm(snk_powers_obj * obj) {
+
+        obj->shm = shm_writer_construct(obj->interface->fileName, obj->interface->queueSize);
+
+    }
+
+    void snk_powers_open_interface_mmap(snk_powers_obj * obj) {
+
+        archive_header header;
+
+        memset(&header, 0x00, sizeof(archive_header));
+
+        header.kind = archive_kind_powers;
+        header.recordSize = sizeof(uint64_t) + sizeof(float) * 1 * obj->nBins * obj->nChannelsSelected;
+        header.recordSize = ((header.recordSize + sizeof(uint64_t) - 1) / sizeof(uint64_t)) * sizeof(uint64_t);
+        header.nChannels = obj->nChannelsSelected;
+        header.nBins = obj->nBins;
+        header.binStep = obj->binStep;
+        header.halfFrameSize = obj->halfFrameSize;
+        header.fS = obj->fS;
+
+        // The channel table keeps the configured order
+        obj->archive = archive_construct(obj->interface->fileName, &header, obj->channels);
+
+    }
+
     void snk_powers_close(snk_powers_obj * obj) {
 
         switch(obj->interface->type) {
@@ -107,6 +241,36 @@
 
             break;
 
+            case interface_file:
+
+                snk_powers_close_interface_file(obj);
+
+            break;
+
+            case interface_socket:
+
+                snk_powers_close_interface_socket(obj);
+
+            break;
+
+            case interface_udp:
+
+                snk_powers_close_interface_udp(obj);
+
+            break;
+
+            case interface_shm:
+
+                snk_powers_close_interface_shm(obj);
+
+            break;
+
+            case interface_mmap:
+
+                snk_powers_close_interface_mmap(obj);
+
+            break;
+
             default:
 
                 printf("Sink powers: Invalid interface type.\n");
@@ -124,14 +288,52 @@
 
     }
 
+    void snk_powers_close_interface_file(snk_powers_obj * obj) {
+
+        fclose(obj->fp);
+
+    }
+
+    void snk_powers_close_interface_socket(snk_powers_obj * obj) {
+
+        sender_destroy(obj->sender);
+
+    }
+
+    void snk_powers_close_interface_udp(snk_powers_obj * obj) {
+
+        datagram_destroy(obj->datagram);
+
+    }
+
+    void snk_powers_close_interface_shm(snk_powers_obj * obj) {
+
+        shm_writer_destroy(obj->shm);
+
+    }
+
+    void snk_powers_close_interface_mmap(snk_powers_obj * obj) {
+
+        archive_destroy(obj->archive);
+
+    }
+
     int snk_powers_process(snk_powers_obj * obj) {
 
         int rtnValue;
 
         if (obj->in->timeStamp != 0) {
 
+            obj->timeStamp = obj->in->timeStamp;
+
             switch(obj->format->type) {
 
+                case format_binary_float:
+
+                    snk_powers_process_format_binary_float(obj);
+
+                break;
+
                 case format_undefined:
 
                     snk_powers_process_format_undefined(obj);
@@ -155,6 +357,36 @@
 
                 break;
 
+                case interface_file:
+
+                    snk_powers_process_interface_file(obj);
+
+                break;
+
+                case interface_socket:
+
+                    snk_powers_process_interface_socket(obj);
+
+                break;
+
+                case interface_udp:
+
+                    snk_powers_process_interface_udp(obj);
+
+                break;
+
+                case interface_shm:
+
+                    snk_powers_process_interface_shm(obj);
+
+                break;
+
+                case interface_mmap:
+
+                    snk_powers_process_interface_mmap(obj);
+
+                break;
+
                 default:
 
                     printf("Sink powers: Invalid interface type.\n");
@@ -183,9 +415,65 @@
 
     }
 
+    void snk_powers_process_interface_file(snk_powers_obj * obj) {
+
+        fwrite(obj->buffer, sizeof(char), obj->bufferSize, obj->fp);
+
+    }
+
+    void snk_powers_process_interface_socket(snk_powers_obj * obj) {
+
+        sender_push(obj->sender, obj->buffer, obj->bufferSize);
+
+    }
+
+    void snk_powers_process_interface_udp(snk_powers_obj * obj) {
+
+        // Fragments never split a bin
+        datagram_send(obj->datagram, obj->in->timeStamp, obj->buffer, obj->bufferSize, sizeof(float) * 1);
+
+    }
+
+    void snk_powers_process_interface_shm(snk_powers_obj * obj) {
+
+        shm_writer_publish(obj->shm, obj->in->timeStamp, obj->buffer, obj->bufferSize);
+
+    }
+
+    void snk_powers_process_interface_mmap(snk_powers_obj * obj) {
+
+        archive_append(obj->archive, obj->in->timeStamp, obj->buffer, obj->bufferSize);
+
+    }
+
+    void snk_powers_process_format_binary_float(snk_powers_obj * obj) {
+
+        unsigned int iChannel;
+        unsigned int iBin;
+        float * src;
+        float * dest;
+
+        dest = (float *) obj->buffer;
+
+        for (iChannel = 0; iChannel < obj->nChannelsSelected; iChannel++) {
+
+            src = obj->in->envs->array[obj->channels[iChannel]];
+
+            for (iBin = 0; iBin < obj->halfFrameSize; iBin += obj->binStep) {
+
+                dest[0] = src[iBin];
+                dest++;
+
+            }
+
+        }
+        obj->bufferSize = sizeof(float) * 1 * obj->nBins * obj->nChannelsSelected;
+
+    }
+
     void snk_powers_process_format_undefined(snk_powers_obj * obj) {
 
-        // Empty
+        obj->bufferSize = 0;
 
     }
 
@@ -199,6 +487,10 @@
         cfg->format = (format_obj *) NULL;
         cfg->interface = (interface_obj *) NULL;
 
+        cfg->binStep = 1;
+        cfg->nChannels = 0;
+        cfg->channels = (unsigned int *) NULL;
+
         return cfg;
 
     }
@@ -211,6 +503,9 @@
         if (snk_powers_config->interface != NULL) {
             interface_destroy(snk_powers_config->interface);
         }
+        if (snk_powers_config->channels != NULL) {
+            free((void *) snk_powers_config->channels);
+        }
 
         free((void *) snk_powers_config);
 
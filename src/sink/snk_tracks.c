@@ -26,6 +26,8 @@
     snk_tracks_obj * snk_tracks_construct(const snk_tracks_cfg * snk_tracks_config, const msg_tracks_cfg * msg_tracks_config) {
 
         snk_tracks_obj * obj;
+        unsigned int iTag;
+        unsigned int one;
 
         obj = (snk_tracks_obj *) malloc(sizeof(snk_tracks_obj));
 
@@ -40,6 +42,12 @@
         if (!(((obj->interface->type == interface_blackhole)  && (obj->format->type == format_undefined)) ||
               ((obj->interface->type == interface_file)  && (obj->format->type == format_text_json)) ||
               ((obj->interface->type == interface_socket)  && (obj->format->type == format_text_json)) ||
+              ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_wire)) ||
+              ((obj->interface->type == interface_socket)  && (obj->format->type == format_binary_wire)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_text_json)) ||
+              ((obj->interface->type == interface_udp)  && (obj->format->type == format_binary_wire)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_text_json)) ||
+              ((obj->interface->type == interface_shm)  && (obj->format->type == format_binary_wire)) ||
               ((obj->interface->type == interface_terminal) && (obj->format->type == format_text_json)))) {
             
             interface_printf(obj->interface);
@@ -50,12 +58,45 @@
 
         }
 
+        // The wire format is little-endian, and records are written with the host byte order
+        if (obj->format->type == format_binary_wire) {
+
+            one = 1;
+
+            if (*((unsigned char *) &one) != 1) {
+                printf("Sink tracks: The wire format requires a little-endian host.\n");
+                exit(EXIT_FAILURE);
+            }
+
+        }
+
         obj->fp = (FILE *) NULL;
 
-        obj->buffer = (char *) malloc(sizeof(char) * 1024);
-        memset(obj->buffer, 0x00, sizeof(char) * 1024);
+        // Longest JSON message: 64 bytes around the list, and 544 bytes per track
+        // (66 characters of text, a 20-digit id, a 255-character tag and 4 floats of 48 characters)
+        // (the wire format needs less, even with every tag announced)
+        obj->bufferCapacity = 64 + 544 * obj->nTracks;
+
+        obj->buffer = (char *) malloc(sizeof(char) * obj->bufferCapacity);
+        memset(obj->buffer, 0x00, sizeof(char) * obj->bufferCapacity);
         obj->bufferSize = 0;
 
+        // Indexes given to tags on the wire: "" and "dynamic" are implicit, and the table
+        // starts over once it cannot hold a full message of new tags
+        obj->nWireTagsMax = 256 + obj->nTracks;
+        obj->nWireTags = 2;
+        obj->wireTags = (char **) malloc(sizeof(char *) * obj->nWireTagsMax);
+
+        for (iTag = 0; iTag < obj->nWireTagsMax; iTag++) {
+            obj->wireTags[iTag] = (char *) malloc(sizeof(char) * 256);
+            memset(obj->wireTags[iTag], 0x00, sizeof(char) * 256);
+        }
+
+        strcpy(obj->wireTags[1], "dynamic");
+
+        obj->wireTagIndexes = (unsigned int *) malloc(sizeof(unsigned int) * obj->nTracks);
+        memset(obj->wireTagIndexes, 0x00, sizeof(unsigned int) * obj->nTracks);
+
         obj->in = (msg_tracks_obj *) NULL;
 
         return obj;
@@ -64,6 +105,15 @@
 
     void snk_tracks_destroy(snk_tracks_obj * obj) {
 
+        unsigned int iTag;
+
+        for (iTag = 0; iTag < obj->nWireTagsMax; iTag++) {
+            free((void *) obj->wireTags[iTag]);
+        }
+
+        free((void *) obj->wireTags);
+        free((void *) obj->wireTagIndexes);
+
         free((void *) obj->buffer);
 
         format_destroy(obj->format);
@@ -107,6 +157,18 @@
 
             break;
 
+            case interface_udp:
+
+                snk_tracks_open_interface_udp(obj);
+
+            break;
+
+            case interface_shm:
+
+                snk_tracks_open_interface_shm(obj);
+
+            break;
+
             case interface_terminal:
 
                 snk_tracks_open_interface_terminal(obj);
@@ -143,19 +205,19 @@
 
     void snk_tracks_open_interface_socket(snk_tracks_obj * obj) {
 
-        memset(&(obj->sserver), 0x00, sizeof(struct sockaddr_in));
+        obj->sender = sender_construct("Sink tracks", obj->interface);
 
-        obj->sserver.sin_family = AF_INET;
-        obj->sserver.sin_addr.s_addr = inet_addr(obj->interface->ip);
-        obj->sserver.sin_port = htons(obj->interface->port);
-        obj->sid = socket(AF_INET, SOCK_STREAM, 0);
+    }
 
-        if ( (connect(obj->sid, (struct sockaddr *) &(obj->sserver), sizeof(obj->sserver))) < 0 ) {
+    void snk_tracks_open_interface_udp(snk_tracks_obj * obj) {
 
-            printf("Sink tracks: Cannot connect to server\n");
-            exit(EXIT_FAILURE);
+        obj->datagram = datagram_construct("Sink tracks", obj->interface);
+
+    }
 
-        }   
+    void snk_tracks_open_interface_shm(snk_tracks_obj * obj) {
+
+        obj->shm = shm_writer_construct(obj->interface->fileName, obj->interface->queueSize);
 
     }
 
@@ -187,6 +249,18 @@
 
             break;
 
+            case interface_udp:
+
+                snk_tracks_close_interface_udp(obj);
+
+            break;
+
+            case interface_shm:
+
+                snk_tracks_close_interface_shm(obj);
+
+            break;
+
             case interface_terminal:
 
                 snk_tracks_close_interface_terminal(obj);
@@ -218,7 +292,19 @@
 
     void snk_tracks_close_interface_socket(snk_tracks_obj * obj) {
 
-        close(obj->sid);
+        sender_destroy(obj->sender);
+
+    }
+
+    void snk_tracks_close_interface_udp(snk_tracks_obj * obj) {
+
+        datagram_destroy(obj->datagram);
+
+    }
+
+    void snk_tracks_close_interface_shm(snk_tracks_obj * obj) {
+
+        shm_writer_destroy(obj->shm);
 
     }
 
@@ -242,6 +328,12 @@
 
                 break;
 
+                case format_binary_wire:
+
+                    snk_tracks_process_format_binary_wire(obj);
+
+                break;
+
                 case format_undefined:
 
                     snk_tracks_process_format_undefined(obj);
@@ -277,6 +369,18 @@
 
                 break;
 
+                case interface_udp:
+
+                    snk_tracks_process_interface_udp(obj);
+
+                break;
+
+                case interface_shm:
+
+                    snk_tracks_process_interface_shm(obj);
+
+                break;
+
                 case interface_terminal:
 
                     snk_tracks_process_interface_terminal(obj);
@@ -319,10 +423,19 @@
 
     void snk_tracks_process_interface_socket(snk_tracks_obj * obj) {
 
-        if (send(obj->sid, obj->buffer, obj->bufferSize, 0) < 0) {
-            printf("Sink tracks: Could not send message.\n");
-            exit(EXIT_FAILURE);
-        }  
+        sender_push(obj->sender, obj->buffer, obj->bufferSize);
+
+    }
+
+    void snk_tracks_process_interface_udp(snk_tracks_obj * obj) {
+
+        datagram_send(obj->datagram, obj->in->timeStamp, obj->buffer, obj->bufferSize, 1);
+
+    }
+
+    void snk_tracks_process_interface_shm(snk_tracks_obj * obj) {
+
+        shm_writer_publish(obj->shm, obj->in->timeStamp, obj->buffer, obj->bufferSize);
 
     }
 
@@ -335,38 +448,153 @@
     void snk_tracks_process_format_text_json(snk_tracks_obj * obj) {
 
         unsigned int iTrack;
+        char * cursor;
 
-        obj->buffer[0] = 0x00;
+        cursor = obj->buffer;
 
-        sprintf(obj->buffer,"%s{\n",obj->buffer);
-        sprintf(obj->buffer,"%s    \"timeStamp\": %llu,\n",obj->buffer,obj->in->timeStamp);
-        sprintf(obj->buffer,"%s    \"src\": [\n",obj->buffer);
+        cursor = json_text(cursor, "{\n");
+        cursor = json_text(cursor, "    \"timeStamp\": ");
+        cursor = json_uint64(cursor, obj->in->timeStamp);
+        cursor = json_text(cursor, ",\n");
+        cursor = json_text(cursor, "    \"src\": [\n");
 
         for (iTrack = 0; iTrack < obj->nTracks; iTrack++) {
 
-            sprintf(obj->buffer,"%s        { \"id\": %llu, \"tag\": \"%s\", \"x\": %1.3f, \"y\": %1.3f, \"z\": %1.3f, \"activity\": %1.3f }", 
-                    obj->buffer,
-                    obj->in->tracks->ids[iTrack],
-                    obj->in->tracks->tags[iTrack],
-                    obj->in->tracks->array[iTrack*3+0], 
-                    obj->in->tracks->array[iTrack*3+1], 
-                    obj->in->tracks->array[iTrack*3+2],
-                    obj->in->tracks->activity[iTrack]);
+            cursor = json_text(cursor, "        { \"id\": ");
+            cursor = json_uint64(cursor, obj->in->tracks->ids[iTrack]);
+            cursor = json_text(cursor, ", \"tag\": \"");
+            cursor = json_text(cursor, obj->in->tracks->tags[iTrack]);
+            cursor = json_text(cursor, "\", \"x\": ");
+            cursor = json_float3(cursor, obj->in->tracks->array[iTrack*3+0]);
+            cursor = json_text(cursor, ", \"y\": ");
+            cursor = json_float3(cursor, obj->in->tracks->array[iTrack*3+1]);
+            cursor = json_text(cursor, ", \"z\": ");
+            cursor = json_float3(cursor, obj->in->tracks->array[iTrack*3+2]);
+            cursor = json_text(cursor, ", \"activity\": ");
+            cursor = json_float3(cursor, obj->in->tracks->activity[iTrack]);
+            cursor = json_text(cursor, " }");
 
             if (iTrack != (obj->nTracks - 1)) {
 
-                sprintf(obj->buffer,"%s,",obj->buffer);
+                cursor = json_text(cursor, ",");
 
             }
 
-            sprintf(obj->buffer,"%s\n",obj->buffer);
+            cursor = json_text(cursor, "\n");
 
         }
         
-        sprintf(obj->buffer,"%s    ]\n",obj->buffer);
-        sprintf(obj->buffer,"%s}\n",obj->buffer);
+        cursor = json_text(cursor, "    ]\n");
+        cursor = json_text(cursor, "}\n");
+
+        obj->bufferSize = cursor - obj->buffer;
+
+    }
+
+    void snk_tracks_process_format_binary_wire(snk_tracks_obj * obj) {
+
+        unsigned int iTrack;
+        unsigned int iTrackPrev;
+        unsigned int iTag;
+        unsigned int nTagsNew;
+        wire_header * header;
+        wire_tag * tags;
+        wire_track * tracks;
+
+        if ((obj->nWireTags + obj->nTracks) > obj->nWireTagsMax) {
+            obj->nWireTags = 2;
+        }
+
+        // The tags used by the tracks go in a tags message, written in front of the tracks message.
+        // They are announced with every message, so a reader that missed one (reconnection, drop,
+        // lost datagram, late shm reader) resolves the indexes of the next one.
+
+        tags = (wire_tag *) &(obj->buffer[sizeof(wire_header)]);
+        nTagsNew = 0;
+
+        for (iTrack = 0; iTrack < obj->nTracks; iTrack++) {
+
+            for (iTag = 0; iTag < obj->nWireTags; iTag++) {
+
+                if (strcmp(obj->wireTags[iTag], obj->in->tracks->tags[iTrack]) == 0) {
+                    break;
+                }
+
+            }
+
+            if (iTag == obj->nWireTags) {
+
+                strcpy(obj->wireTags[iTag], obj->in->tracks->tags[iTrack]);
+                obj->nWireTags++;
+
+            }
+
+            obj->wireTagIndexes[iTrack] = iTag;
+
+            // "" and "dynamic" are implicit, and a tag shared by several tracks is announced once
+            if (iTag < 2) {
+                continue;
+            }
+
+            for (iTrackPrev = 0; iTrackPrev < iTrack; iTrackPrev++) {
+
+                if (obj->wireTagIndexes[iTrackPrev] == iTag) {
+                    break;
+                }
+
+            }
+
+            if (iTrackPrev == iTrack) {
+
+                tags[nTagsNew].index = iTag;
+                tags[nTagsNew].reserved = 0;
+                strncpy(tags[nTagsNew].name, obj->in->tracks->tags[iTrack], sizeof(tags[nTagsNew].name));
+                nTagsNew++;
+
+            }
+
+        }
+
+        obj->bufferSize = 0;
+
+        if (nTagsNew > 0) {
+
+            header = (wire_header *) obj->buffer;
+
+            header->magic = wire_magic;
+            header->version = wire_version;
+            header->type = wire_type_tags;
+            header->timeStamp = obj->in->timeStamp;
+            header->count = nTagsNew;
+            header->recordSize = sizeof(wire_tag);
+
+            obj->bufferSize = sizeof(wire_header) + sizeof(wire_tag) * nTagsNew;
+
+        }
+
+        header = (wire_header *) &(obj->buffer[obj->bufferSize]);
+        tracks = (wire_track *) &(obj->buffer[obj->bufferSize + sizeof(wire_header)]);
+
+        header->magic = wire_magic;
+        header->version = wire_version;
+        header->type = wire_type_tracks;
+        header->timeStamp = obj->in->timeStamp;
+        header->count = obj->nTracks;
+        header->recordSize = sizeof(wire_track);
+
+        for (iTrack = 0; iTrack < obj->nTracks; iTrack++) {
+
+            tracks[iTrack].id = obj->in->tracks->ids[iTrack];
+            tracks[iTrack].tag = obj->wireTagIndexes[iTrack];
+            tracks[iTrack].x = obj->in->tracks->array[iTrack*3+0];
+            tracks[iTrack].y = obj->in->tracks->array[iTrack*3+1];
+            tracks[iTrack].z = obj->in->tracks->array[iTrack*3+2];
+            tracks[iTrack].activity = obj->in->tracks->activity[iTrack];
+            tracks[iTrack].reserved = 0;
+
+        }
 
-        obj->bufferSize = strlen(obj->buffer);
+        obj->bufferSize += sizeof(wire_header) + sizeof(wire_track) * obj->nTracks;
 
     }
 
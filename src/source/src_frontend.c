@@ -0,0 +1,449 @@
+   
+   /**
+    * \file     src_frontend.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <source/src_frontend.h>
+
+    src_frontend_obj * src_frontend_construct(const src_frontend_cfg * src_frontend_config, const msg_hops_cfg * msg_hops_raw_config, const msg_hops_cfg * msg_hops_config, const msg_spectra_cfg * msg_spectra_config) {
+
+        src_frontend_obj * obj;
+        src_hops_cfg * src_hops_config;
+        unsigned int iLink;
+
+        obj = (src_frontend_obj *) malloc(sizeof(src_frontend_obj));
+
+        obj->timeStamp = 0;
+
+        obj->hopSizeIn = msg_hops_raw_config->hopSize;
+        obj->hopSizeOut = msg_hops_config->hopSize;
+        obj->nChannelsIn = msg_hops_raw_config->nChannels;
+        obj->nChannels = msg_hops_config->nChannels;
+        obj->fSin = msg_hops_raw_config->fS;
+        obj->fSout = msg_hops_config->fS;
+        obj->halfFrameSize = msg_spectra_config->halfFrameSize;
+        obj->frameSize = 2 * (obj->halfFrameSize - 1);
+
+        if (src_frontend_config->links->nLinks != obj->nChannels) {
+            printf("Source frontend: Number of links does not match the number of channels.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        for (iLink = 0; iLink < src_frontend_config->links->nLinks; iLink++) {
+
+            if (src_frontend_config->links->array[iLink] > obj->nChannelsIn) {
+                printf("Source frontend: Link %u points to a channel that does not exist.\n", iLink);
+                exit(EXIT_FAILURE);
+            }
+
+        }
+
+        // Input/output goes through a hops source, only its raw buffer is used here
+
+        src_hops_config = src_hops_cfg_construct();
+        src_hops_config->format = format_clone(src_frontend_config->format);
+        src_hops_config->interface = interface_clone(src_frontend_config->interface);
+        src_hops_config->access = src_frontend_config->access;
+        src_hops_config->periodSize = src_frontend_config->periodSize;
+        src_hops_config->nPeriods = src_frontend_config->nPeriods;
+        obj->src_hops = src_hops_construct(src_hops_config, msg_hops_raw_config);
+        src_hops_cfg_destroy(src_hops_config);
+
+        obj->isFloat = 0;
+
+        switch (obj->src_hops->format->type) {
+
+            case format_binary_int08: obj->nBytes = 1; break;
+            case format_binary_int16: obj->nBytes = 2; break;
+            case format_binary_int24: obj->nBytes = 3; break;
+            case format_binary_int32: obj->nBytes = 4; break;
+            case format_binary_float: obj->nBytes = 4; obj->isFloat = 1; break;
+
+            default:
+
+                printf("Source frontend: Invalid format type.\n");
+                exit(EXIT_FAILURE);
+
+            break;
+
+        }
+
+        obj->links = links_clone(src_frontend_config->links);
+
+        // Mapped hop at the input sample rate
+        obj->hops = hops_construct_zero(obj->nChannels, obj->hopSizeIn);
+        obj->nHops = 0;
+
+        obj->hop2hop_buffer = (hop2hop_buffer_obj *) NULL;
+        obj->hop2hop_polyphase = (hop2hop_polyphase_obj *) NULL;
+
+        if ((obj->fSin == obj->fSout) && (obj->hopSizeIn == obj->hopSizeOut)) {
+
+            obj->type = 'c';
+
+        }
+        else if (obj->fSin == obj->fSout) {
+
+            obj->type = 'b';
+            obj->hop2hop_buffer = hop2hop_buffer_construct_zero(obj->nChannels, obj->hopSizeIn, obj->hopSizeOut, 1.0f);
+
+        }
+        else {
+
+            obj->type = 'p';
+            obj->hop2hop_polyphase = hop2hop_polyphase_construct_zero(obj->nChannels, obj->hopSizeIn, obj->hopSizeOut, obj->fSin, obj->fSout, src_frontend_config->nTaps);
+
+        }
+
+        obj->hop2frame = hop2frame_construct_zero(obj->hopSizeOut, obj->frameSize, obj->nChannels);
+        obj->frame2freq = frame2freq_construct_zero(obj->frameSize, obj->halfFrameSize);
+
+        obj->noMorePush = 0;
+        obj->nFramesSkipped = 0;
+
+        obj->out1 = (msg_hops_obj *) NULL;
+        obj->out2 = (msg_spectra_obj *) NULL;
+
+        return obj;
+
+    }
+
+    void src_frontend_destroy(src_frontend_obj * obj) {
+
+        src_hops_destroy(obj->src_hops);
+        links_destroy(obj->links);
+        hops_destroy(obj->hops);
+
+        if (obj->hop2hop_buffer != NULL) {
+            hop2hop_buffer_destroy(obj->hop2hop_buffer);
+        }
+
+        if (obj->hop2hop_polyphase != NULL) {
+            hop2hop_polyphase_destroy(obj->hop2hop_polyphase);
+        }
+
+        hop2frame_destroy(obj->hop2frame);
+        frame2freq_destroy(obj->frame2freq);
+
+        free((void *) obj);
+
+    }
+
+    void src_frontend_connect(src_frontend_obj * obj, msg_hops_obj * out1, msg_spectra_obj * out2) {
+
+        obj->out1 = out1;
+        obj->out2 = out2;
+
+    }
+
+    void src_frontend_disconnect(src_frontend_obj * obj) {
+
+        obj->out1 = (msg_hops_obj *) NULL;
+        obj->out2 = (msg_spectra_obj *) NULL;
+
+    }
+
+    void src_frontend_open(src_frontend_obj * obj) {
+
+        src_hops_open(obj->src_hops);
+
+    }
+
+    void src_frontend_close(src_frontend_obj * obj) {
+
+        src_hops_close(obj->src_hops);
+
+    }
+
+    int src_frontend_process_push(src_frontend_obj * obj) {
+
+        int rtnValue;
+
+        switch(obj->src_hops->interface->type) {
+
+            case interface_file:
+
+                rtnValue = src_hops_process_interface_file(obj->src_hops);
+
+            break;
+
+            case interface_soundcard:
+
+                rtnValue = src_hops_process_interface_soundcard(obj->src_hops);
+
+            break;
+
+            default:
+
+                printf("Source frontend: Invalid interface type.\n");
+                exit(EXIT_FAILURE);
+
+            break;
+
+        }
+
+        if (rtnValue == 0) {
+
+            // Frames lost in an overrun, counted at the output rate times fSin
+            obj->nFramesSkipped += ((unsigned long long) obj->src_hops->nFramesSkipped) * obj->fSout;
+            obj->src_hops->nFramesSkipped = 0;
+
+            src_frontend_process_decode(obj);
+
+            switch(obj->type) {
+
+                case 'c':
+
+                    obj->nHops = 1;
+
+                break;
+
+                case 'b':
+
+                    hop2hop_buffer_push(obj->hop2hop_buffer, obj->hops);
+
+                break;
+
+                case 'p':
+
+                    hop2hop_polyphase_push(obj->hop2hop_polyphase, obj->hops);
+
+                break;
+
+            }
+
+        }
+        else {
+
+            obj->noMorePush = 1;
+
+        }
+
+        return rtnValue;
+
+    }
+
+    int src_frontend_process_pop(src_frontend_obj * obj) {
+
+        int rtnValue;
+        unsigned long long nHopsSkipped;
+
+        if (src_frontend_isEmpty(obj) == 0) {
+
+            switch(obj->type) {
+
+                case 'c':
+
+                    hops_copy(obj->out1->hops, obj->hops);
+                    obj->nHops = 0;
+
+                break;
+
+                case 'b':
+
+                    hop2hop_buffer_pop(obj->hop2hop_buffer, obj->out1->hops);
+
+                break;
+
+                case 'p':
+
+                    hop2hop_polyphase_pop(obj->hop2hop_polyphase, obj->out1->hops);
+
+                break;
+
+            }
+
+            hop2frame_push(obj->hop2frame, obj->out1->hops);
+            frame2freq_process_ring(obj->frame2freq, obj->hop2frame, obj->out2->freqs);
+
+            // Hops lost in an overrun still count, as in src_hops_process
+            nHopsSkipped = obj->nFramesSkipped / (((unsigned long long) obj->hopSizeOut) * obj->fSin);
+            obj->nFramesSkipped -= nHopsSkipped * ((unsigned long long) obj->hopSizeOut) * obj->fSin;
+
+            obj->timeStamp += nHopsSkipped;
+            obj->timeStamp++;
+            obj->out1->timeStamp = obj->timeStamp;
+            obj->out2->timeStamp = obj->timeStamp;
+
+            rtnValue = 0;
+
+        }
+        else {
+
+            if (obj->noMorePush == 1) {
+                msg_hops_zero(obj->out1);
+                msg_spectra_zero(obj->out2);
+            }
+
+            rtnValue = -1;
+
+        }
+
+        return rtnValue;
+
+    }
+
+    void src_frontend_process_decode(src_frontend_obj * obj) {
+
+        unsigned int iChannel;
+        unsigned int iSample;
+        unsigned int stride;
+        const unsigned char * bytes;
+        float * samples;
+
+        // Each mapped channel is read straight from the interleaved buffer,
+        // with the same scaling as pcm_signedXXbits2normalized
+
+        stride = obj->nChannelsIn * obj->nBytes;
+
+        for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+
+            samples = obj->hops->array[iChannel];
+
+            if (obj->links->array[iChannel] == 0) {
+
+                memset(samples, 0x00, sizeof(float) * obj->hopSizeIn);
+                continue;
+
+            }
+
+            bytes = (const unsigned char *) &(obj->src_hops->bytes[(obj->links->array[iChannel] - 1) * obj->nBytes]);
+
+            // Float samples are already normalized, and a mapped file gives no alignment guarantee
+            if (obj->isFloat == 1) {
+
+                for (iSample = 0; iSample < obj->hopSizeIn; iSample++) {
+                    memcpy(&(samples[iSample]), bytes, sizeof(float));
+                    bytes += stride;
+                }
+
+                continue;
+
+            }
+
+            switch(obj->nBytes) {
+
+                case 1:
+
+                    for (iSample = 0; iSample < obj->hopSizeIn; iSample++) {
+                        samples[iSample] = ((float) ((signed char) bytes[0])) / 128.0f;
+                        bytes += stride;
+                    }
+
+                break;
+
+                case 2:
+
+                    for (iSample = 0; iSample < obj->hopSizeIn; iSample++) {
+                        samples[iSample] = ((float) (((int) ((signed char) bytes[1])) * 256 + ((int) bytes[0]))) / 32768.0f;
+                        bytes += stride;
+                    }
+
+                break;
+
+                case 3:
+
+                    for (iSample = 0; iSample < obj->hopSizeIn; iSample++) {
+                        samples[iSample] = ((float) (((int) ((signed char) bytes[2])) * 65536 + ((int) bytes[1]) * 256 + ((int) bytes[0]))) / 8388608.0f;
+                        bytes += stride;
+                    }
+
+                break;
+
+                case 4:
+
+                    for (iSample = 0; iSample < obj->hopSizeIn; iSample++) {
+                        samples[iSample] = ((float) (((int) ((signed char) bytes[3])) * 16777216 + ((int) bytes[2]) * 65536 + ((int) bytes[1]) * 256 + ((int) bytes[0]))) / 2147483648.0f;
+                        bytes += stride;
+                    }
+
+                break;
+
+            }
+
+        }
+
+    }
+
+    char src_frontend_isEmpty(src_frontend_obj * obj) {
+
+        char rtnValue;
+
+        switch(obj->type) {
+
+            case 'c':
+
+                rtnValue = (obj->nHops == 0) ? 1 : 0;
+
+            break;
+
+            case 'b':
+
+                rtnValue = hop2hop_buffer_isEmpty(obj->hop2hop_buffer);
+
+            break;
+
+            case 'p':
+
+                rtnValue = hop2hop_polyphase_isEmpty(obj->hop2hop_polyphase);
+
+            break;
+
+        }
+
+        return rtnValue;
+
+    }
+
+    src_frontend_cfg * src_frontend_cfg_construct(void) {
+
+        src_frontend_cfg * cfg;
+
+        cfg = (src_frontend_cfg *) malloc(sizeof(src_frontend_cfg));
+
+        cfg->format = (format_obj *) NULL;
+        cfg->interface = (interface_obj *) NULL;
+        cfg->links = (links_obj *) NULL;
+        cfg->nTaps = 0;
+
+        cfg->access = 'r';
+        cfg->periodSize = 0;
+        cfg->nPeriods = 0;
+
+        return cfg;
+
+    }
+
+    void src_frontend_cfg_destroy(src_frontend_cfg * src_frontend_config) {
+
+        if (src_frontend_config->format != NULL) {
+            format_destroy(src_frontend_config->format);
+        }
+        if (src_frontend_config->interface != NULL) {
+            interface_destroy(src_frontend_config->interface);
+        }
+        if (src_frontend_config->links != NULL) {
+            links_destroy(src_frontend_config->links);
+        }
+
+        free((void *) src_frontend_config);
+
+    }
@@ -39,16 +39,75 @@
         obj->format = format_clone(src_hops_config->format);
         obj->interface = interface_clone(src_hops_config->interface);
 
-        memset(obj->bytes, 0x00, 4 * sizeof(char));
+        obj->access = src_hops_config->access;
+        obj->periodSize = src_hops_config->periodSize;
+        obj->nPeriods = src_hops_config->nPeriods;
+        obj->ringSize = 0;
+
+        obj->nXruns = 0;
+        obj->nFramesDropped = 0;
+        obj->nFramesSkipped = 0;
+
+        obj->status = (snd_pcm_status_t *) NULL;
+
+        obj->wave = (wave_obj *) NULL;
+        obj->fp = (FILE *) NULL;
+        obj->map = (char *) NULL;
+        obj->mapSize = 0;
+        obj->position = 0;
+        obj->dataEnd = 0;
+
+        if ((obj->access != 'r') && (obj->access != 'm')) {
+            printf("Source hops: Invalid access type.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        // A WAV or RF64 header gives the sample format, and must agree with the configuration
+
+        if (obj->interface->type == interface_file) {
+
+            obj->wave = wave_construct_file(obj->interface->fileName);
+
+            if (obj->wave->container != 'n') {
+
+                if (obj->wave->nChannels != obj->nChannels) {
+                    printf("Source hops: File %s has %u channels, expected %u.\n", obj->interface->fileName, obj->wave->nChannels, obj->nChannels);
+                    exit(EXIT_FAILURE);
+                }
+
+                if (obj->wave->fS != obj->fS) {
+                    printf("Source hops: File %s is sampled at %u Hz, expected %u Hz.\n", obj->interface->fileName, obj->wave->fS, obj->fS);
+                    exit(EXIT_FAILURE);
+                }
+
+                format_destroy(obj->format);
+
+                if (obj->wave->isFloat == 1) {
+                    obj->format = format_construct_binary_float();
+                }
+                else {
+                    obj->format = format_construct_binary_int(obj->wave->nBits);
+                }
+
+                // The header wins over the configuration, so a mismatch is reported
+                if (obj->format->type != src_hops_config->format->type) {
+                    printf("Source hops: File %s holds %u-bit %s samples, the configured nBits is ignored.\n", obj->interface->fileName, obj->wave->nBits, (obj->wave->isFloat == 1) ? "float" : "integer");
+                }
+
+            }
+
+        }
 
         if (!(((obj->interface->type == interface_file)  && (obj->format->type == format_binary_int08)) ||
               ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_int16)) ||
               ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_int24)) ||
               ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_int32)) ||
+              ((obj->interface->type == interface_file)  && (obj->format->type == format_binary_float)) ||
               ((obj->interface->type == interface_soundcard)  && (obj->format->type == format_binary_int08)) ||
               ((obj->interface->type == interface_soundcard)  && (obj->format->type == format_binary_int16)) ||
               ((obj->interface->type == interface_soundcard)  && (obj->format->type == format_binary_int24)) ||
-              ((obj->interface->type == interface_soundcard)  && (obj->format->type == format_binary_int32)))) {
+              ((obj->interface->type == interface_soundcard)  && (obj->format->type == format_binary_int32)) ||
+              ((obj->interface->type == interface_soundcard)  && (obj->format->type == format_binary_float)))) {
             
             printf("Source hops: Invalid interface and/or format.\n");
             exit(EXIT_FAILURE);
@@ -64,9 +123,12 @@
             case format_binary_int16: obj->bufferSize = obj->hopSize * obj->nChannels * 2; break;
             case format_binary_int24: obj->bufferSize = obj->hopSize * obj->nChannels * 3; break;
             case format_binary_int32: obj->bufferSize = obj->hopSize * obj->nChannels * 4; break;
+            case format_binary_float: obj->bufferSize = obj->hopSize * obj->nChannels * 4; break;
 
         }      
 
+        obj->bytes = obj->buffer;
+
         obj->out = (msg_hops_obj *) NULL;
         
         return obj;
@@ -75,6 +137,10 @@
 
     void src_hops_destroy(src_hops_obj * obj) {
 
+        if (obj->wave != NULL) {
+            wave_destroy(obj->wave);
+        }
+
         free((void *) obj->buffer);
         format_destroy(obj->format);
         interface_destroy(obj->interface);
@@ -124,19 +190,77 @@
 
     void src_hops_open_interface_file(src_hops_obj * obj) {
 
-        obj->fp = fopen(obj->interface->fileName, "rb");
+        int fd;
+        struct stat st;
+        void * map;
 
-        if (obj->fp == NULL) {
+        fd = open(obj->interface->fileName, O_RDONLY);
+
+        if (fd < 0) {
             printf("Cannot open file %s\n",obj->interface->fileName);
             exit(EXIT_FAILURE);
         }
 
+        if (fstat(fd, &st) < 0) {
+            printf("Cannot read the size of file %s\n",obj->interface->fileName);
+            exit(EXIT_FAILURE);
+        }
+
+        obj->mapSize = (unsigned long long) st.st_size;
+        obj->map = (char *) NULL;
+
+        // A pipe or a device has no size and cannot be mapped: it is read as a stream
+        if ((!S_ISREG(st.st_mode)) || (obj->mapSize == 0)) {
+
+            obj->fp = fdopen(fd, "rb");
+
+            if (obj->fp == NULL) {
+                printf("Cannot open file %s\n",obj->interface->fileName);
+                exit(EXIT_FAILURE);
+            }
+
+            obj->mapSize = 0;
+
+            return;
+
+        }
+
+        // Hops are decoded straight from the mapping, read ahead by the kernel
+        if (obj->mapSize > 0) {
+
+            map = mmap(NULL, (size_t) obj->mapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (map == MAP_FAILED) {
+                printf("Cannot map file %s\n",obj->interface->fileName);
+                exit(EXIT_FAILURE);
+            }
+
+            madvise(map, (size_t) obj->mapSize, MADV_SEQUENTIAL);
+
+            obj->map = (char *) map;
+
+        }
+
+        close(fd);
+
+        obj->position = obj->wave->dataOffset;
+        obj->dataEnd = obj->wave->dataOffset + obj->wave->dataSize;
+
+        if (obj->dataEnd > obj->mapSize) {
+            obj->dataEnd = obj->mapSize;
+        }
+
     }
 
     void src_hops_open_interface_soundcard(src_hops_obj * obj) {
 
         snd_pcm_hw_params_t * hw_params;
         snd_pcm_format_t format;
+        snd_pcm_access_t access;
+        snd_pcm_uframes_t periodSize;
+        snd_pcm_uframes_t ringSize;
+        unsigned int nPeriods;
+        int dir;
         int err;
 
         switch (obj->format->type) {
@@ -155,7 +279,8 @@
 
             case format_binary_int24:
 
-                format = SND_PCM_FORMAT_S24_LE;
+                // Packed in 3 bytes, as assumed by bufferSize and the decoder
+                format = SND_PCM_FORMAT_S24_3LE;
 
             break;
             
@@ -165,6 +290,12 @@
             
             break;
 
+            case format_binary_float:
+
+                format = SND_PCM_FORMAT_FLOAT_LE;
+
+            break;
+
             default:
 
                 printf("Source hops: Invalid format.\n");
@@ -190,7 +321,30 @@
             exit(EXIT_FAILURE);
         }
 
-        if ((err = snd_pcm_hw_params_set_access(obj->ch, hw_params, SND_PCM_ACCESS_RW_INTERLEAVED)) < 0) {
+        switch (obj->access) {
+
+            case 'r':
+
+                access = SND_PCM_ACCESS_RW_INTERLEAVED;
+
+            break;
+
+            case 'm':
+
+                access = SND_PCM_ACCESS_MMAP_INTERLEAVED;
+
+            break;
+
+            default:
+
+                printf("Source hops: Invalid access type.\n");
+                exit(EXIT_FAILURE);
+
+            break;
+
+        }
+
+        if ((err = snd_pcm_hw_params_set_access(obj->ch, hw_params, access)) < 0) {
             printf("Source hops: Cannot set access type: %s\n", snd_strerror(err));
             exit(EXIT_FAILURE);
         }
@@ -210,18 +364,66 @@
             exit(EXIT_FAILURE);
         }
 
+        // Period size and count are left to the driver when set to 0
+
+        dir = 0;
+
+        if (obj->periodSize > 0) {
+
+            periodSize = obj->periodSize;
+
+            if ((err = snd_pcm_hw_params_set_period_size_near(obj->ch, hw_params, &periodSize, &dir)) < 0) {
+                printf("Source hops: Cannot set period size: %s\n", snd_strerror(err));
+                exit(EXIT_FAILURE);
+            }
+
+        }
+
+        if (obj->nPeriods > 0) {
+
+            nPeriods = obj->nPeriods;
+
+            if ((err = snd_pcm_hw_params_set_periods_near(obj->ch, hw_params, &nPeriods, &dir)) < 0) {
+                printf("Source hops: Cannot set number of periods: %s\n", snd_strerror(err));
+                exit(EXIT_FAILURE);
+            }
+
+        }
+
         if ((err = snd_pcm_hw_params(obj->ch, hw_params)) < 0) {
             printf("Source hops: Cannot set parameters: %s\n", snd_strerror(err));
             exit(EXIT_FAILURE);
         }
 
+        if ((err = snd_pcm_hw_params_get_buffer_size(hw_params, &ringSize)) < 0) {
+            printf("Source hops: Cannot get buffer size: %s\n", snd_strerror(err));
+            exit(EXIT_FAILURE);
+        }
+
+        obj->ringSize = ringSize;
+
         snd_pcm_hw_params_free(hw_params);
 
+        if ((err = snd_pcm_status_malloc(&(obj->status))) < 0) {
+            printf("Source hops: Cannot allocate status structure: %s\n", snd_strerror(err));
+            exit(EXIT_FAILURE);
+        }
+
         if ((err = snd_pcm_prepare(obj->ch)) < 0) {
             printf("Source hops: Cannot prepare audio interface for use: %s\n", snd_strerror(err));
             exit(EXIT_FAILURE);
         }
 
+        // Reads start the capture by themselves, but mmap access does not
+        if (obj->access == 'm') {
+
+            if ((err = snd_pcm_start(obj->ch)) < 0) {
+                printf("Source hops: Cannot start audio interface: %s\n", snd_strerror(err));
+                exit(EXIT_FAILURE);
+            }
+
+        }
+
     }
 
     void src_hops_close(src_hops_obj * obj) {
@@ -253,7 +455,19 @@
 
     void src_hops_close_interface_file(src_hops_obj * obj) {
 
-        fclose(obj->fp);
+        if (obj->fp != NULL) {
+            fclose(obj->fp);
+        }
+
+        obj->fp = (FILE *) NULL;
+
+        if (obj->map != NULL) {
+            munmap((void *) obj->map, (size_t) obj->mapSize);
+        }
+
+        obj->map = (char *) NULL;
+        obj->mapSize = 0;
+        obj->bytes = obj->buffer;
 
     }
 
@@ -261,12 +475,24 @@
 
         snd_pcm_close(obj->ch);
 
+        snd_pcm_status_free(obj->status);
+        obj->status = (snd_pcm_status_t *) NULL;
+
+        if (obj->nXruns > 0) {
+            printf("Source hops: %u overrun(s), %llu frame(s) dropped.\n", obj->nXruns, obj->nFramesDropped);
+        }
+
     }
 
     int src_hops_process(src_hops_obj * obj) {
 
         int rtnValue;
 
+        // Hops lost in an overrun during the previous read still count, so that
+        // the time stamp of the hop decoded below follows the capture clock
+        obj->timeStamp += obj->nFramesSkipped / obj->hopSize;
+        obj->nFramesSkipped %= obj->hopSize;
+
         switch(obj->format->type) {
 
             case format_binary_int08:
@@ -293,6 +519,12 @@
 
             break;
 
+            case format_binary_float:
+
+                src_hops_process_format_binary_float(obj);
+
+            break;
+
             default:
 
                 printf("Source hops: Invalid format type.\n");
@@ -337,10 +569,20 @@
         unsigned int nBytesTotal;
         int rtnValue;
 
-        nBytesTotal = fread(obj->buffer, sizeof(char), obj->bufferSize, obj->fp);
+        if (obj->fp != NULL) {
+
+            nBytesTotal = fread(obj->buffer, sizeof(char), obj->bufferSize, obj->fp);
+
+            return (nBytesTotal == obj->bufferSize) ? 0 : -1;
+
+        }
+
+        // No copy: the hop points into the mapping, and a partial last hop is dropped
+        if ((obj->position + obj->bufferSize) <= obj->dataEnd) {
+
+            obj->bytes = &(obj->map[obj->position]);
+            obj->position += obj->bufferSize;
 
-        if (nBytesTotal == obj->bufferSize) {
-            
             rtnValue = 0;    
 
         }
@@ -356,130 +598,201 @@
 
     int src_hops_process_interface_soundcard(src_hops_obj * obj) {
 
-        unsigned int nSamples;
-        int rtnValue;
-        int err;
+        unsigned int nFramesRead;
+        unsigned int nBytesPerFrame;
+        snd_pcm_sframes_t nFrames;
 
-        if (err = snd_pcm_readi(obj->ch, obj->buffer, obj->hopSize) > 0) {
-            
-            rtnValue = 0;    
+        nBytesPerFrame = obj->bufferSize / obj->hopSize;
+        nFramesRead = 0;
 
-        }
-        else {
+        while (nFramesRead < obj->hopSize) {
 
-            rtnValue = -1;
+            switch (obj->access) {
 
-        }
+                case 'r':
 
-        return rtnValue;
+                    nFrames = snd_pcm_readi(obj->ch, &(obj->buffer[nFramesRead * nBytesPerFrame]), obj->hopSize - nFramesRead);
 
-    }
+                break;
 
-    void src_hops_process_format_binary_int08(src_hops_obj * obj) {
+                case 'm':
 
-        unsigned int iSample;
-        unsigned int iChannel;
-        unsigned int nBytes;
-        float sample;
+                    nFrames = src_hops_process_interface_soundcard_mmap(obj, nFramesRead);
 
-        nBytes = 1;
+                break;
 
-        for (iSample = 0; iSample < obj->hopSize; iSample++) {
+                default:
 
-            for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+                    printf("Source hops: Invalid access type.\n");
+                    exit(EXIT_FAILURE);
+
+                break;
+
+            }
 
-                memcpy(&(obj->bytes[4-nBytes]),
-                       &(obj->buffer[(iSample * obj->nChannels + iChannel) * nBytes]),
-                       sizeof(char) * nBytes);
+            if (nFrames < 0) {
 
-                sample = pcm_signedXXbits2normalized(obj->bytes, nBytes);
+                if (src_hops_process_interface_soundcard_recover(obj, (int) nFrames, nFramesRead) < 0) {
+                    return -1;
+                }
 
-                obj->out->hops->array[iChannel][iSample] = sample;
+                // The partial hop is dropped, and the hop starts over
+                nFramesRead = 0;
+                continue;
 
             }
 
+            nFramesRead += (unsigned int) nFrames;
+
         }
 
+        return 0;
+
     }
 
-    void src_hops_process_format_binary_int16(src_hops_obj * obj) {
+    snd_pcm_sframes_t src_hops_process_interface_soundcard_mmap(src_hops_obj * obj, const unsigned int nFramesRead) {
 
-        unsigned int iSample;
-        unsigned int iChannel;
-        unsigned int nBytes;
-        float sample;
+        const snd_pcm_channel_area_t * areas;
+        snd_pcm_uframes_t offset;
+        snd_pcm_uframes_t nFrames;
+        snd_pcm_sframes_t nFramesAvailable;
+        snd_pcm_sframes_t nFramesCommitted;
+        unsigned int nBytesPerFrame;
+        const char * dma;
+        int err;
 
-        nBytes = 2;
+        nFramesAvailable = snd_pcm_avail_update(obj->ch);
 
-        for (iSample = 0; iSample < obj->hopSize; iSample++) {
+        if (nFramesAvailable < 0) {
+            return nFramesAvailable;
+        }
+
+        if (nFramesAvailable == 0) {
 
-            for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+            // Nothing captured yet: sleep until the next period (a timeout just loops)
+            if ((err = snd_pcm_wait(obj->ch, 1000)) < 0) {
+                return err;
+            }
 
-                memcpy(&(obj->bytes[4-nBytes]),
-                       &(obj->buffer[(iSample * obj->nChannels + iChannel) * nBytes]),
-                       sizeof(char) * nBytes);
+            return 0;
 
-                sample = pcm_signedXXbits2normalized(obj->bytes, nBytes);
+        }
 
-                obj->out->hops->array[iChannel][iSample] = sample;
+        nFrames = obj->hopSize - nFramesRead;
 
-            }
+        if (nFrames > (snd_pcm_uframes_t) nFramesAvailable) {
+            nFrames = (snd_pcm_uframes_t) nFramesAvailable;
+        }
 
+        // The area may end before nFrames when the ring wraps around, in which case
+        // mmap_begin shortens nFrames and the rest comes with the next call
+        if ((err = snd_pcm_mmap_begin(obj->ch, &areas, &offset, &nFrames)) < 0) {
+            return err;
         }
 
+        // Interleaved access: all channels share the first area, step is one frame
+        nBytesPerFrame = obj->bufferSize / obj->hopSize;
+        dma = ((const char *) areas[0].addr) + (areas[0].first / 8) + offset * (areas[0].step / 8);
+
+        memcpy(&(obj->buffer[nFramesRead * nBytesPerFrame]), dma, nFrames * nBytesPerFrame);
+
+        nFramesCommitted = snd_pcm_mmap_commit(obj->ch, offset, nFrames);
+
+        if (nFramesCommitted < 0) {
+            return nFramesCommitted;
+        }
+
+        if (nFramesCommitted != (snd_pcm_sframes_t) nFrames) {
+            return -EPIPE;
+        }
+
+        return nFramesCommitted;
+
     }
 
-    void src_hops_process_format_binary_int24(src_hops_obj * obj) {
+    int src_hops_process_interface_soundcard_recover(src_hops_obj * obj, const int error, const unsigned int nFramesRead) {
 
-        unsigned int iSample;
-        unsigned int iChannel;
-        unsigned int nBytes;
-        float sample;
+        snd_htimestamp_t tsTrigger;
+        snd_htimestamp_t tsNow;
+        double elapsed;
+        unsigned int nFramesLost;
+        int err;
+
+        nFramesLost = nFramesRead;
 
-        nBytes = 3;
+        if (error == -EPIPE) {
 
-        for (iSample = 0; iSample < obj->hopSize; iSample++) {
+            obj->nXruns++;
 
-            for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+            // The capture stopped when the ring filled up (trigger time stamp). The ring content
+            // is thrown away by the recovery, and nothing is captured until the restart.
+            if ((snd_pcm_status(obj->ch, obj->status) == 0) && (snd_pcm_status_get_state(obj->status) == SND_PCM_STATE_XRUN)) {
 
-                memcpy(&(obj->bytes[4-nBytes]),
-                       &(obj->buffer[(iSample * obj->nChannels + iChannel) * nBytes]),
-                       sizeof(char) * nBytes);
+                snd_pcm_status_get_trigger_htstamp(obj->status, &tsTrigger);
+                snd_pcm_status_get_htstamp(obj->status, &tsNow);
 
-                sample = pcm_signedXXbits2normalized(obj->bytes, nBytes);
+                elapsed = ((double) (tsNow.tv_sec - tsTrigger.tv_sec)) + 1E-9 * ((double) (tsNow.tv_nsec - tsTrigger.tv_nsec));
 
-                obj->out->hops->array[iChannel][iSample] = sample;
+                if (elapsed < 0.0) {
+                    elapsed = 0.0;
+                }
+
+                nFramesLost += obj->ringSize + (unsigned int) (elapsed * ((double) obj->fS) + 0.5);
 
             }
 
         }
 
+        if ((err = snd_pcm_recover(obj->ch, error, 1)) < 0) {
+            printf("Source hops: Cannot recover from error: %s\n", snd_strerror(err));
+            return -1;
+        }
+
+        // Only an xrun or a suspend leaves the stream prepared: after -EINTR it is still
+        // running, and starting it again would fail
+        if ((obj->access == 'm') && (snd_pcm_state(obj->ch) == SND_PCM_STATE_PREPARED)) {
+
+            if ((err = snd_pcm_start(obj->ch)) < 0) {
+                printf("Source hops: Cannot restart audio interface: %s\n", snd_strerror(err));
+                return -1;
+            }
+
+        }
+
+        obj->nFramesDropped += nFramesLost;
+        obj->nFramesSkipped += nFramesLost;
+
+        return 0;
+
     }
 
-    void src_hops_process_format_binary_int32(src_hops_obj * obj) {
+    void src_hops_process_format_binary_int08(src_hops_obj * obj) {
 
-        unsigned int iSample;
-        unsigned int iChannel;
-        unsigned int nBytes;
-        float sample;
+        pcm_signedXXbits2normalized_interleaved(obj->bytes, 1, obj->nChannels, obj->hopSize, obj->out->hops->array);
+
+    }
+
+    void src_hops_process_format_binary_int16(src_hops_obj * obj) {
 
-        nBytes = 4;
+        pcm_signedXXbits2normalized_interleaved(obj->bytes, 2, obj->nChannels, obj->hopSize, obj->out->hops->array);
 
-        for (iSample = 0; iSample < obj->hopSize; iSample++) {
+    }
 
-            for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+    void src_hops_process_format_binary_int24(src_hops_obj * obj) {
 
-                memcpy(&(obj->bytes[4-nBytes]),
-                       &(obj->buffer[(iSample * obj->nChannels + iChannel) * nBytes]),
-                       sizeof(char) * nBytes);
+        pcm_signedXXbits2normalized_interleaved(obj->bytes, 3, obj->nChannels, obj->hopSize, obj->out->hops->array);
 
-                sample = pcm_signedXXbits2normalized(obj->bytes, nBytes);
+    }
 
-                obj->out->hops->array[iChannel][iSample] = sample;
+    void src_hops_process_format_binary_int32(src_hops_obj * obj) {
 
-            }
+        pcm_signedXXbits2normalized_interleaved(obj->bytes, 4, obj->nChannels, obj->hopSize, obj->out->hops->array);
 
-        }
+    }
+
+    void src_hops_process_format_binary_float(src_hops_obj * obj) {
+
+        pcm_float2normalized_interleaved(obj->bytes, obj->nChannels, obj->hopSize, obj->out->hops->array);
 
     }
 
@@ -492,6 +805,10 @@
         cfg->format = (format_obj *) NULL;
         cfg->interface = (interface_obj *) NULL;
 
+        cfg->access = 'r';
+        cfg->periodSize = 0;
+        cfg->nPeriods = 0;
+
         return cfg;
 
     }
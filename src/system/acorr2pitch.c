@@ -126,3 +126,88 @@
         }
 
     }
+
+    void acorr2pitch_process_range(acorr2pitch_obj * obj, const acorrs_obj * acorrs, const tracks_obj * tracks, pitches_obj * pitches, const unsigned int binMin, const unsigned int binMax, const float scale) {
+
+        unsigned int iSignal;
+
+        signed int iBin;
+        signed int iWin;
+
+        float * acorr;
+        float peakValue;
+
+        float maxValue;
+        unsigned int maxIndex;
+        char isPeak;
+        char peakFound;
+
+        float RPrev;
+        float RNow;
+        float RNext;
+
+        for (iSignal = 0; iSignal < obj->nSignals; iSignal++) {
+
+            if (tracks->ids[iSignal] == 0) {
+
+                pitches->array[iSignal] = 0.0f;
+                continue;
+
+            }
+
+            acorr = acorrs->array[iSignal];
+
+            maxValue = -INFINITY;
+            peakFound = 0x00;
+
+            // Same peak picking as acorr2pitch_process, but only over the lags binMin...binMax
+            for (iBin = binMin; iBin <= (signed int) binMax; iBin++) {
+
+                peakValue = acorr[iBin];
+
+                if (peakValue <= maxValue) {
+                    continue;
+                }
+
+                isPeak = 0x01;
+
+                for (iWin = 1; iWin <= ((signed int) (obj->winSize)); iWin++) {
+
+                    if ((peakValue <= acorr[iBin - iWin]) || (peakValue <= acorr[iBin + iWin])) {
+
+                        isPeak = 0x00;
+                        break;
+
+                    }
+
+                }
+
+                if (isPeak == 0x01) {
+
+                    maxValue = peakValue;
+                    maxIndex = iBin;
+
+                    peakFound = 0x01;
+
+                }
+
+            }
+
+            if (peakFound == 0x01) {
+
+                RPrev = acorr[maxIndex - 1];
+                RNow = acorr[maxIndex];
+                RNext = acorr[maxIndex + 1];
+
+                pitches->array[iSignal] = scale * (((float) maxIndex) + ((RPrev - RNext) / (2*RPrev - 4*RNow + 2*RNext)));
+
+            }
+            else {
+
+                pitches->array[iSignal] = 0.0f;
+
+            }
+
+        }
+
+    }
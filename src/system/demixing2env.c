@@ -45,6 +45,12 @@
 
     void demixing2env_process(demixing2env_obj * obj, const tracks_obj * tracks, const demixings_obj * demixings, const masks_obj * masks, const envs_obj * envsChannel, envs_obj * envsSeparated) {
 
+        demixing2env_process_range(obj, tracks, demixings, masks, envsChannel, envsSeparated, 0, obj->halfFrameSize);
+
+    }
+
+    void demixing2env_process_range(demixing2env_obj * obj, const tracks_obj * tracks, const demixings_obj * demixings, const masks_obj * masks, const envs_obj * envsChannel, envs_obj * envsSeparated, const unsigned int iBinStart, const unsigned int iBinStop) {
+
         unsigned int iSep;
         unsigned int iChannel;
         unsigned int iBin;
@@ -63,7 +69,7 @@
 
             if (tracks->ids[iSep] != 0) {
 
-                memset(envsSeparated->array[iSep], 0x00, sizeof(float) * obj->halfFrameSize);
+                memset(&(envsSeparated->array[iSep][iBinStart]), 0x00, sizeof(float) * (iBinStop - iBinStart));
 
                 for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
 
@@ -71,7 +77,7 @@
 
                     if (masks->array[iSampleSC] == 1) {                       
 
-                        for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                        for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                             iSampleBC = iBin * obj->nChannels + iChannel;
                             iSampleB = iBin;
@@ -95,7 +101,7 @@
             }
             else {
 
-                memset(envsSeparated->array[iSep], 0x00, sizeof(float) * obj->halfFrameSize);
+                memset(&(envsSeparated->array[iSep][iBinStart]), 0x00, sizeof(float) * (iBinStop - iBinStart));
 
             }
 
@@ -45,6 +45,12 @@
 
     void demixing2freq_process(demixing2freq_obj * obj, const tracks_obj * tracks, const demixings_obj * demixings, const masks_obj * masks, const freqs_obj * freqsChannel, freqs_obj * freqsSeparated) {
 
+        demixing2freq_process_range(obj, tracks, demixings, masks, freqsChannel, freqsSeparated, 0, obj->halfFrameSize);
+
+    }
+
+    void demixing2freq_process_range(demixing2freq_obj * obj, const tracks_obj * tracks, const demixings_obj * demixings, const masks_obj * masks, const freqs_obj * freqsChannel, freqs_obj * freqsSeparated, const unsigned int iBinStart, const unsigned int iBinStop) {
+
         unsigned int iSep;
         unsigned int iChannel;
         unsigned int iBin;
@@ -64,7 +70,7 @@
 
             if (tracks->ids[iSep] != 0) {
 
-                memset(freqsSeparated->array[iSep], 0x00, sizeof(float) * obj->halfFrameSize * 2);
+                memset(&(freqsSeparated->array[iSep][iBinStart * 2]), 0x00, sizeof(float) * (iBinStop - iBinStart) * 2);
 
                 for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
 
@@ -72,7 +78,7 @@
 
                     if (masks->array[iSampleSC] == 1) {                       
 
-                        for (iBin = 0; iBin < obj->halfFrameSize; iBin++)                 {
+                        for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                             iSampleBC = iBin * obj->nChannels + iChannel;
                             iSampleB = iBin;
@@ -98,7 +104,7 @@
             }
             else {
 
-                memset(freqsSeparated->array[iSep], 0x00, sizeof(float) * obj->halfFrameSize * 2);
+                memset(&(freqsSeparated->array[iSep][iBinStart * 2]), 0x00, sizeof(float) * (iBinStop - iBinStart) * 2);
 
             }
 
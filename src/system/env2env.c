@@ -27,7 +27,9 @@
 
         env2env_mcra_obj * obj;
         unsigned int n;
-        unsigned int iChannel;
+        unsigned int iPosition;
+        unsigned int nPositions;
+        signed int iBinWrapped;
         float bTotal;
 
         obj = (env2env_mcra_obj *) malloc(sizeof(env2env_mcra_obj));
@@ -45,6 +47,14 @@
         memset(obj->idsPrev, 0x00, sizeof(unsigned long long) * nChannels);
         obj->l = (unsigned int *) malloc(sizeof(unsigned int) * nChannels);
         memset(obj->l, 0x00, sizeof(unsigned int) * nChannels);
+        obj->doProcess = (char *) malloc(sizeof(char) * nChannels);
+        memset(obj->doProcess, 0x00, sizeof(char) * nChannels);
+        obj->doReset = (char *) malloc(sizeof(char) * nChannels);
+        memset(obj->doReset, 0x00, sizeof(char) * nChannels);
+        obj->doRestart = (char *) malloc(sizeof(char) * nChannels);
+        memset(obj->doRestart, 0x00, sizeof(char) * nChannels);
+
+        bTotal = 0.0f;
 
         obj->b = (float *) malloc(sizeof(float) * bSize);
         for (n = 0; n < obj->bSize; n++) {
@@ -55,74 +65,69 @@
             obj->b[n] /= bTotal;
         }
 
-        obj->Sf = (float **) malloc(sizeof(float *) * obj->nChannels);
-        obj->S = (float **) malloc(sizeof(float *) * obj->nChannels);        
-        obj->SPrev = (float **) malloc(sizeof(float *) * obj->nChannels);
-        obj->Smin = (float **) malloc(sizeof(float *) * obj->nChannels);
-        obj->SminPrev = (float **) malloc(sizeof(float *) * obj->nChannels);
-        obj->Stmp = (float **) malloc(sizeof(float *) * obj->nChannels);
-        obj->StmpPrev = (float **) malloc(sizeof(float *) * obj->nChannels);
-        obj->lambdaD = (float **) malloc(sizeof(float *) * obj->nChannels);
-        obj->lambdaDnext = (float **) malloc(sizeof(float *) * obj->nChannels);
+        // The smoothing window is centered on each bin and mirrored at both ends of the spectrum.
+        // Position (iBin + n) maps to the bin read by tap n, so the edges need no test at run time,
+        // and the bins in [iBinInnerStart, iBinInnerStop) read their neighbours directly.
 
-        for (iChannel = 0; iChannel < nChannels; iChannel++) {
+        nPositions = halfFrameSize + bSize - 1;
+        obj->wraps = (unsigned int *) malloc(sizeof(unsigned int) * nPositions);
+
+        for (iPosition = 0; iPosition < nPositions; iPosition++) {
+
+            iBinWrapped = ((signed int) iPosition) - ((signed int) ((bSize-1)/2));
+
+            if (iBinWrapped < 0) {
+                iBinWrapped = -1 * iBinWrapped;
+            }
+            if (iBinWrapped >= ((signed int) halfFrameSize)) {
+                iBinWrapped = 2*(halfFrameSize-1) - iBinWrapped;
+            }
 
-            obj->Sf[iChannel] = (float *) malloc(sizeof(float) * halfFrameSize);
-            memset(obj->Sf[iChannel], 0x00, sizeof(float) * halfFrameSize);
-            obj->S[iChannel] = (float *) malloc(sizeof(float) * halfFrameSize);
-            memset(obj->S[iChannel], 0x00, sizeof(float) * halfFrameSize);
-            obj->SPrev[iChannel] = (float *) malloc(sizeof(float) * halfFrameSize);
-            memset(obj->SPrev[iChannel], 0x00, sizeof(float) * halfFrameSize);
-            obj->Smin[iChannel] = (float *) malloc(sizeof(float) * halfFrameSize);
-            memset(obj->Smin[iChannel], 0x00, sizeof(float) * halfFrameSize);
-            obj->SminPrev[iChannel] = (float *) malloc(sizeof(float) * halfFrameSize);
-            memset(obj->SminPrev[iChannel], 0x00, sizeof(float) * halfFrameSize);
-            obj->Stmp[iChannel] = (float *) malloc(sizeof(float) * halfFrameSize);
-            memset(obj->Stmp[iChannel], 0x00, sizeof(float) * halfFrameSize);
-            obj->StmpPrev[iChannel] = (float *) malloc(sizeof(float) * halfFrameSize);
-            memset(obj->StmpPrev[iChannel], 0x00, sizeof(float) * halfFrameSize);
-            obj->lambdaD[iChannel] = (float *) malloc(sizeof(float) * halfFrameSize);
-            memset(obj->lambdaD[iChannel], 0x00, sizeof(float) * halfFrameSize);
-            obj->lambdaDnext[iChannel] = (float *) malloc(sizeof(float) * halfFrameSize);
-            memset(obj->lambdaDnext[iChannel], 0x00, sizeof(float) * halfFrameSize);
+            obj->wraps[iPosition] = (unsigned int) iBinWrapped;
 
         }
 
+        obj->iBinInnerStart = (bSize-1)/2;
+
+        if (halfFrameSize > (bSize - 1)) {
+            obj->iBinInnerStop = halfFrameSize - ((bSize-1) - (bSize-1)/2);
+        }
+        else {
+            obj->iBinInnerStop = obj->iBinInnerStart;
+        }
+
+        // One contiguous block per state, channels one after the other
+
+        obj->Sf = (float *) malloc(sizeof(float) * nChannels * halfFrameSize);
+        memset(obj->Sf, 0x00, sizeof(float) * nChannels * halfFrameSize);
+        obj->S = (float *) malloc(sizeof(float) * nChannels * halfFrameSize);
+        memset(obj->S, 0x00, sizeof(float) * nChannels * halfFrameSize);
+        obj->Smin = (float *) malloc(sizeof(float) * nChannels * halfFrameSize);
+        memset(obj->Smin, 0x00, sizeof(float) * nChannels * halfFrameSize);
+        obj->Stmp = (float *) malloc(sizeof(float) * nChannels * halfFrameSize);
+        memset(obj->Stmp, 0x00, sizeof(float) * nChannels * halfFrameSize);
+        obj->lambdaD = (float *) malloc(sizeof(float) * nChannels * halfFrameSize);
+        memset(obj->lambdaD, 0x00, sizeof(float) * nChannels * halfFrameSize);
+
         return obj;
 
     }
 
     void env2env_mcra_destroy(env2env_mcra_obj * obj) {
 
-        unsigned iChannel;
-
         free((void *) obj->idsPrev);
         free((void *) obj->l);
+        free((void *) obj->doProcess);
+        free((void *) obj->doReset);
+        free((void *) obj->doRestart);
         free((void *) obj->b);
-
-        for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
-
-            free((void *) obj->Sf[iChannel]);
-            free((void *) obj->S[iChannel]);
-            free((void *) obj->SPrev[iChannel]);
-            free((void *) obj->Smin[iChannel]);
-            free((void *) obj->SminPrev[iChannel]);
-            free((void *) obj->Stmp[iChannel]);
-            free((void *) obj->StmpPrev[iChannel]);
-            free((void *) obj->lambdaD[iChannel]);
-            free((void *) obj->lambdaDnext[iChannel]);
-
-        }
+        free((void *) obj->wraps);
 
         free((void *) obj->Sf);
         free((void *) obj->S);
-        free((void *) obj->SPrev);
         free((void *) obj->Smin);
-        free((void *) obj->SminPrev);
         free((void *) obj->Stmp);
-        free((void *) obj->StmpPrev);
         free((void *) obj->lambdaD);
-        free((void *) obj->lambdaDnext);
 
         free((void *) obj);
 
@@ -130,14 +135,14 @@
 
     void env2env_mcra_process(env2env_mcra_obj * obj, const tracks_obj * tracks, const envs_obj * noisys, const envs_obj * estNoises, envs_obj * noises) {
 
-        unsigned int iChannel;
-        unsigned int iBin;
-        signed int iSample;
-        signed int iBinWrapped;
-        float sample;
+        env2env_mcra_process_prepare(obj, tracks);
+        env2env_mcra_process_range(obj, noisys, estNoises, noises, 0, obj->halfFrameSize);
 
-        char doProcess;
-        char doReset;
+    }
+
+    void env2env_mcra_process_prepare(env2env_mcra_obj * obj, const tracks_obj * tracks) {
+
+        unsigned int iChannel;
 
         for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
 
@@ -147,22 +152,22 @@
 
                     if (obj->idsPrev[iChannel] != 0) {
 
-                        doProcess = 0x01;
-                        doReset = 0x00;
+                        obj->doProcess[iChannel] = 0x01;
+                        obj->doReset[iChannel] = 0x00;
 
                     }
                     else {
 
-                        doProcess = 0x01;
-                        doReset = 0x01;
+                        obj->doProcess[iChannel] = 0x01;
+                        obj->doReset[iChannel] = 0x01;
 
                     }
 
                 }
                 else {
 
-                    doProcess = 0x00;
-                    doReset = 0x00;
+                    obj->doProcess[iChannel] = 0x00;
+                    obj->doReset[iChannel] = 0x00;
 
                 }
 
@@ -171,146 +176,170 @@
             }
             else {
 
-                doProcess = 0x01;
-                doReset = 0x00;
+                obj->doProcess[iChannel] = 0x01;
+                obj->doReset[iChannel] = 0x00;
 
             }
 
-            if (doReset == 0x01) {
+            if (obj->doReset[iChannel] == 0x01) {
 
                 obj->l[iChannel] = 0; 
 
-                if (estNoises != NULL) {
+            }
+
+            if (obj->doProcess[iChannel] == 0x01) {
 
-                    memcpy(obj->Sf[iChannel], estNoises->array[iChannel], sizeof(float) * obj->halfFrameSize);
-                    memcpy(obj->S[iChannel], estNoises->array[iChannel], sizeof(float) * obj->halfFrameSize);
-                    memcpy(obj->SPrev[iChannel], estNoises->array[iChannel], sizeof(float) * obj->halfFrameSize);
-                    memcpy(obj->Smin[iChannel], estNoises->array[iChannel], sizeof(float) * obj->halfFrameSize);
-                    memcpy(obj->SminPrev[iChannel], estNoises->array[iChannel], sizeof(float) * obj->halfFrameSize);
-                    memcpy(obj->Stmp[iChannel], estNoises->array[iChannel], sizeof(float) * obj->halfFrameSize);
-                    memcpy(obj->StmpPrev[iChannel], estNoises->array[iChannel], sizeof(float) * obj->halfFrameSize);
-                    memcpy(obj->lambdaD[iChannel], estNoises->array[iChannel], sizeof(float) * obj->halfFrameSize);
-                    memcpy(obj->lambdaDnext[iChannel], estNoises->array[iChannel], sizeof(float) * obj->halfFrameSize);
+                if (obj->l[iChannel] <= obj->L) {
+
+                    // Keep tracking the minimum, and count frames
+
+                    obj->doRestart[iChannel] = 0x00;
+                    (obj->l[iChannel])++;       
 
                 }
                 else {
 
-                    memset(obj->Sf[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                    memset(obj->S[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                    memset(obj->SPrev[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                    memset(obj->Smin[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                    memset(obj->SminPrev[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                    memset(obj->Stmp[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                    memset(obj->StmpPrev[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                    memset(obj->lambdaD[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                    memset(obj->lambdaDnext[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+                    // Restart the minimum search, and reset frame counter
+
+                    obj->doRestart[iChannel] = 0x01;
+                    obj->l[iChannel] = 0;
 
                 }
 
             }
 
-            if (doProcess == 0x01) {
-
-                //           N-1
-                //           +--
-                // Sf_l[k] = >   b[n] |X_l[k+n-(N-1)/2]|^2
-                //           +--
-                //           n=0
+        }
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+    }
 
-                    sample = 0.0f;
+    void env2env_mcra_process_range(env2env_mcra_obj * obj, const envs_obj * noisys, const envs_obj * estNoises, envs_obj * noises, const unsigned int iBinStart, const unsigned int iBinStop) {
 
-                    for (iSample = 0; iSample < obj->bSize; iSample++) {
+        unsigned int iChannel;
+        unsigned int iBin;
+        unsigned int iSample;
+        unsigned int nBins;
+        unsigned int iBinInnerStart;
+        unsigned int iBinInnerStop;
+
+        const float * noisy;
+        float * noise;
+        float * Sf;
+        float * S;
+        float * Smin;
+        float * Stmp;
+        float * lambdaD;
+
+        float b;
+        float sample;
+        float Snow;
+        float lambdaDnext;
+        float oneMinusAlphaS;
+        float oneMinusAlphaD;
 
-                        iBinWrapped = ((signed int) iBin) + iSample - ((signed int) ((obj->bSize-1)/2));
+        nBins = iBinStop - iBinStart;
 
-                        if (iBinWrapped < 0) {
-                            iBinWrapped = -1 * iBinWrapped;
-                        }
-                        if (iBinWrapped >= ((signed int) obj->halfFrameSize)) {
-                            iBinWrapped = 2*(obj->halfFrameSize-1) - iBinWrapped;
-                        }
+        oneMinusAlphaS = 1 - obj->alphaS;
+        oneMinusAlphaD = 1.0f - obj->alphaD;
 
-                        sample += obj->b[iSample] * noisys->array[iChannel][iBinWrapped];
+        iBinInnerStart = (iBinStart > obj->iBinInnerStart) ? iBinStart : obj->iBinInnerStart;
+        iBinInnerStop = (iBinStop < obj->iBinInnerStop) ? iBinStop : obj->iBinInnerStop;
 
-                    }
+        if (iBinInnerStop < iBinInnerStart) {
+            iBinInnerStop = iBinInnerStart;
+        }
 
-                    obj->Sf[iChannel][iBin] = sample;
+        for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
 
-                }
+            noisy = noisys->array[iChannel];
+            noise = noises->array[iChannel];
+            Sf = &(obj->Sf[iChannel * obj->halfFrameSize]);
+            S = &(obj->S[iChannel * obj->halfFrameSize]);
+            Smin = &(obj->Smin[iChannel * obj->halfFrameSize]);
+            Stmp = &(obj->Stmp[iChannel * obj->halfFrameSize]);
+            lambdaD = &(obj->lambdaD[iChannel * obj->halfFrameSize]);
 
-                //
-                // S_l[k] = (1 - alphaS) * S_l-1[k] + alphaS * Sf_l[k]
-                //
+            if (obj->doReset[iChannel] == 0x01) {
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                if (estNoises != NULL) {
 
-                    obj->S[iChannel][iBin] = (1 - obj->alphaS) * obj->SPrev[iChannel][iBin] + obj->alphaS * obj->Sf[iChannel][iBin];
+                    memcpy(&(S[iBinStart]), &(estNoises->array[iChannel][iBinStart]), sizeof(float) * nBins);
+                    memcpy(&(Smin[iBinStart]), &(estNoises->array[iChannel][iBinStart]), sizeof(float) * nBins);
+                    memcpy(&(Stmp[iBinStart]), &(estNoises->array[iChannel][iBinStart]), sizeof(float) * nBins);
+                    memcpy(&(lambdaD[iBinStart]), &(estNoises->array[iChannel][iBinStart]), sizeof(float) * nBins);
 
                 }
+                else {
 
-                //                                     \
-                // Smin_l[k] = min{Smin_l-1[k],S_l[k]} | l < L 
-                // Stmp_l[k] = min{Stmp_l-1[k],S_l[k]} |
-                //                                     / 
-                //                                     \
-                // Smin_l[k] = min{Stmp_l-1[k],S_l[k]} | l = L
-                // Stmp_l[k] = S_l[k]                  |
-                //                                     /
+                    memset(&(S[iBinStart]), 0x00, sizeof(float) * nBins);
+                    memset(&(Smin[iBinStart]), 0x00, sizeof(float) * nBins);
+                    memset(&(Stmp[iBinStart]), 0x00, sizeof(float) * nBins);
+                    memset(&(lambdaD[iBinStart]), 0x00, sizeof(float) * nBins);
 
-                if (obj->l[iChannel] <= obj->L) {
+                }
 
-                    // Smin_l[k] = min{Smin_l-1[k],S_l[k]}
-                    // Stmp_l[k] = min{Stmp_l-1[k],S_l[k]}
+            }
 
-                    for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+            if (obj->doProcess[iChannel] == 0x01) {
 
-                        if (obj->SminPrev[iChannel][iBin] < obj->S[iChannel][iBin]) {
-                            obj->Smin[iChannel][iBin] = obj->SminPrev[iChannel][iBin];
-                        }
-                        else {
-                            obj->Smin[iChannel][iBin] = obj->S[iChannel][iBin];
-                        }
+                //           N-1
+                //           +--
+                // Sf_l[k] = >   b[n] |X_l[k+n-(N-1)/2]|^2
+                //           +--
+                //           n=0
+                //
+                // Taps are accumulated in the same order for every bin. Bins near the edges go
+                // through the precomputed mirrored positions, the others read their neighbours
+                // directly, one tap at a time over all bins.
 
-                        if (obj->StmpPrev[iChannel][iBin] < obj->S[iChannel][iBin]) {
-                            obj->Stmp[iChannel][iBin] = obj->StmpPrev[iChannel][iBin];
-                        }
-                        else {
-                            obj->Stmp[iChannel][iBin] = obj->S[iChannel][iBin];
-                        }
+                for (iBin = iBinStart; iBin < iBinInnerStart; iBin++) {
 
+                    sample = 0.0f;
+
+                    for (iSample = 0; iSample < obj->bSize; iSample++) {
+                        sample += obj->b[iSample] * noisy[obj->wraps[iBin + iSample]];
                     }
 
-                    // Count frames
+                    Sf[iBin] = sample;
 
-                    (obj->l[iChannel])++;       
+                }
 
+                for (iBin = iBinInnerStart; iBin < iBinInnerStop; iBin++) {
+                    Sf[iBin] = 0.0f;
                 }
-                else {
 
-                    // Smin_l[k] = min{Stmp_l-1[k],S_l[k]}
-                    // Stmp_l[k] = S_l[k]
+                for (iSample = 0; iSample < obj->bSize; iSample++) {
 
-                    for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                    b = obj->b[iSample];
 
-                        if (obj->StmpPrev[iChannel][iBin] < obj->S[iChannel][iBin]) {
-                            obj->Smin[iChannel][iBin] = obj->StmpPrev[iChannel][iBin];
-                        }
-                        else {
-                            obj->Smin[iChannel][iBin] = obj->S[iChannel][iBin];
-                        }
+                    for (iBin = iBinInnerStart; iBin < iBinInnerStop; iBin++) {
+                        Sf[iBin] += b * noisy[iBin + iSample - obj->iBinInnerStart];
+                    }
 
-                        obj->Stmp[iChannel][iBin] = obj->S[iChannel][iBin];
+                }
 
-                    }
+                for (iBin = iBinInnerStop; iBin < iBinStop; iBin++) {
 
-                    // Reset frame counter
+                    sample = 0.0f;
 
-                    obj->l[iChannel] = 0;
+                    for (iSample = 0; iSample < obj->bSize; iSample++) {
+                        sample += obj->b[iSample] * noisy[obj->wraps[iBin + iSample]];
+                    }
+
+                    Sf[iBin] = sample;
 
                 }
 
+                //
+                // S_l[k] = (1 - alphaS) * S_l-1[k] + alphaS * Sf_l[k]
+                //
+                //                                     \
+                // Smin_l[k] = min{Smin_l-1[k],S_l[k]} | l < L 
+                // Stmp_l[k] = min{Stmp_l-1[k],S_l[k]} |
+                //                                     / 
+                //                                     \
+                // Smin_l[k] = min{Stmp_l-1[k],S_l[k]} | l = L
+                // Stmp_l[k] = S_l[k]                  |
+                //                                     /
                 //                                                                  \
                 //                                                                  | S_l[k] < Smin_l[k] * delta
                 // lambdaD_l+1[k] = (1-alphaD) * lambdaD_l[k] + alphaD * |Y_l[k]|^2 | lambdaD_l[k] > |Y_l[k]|^2
@@ -319,35 +348,45 @@
                 //
                 // lambdaD_l+1[k] = lambdaD_l[k]                                    otherwise
                 //
+                // Each state only depends on its own previous value at the same bin, so it is 
+                // updated in place, in a single pass without branches in the loop body.
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                if (obj->doRestart[iChannel] == 0x00) {
+
+                    for (iBin = iBinStart; iBin < iBinStop; iBin++) {
+
+                        Snow = oneMinusAlphaS * S[iBin] + obj->alphaS * Sf[iBin];
 
-                    if ((obj->S[iChannel][iBin] < (obj->Smin[iChannel][iBin] * obj->delta)) || (obj->lambdaD[iChannel][iBin] > obj->S[iChannel][iBin])) {
+                        Smin[iBin] = (Smin[iBin] < Snow) ? Smin[iBin] : Snow;
+                        Stmp[iBin] = (Stmp[iBin] < Snow) ? Stmp[iBin] : Snow;
 
-                        obj->lambdaDnext[iChannel][iBin] = (1.0f - obj->alphaD) * obj->lambdaD[iChannel][iBin] + obj->alphaD * noisys->array[iChannel][iBin];
+                        lambdaDnext = oneMinusAlphaD * lambdaD[iBin] + obj->alphaD * noisy[iBin];
+                        lambdaD[iBin] = ((Snow < (Smin[iBin] * obj->delta)) || (lambdaD[iBin] > Snow)) ? lambdaDnext : lambdaD[iBin];
+
+                        S[iBin] = Snow;
+                        noise[iBin] = lambdaD[iBin];
 
                     }
 
                 }
+                else {
 
+                    for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
-                // Copy to output
+                        Snow = oneMinusAlphaS * S[iBin] + obj->alphaS * Sf[iBin];
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                        Smin[iBin] = (Stmp[iBin] < Snow) ? Stmp[iBin] : Snow;
+                        Stmp[iBin] = Snow;
 
-                    noises->array[iChannel][iBin] = obj->lambdaDnext[iChannel][iBin];
+                        lambdaDnext = oneMinusAlphaD * lambdaD[iBin] + obj->alphaD * noisy[iBin];
+                        lambdaD[iBin] = ((Snow < (Smin[iBin] * obj->delta)) || (lambdaD[iBin] > Snow)) ? lambdaDnext : lambdaD[iBin];
 
-                }
+                        S[iBin] = Snow;
+                        noise[iBin] = lambdaD[iBin];
 
-                // Smin_l-1 = Smin_l
-                // S_l-1 = S_l
-                // Stmp_l-1 = Stmp_l
-                // lambdaD_l = lambdaD_l+1
+                    }
 
-                memcpy(obj->SminPrev[iChannel], obj->Smin[iChannel], sizeof(float) * obj->halfFrameSize);
-                memcpy(obj->SPrev[iChannel], obj->S[iChannel], sizeof(float) * obj->halfFrameSize);
-                memcpy(obj->StmpPrev[iChannel], obj->Stmp[iChannel], sizeof(float) * obj->halfFrameSize);
-                memcpy(obj->lambdaD[iChannel], obj->lambdaDnext[iChannel], sizeof(float) * obj->halfFrameSize);
+                }
 
             }
 
@@ -511,28 +550,37 @@
 
     void env2env_interf_process(env2env_interf_obj * obj, const tracks_obj * tracks, const envs_obj * seps, const envs_obj * noises, envs_obj * interfs) {
 
+        env2env_interf_process_range(obj, tracks, seps, noises, interfs, 0, obj->halfFrameSize);
+
+    }
+
+    void env2env_interf_process_range(env2env_interf_obj * obj, const tracks_obj * tracks, const envs_obj * seps, const envs_obj * noises, envs_obj * interfs, const unsigned int iBinStart, const unsigned int iBinStop) {
+
         unsigned int iChannel1;
         unsigned int iChannel2;
         unsigned int iChannel;
         unsigned int iBin;
+        unsigned int nBins;
+
+        nBins = iBinStop - iBinStart;
 
         for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
 
             if (tracks->ids[iChannel] != 0) {
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                     obj->Zs[iChannel][iBin] = (1.0f - obj->alphaZ) * obj->ZsPrev[iChannel][iBin] + obj->alphaZ * seps->array[iChannel][iBin];
 
                 }
 
-                memcpy(obj->ZsPrev[iChannel], obj->Zs[iChannel], sizeof(float)*obj->halfFrameSize);
+                memcpy(&(obj->ZsPrev[iChannel][iBinStart]), &(obj->Zs[iChannel][iBinStart]), sizeof(float) * nBins);
 
             }
             else {
 
-                memset(obj->Zs[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->ZsPrev[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+                memset(&(obj->Zs[iChannel][iBinStart]), 0x00, sizeof(float) * nBins);
+                memset(&(obj->ZsPrev[iChannel][iBinStart]), 0x00, sizeof(float) * nBins);
 
             }
 
@@ -542,7 +590,7 @@
 
             if (tracks->ids[iChannel1] != 0) {
 
-                memset(interfs->array[iChannel1], 0x00, sizeof(float) * obj->halfFrameSize);
+                memset(&(interfs->array[iChannel1][iBinStart]), 0x00, sizeof(float) * nBins);
 
                 for (iChannel2 = 0; iChannel2 < obj->nChannels; iChannel2++) {
 
@@ -550,7 +598,7 @@
 
                         if (iChannel1 != iChannel2) {
 
-                            for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                            for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                                 interfs->array[iChannel1][iBin] += obj->Zs[iChannel2][iBin] * obj->eta;
 
@@ -562,7 +610,7 @@
 
                 }
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                     interfs->array[iChannel1][iBin] += noises->array[iChannel1][iBin];
 
@@ -571,7 +619,7 @@
             }
             else {
 
-                memset(interfs->array[iChannel1], 0x00, sizeof(float) * obj->halfFrameSize);
+                memset(&(interfs->array[iChannel1][iBinStart]), 0x00, sizeof(float) * nBins);
 
             }
 
@@ -647,12 +695,21 @@
 
     void env2env_gainspeech_process(env2env_gainspeech_obj * obj, const tracks_obj * tracks, const envs_obj * seps, const envs_obj * noises, envs_obj * gains, envs_obj * snrs, envs_obj * vs) {
 
+        env2env_gainspeech_process_range(obj, tracks, seps, noises, gains, snrs, vs, 0, obj->halfFrameSize);
+
+    }
+
+    void env2env_gainspeech_process_range(env2env_gainspeech_obj * obj, const tracks_obj * tracks, const envs_obj * seps, const envs_obj * noises, envs_obj * gains, envs_obj * snrs, envs_obj * vs, const unsigned int iBinStart, const unsigned int iBinStop) {
+
         unsigned int iChannel;
         unsigned int iBin;
+        unsigned int nBins;
         float xi_over_xi_plus_1;
         float max_gamma_minus_1_vs_0;
         float GH1_2;
 
+        nBins = iBinStop - iBinStart;
+
         for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
 
             if (tracks->ids[iChannel] != 0) {
@@ -661,7 +718,7 @@
                 // gamma_l[k] = |Y_l(k)|^2 / (lambda_l[k] + epsilon)
                 //
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                     obj->gamma[iChannel][iBin] = seps->array[iChannel][iBin] / (noises->array[iChannel][iBin] + obj->epsilon);
 
@@ -671,7 +728,7 @@
                 // alphaP_l[k] = min{(xi_l-1[k] / (xi_l-1[k] + 1))^2 + alphaPmin, 1.0}
                 //
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                     xi_over_xi_plus_1 = obj->xi[iChannel][iBin] / (obj->xi[iChannel][iBin] + 1.0f);
 
@@ -687,7 +744,7 @@
                 // xi_l[k] = (1 - alphaP_l[k]) * (GH1_l-1[k])^2 * gamma_l[k] + alphaP_l[k] * max{gamma_l[k]-1,0}
                 //
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                     if ((obj->gamma[iChannel][iBin] - 1.0f) < 0.0f) {
                         max_gamma_minus_1_vs_0 = 0.0f;
@@ -706,7 +763,7 @@
                 // v_l[k] = gamma_l[k] * xi_l[k] / (xi_l[k] + 1)
                 //
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                     obj->v[iChannel][iBin] = obj->gamma[iChannel][iBin] * obj->xi[iChannel][iBin] / (obj->xi[iChannel][iBin] + 1.0f);
 
@@ -716,7 +773,7 @@
                 // GH1_l[k] = (xi_l[k] / (xi_l[k] + 1)) * fcn(v_l[k])
                 //
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                     obj->GH1[iChannel][iBin] = (obj->xi[iChannel][iBin] / (obj->xi[iChannel][iBin] + 1.0f)) * transcendental_process(obj->transcendental, obj->v[iChannel][iBin]);
 
@@ -726,22 +783,22 @@
 
                 }
 
-                memcpy(gains->array[iChannel],obj->GH1[iChannel],sizeof(float) * obj->halfFrameSize);
-                memcpy(snrs->array[iChannel],obj->xi[iChannel],sizeof(float) * obj->halfFrameSize);
-                memcpy(vs->array[iChannel],obj->v[iChannel],sizeof(float) * obj->halfFrameSize);
+                memcpy(&(gains->array[iChannel][iBinStart]), &(obj->GH1[iChannel][iBinStart]), sizeof(float) * nBins);
+                memcpy(&(snrs->array[iChannel][iBinStart]), &(obj->xi[iChannel][iBinStart]), sizeof(float) * nBins);
+                memcpy(&(vs->array[iChannel][iBinStart]), &(obj->v[iChannel][iBinStart]), sizeof(float) * nBins);
 
             }
             else {
 
-                memset(obj->gamma[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->alphaP[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->xi[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->GH1[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->v[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+                memset(&(obj->gamma[iChannel][iBinStart]), 0x00, sizeof(float) * nBins);
+                memset(&(obj->alphaP[iChannel][iBinStart]), 0x00, sizeof(float) * nBins);
+                memset(&(obj->xi[iChannel][iBinStart]), 0x00, sizeof(float) * nBins);
+                memset(&(obj->GH1[iChannel][iBinStart]), 0x00, sizeof(float) * nBins);
+                memset(&(obj->v[iChannel][iBinStart]), 0x00, sizeof(float) * nBins);
 
-                memset(gains->array[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(snrs->array[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(vs->array[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+                memset(&(gains->array[iChannel][iBinStart]), 0x00, sizeof(float) * nBins);
+                memset(&(snrs->array[iChannel][iBinStart]), 0x00, sizeof(float) * nBins);
+                memset(&(vs->array[iChannel][iBinStart]), 0x00, sizeof(float) * nBins);
 
             }            
 
@@ -749,7 +806,7 @@
 
     }
 
-    env2env_probspeech_obj * env2env_probspeech_construct_zero(const unsigned int nChannels, const unsigned int halfFrameSize, const float theta, const float alpha, const float maxAbsenceProb, const float Gmin, const unsigned int winSizeLocal, const unsigned int winSizeGlobal, const unsigned int winSizeFrame) {
+    env2env_probspeech_obj * env2env_probspeech_construct_zero(const unsigned int nChannels, const unsigned int halfFrameSize, const float theta, const float alpha, const float maxAbsenceProb, const float Gmin, const unsigned int winSizeLocal, const unsigned int winSizeGlobal, const unsigned int winSizeFrame, const char math) {
 
         env2env_probspeech_obj * obj;
         unsigned int iSample;
@@ -770,9 +827,16 @@
         obj->winSizeLocal = winSizeLocal;
         obj->winSizeGlobal = winSizeGlobal;
         obj->winSizeFrame = winSizeFrame;
+        obj->math = math;
 
         obj->fft = fft_construct(obj->frameSize);
 
+        obj->ffts = (fft_obj **) malloc(sizeof(fft_obj *) * nChannels);
+
+        for (iChannel = 0; iChannel < nChannels; iChannel++) {
+            obj->ffts[iChannel] = fft_construct(obj->frameSize);
+        }
+
         obj->winLocal = (float *) malloc(sizeof(float) * winSizeLocal);
         memset(obj->winLocal, 0x00, sizeof(float) * winSizeLocal);
         obj->winGlobal = (float *) malloc(sizeof(float) * winSizeGlobal);
@@ -976,6 +1040,12 @@
 
         fft_destroy(obj->fft);
 
+        for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+            fft_destroy(obj->ffts[iChannel]);
+        }
+
+        free((void *) obj->ffts);
+
         free((void *) obj->winLocal);
         free((void *) obj->winGlobal);
         free((void *) obj->winFrame);
@@ -1053,6 +1123,17 @@
     void env2env_probspeech_process(env2env_probspeech_obj * obj, const tracks_obj * tracks, const envs_obj * snrs, const envs_obj * vs, envs_obj * probspeechs) {
 
         unsigned int iChannel;
+
+        for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+
+            env2env_probspeech_process_channel(obj, tracks, snrs, vs, probspeechs, iChannel);
+
+        }
+
+    }
+
+    void env2env_probspeech_process_channel(env2env_probspeech_obj * obj, const tracks_obj * tracks, const envs_obj * snrs, const envs_obj * vs, envs_obj * probspeechs, const unsigned int iChannel) {
+
         unsigned int iBin;
         
         float hLocalReal;
@@ -1074,118 +1155,135 @@
         float theta_zeta;
         float PLocalGlobalFrame;
 
-        for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+        if (tracks->ids[iChannel] != 0) {
 
-            if (tracks->ids[iChannel] != 0) {
+            //
+            // Circular convolution with local, global and frame windows
+            //
 
-                //
-                // Circular convolution with local, global and frame windows
-                //
+            obj->xiTime[iChannel][0] = snrs->array[iChannel][0];
+            obj->xiTime[iChannel][obj->halfFrameSize-1] = snrs->array[iChannel][obj->halfFrameSize-1];
+
+            for (iBin = 1; iBin < (obj->halfFrameSize-1); iBin++) {
 
-                obj->xiTime[iChannel][0] = snrs->array[iChannel][0];
-                obj->xiTime[iChannel][obj->halfFrameSize-1] = snrs->array[iChannel][obj->halfFrameSize-1];
+                obj->xiTime[iChannel][iBin] = snrs->array[iChannel][iBin];
+                obj->xiTime[iChannel][obj->frameSize-iBin] = snrs->array[iChannel][iBin];
 
-                for (iBin = 1; iBin < (obj->halfFrameSize-1); iBin++) {
+            }
 
-                    obj->xiTime[iChannel][iBin] = snrs->array[iChannel][iBin];
-                    obj->xiTime[iChannel][obj->frameSize-iBin] = snrs->array[iChannel][iBin];
+            fft_r2c(obj->ffts[iChannel], obj->xiTime[iChannel], obj->xiFreq[iChannel]);
+
+            for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+
+                hLocalReal = obj->winLocalShiftedFreq[iBin*2+0];
+                hLocalImag = obj->winLocalShiftedFreq[iBin*2+1];
+                hGlobalReal = obj->winGlobalShiftedFreq[iBin*2+0];
+                hGlobalImag = obj->winGlobalShiftedFreq[iBin*2+1];
+                hFrameReal = obj->winFrameShiftedFreq[iBin*2+0];
+                hFrameImag = obj->winFrameShiftedFreq[iBin*2+1];
+                xiReal = obj->xiFreq[iChannel][iBin*2+0];
+                xiImag = obj->xiFreq[iChannel][iBin*2+1];
+
+                hLocalxiReal = hLocalReal * xiReal - hLocalImag * xiImag;
+                hLocalxiImag = hLocalReal * xiImag + hLocalImag * xiReal;
+                hGlobalxiReal = hGlobalReal * xiReal - hGlobalImag * xiImag;
+                hGlobalxiImag = hGlobalReal * xiImag + hGlobalImag * xiReal;
+                hFramexiReal = hFrameReal * xiReal - hFrameImag * xiImag;
+                hFramexiImag = hFrameReal * xiImag + hFrameImag * xiReal;
+
+                obj->xiSmoothedLocalFreq[iChannel][iBin*2+0] = hLocalxiReal;
+                obj->xiSmoothedLocalFreq[iChannel][iBin*2+1] = hLocalxiImag;
+                obj->xiSmoothedGlobalFreq[iChannel][iBin*2+0] = hGlobalxiReal;
+                obj->xiSmoothedGlobalFreq[iChannel][iBin*2+1] = hGlobalxiImag;
+                obj->xiSmoothedFrameFreq[iChannel][iBin*2+0] = hFramexiReal;
+                obj->xiSmoothedFrameFreq[iChannel][iBin*2+1] = hFramexiImag;
 
-                }
+            }
 
-                fft_r2c(obj->fft, obj->xiTime[iChannel], obj->xiFreq[iChannel]);
+            fft_c2r(obj->ffts[iChannel], obj->xiSmoothedLocalFreq[iChannel], obj->xiSmoothedLocalTime[iChannel]);
+            fft_c2r(obj->ffts[iChannel], obj->xiSmoothedGlobalFreq[iChannel], obj->xiSmoothedGlobalTime[iChannel]);
+            fft_c2r(obj->ffts[iChannel], obj->xiSmoothedFrameFreq[iChannel], obj->xiSmoothedFrameTime[iChannel]);
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+            for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
 
-                    hLocalReal = obj->winLocalShiftedFreq[iBin*2+0];
-                    hLocalImag = obj->winLocalShiftedFreq[iBin*2+1];
-                    hGlobalReal = obj->winGlobalShiftedFreq[iBin*2+0];
-                    hGlobalImag = obj->winGlobalShiftedFreq[iBin*2+1];
-                    hFrameReal = obj->winFrameShiftedFreq[iBin*2+0];
-                    hFrameImag = obj->winFrameShiftedFreq[iBin*2+1];
-                    xiReal = obj->xiFreq[iChannel][iBin*2+0];
-                    xiImag = obj->xiFreq[iChannel][iBin*2+1];
-
-                    hLocalxiReal = hLocalReal * xiReal - hLocalImag * xiImag;
-                    hLocalxiImag = hLocalReal * xiImag + hLocalImag * xiReal;
-                    hGlobalxiReal = hGlobalReal * xiReal - hGlobalImag * xiImag;
-                    hGlobalxiImag = hGlobalReal * xiImag + hGlobalImag * xiReal;
-                    hFramexiReal = hFrameReal * xiReal - hFrameImag * xiImag;
-                    hFramexiImag = hFrameReal * xiImag + hFrameImag * xiReal;
-
-                    obj->xiSmoothedLocalFreq[iChannel][iBin*2+0] = hLocalxiReal;
-                    obj->xiSmoothedLocalFreq[iChannel][iBin*2+1] = hLocalxiImag;
-                    obj->xiSmoothedGlobalFreq[iChannel][iBin*2+0] = hGlobalxiReal;
-                    obj->xiSmoothedGlobalFreq[iChannel][iBin*2+1] = hGlobalxiImag;
-                    obj->xiSmoothedFrameFreq[iChannel][iBin*2+0] = hFramexiReal;
-                    obj->xiSmoothedFrameFreq[iChannel][iBin*2+1] = hFramexiImag;
+                obj->xiSmoothedLocal[iChannel][iBin] = obj->xiSmoothedLocalTime[iChannel][iBin];
+                obj->xiSmoothedGlobal[iChannel][iBin] = obj->xiSmoothedGlobalTime[iChannel][iBin];
+                obj->xiSmoothedFrame[iChannel][iBin] = obj->xiSmoothedFrameTime[iChannel][iBin];
 
-                }
+            }    
 
-                fft_c2r(obj->fft, obj->xiSmoothedLocalFreq[iChannel], obj->xiSmoothedLocalTime[iChannel]);
-                fft_c2r(obj->fft, obj->xiSmoothedGlobalFreq[iChannel], obj->xiSmoothedGlobalTime[iChannel]);
-                fft_c2r(obj->fft, obj->xiSmoothedFrameFreq[iChannel], obj->xiSmoothedFrameTime[iChannel]);
+            //
+            // zeta_l(k) = (1 - alpha) * zeta_l-1(k) + alpha * xiSmoothed_l(k)
+            //
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+            for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
 
-                    obj->xiSmoothedLocal[iChannel][iBin] = obj->xiSmoothedLocalTime[iChannel][iBin];
-                    obj->xiSmoothedGlobal[iChannel][iBin] = obj->xiSmoothedGlobalTime[iChannel][iBin];
-                    obj->xiSmoothedFrame[iChannel][iBin] = obj->xiSmoothedFrameTime[iChannel][iBin];
+                obj->zetaLocal[iChannel][iBin] = (1.0f - obj->alpha) * obj->zetaLocalPrev[iChannel][iBin] + obj->alpha * obj->xiSmoothedLocal[iChannel][iBin];
+                obj->zetaGlobal[iChannel][iBin] = (1.0f - obj->alpha) * obj->zetaGlobalPrev[iChannel][iBin] + obj->alpha * obj->xiSmoothedGlobal[iChannel][iBin];
+                obj->zetaFrame[iChannel][iBin] = (1.0f - obj->alpha) * obj->zetaFramePrev[iChannel][iBin] + obj->alpha * obj->xiSmoothedFrame[iChannel][iBin];
 
-                }    
+            }        
 
-                //
-                // zeta_l(k) = (1 - alpha) * zeta_l-1(k) + alpha * xiSmoothed_l(k)
-                //
+            memcpy(obj->zetaLocalPrev[iChannel], obj->zetaLocal[iChannel], sizeof(float) * obj->halfFrameSize);
+            memcpy(obj->zetaGlobalPrev[iChannel], obj->zetaGlobal[iChannel], sizeof(float) * obj->halfFrameSize);
+            memcpy(obj->zetaFramePrev[iChannel], obj->zetaFrame[iChannel], sizeof(float) * obj->halfFrameSize);
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+            //
+            // P_l(k) = 1 / (1 + (theta/zeta_l(k))^2)
+            //
 
-                    obj->zetaLocal[iChannel][iBin] = (1.0f - obj->alpha) * obj->zetaLocalPrev[iChannel][iBin] + obj->alpha * obj->xiSmoothedLocal[iChannel][iBin];
-                    obj->zetaGlobal[iChannel][iBin] = (1.0f - obj->alpha) * obj->zetaGlobalPrev[iChannel][iBin] + obj->alpha * obj->xiSmoothedGlobal[iChannel][iBin];
-                    obj->zetaFrame[iChannel][iBin] = (1.0f - obj->alpha) * obj->zetaFramePrev[iChannel][iBin] + obj->alpha * obj->xiSmoothedFrame[iChannel][iBin];
+            for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
 
-                }        
+                theta_zeta = obj->theta/obj->zetaLocal[iChannel][iBin];
+                obj->PLocal[iChannel][iBin] = 1.0f / (1.0f + (theta_zeta*theta_zeta));
 
-                memcpy(obj->zetaLocalPrev[iChannel], obj->zetaLocal[iChannel], sizeof(float) * obj->halfFrameSize);
-                memcpy(obj->zetaGlobalPrev[iChannel], obj->zetaGlobal[iChannel], sizeof(float) * obj->halfFrameSize);
-                memcpy(obj->zetaFramePrev[iChannel], obj->zetaFrame[iChannel], sizeof(float) * obj->halfFrameSize);
+                theta_zeta = obj->theta/obj->zetaGlobal[iChannel][iBin];
+                obj->PGlobal[iChannel][iBin] = 1.0f / (1.0f + (theta_zeta*theta_zeta));
 
-                //
-                // P_l(k) = 1 / (1 + (theta/zeta_l(k))^2)
-                //
+                theta_zeta = obj->theta/obj->zetaFrame[iChannel][iBin];
+                obj->PFrame[iChannel][iBin] = 1.0f / (1.0f + (theta_zeta*theta_zeta));
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+            }
 
-                    theta_zeta = obj->theta/obj->zetaLocal[iChannel][iBin];
-                    obj->PLocal[iChannel][iBin] = 1.0f / (1.0f + (theta_zeta*theta_zeta));
+            //
+            // q_l(k) = min(1-Plocal_l(k)*Pglobal_l(k)*Pframe_l(k))
+            //
 
-                    theta_zeta = obj->theta/obj->zetaGlobal[iChannel][iBin];
-                    obj->PGlobal[iChannel][iBin] = 1.0f / (1.0f + (theta_zeta*theta_zeta));
+            for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
 
-                    theta_zeta = obj->theta/obj->zetaFrame[iChannel][iBin];
-                    obj->PFrame[iChannel][iBin] = 1.0f / (1.0f + (theta_zeta*theta_zeta));
+                PLocalGlobalFrame = obj->PLocal[iChannel][iBin] * obj->PGlobal[iChannel][iBin] * obj->PFrame[iChannel][iBin];
 
+                if ((1.0f - PLocalGlobalFrame) > 0.9f) {
+                    obj->q[iChannel][iBin] = 0.9;
+                }
+                else {
+                    obj->q[iChannel][iBin] = 1.0f - PLocalGlobalFrame;
                 }
 
-                //
-                // q_l(k) = min(1-Plocal_l(k)*Pglobal_l(k)*Pframe_l(k))
-                //
+            }
+
+            //
+            // p_l(k) = (1 + (q_l(k) / (1 - q_l(k)) * (1 + xi_l(k)) * exp(-v_l(k)))
+            //
+
+            if (obj->math == 'f') {
+
+                // exp(-v_l(k)) is computed in p_l(k) first
 
                 for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                    obj->p[iChannel][iBin] = -1.0f * vs->array[iChannel][iBin];
+                }
 
-                    PLocalGlobalFrame = obj->PLocal[iChannel][iBin] * obj->PGlobal[iChannel][iBin] * obj->PFrame[iChannel][iBin];
+                fastmath_exp(obj->p[iChannel], obj->p[iChannel], obj->halfFrameSize);
 
-                    if ((1.0f - PLocalGlobalFrame) > 0.9f) {
-                        obj->q[iChannel][iBin] = 0.9;
-                    }
-                    else {
-                        obj->q[iChannel][iBin] = 1.0f - PLocalGlobalFrame;
-                    }
+                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+
+                    obj->p[iChannel][iBin] = 1.0f / (1.0f + (obj->q[iChannel][iBin] / (1.0f - obj->q[iChannel][iBin])) * (1.0f + snrs->array[iChannel][iBin]) * obj->p[iChannel][iBin]);
 
                 }
 
-                //
-                // p_l(k) = (1 + (q_l(k) / (1 - q_l(k)) * (1 + xi_l(k)) * exp(-v_l(k)))
-                //
+            }
+            else {
 
                 for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
 
@@ -1193,47 +1291,47 @@
 
                 }
 
-                memcpy(probspeechs->array[iChannel],obj->p[iChannel],sizeof(float) * obj->halfFrameSize);
-
             }
-            else {
 
-                memset(obj->xiTime[iChannel], 0x00, sizeof(float) * obj->frameSize);
-                memset(obj->xiFreq[iChannel], 0x00, sizeof(float) * obj->halfFrameSize * 2);
+            memcpy(probspeechs->array[iChannel],obj->p[iChannel],sizeof(float) * obj->halfFrameSize);
+
+        }
+        else {
 
-                memset(obj->xiSmoothedLocalFreq[iChannel], 0x00, sizeof(float) * obj->halfFrameSize * 2);
-                memset(obj->xiSmoothedGlobalFreq[iChannel], 0x00, sizeof(float) * obj->halfFrameSize * 2);
-                memset(obj->xiSmoothedFrameFreq[iChannel], 0x00, sizeof(float) * obj->halfFrameSize * 2);
-                memset(obj->xiSmoothedLocalTime[iChannel], 0x00, sizeof(float) * obj->frameSize);
-                memset(obj->xiSmoothedGlobalTime[iChannel], 0x00, sizeof(float) * obj->frameSize);
-                memset(obj->xiSmoothedFrameTime[iChannel], 0x00, sizeof(float) * obj->frameSize);
-                memset(obj->xiSmoothedLocalTime[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->xiSmoothedGlobalTime[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->xiSmoothedFrameTime[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->xiTime[iChannel], 0x00, sizeof(float) * obj->frameSize);
+            memset(obj->xiFreq[iChannel], 0x00, sizeof(float) * obj->halfFrameSize * 2);
 
-                memset(obj->zetaLocal[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->zetaLocalPrev[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->zetaGlobal[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->zetaGlobalPrev[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->zetaFrame[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->zetaFramePrev[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->xiSmoothedLocalFreq[iChannel], 0x00, sizeof(float) * obj->halfFrameSize * 2);
+            memset(obj->xiSmoothedGlobalFreq[iChannel], 0x00, sizeof(float) * obj->halfFrameSize * 2);
+            memset(obj->xiSmoothedFrameFreq[iChannel], 0x00, sizeof(float) * obj->halfFrameSize * 2);
+            memset(obj->xiSmoothedLocalTime[iChannel], 0x00, sizeof(float) * obj->frameSize);
+            memset(obj->xiSmoothedGlobalTime[iChannel], 0x00, sizeof(float) * obj->frameSize);
+            memset(obj->xiSmoothedFrameTime[iChannel], 0x00, sizeof(float) * obj->frameSize);
+            memset(obj->xiSmoothedLocalTime[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->xiSmoothedGlobalTime[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->xiSmoothedFrameTime[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+
+            memset(obj->zetaLocal[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->zetaLocalPrev[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->zetaGlobal[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->zetaGlobalPrev[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->zetaFrame[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->zetaFramePrev[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
 
-                memset(obj->PLocal[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->PGlobal[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->PFrame[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->PLocal[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->PGlobal[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->PFrame[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
 
-                memset(obj->q[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
-                memset(obj->p[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);                
+            memset(obj->q[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(obj->p[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);                
 
-                memset(probspeechs->array[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+            memset(probspeechs->array[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
 
-            }
-            
         }
 
     }
 
-    env2env_gainall_obj * env2env_gainall_construct_zero(const unsigned int nChannels, const unsigned int halfFrameSize, const float Gmin) {
+    env2env_gainall_obj * env2env_gainall_construct_zero(const unsigned int nChannels, const unsigned int halfFrameSize, const float Gmin, const char math) {
 
         env2env_gainall_obj * obj;
 
@@ -1242,6 +1340,8 @@
         obj->nChannels = nChannels;
         obj->halfFrameSize = halfFrameSize;
         obj->Gmin = Gmin;
+        obj->logGmin = logf(Gmin);
+        obj->math = math;
 
         return obj;
 
@@ -1255,29 +1355,61 @@
 
     void env2env_gainall_process(env2env_gainall_obj * obj, const tracks_obj * tracks, const envs_obj * gainspeeches, const envs_obj * probspeeches, envs_obj * gainalls) {
 
+        env2env_gainall_process_range(obj, tracks, gainspeeches, probspeeches, gainalls, 0, obj->halfFrameSize);
+
+    }
+
+    void env2env_gainall_process_range(env2env_gainall_obj * obj, const tracks_obj * tracks, const envs_obj * gainspeeches, const envs_obj * probspeeches, envs_obj * gainalls, const unsigned int iBinStart, const unsigned int iBinStop) {
+
         unsigned int iChannel;
         unsigned int iBin;
 
         float expr1;
         float expr2;
+        float * gainall;
 
         for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
 
             if (tracks->ids[iChannel] != 0) {
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                // With Gmin = 0, log(Gmin) is -inf and p = 1 would give 0 * -inf, so the exact path is kept
+                if ((obj->math == 'f') && (obj->Gmin > 0.0f)) {
+
+                    //
+                    // G^p * Gmin^(1-p) = exp(p * log(G) + (1-p) * log(Gmin)), built in the output
+                    //
+
+                    gainall = &(gainalls->array[iChannel][iBinStart]);
+
+                    fastmath_log(&(gainspeeches->array[iChannel][iBinStart]), gainall, iBinStop - iBinStart);
 
-                    expr1 = powf(gainspeeches->array[iChannel][iBin], probspeeches->array[iChannel][iBin]);
-                    expr2 = powf(obj->Gmin, (1.0f - probspeeches->array[iChannel][iBin]));
+                    for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
-                    gainalls->array[iChannel][iBin] = expr1 * expr2;
+                        gainalls->array[iChannel][iBin] = probspeeches->array[iChannel][iBin] * gainalls->array[iChannel][iBin] + 
+                                                          (1.0f - probspeeches->array[iChannel][iBin]) * obj->logGmin;
+
+                    }
+
+                    fastmath_exp(gainall, gainall, iBinStop - iBinStart);
+
+                }
+                else {
+
+                    for (iBin = iBinStart; iBin < iBinStop; iBin++) {
+
+                        expr1 = powf(gainspeeches->array[iChannel][iBin], probspeeches->array[iChannel][iBin]);
+                        expr2 = powf(obj->Gmin, (1.0f - probspeeches->array[iChannel][iBin]));
+
+                        gainalls->array[iChannel][iBin] = expr1 * expr2;
+
+                    }
 
                 }
 
             }
             else {
 
-                memset(gainalls->array[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+                memset(&(gainalls->array[iChannel][iBinStart]), 0x00, sizeof(float) * (iBinStop - iBinStart));
 
             }
 
@@ -1285,7 +1417,7 @@
 
     }
 
-    env2env_gainratio_obj * env2env_gainratio_construct_zero(const unsigned int nInitChannels, const unsigned int nChannels, const unsigned int halfFrameSize, const float Gmin, const float Gmid, const float Gslope, const float epsilon) {
+    env2env_gainratio_obj * env2env_gainratio_construct_zero(const unsigned int nInitChannels, const unsigned int nChannels, const unsigned int halfFrameSize, const float Gmin, const float Gmid, const float Gslope, const float epsilon, const char math) {
 
         env2env_gainratio_obj * obj;
 
@@ -1298,6 +1430,7 @@
         obj->Gmid = Gmid;
         obj->Gslope = Gslope;
         obj->epsilon = epsilon;
+        obj->math = math;
 
         return obj;        
 
@@ -1311,33 +1444,67 @@
 
     void env2env_gainratio_process(env2env_gainratio_obj * obj, const tracks_obj * tracks, const envs_obj * seps, const envs_obj * diffuse, envs_obj * gainratio) {
 
+        env2env_gainratio_process_range(obj, tracks, seps, diffuse, gainratio, 0, obj->halfFrameSize);
+
+    }
+
+    void env2env_gainratio_process_range(env2env_gainratio_obj * obj, const tracks_obj * tracks, const envs_obj * seps, const envs_obj * diffuse, envs_obj * gainratio, const unsigned int iBinStart, const unsigned int iBinStop) {
+
         unsigned int iChannel;
         unsigned int iBin;
 
         float ratio;
         float sigmoid;
         float gain;
+        float * gains;
 
         for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
 
             if (tracks->ids[iChannel] != 0) {
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                if (obj->math == 'f') {
+
+                    // The sigmoid argument is stored in the output, and the sigmoid is applied in place
 
-                    ratio = seps->array[iChannel][iBin] / (((float) obj->nInitChannels) * diffuse->array[iChannel][iBin] + obj->epsilon);
+                    gains = &(gainratio->array[iChannel][iBinStart]);
 
-                    sigmoid = 1.0f / (1.0f + expf(-1.0f * obj->Gslope * (ratio - obj->Gmid)));
+                    for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
-                    gain = obj->Gmin + (1.0f - obj->Gmin) * sigmoid;
+                        ratio = seps->array[iChannel][iBin] / (((float) obj->nInitChannels) * diffuse->array[iChannel][iBin] + obj->epsilon);
 
-                    gainratio->array[iChannel][iBin] = gain;
+                        gainratio->array[iChannel][iBin] = obj->Gslope * (ratio - obj->Gmid);
+
+                    }
+
+                    fastmath_sigmoid(gains, gains, iBinStop - iBinStart);
+
+                    for (iBin = iBinStart; iBin < iBinStop; iBin++) {
+
+                        gainratio->array[iChannel][iBin] = obj->Gmin + (1.0f - obj->Gmin) * gainratio->array[iChannel][iBin];
+
+                    }
+
+                }
+                else {
+
+                    for (iBin = iBinStart; iBin < iBinStop; iBin++) {
+
+                        ratio = seps->array[iChannel][iBin] / (((float) obj->nInitChannels) * diffuse->array[iChannel][iBin] + obj->epsilon);
+
+                        sigmoid = 1.0f / (1.0f + expf(-1.0f * obj->Gslope * (ratio - obj->Gmid)));
+
+                        gain = obj->Gmin + (1.0f - obj->Gmin) * sigmoid;
+
+                        gainratio->array[iChannel][iBin] = gain;
+
+                    }
 
                 }
 
             }
             else {
 
-                memset(gainratio->array[iChannel], 0x00, sizeof(float) * obj->halfFrameSize);
+                memset(&(gainratio->array[iChannel][iBinStart]), 0x00, sizeof(float) * (iBinStop - iBinStart));
 
             }
 
@@ -71,3 +71,46 @@
         }
 
     }
+
+    void frame2freq_process_ring(frame2freq_obj * obj, const hop2frame_obj * hop2frame, freqs_obj * freqs) {
+
+        unsigned int iSignal;
+        unsigned int iSample;
+        unsigned int nSamples1;
+        unsigned int nSamples2;
+        const float * win1;
+        const float * win2;
+        const float * ring1;
+        const float * ring2;
+        float * frame1;
+        float * frame2;
+
+        // Window the circular buffer in two segments, oldest samples first
+        nSamples1 = obj->frameSize - hop2frame->iSample;
+        nSamples2 = hop2frame->iSample;
+
+        win1 = obj->win->array;
+        win2 = &(obj->win->array[nSamples1]);
+        frame1 = obj->frame;
+        frame2 = &(obj->frame[nSamples1]);
+
+        for (iSignal = 0; iSignal < hop2frame->nSignals; iSignal++) {
+
+            ring1 = &(hop2frame->array[iSignal][nSamples2]);
+            ring2 = hop2frame->array[iSignal];
+
+            for (iSample = 0; iSample < nSamples1; iSample++) {
+                frame1[iSample] = win1[iSample] * ring1[iSample];
+            }
+
+            for (iSample = 0; iSample < nSamples2; iSample++) {
+                frame2[iSample] = win2[iSample] * ring2[iSample];
+            }
+
+            fft_r2c(obj->fft, 
+                    obj->frame,
+                    freqs->array[iSignal]);
+
+        }
+
+    }
@@ -43,6 +43,12 @@
 
     void freq2env_process(freq2env_obj * obj, const freqs_obj * freqs, envs_obj * envs) {
 
+        freq2env_process_range(obj, freqs, envs, 0, obj->halfFrameSize);
+
+    }
+
+    void freq2env_process_range(freq2env_obj * obj, const freqs_obj * freqs, envs_obj * envs, const unsigned int iBinStart, const unsigned int iBinStop) {
+
         unsigned int iSignal;
         unsigned int iBin;
 
@@ -52,7 +58,7 @@
 
         for (iSignal = 0; iSignal < freqs->nSignals; iSignal++) {
 
-            for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+            for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                 Xreal = freqs->array[iSignal][iBin * 2 + 0];
                 Ximag = freqs->array[iSignal][iBin * 2 + 1];
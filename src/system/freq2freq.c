@@ -248,6 +248,12 @@
 
     void freq2freq_gain_process(freq2freq_gain_obj * obj, const freqs_obj * freqsIn, const envs_obj * envsIn, freqs_obj * freqsOut) {
 
+        freq2freq_gain_process_range(obj, freqsIn, envsIn, freqsOut, 0, obj->halfFrameSize);
+
+    }
+
+    void freq2freq_gain_process_range(freq2freq_gain_obj * obj, const freqs_obj * freqsIn, const envs_obj * envsIn, freqs_obj * freqsOut, const unsigned int iBinStart, const unsigned int iBinStop) {
+
         unsigned int iSignal;
         unsigned int iSample;
 
@@ -259,7 +265,7 @@
 
         for (iSignal = 0; iSignal < freqsIn->nSignals; iSignal++) {
 
-            for (iSample = 0; iSample < obj->halfFrameSize; iSample++) {
+            for (iSample = iBinStart; iSample < iBinStop; iSample++) {
 
                 xReal = freqsIn->array[iSignal][iSample*2+0];
                 xImag = freqsIn->array[iSignal][iSample*2+1];
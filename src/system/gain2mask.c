@@ -45,11 +45,27 @@
 
     void gain2mask_process(gain2mask_obj * obj, const gains_obj * gains, masks_obj * masks) {
 
+        gain2mask_process_partial(obj, gains, NULL, masks);
+
+    }
+
+    void gain2mask_process_partial(gain2mask_obj * obj, const gains_obj * gains, const char * updates, masks_obj * masks) {
+
+        // If updates is not NULL, only the sources flagged with 0x01 are recomputed
+
         unsigned int iSep;
         unsigned int iChannel;
 
         for (iSep = 0; iSep < obj->nSeps; iSep++) {
 
+            if (updates != NULL) {
+
+                if (updates[iSep] == 0x00) {
+                    continue;
+                }
+
+            }
+
             for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
 
                 if (gains->array[iSep * obj->nChannels + iChannel] >= obj->gainMin) {
@@ -0,0 +1,182 @@
+
+   /**
+    * \file     hop2acorr.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <system/hop2acorr.h>
+
+    hop2acorr_obj * hop2acorr_construct_zero(const unsigned int nSignals, const unsigned int hopSize, const unsigned int frameSize, const unsigned int decimation, const unsigned int lagMin, const unsigned int lagMax) {
+
+        hop2acorr_obj * obj;
+        unsigned int iSignal;
+
+        if ((decimation == 0) || ((hopSize % decimation) != 0)) {
+            printf("Hop to acorr: Hop size must be a multiple of the decimation factor.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        if (frameSize <= hopSize) {
+            printf("Hop to acorr: Frame size must be greater than the hop size.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        obj = (hop2acorr_obj *) malloc(sizeof(hop2acorr_obj));
+
+        obj->nSignals = nSignals;
+        obj->hopSize = hopSize;
+        obj->decimation = decimation;
+        obj->hopSizeDec = hopSize / decimation;
+
+        obj->lagMin = lagMin;
+        obj->lagMax = lagMax;
+
+        // Forgetting factor that gives a memory of about frameSize samples
+        obj->lambda = 1.0f - ((float) hopSize) / ((float) frameSize);
+
+        // Each signal holds the last lagMax decimated samples followed by the current hop
+        obj->array = (float **) malloc(sizeof(float *) * nSignals);
+
+        for (iSignal = 0; iSignal < nSignals; iSignal++) {
+
+            obj->array[iSignal] = (float *) malloc(sizeof(float) * (obj->lagMax + obj->hopSizeDec));
+            memset(obj->array[iSignal], 0x00, sizeof(float) * (obj->lagMax + obj->hopSizeDec));
+
+        }
+
+        return obj;
+
+    }
+
+    void hop2acorr_destroy(hop2acorr_obj * obj) {
+
+        unsigned int iSignal;
+
+        for (iSignal = 0; iSignal < obj->nSignals; iSignal++) {
+            free((void *) obj->array[iSignal]);
+        }
+        free((void *) obj->array);
+
+        free((void *) obj);
+
+    }
+
+    void hop2acorr_process(hop2acorr_obj * obj, const hops_obj * hops, const tracks_obj * tracks, acorrs_obj * acorrs) {
+
+        unsigned int iSignal;
+        unsigned int iSample;
+        signed int iSampleDec;
+        unsigned int iDec;
+        unsigned int iLag;
+
+        float gain;
+        float sum;
+        float sum0;
+        float sum1;
+        float sum2;
+        float sum3;
+        float sample;
+        float * samples;
+        float * acorr;
+        float * current;
+        float * delayed;
+        const float * hop;
+
+        gain = 1.0f / ((float) obj->decimation);
+
+        for (iSignal = 0; iSignal < obj->nSignals; iSignal++) {
+
+            samples = obj->array[iSignal];
+
+            if (tracks->ids[iSignal] == 0) {
+
+                // Start from a clean history when a new track shows up
+                memset(samples, 0x00, sizeof(float) * (obj->lagMax + obj->hopSizeDec));
+                memset(acorrs->array[iSignal], 0x00, sizeof(float) * acorrs->halfFrameSize);
+
+                continue;
+
+            }
+
+            hop = hops->array[iSignal];
+            current = &(samples[obj->lagMax]);
+
+            // Decimate with a moving average over each block of samples
+            iSample = 0;
+
+            for (iSampleDec = 0; iSampleDec < (signed int) obj->hopSizeDec; iSampleDec++) {
+
+                sum = 0.0f;
+
+                for (iDec = 0; iDec < obj->decimation; iDec++) {
+                    sum += hop[iSample++];
+                }
+
+                current[iSampleDec] = gain * sum;
+
+            }
+
+            // R(l) <- lambda * R(l) + sum_n x(n) x(n-l), only over the lags of interest
+            // Four lags share each pass over the hop to keep independent accumulators busy
+            acorr = acorrs->array[iSignal];
+
+            for (iLag = obj->lagMin; (iLag + 3) <= obj->lagMax; iLag += 4) {
+
+                delayed = &(current[-1 * ((signed int) iLag)]);
+                sum0 = 0.0f;
+                sum1 = 0.0f;
+                sum2 = 0.0f;
+                sum3 = 0.0f;
+
+                for (iSampleDec = 0; iSampleDec < (signed int) obj->hopSizeDec; iSampleDec++) {
+
+                    sample = current[iSampleDec];
+                    sum0 += sample * delayed[iSampleDec];
+                    sum1 += sample * delayed[iSampleDec - 1];
+                    sum2 += sample * delayed[iSampleDec - 2];
+                    sum3 += sample * delayed[iSampleDec - 3];
+
+                }
+
+                acorr[iLag + 0] = obj->lambda * acorr[iLag + 0] + sum0;
+                acorr[iLag + 1] = obj->lambda * acorr[iLag + 1] + sum1;
+                acorr[iLag + 2] = obj->lambda * acorr[iLag + 2] + sum2;
+                acorr[iLag + 3] = obj->lambda * acorr[iLag + 3] + sum3;
+
+            }
+
+            for (; iLag <= obj->lagMax; iLag++) {
+
+                delayed = &(current[-1 * ((signed int) iLag)]);
+                sum0 = 0.0f;
+
+                for (iSampleDec = 0; iSampleDec < (signed int) obj->hopSizeDec; iSampleDec++) {
+                    sum0 += current[iSampleDec] * delayed[iSampleDec];
+                }
+
+                acorr[iLag] = obj->lambda * acorr[iLag] + sum0;
+
+            }
+
+            memmove(samples, &(samples[obj->hopSizeDec]), sizeof(float) * obj->lagMax);
+
+        }
+
+    }
@@ -34,6 +34,8 @@
         obj->frameSize = frameSize;
         obj->nSignals = nSignals;
 
+        // Circular buffer, iSample points to the oldest sample
+        obj->iSample = 0;
         obj->array = (float **) malloc(sizeof(float *) * nSignals);
 
         for (iSignal = 0; iSignal < nSignals; iSignal++) {
@@ -58,24 +60,57 @@
 
     }
 
-    void hop2frame_process(hop2frame_obj * obj, const hops_obj * hops, frames_obj * frames) {
+    void hop2frame_push(hop2frame_obj * obj, const hops_obj * hops) {
 
         unsigned int iSignal;
+        unsigned int nSamples1;
+        unsigned int nSamples2;
 
-        for (iSignal = 0; iSignal < hops->nSignals; iSignal++) {
+        // The new hop overwrites the oldest one, wrapping around the end
+        nSamples1 = obj->frameSize - obj->iSample;
+        if (nSamples1 > obj->hopSize) {
+            nSamples1 = obj->hopSize;
+        }
+        nSamples2 = obj->hopSize - nSamples1;
 
-            memmove(&(obj->array[iSignal][0]),
-                    &(obj->array[iSignal][obj->hopSize]),
-                    sizeof(float) * (obj->frameSize-obj->hopSize));
+        for (iSignal = 0; iSignal < hops->nSignals; iSignal++) {
 
-            memcpy(&(obj->array[iSignal][(obj->frameSize-obj->hopSize)]),
+            memcpy(&(obj->array[iSignal][obj->iSample]),
                    &(hops->array[iSignal][0]),
-                   sizeof(float) * obj->hopSize);
+                   sizeof(float) * nSamples1);
+
+            memcpy(&(obj->array[iSignal][0]),
+                   &(hops->array[iSignal][nSamples1]),
+                   sizeof(float) * nSamples2);
 
-            memcpy(frames->array[iSignal],
-                   obj->array[iSignal],
-                   sizeof(float) * obj->frameSize);
+        }
 
-        }        
+        obj->iSample += obj->hopSize;
+        if (obj->iSample >= obj->frameSize) {
+            obj->iSample -= obj->frameSize;
+        }
+
+    }
+
+    void hop2frame_process(hop2frame_obj * obj, const hops_obj * hops, frames_obj * frames) {
+
+        unsigned int iSignal;
+        unsigned int nSamples1;
+
+        hop2frame_push(obj, hops);
+
+        nSamples1 = obj->frameSize - obj->iSample;
+
+        for (iSignal = 0; iSignal < hops->nSignals; iSignal++) {
+
+            memcpy(&(frames->array[iSignal][0]),
+                   &(obj->array[iSignal][obj->iSample]),
+                   sizeof(float) * nSamples1);
+
+            memcpy(&(frames->array[iSignal][nSamples1]),
+                   &(obj->array[iSignal][0]),
+                   sizeof(float) * obj->iSample);
+
+        }
 
     }
@@ -253,6 +253,356 @@
 
     }
 
+    hop2hop_polyphase_obj * hop2hop_polyphase_construct_zero(const unsigned int nSignals, const unsigned int hopSizeIn, const unsigned int hopSizeOut, const unsigned int fSin, const unsigned int fSout, const unsigned int nTaps) {
+
+        hop2hop_polyphase_obj * obj;
+        window_obj * window;
+        float * prototype;
+        unsigned int nSamplesPrototype;
+        unsigned int a;
+        unsigned int b;
+        unsigned int r;
+        unsigned int iSample;
+        unsigned int iPhase;
+        unsigned int iTap;
+        unsigned int iSignal;
+        float attenuation;
+        float beta;
+        float edge;
+        float transition;
+        float cutoff;
+        float t;
+        float total;
+
+        obj = (hop2hop_polyphase_obj *) malloc(sizeof(hop2hop_polyphase_obj));
+
+        obj->nSignals = nSignals;
+        obj->hopSizeIn = hopSizeIn;
+        obj->hopSizeOut = hopSizeOut;
+
+        // Rational ratio fSout/fSin = L/M, reduced with the greatest common divisor
+
+        a = fSin;
+        b = fSout;
+
+        while (b != 0) {
+            r = a % b;
+            a = b;
+            b = r;
+        }
+
+        obj->L = fSout / a;
+        obj->M = fSin / a;
+
+        // Taps per phase: 0 selects 32 zero crossings on each side of the sinc
+        // at the lowest of the two rates. Rounded up to a multiple of 8 for the
+        // partial sums of the inner loop.
+
+        if (nTaps == 0) {
+            obj->nTaps = 64 * ((obj->M + obj->L - 1) / obj->L);
+        }
+        else {
+            obj->nTaps = nTaps;
+        }
+
+        obj->nTaps = ((obj->nTaps + 7) / 8) * 8;
+        obj->nHistory = obj->nTaps - 1;
+
+        // Kaiser windowed sinc at rate L*fSin, with 80 dB of attenuation. The
+        // stopband starts at the lowest Nyquist frequency so that nothing
+        // aliases in the passband.
+
+        nSamplesPrototype = obj->nTaps * obj->L;
+
+        attenuation = 80.0f;
+        beta = 0.1102f * (attenuation - 8.7f);
+
+        edge = 0.5f / ((float) ((obj->L > obj->M) ? obj->L : obj->M));
+        transition = (attenuation - 7.95f) / (2.285f * 2.0f * M_PI * ((float) (nSamplesPrototype - 1)));
+        cutoff = edge - 0.5f * transition;
+
+        if (cutoff < (0.5f * edge)) {
+            cutoff = 0.5f * edge;
+        }
+
+        window = windowing_kaiser(nSamplesPrototype, beta);
+        prototype = (float *) malloc(sizeof(float) * nSamplesPrototype);
+
+        total = 0.0f;
+
+        for (iSample = 0; iSample < nSamplesPrototype; iSample++) {
+
+            t = 2.0f * cutoff * (((float) iSample) - 0.5f * ((float) (nSamplesPrototype - 1)));
+
+            if (t == 0.0f) {
+                prototype[iSample] = 2.0f * cutoff;
+            }
+            else {
+                prototype[iSample] = 2.0f * cutoff * sinf(M_PI * t) / (M_PI * t);
+            }
+
+            prototype[iSample] *= window->array[iSample];
+            total += prototype[iSample];
+
+        }
+
+        // Phase p holds taps p, p+L, p+2L, ... in reverse order, so that the
+        // dot product runs forward on the history. Gain L compensates for the
+        // zeros inserted by the upsampling.
+
+        obj->coeffs = (float *) malloc(sizeof(float) * obj->L * obj->nTaps);
+
+        for (iPhase = 0; iPhase < obj->L; iPhase++) {
+
+            for (iTap = 0; iTap < obj->nTaps; iTap++) {
+
+                obj->coeffs[iPhase * obj->nTaps + (obj->nTaps - 1 - iTap)] = ((float) obj->L) * prototype[iTap * obj->L + iPhase] / total;
+
+            }
+
+        }
+
+        free((void *) prototype);
+        window_destroy(window);
+
+        // Each output sample moves the phase by M: precompute where it lands
+        // and by how many input samples it advances
+
+        obj->phaseNext = (unsigned int *) malloc(sizeof(unsigned int) * obj->L);
+        obj->phaseStep = (unsigned int *) malloc(sizeof(unsigned int) * obj->L);
+
+        for (iPhase = 0; iPhase < obj->L; iPhase++) {
+
+            obj->phaseNext[iPhase] = (iPhase + obj->M) % obj->L;
+            obj->phaseStep[iPhase] = (iPhase + obj->M) / obj->L;
+
+        }
+
+        // Linear phase filter: constant group delay, in samples at fSout
+
+        obj->delay = ((float) (nSamplesPrototype - 1)) / (2.0f * ((float) obj->M));
+
+        obj->phase = 0;
+        obj->iInput = 0;
+
+        obj->history = (float **) malloc(sizeof(float *) * nSignals);
+
+        for (iSignal = 0; iSignal < nSignals; iSignal++) {
+
+            obj->history[iSignal] = (float *) malloc(sizeof(float) * (obj->nHistory + hopSizeIn));
+            memset(obj->history[iSignal], 0x00, sizeof(float) * (obj->nHistory + hopSizeIn));
+
+        }
+
+        obj->nSamplesPush = (hopSizeIn * obj->L + obj->M - 1) / obj->M + 1;
+        obj->bufferSize = 2 * (hopSizeOut + obj->nSamplesPush);
+        obj->iWrite = 0;
+        obj->iRead = 0;
+        obj->nSamples = 0;
+
+        obj->array = (float **) malloc(sizeof(float *) * nSignals);
+
+        for (iSignal = 0; iSignal < nSignals; iSignal++) {
+
+            obj->array[iSignal] = (float *) malloc(sizeof(float) * obj->bufferSize);
+            memset(obj->array[iSignal], 0x00, sizeof(float) * obj->bufferSize);
+
+        }
+
+        return obj;
+
+    }
+
+    void hop2hop_polyphase_destroy(hop2hop_polyphase_obj * obj) {
+
+        unsigned int iSignal;
+
+        for (iSignal = 0; iSignal < obj->nSignals; iSignal++) {
+            free((void *) obj->history[iSignal]);
+            free((void *) obj->array[iSignal]);
+        }
+
+        free((void *) obj->history);
+        free((void *) obj->array);
+        free((void *) obj->coeffs);
+        free((void *) obj->phaseNext);
+        free((void *) obj->phaseStep);
+        free((void *) obj);
+
+    }
+
+    void hop2hop_polyphase_push(hop2hop_polyphase_obj * obj, const hops_obj * hops) {
+
+        unsigned int iSignal;
+        unsigned int iTap;
+        unsigned int iLane;
+        unsigned int phase;
+        unsigned int iInput;
+        unsigned int iWrite;
+        unsigned int nSamples;
+        const float * coeffs;
+        const float * history;
+        const float * samples;
+        float * array;
+        float acc[8];
+
+        if ((obj->nSamples + obj->nSamplesPush) <= obj->bufferSize) {
+
+            for (iSignal = 0; iSignal < obj->nSignals; iSignal++) {
+
+                memcpy(&(obj->history[iSignal][obj->nHistory]),
+                       hops->array[iSignal],
+                       sizeof(float) * obj->hopSizeIn);
+
+                history = obj->history[iSignal];
+                array = obj->array[iSignal];
+
+                phase = obj->phase;
+                iInput = obj->iInput;
+                iWrite = obj->iWrite;
+
+                while (iInput < obj->hopSizeIn) {
+
+                    coeffs = &(obj->coeffs[phase * obj->nTaps]);
+                    samples = &(history[iInput]);
+
+                    // Eight independent partial sums: no reassociation is
+                    // needed to map the taps on vector lanes
+
+                    for (iLane = 0; iLane < 8; iLane++) {
+                        acc[iLane] = 0.0f;
+                    }
+
+                    for (iTap = 0; iTap < obj->nTaps; iTap += 8) {
+
+                        for (iLane = 0; iLane < 8; iLane++) {
+
+                            acc[iLane] += coeffs[iLane] * samples[iLane];
+
+                        }
+
+                        coeffs += 8;
+                        samples += 8;
+
+                    }
+
+                    array[iWrite] = ((acc[0] + acc[4]) + (acc[1] + acc[5])) + ((acc[2] + acc[6]) + (acc[3] + acc[7]));
+
+                    iWrite++;
+                    if (iWrite == obj->bufferSize) {
+                        iWrite = 0;
+                    }
+
+                    // Integer ratio (L = 1): single phase, constant stride
+
+                    if (obj->L == 1) {
+                        iInput += obj->M;
+                    }
+                    else {
+                        iInput += obj->phaseStep[phase];
+                        phase = obj->phaseNext[phase];
+                    }
+
+                }
+
+                memmove(&(obj->history[iSignal][0]),
+                        &(obj->history[iSignal][obj->hopSizeIn]),
+                        sizeof(float) * obj->nHistory);
+
+            }
+
+            // All signals share the same phase trajectory: iterate it once
+            // more to update the state (this also covers nSignals = 0)
+
+            phase = obj->phase;
+            iInput = obj->iInput;
+            nSamples = 0;
+
+            while (iInput < obj->hopSizeIn) {
+
+                iInput += obj->phaseStep[phase];
+                phase = obj->phaseNext[phase];
+                nSamples++;
+
+            }
+
+            obj->phase = phase;
+            obj->iInput = iInput - obj->hopSizeIn;
+            obj->iWrite = (obj->iWrite + nSamples) % obj->bufferSize;
+            obj->nSamples += nSamples;
+
+        }
+
+    }
+
+    void hop2hop_polyphase_pop(hop2hop_polyphase_obj * obj, hops_obj * hops) {
+
+        unsigned int iSignal;
+        unsigned int nSamples1;
+        unsigned int nSamples2;
+
+        if (obj->nSamples >= obj->hopSizeOut) {
+
+            if ((obj->iRead + obj->hopSizeOut) <= obj->bufferSize) {
+                nSamples1 = obj->hopSizeOut;
+                nSamples2 = 0;
+            }
+            else {
+                nSamples1 = obj->bufferSize - obj->iRead;
+                nSamples2 = obj->hopSizeOut - nSamples1;
+            }
+
+            for (iSignal = 0; iSignal < obj->nSignals; iSignal++) {
+
+                memcpy(&(hops->array[iSignal][0]),
+                       &(obj->array[iSignal][obj->iRead]),
+                       sizeof(float) * nSamples1);
+
+                memcpy(&(hops->array[iSignal][nSamples1]),
+                       &(obj->array[iSignal][0]),
+                       sizeof(float) * nSamples2);
+
+            }
+
+            obj->iRead = (obj->iRead + obj->hopSizeOut) % obj->bufferSize;
+            obj->nSamples -= obj->hopSizeOut;
+
+        }
+
+    }
+
+    char hop2hop_polyphase_isFull(hop2hop_polyphase_obj * obj) {
+
+        char rtnValue;
+
+        rtnValue = 0;
+
+        if ((obj->nSamples + obj->nSamplesPush) > obj->bufferSize) {
+
+            rtnValue = 1;
+
+        }
+
+        return rtnValue;
+
+    }
+
+    char hop2hop_polyphase_isEmpty(hop2hop_polyphase_obj * obj) {
+
+        char rtnValue;
+
+        rtnValue = 0;
+
+        if (obj->hopSizeOut > obj->nSamples) {
+
+            rtnValue = 1;
+
+        }
+
+        return rtnValue;
+
+    }
+
     hop2hop_gain_obj * hop2hop_gain_construct_zero(const unsigned int hopSize, const float gain) {
 
         hop2hop_gain_obj * obj;
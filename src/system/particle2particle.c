@@ -60,6 +60,7 @@
 
         obj->realisation_normal = (float *) malloc(sizeof(float) * nParticles * 3);
         obj->normaloff = normaloff_construct_rnd(epsilon, 10000);
+        obj->normaloffOwned = 1;
 
         obj->epsilon = epsilon;
         obj->Nmin = Nmin;
@@ -75,6 +76,53 @@
 
     }
 
+    particle2particle_obj * particle2particle_construct_clone(const particle2particle_obj * src) {
+
+        particle2particle_obj * obj;
+        unsigned int iState;
+
+        obj = (particle2particle_obj *) malloc(sizeof(particle2particle_obj));
+
+        obj->nParticles = src->nParticles;
+        obj->deltaT = src->deltaT;
+
+        for (iState = 0; iState < 3; iState++) {
+
+            obj->alphas[iState] = src->alphas[iState];
+            obj->betas[iState] = src->betas[iState];
+            obj->ratios[iState] = src->ratios[iState];
+            obj->as[iState] = src->as[iState];
+            obj->bs[iState] = src->bs[iState];
+
+        }
+
+        obj->rnd_ratio = random_construct_zero(3);
+        random_pdf(obj->rnd_ratio, obj->ratios);
+        obj->indexes_ratio = (unsigned int *) malloc(sizeof(unsigned int) * obj->nParticles);
+
+        obj->pdf_weight = (float *) malloc(sizeof(float) * obj->nParticles);
+        obj->indexes_weight = (unsigned int *) malloc(sizeof(unsigned int) * obj->nParticles);
+        obj->rnd_weight = random_construct_zero(obj->nParticles);
+
+        // Share the table of normal realisations: the clone must draw the same values as the source
+        obj->realisation_normal = (float *) malloc(sizeof(float) * obj->nParticles * 3);
+        obj->normaloff = src->normaloff;
+        obj->normaloffOwned = 0;
+
+        obj->epsilon = src->epsilon;
+        obj->Nmin = src->Nmin;
+
+        obj->sigmaR = src->sigmaR;
+        obj->expScale = src->expScale;
+        obj->expFactor = src->expFactor;
+
+        obj->sum_P_p_x_O = (float *) malloc(sizeof(float) * obj->nParticles);
+        obj->particles = particles_construct_zero(obj->nParticles);
+
+        return obj;
+
+    }
+
     void particle2particle_destroy(particle2particle_obj * obj) {
 
         random_destroy(obj->rnd_ratio);
@@ -85,7 +133,9 @@
         random_destroy(obj->rnd_weight);
 
         free((void *) obj->realisation_normal);
-        normaloff_destroy(obj->normaloff);
+        if (obj->normaloffOwned == 1) {
+            normaloff_destroy(obj->normaloff);
+        }
 
         free((void *) obj->sum_P_p_x_O);
         particles_destroy(obj->particles);
@@ -98,7 +148,7 @@
 
         unsigned int iParticle;
 
-        random_generate(obj->rnd_ratio, obj->nParticles, obj->indexes_ratio);        
+        random_generate_r(obj->rnd_ratio, obj->nParticles, obj->indexes_ratio, &(particles->seed));        
 
         memset(particles->array, 0x00, sizeof(float) * 7 * obj->nParticles);
 
@@ -119,7 +169,7 @@
 
         unsigned int iParticle;
 
-        random_generate(obj->rnd_ratio, obj->nParticles, obj->indexes_ratio);        
+        random_generate_r(obj->rnd_ratio, obj->nParticles, obj->indexes_ratio, &(particles->seed));        
 
         memset(particles->array, 0x00, sizeof(float) * 7 * obj->nParticles);
 
@@ -141,7 +191,7 @@
         unsigned int iParticle;
         float a, b;
 
-        normaloff_generate(obj->normaloff, obj->nParticles * 3, obj->realisation_normal);
+        normaloff_generate_r(obj->normaloff, obj->nParticles * 3, obj->realisation_normal, &(particles->seed));
 
         for (iParticle = 0; iParticle < particles->nParticles; iParticle++) {
 
@@ -262,8 +312,8 @@
             }
 
             random_pdf(obj->rnd_weight, obj->pdf_weight);
-            random_generate(obj->rnd_weight, obj->nParticles, obj->indexes_weight);
-            random_generate(obj->rnd_ratio, obj->nParticles, obj->indexes_ratio);
+            random_generate_r(obj->rnd_weight, obj->nParticles, obj->indexes_weight, &(particles->seed));
+            random_generate_r(obj->rnd_ratio, obj->nParticles, obj->indexes_ratio, &(particles->seed));
             uniform = (1.0f/((float) obj->nParticles));
 
             for (iParticle = 0; iParticle < obj->nParticles; iParticle++) {
@@ -52,6 +52,12 @@
 
     void steer2demixing_ds_process(steer2demixing_ds_obj * obj, const tracks_obj * tracks, const steers_obj * steers, const masks_obj * masks, demixings_obj * demixings) {
 
+        steer2demixing_ds_process_range(obj, tracks, steers, masks, demixings, 0, obj->halfFrameSize);
+
+    }
+
+    void steer2demixing_ds_process_range(steer2demixing_ds_obj * obj, const tracks_obj * tracks, const steers_obj * steers, const masks_obj * masks, demixings_obj * demixings, const unsigned int iBinStart, const unsigned int iBinStop) {
+
         unsigned int iSep;
         unsigned int iChannel;
         unsigned int iBin;
@@ -69,9 +75,9 @@
 
             if (tracks->ids[iSep] != 0) {
 
-                memset(obj->gains2, 0x00, sizeof(float) * obj->halfFrameSize);
+                memset(&(obj->gains2[iBinStart]), 0x00, sizeof(float) * (iBinStop - iBinStart));
 
-                for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                     obj->gains2[iBin] = obj->epsilon;
 
@@ -84,7 +90,7 @@
 
                     if (mask == 1) {                   
 
-                        for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                        for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                             iSampleBC = iBin * obj->nChannels + iChannel;
 
@@ -108,7 +114,7 @@
 
                     if (mask == 1) {
 
-                        for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                        for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                             iSampleBC = iBin * obj->nChannels + iChannel;
 
@@ -126,8 +132,14 @@
                     }       
                     else {
 
-                        demixings->array[iSep][iSampleBC * 2 + 0] = 0.0f;
-                        demixings->array[iSep][iSampleBC * 2 + 1] = 0.0f;
+                        for (iBin = iBinStart; iBin < iBinStop; iBin++) {
+
+                            iSampleBC = iBin * obj->nChannels + iChannel;
+
+                            demixings->array[iSep][iSampleBC * 2 + 0] = 0.0f;
+                            demixings->array[iSep][iSampleBC * 2 + 1] = 0.0f;
+
+                        }
 
                     }             
 
@@ -287,6 +299,370 @@
 
     void steer2demixing_gss_process(steer2demixing_gss_obj * obj, const tracks_obj * tracksPrev, const tracks_obj * tracks, const steers_obj * steers, const masks_obj * masks, const freqs_obj * freqs, const demixings_obj * demixingsPrev, demixings_obj * demixings) {
 
+        steer2demixing_gss_process_range(obj, tracksPrev, tracks, steers, masks, freqs, demixingsPrev, demixings, 0, obj->halfFrameSize);
+
+    }
+
+    void steer2demixing_gss_process_range(steer2demixing_gss_obj * obj, const tracks_obj * tracksPrev, const tracks_obj * tracks, const steers_obj * steers, const masks_obj * masks, const freqs_obj * freqs, const demixings_obj * demixingsPrev, demixings_obj * demixings, const unsigned int iBinStart, const unsigned int iBinStop) {
+
+        unsigned int iSep;
+        unsigned int nActiveSources;
+
+        nActiveSources = 0;
+
+        for (iSep = 0; iSep < obj->nSeps; iSep++) {
+
+            if (tracks->ids[iSep] != 0) {
+                
+                nActiveSources++;
+
+            }
+
+        }
+
+        if ((nActiveSources <= STEER2DEMIXING_GSS_NSEPSMAX) && (obj->nChannels <= STEER2DEMIXING_GSS_NCHANNELSMAX)) {
+
+            steer2demixing_gss_process_fused(obj, tracksPrev, tracks, steers, masks, freqs, demixingsPrev, demixings, iBinStart, iBinStop);
+
+        }
+        else {
+
+            steer2demixing_gss_process_cmatrix(obj, tracksPrev, tracks, steers, masks, freqs, demixingsPrev, demixings, iBinStart, iBinStop);
+
+        }
+
+    }
+
+    void steer2demixing_gss_process_fused(steer2demixing_gss_obj * obj, const tracks_obj * tracksPrev, const tracks_obj * tracks, const steers_obj * steers, const masks_obj * masks, const freqs_obj * freqs, const demixings_obj * demixingsPrev, demixings_obj * demixings, const unsigned int iBinStart, const unsigned int iBinStop) {
+
+        // Same operations as steer2demixing_gss_process_cmatrix, in the same order (so the result
+        // is identical), but all the intermediate matrices for one bin live in small local arrays.
+
+        unsigned int iSep;
+        unsigned int iBin;
+        unsigned int iChannel;
+        unsigned int nActiveSources;
+        unsigned int iActiveSource;
+        unsigned int jActiveSource;
+        unsigned int iSampleBC;
+
+        unsigned int seps[STEER2DEMIXING_GSS_NSEPSMAX];
+        char news[STEER2DEMIXING_GSS_NSEPSMAX];
+        const char * masksSep[STEER2DEMIXING_GSS_NSEPSMAX];
+
+        float Xreal[STEER2DEMIXING_GSS_NCHANNELSMAX];
+        float Ximag[STEER2DEMIXING_GSS_NCHANNELSMAX];
+        float Wreal[STEER2DEMIXING_GSS_NSEPSMAX][STEER2DEMIXING_GSS_NCHANNELSMAX];
+        float Wimag[STEER2DEMIXING_GSS_NSEPSMAX][STEER2DEMIXING_GSS_NCHANNELSMAX];
+        float Areal[STEER2DEMIXING_GSS_NSEPSMAX][STEER2DEMIXING_GSS_NCHANNELSMAX];
+        float Aimag[STEER2DEMIXING_GSS_NSEPSMAX][STEER2DEMIXING_GSS_NCHANNELSMAX];
+        float AHimag[STEER2DEMIXING_GSS_NSEPSMAX][STEER2DEMIXING_GSS_NCHANNELSMAX];
+        float Yreal[STEER2DEMIXING_GSS_NSEPSMAX];
+        float Yimag[STEER2DEMIXING_GSS_NSEPSMAX];
+        float Ereal[STEER2DEMIXING_GSS_NSEPSMAX][STEER2DEMIXING_GSS_NSEPSMAX];
+        float Eimag[STEER2DEMIXING_GSS_NSEPSMAX][STEER2DEMIXING_GSS_NSEPSMAX];
+        float EY4real[STEER2DEMIXING_GSS_NSEPSMAX];
+        float EY4imag[STEER2DEMIXING_GSS_NSEPSMAX];
+        float WAmI2real[STEER2DEMIXING_GSS_NSEPSMAX][STEER2DEMIXING_GSS_NSEPSMAX];
+        float WAmI2imag[STEER2DEMIXING_GSS_NSEPSMAX][STEER2DEMIXING_GSS_NSEPSMAX];
+
+        const float * steer;
+        const float * demixingPrev;
+        float * demixing;
+
+        float sumReal;
+        float sumImag;
+        float real1, imag1;
+        float real2, imag2;
+        float gain2;
+        float X2;
+        float Rxx2;
+        float alpha;
+        float mu;
+        float oneMinusLambdaMu;
+        float dJ1real;
+        float dJ2real;
+        float Greal;
+
+        // Active sources, and whether they were already active in the previous frame
+
+        nActiveSources = 0;
+
+        for (iSep = 0; iSep < obj->nSeps; iSep++) {
+
+            if (tracks->ids[iSep] != 0) {
+
+                seps[nActiveSources] = iSep;
+                news[nActiveSources] = (tracks->ids[iSep] != tracksPrev->ids[iSep]) ? 1 : 0;
+                masksSep[nActiveSources] = &(masks->array[iSep * obj->nChannels]);
+                nActiveSources++;
+
+            }
+
+        }
+
+        if (nActiveSources == 0) {
+            return;
+        }
+
+        mu = 1.0f * obj->mu;
+        oneMinusLambdaMu = 1.0f - obj->lambda * obj->mu;
+
+        for (iBin = iBinStart; iBin < iBinStop; iBin++) {
+
+            iSampleBC = iBin * obj->nChannels;
+
+            // X[k], and ||X[k]||^2
+
+            X2 = 0.0f;
+
+            for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+
+                Xreal[iChannel] = freqs->array[iChannel][iBin*2+0];
+                Ximag[iChannel] = freqs->array[iChannel][iBin*2+1];
+
+                X2 += Xreal[iChannel] * Xreal[iChannel] + Ximag[iChannel] * Ximag[iChannel];
+
+            }
+
+            // A[k] (stored transposed, one row per source) and W_n[k]
+
+            for (iActiveSource = 0; iActiveSource < nActiveSources; iActiveSource++) {
+
+                steer = &(steers->array[seps[iActiveSource]][iSampleBC * 2]);
+
+                for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+
+                    if (masksSep[iActiveSource][iChannel] == 1) {
+
+                        Areal[iActiveSource][iChannel] = steer[iChannel * 2 + 0];
+                        Aimag[iActiveSource][iChannel] = steer[iChannel * 2 + 1];
+                        AHimag[iActiveSource][iChannel] = -1.0f * steer[iChannel * 2 + 1];
+
+                    }
+                    else {
+
+                        Areal[iActiveSource][iChannel] = 0.0f;
+                        Aimag[iActiveSource][iChannel] = 0.0f;
+                        AHimag[iActiveSource][iChannel] = 0.0f;
+
+                    }
+
+                }
+
+                if (news[iActiveSource] == 0) {
+
+                    // Previously active: load the corresponding demixing terms
+
+                    demixingPrev = &(demixingsPrev->array[seps[iActiveSource]][iSampleBC * 2]);
+
+                    for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+
+                        Wreal[iActiveSource][iChannel] = demixingPrev[iChannel * 2 + 0];
+                        Wimag[iActiveSource][iChannel] = demixingPrev[iChannel * 2 + 1];
+
+                    }
+
+                }
+                else {
+
+                    // Otherwise instantiate with terms of a weighted delay and sum beamformer
+
+                    gain2 = obj->epsilon;
+
+                    for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+
+                        if (masksSep[iActiveSource][iChannel] == 1) {
+
+                            gain2 += Areal[iActiveSource][iChannel] * Areal[iActiveSource][iChannel] + Aimag[iActiveSource][iChannel] * Aimag[iActiveSource][iChannel];
+
+                        }
+
+                    }
+
+                    for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+
+                        if (masksSep[iActiveSource][iChannel] == 1) {
+
+                            Wreal[iActiveSource][iChannel] = Areal[iActiveSource][iChannel] / gain2;
+                            Wimag[iActiveSource][iChannel] = -1.0f * Aimag[iActiveSource][iChannel] / gain2;
+
+                        }
+                        else {
+
+                            Wreal[iActiveSource][iChannel] = 0.0f;
+                            Wimag[iActiveSource][iChannel] = 0.0f;
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+            // Y[k] = W_n[k]X[k]
+
+            for (iActiveSource = 0; iActiveSource < nActiveSources; iActiveSource++) {
+
+                sumReal = 0.0f;
+                sumImag = 0.0f;
+
+                for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+
+                    real1 = Wreal[iActiveSource][iChannel];
+                    imag1 = Wimag[iActiveSource][iChannel];
+                    real2 = Xreal[iChannel];
+                    imag2 = Ximag[iChannel];
+
+                    sumReal += real1 * real2 - imag1 * imag2;
+                    sumImag += real1 * imag2 + imag1 * real2;
+
+                }
+
+                Yreal[iActiveSource] = sumReal;
+                Yimag[iActiveSource] = sumImag;
+
+            }
+
+            // E[k] = Y[k]Y[k]^H - diag{Y[k]Y[k]^H}
+
+            for (iActiveSource = 0; iActiveSource < nActiveSources; iActiveSource++) {
+
+                for (jActiveSource = 0; jActiveSource < nActiveSources; jActiveSource++) {
+
+                    if (iActiveSource != jActiveSource) {
+
+                        real1 = Yreal[iActiveSource];
+                        imag1 = Yimag[iActiveSource];
+                        real2 = Yreal[jActiveSource];
+                        imag2 = -1.0f * Yimag[jActiveSource];
+
+                        Ereal[iActiveSource][jActiveSource] = 0.0f + (real1 * real2 - imag1 * imag2);
+                        Eimag[iActiveSource][jActiveSource] = 0.0f + (real1 * imag2 + imag1 * real2);
+
+                    }
+                    else {
+
+                        Ereal[iActiveSource][jActiveSource] = 0.0f;
+                        Eimag[iActiveSource][jActiveSource] = 0.0f;
+
+                    }
+
+                }
+
+            }
+
+            // 4E[k]Y[k]
+
+            for (iActiveSource = 0; iActiveSource < nActiveSources; iActiveSource++) {
+
+                sumReal = 0.0f;
+                sumImag = 0.0f;
+
+                for (jActiveSource = 0; jActiveSource < nActiveSources; jActiveSource++) {
+
+                    real1 = Ereal[iActiveSource][jActiveSource];
+                    imag1 = Eimag[iActiveSource][jActiveSource];
+                    real2 = Yreal[jActiveSource];
+                    imag2 = Yimag[jActiveSource];
+
+                    sumReal += real1 * real2 - imag1 * imag2;
+                    sumImag += real1 * imag2 + imag1 * real2;
+
+                }
+
+                EY4real[iActiveSource] = 4.0f * sumReal;
+                EY4imag[iActiveSource] = 4.0f * sumImag;
+
+            }
+
+            // 2{W_n[k]A[k]-I}
+
+            for (iActiveSource = 0; iActiveSource < nActiveSources; iActiveSource++) {
+
+                for (jActiveSource = 0; jActiveSource < nActiveSources; jActiveSource++) {
+
+                    sumReal = 0.0f;
+                    sumImag = 0.0f;
+
+                    for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+
+                        real1 = Wreal[iActiveSource][iChannel];
+                        imag1 = Wimag[iActiveSource][iChannel];
+                        real2 = Areal[jActiveSource][iChannel];
+                        imag2 = Aimag[jActiveSource][iChannel];
+
+                        sumReal += real1 * real2 - imag1 * imag2;
+                        sumImag += real1 * imag2 + imag1 * real2;
+
+                    }
+
+                    if (iActiveSource == jActiveSource) {
+                        sumReal -= 1.0f;
+                    }
+
+                    WAmI2real[iActiveSource][jActiveSource] = 2.0f * sumReal;
+                    WAmI2imag[iActiveSource][jActiveSource] = 2.0f * sumImag;
+
+                }
+
+            }
+
+            // alpha = 1 / ||Rxx||^2
+
+            Rxx2 = X2 * X2;
+            alpha = 1.0f / (Rxx2 + obj->epsilon);
+
+            // W_n+1[k] = (1 - lambda * mu) * W_n[k] - mu * {alpha * dJ1[k] + dJ2[k]}
+            // with dJ1[k] = 4{E[k]Y[k]}X^H[k] and dJ2[k] = 2{W_n[k]A[k]-I}A^H[k]
+
+            for (iActiveSource = 0; iActiveSource < nActiveSources; iActiveSource++) {
+
+                demixing = &(demixings->array[seps[iActiveSource]][iSampleBC * 2]);
+
+                for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+
+                    real1 = EY4real[iActiveSource];
+                    imag1 = EY4imag[iActiveSource];
+                    real2 = Xreal[iChannel];
+                    imag2 = -1.0f * Ximag[iChannel];
+
+                    dJ1real = 0.0f + (real1 * real2 - imag1 * imag2);
+
+                    sumReal = 0.0f;
+
+                    for (jActiveSource = 0; jActiveSource < nActiveSources; jActiveSource++) {
+
+                        real1 = WAmI2real[iActiveSource][jActiveSource];
+                        imag1 = WAmI2imag[iActiveSource][jActiveSource];
+                        real2 = Areal[jActiveSource][iChannel];
+                        imag2 = AHimag[jActiveSource][iChannel];
+
+                        sumReal += real1 * real2 - imag1 * imag2;
+
+                    }
+
+                    dJ2real = sumReal;
+
+                    Greal = mu * (alpha * dJ1real + dJ2real);
+
+                    // cmatrix_add and cmatrix_sub only operate on the real part, so the generic path 
+                    // always ends up with a null imaginary part: do the same here
+
+                    demixing[iChannel * 2 + 0] = oneMinusLambdaMu * Wreal[iActiveSource][iChannel] - Greal;
+                    demixing[iChannel * 2 + 1] = 0.0f;
+
+                }
+
+            }
+
+        }
+
+    }
+
+    void steer2demixing_gss_process_cmatrix(steer2demixing_gss_obj * obj, const tracks_obj * tracksPrev, const tracks_obj * tracks, const steers_obj * steers, const masks_obj * masks, const freqs_obj * freqs, const demixings_obj * demixingsPrev, demixings_obj * demixings, const unsigned int iBinStart, const unsigned int iBinStop) {
+
         unsigned int iSep;
         unsigned int iBin;
         unsigned int iChannel;
@@ -326,7 +702,7 @@
 
         if (nActiveSources > 0) {
 
-            for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+            for (iBin = iBinStart; iBin < iBinStop; iBin++) {
 
                 //
                 // Compute X[k] and X^H[k]
@@ -0,0 +1,139 @@
+
+   /**
+    * \file     track2demixing.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+    
+    #include <system/track2demixing.h>
+
+    track2demixing_obj * track2demixing_construct_zero(const unsigned int nSeps, const unsigned int nChannels, const unsigned int halfFrameSize, const demixtable_obj * table) {
+
+        track2demixing_obj * obj;
+
+        if ((table->nChannels != nChannels) || (table->halfFrameSize != halfFrameSize)) {
+            printf("Demixing table does not match the number of channels or the frame size.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        obj = (track2demixing_obj *) malloc(sizeof(track2demixing_obj));
+
+        obj->nSeps = nSeps;
+        obj->nChannels = nChannels;
+        obj->halfFrameSize = halfFrameSize;
+
+        obj->table = table;
+
+        obj->indexes = (unsigned int *) malloc(sizeof(unsigned int) * nSeps);
+        memset(obj->indexes, 0x00, sizeof(unsigned int) * nSeps);
+
+        return obj;
+
+    }
+
+    void track2demixing_destroy(track2demixing_obj * obj) {
+
+        free((void *) obj->indexes);
+        free((void *) obj);
+
+    }
+
+    void track2demixing_update(track2demixing_obj * obj, const tracks_obj * tracks, masks_obj * masks) {
+
+        // Snap each active source to the grid point with the largest projection
+
+        unsigned int iSep;
+        unsigned int iPoint;
+        unsigned int iPointMax;
+
+        float ux, uy, uz;
+        float proj;
+        float projMax;
+
+        for (iSep = 0; iSep < obj->nSeps; iSep++) {
+
+            if (tracks->ids[iSep] != 0) {
+
+                ux = tracks->array[iSep * 3 + 0];
+                uy = tracks->array[iSep * 3 + 1];
+                uz = tracks->array[iSep * 3 + 2];
+
+                iPointMax = 0;
+                projMax = -INFINITY;
+
+                for (iPoint = 0; iPoint < obj->table->nPoints; iPoint++) {
+
+                    proj = ux * obj->table->points[iPoint * 3 + 0] + 
+                           uy * obj->table->points[iPoint * 3 + 1] + 
+                           uz * obj->table->points[iPoint * 3 + 2];
+
+                    if (proj > projMax) {
+                        projMax = proj;
+                        iPointMax = iPoint;
+                    }
+
+                }
+
+                obj->indexes[iSep] = iPointMax;
+
+                memcpy(&(masks->array[iSep * obj->nChannels]), 
+                       &(obj->table->masks[iPointMax * obj->nChannels]), 
+                       sizeof(char) * obj->nChannels);
+
+            }
+            else {
+
+                memset(&(masks->array[iSep * obj->nChannels]), 0x00, sizeof(char) * obj->nChannels);
+
+            }
+
+        }
+
+    }
+
+    void track2demixing_process(track2demixing_obj * obj, const tracks_obj * tracks, masks_obj * masks, demixings_obj * demixings) {
+
+        track2demixing_update(obj, tracks, masks);
+        track2demixing_process_range(obj, tracks, demixings, 0, obj->halfFrameSize);
+
+    }
+
+    void track2demixing_process_range(track2demixing_obj * obj, const tracks_obj * tracks, demixings_obj * demixings, const unsigned int iBinStart, const unsigned int iBinStop) {
+
+        unsigned int iSep;
+        unsigned int nSamples;
+        const float * src;
+
+        nSamples = obj->nChannels * 2;
+
+        for (iSep = 0; iSep < obj->nSeps; iSep++) {
+
+            if (tracks->ids[iSep] != 0) {
+
+                src = &(obj->table->array[(size_t) obj->indexes[iSep] * obj->halfFrameSize * nSamples]);
+
+                memcpy(&(demixings->array[iSep][iBinStart * nSamples]), 
+                       &(src[iBinStart * nSamples]), 
+                       sizeof(float) * (iBinStop - iBinStart) * nSamples);
+
+            }
+
+        }
+
+    }
@@ -48,6 +48,14 @@
 
     void track2gain_process(track2gain_obj * obj, const beampatterns_obj * beampatterns_mics, const tracks_obj * tracks, gains_obj * gains) {
 
+        track2gain_process_partial(obj, beampatterns_mics, tracks, NULL, gains);
+
+    }
+
+    void track2gain_process_partial(track2gain_obj * obj, const beampatterns_obj * beampatterns_mics, const tracks_obj * tracks, const char * updates, gains_obj * gains) {
+
+        // If updates is not NULL, only the sources flagged with 0x01 are recomputed
+
         unsigned int iSep;
         unsigned int iChannel;
         
@@ -65,6 +73,14 @@
 
         for (iSep = 0; iSep < obj->nSeps; iSep++) {
 
+            if (updates != NULL) {
+
+                if (updates[iSep] == 0x00) {
+                    continue;
+                }
+
+            }
+
             if (tracks->ids[iSep] != 0) {
 
                 ux = tracks->array[iSep * 3 + 0];
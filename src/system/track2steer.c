@@ -23,7 +23,7 @@
     
     #include <system/track2steer.h>
 
-    track2steer_obj * track2steer_construct_zero(const unsigned int nSeps, const unsigned int nChannels, const unsigned int halfFrameSize, const float c, const unsigned int fS, const float * mics) {
+    track2steer_obj * track2steer_construct_zero(const unsigned int nSeps, const unsigned int nChannels, const unsigned int halfFrameSize, const float c, const unsigned int fS, const float * mics, const float tolerance) {
 
         track2steer_obj * obj;
         unsigned int iBin;
@@ -49,25 +49,121 @@
 
         obj->speed = ((float) obj->fS) / obj->c;
 
+        // Angular tolerance (in degrees) before the steering vectors of a source are recomputed
+        // (0 means they are recomputed every frame)
+
+        obj->tolerance = tolerance;
+        obj->cosTolerance = cosf(tolerance * M_PI / 180.0f);
+
+        obj->cached = (char *) malloc(sizeof(char) * nSeps);
+        memset(obj->cached, 0x00, sizeof(char) * nSeps);
+        obj->ids = (unsigned long long *) malloc(sizeof(unsigned long long) * nSeps);
+        memset(obj->ids, 0x00, sizeof(unsigned long long) * nSeps);
+        obj->directions = (float *) malloc(sizeof(float) * nSeps * 3);
+        memset(obj->directions, 0x00, sizeof(float) * nSeps * 3);
+        obj->updates = (char *) malloc(sizeof(char) * nSeps);
+        memset(obj->updates, 0x00, sizeof(char) * nSeps);
+
         return obj;
 
     }
 
     void track2steer_destroy(track2steer_obj * obj) {
 
-        unsigned int iBin;
-
         free((void *) obj->factor);
         free((void *) obj->mics);
 
+        free((void *) obj->cached);
+        free((void *) obj->ids);
+        free((void *) obj->directions);
+        free((void *) obj->updates);
+
         free((void *) obj);
 
     }
 
+    void track2steer_update(track2steer_obj * obj, const tracks_obj * tracks) {
+
+        unsigned int iSep;
+
+        float ux, uy, uz;
+        float vx, vy, vz;
+        float proj;
+        float norm2;
+
+        for (iSep = 0; iSep < obj->nSeps; iSep++) {
+
+            if ((obj->cached[iSep] == 0) || (tracks->ids[iSep] != obj->ids[iSep])) {
+
+                // New source, source removed, or nothing computed yet
+
+                obj->updates[iSep] = 0x01;
+
+            }
+            else if (tracks->ids[iSep] == 0) {
+
+                // Still inactive
+
+                obj->updates[iSep] = 0x00;
+
+            }
+            else if (obj->tolerance <= 0.0f) {
+
+                obj->updates[iSep] = 0x01;
+
+            }
+            else {
+
+                // Same source: refresh only if it moved beyond the tolerance
+
+                ux = tracks->array[iSep * 3 + 0];
+                uy = tracks->array[iSep * 3 + 1];
+                uz = tracks->array[iSep * 3 + 2];
+
+                vx = obj->directions[iSep * 3 + 0];
+                vy = obj->directions[iSep * 3 + 1];
+                vz = obj->directions[iSep * 3 + 2];
+
+                proj = ux * vx + uy * vy + uz * vz;
+                norm2 = (ux * ux + uy * uy + uz * uz) * (vx * vx + vy * vy + vz * vz);
+
+                // proj / sqrt(norm2) < cos(tolerance), without the square root
+
+                if ((proj < 0.0f) || ((proj * proj) < (obj->cosTolerance * obj->cosTolerance * norm2))) {
+                    obj->updates[iSep] = 0x01;
+                }
+                else {
+                    obj->updates[iSep] = 0x00;
+                }
+
+            }
+
+            if (obj->updates[iSep] == 0x01) {
+
+                obj->cached[iSep] = 0x01;
+                obj->ids[iSep] = tracks->ids[iSep];
+                memcpy(&(obj->directions[iSep * 3]), &(tracks->array[iSep * 3]), sizeof(float) * 3);
+
+            }
+
+        }
+
+    }
+
     void track2steer_process(track2steer_obj * obj, const tracks_obj * tracks, const gains_obj * gains, const masks_obj * masks, steers_obj * steers) {
 
+        track2steer_update(obj, tracks);
+        track2steer_process_range(obj, tracks, gains, masks, steers, 0, obj->halfFrameSize);
+
+    }
+
+    void track2steer_process_range(track2steer_obj * obj, const tracks_obj * tracks, const gains_obj * gains, const masks_obj * masks, steers_obj * steers, const unsigned int iBinStart, const unsigned int iBinStop) {
+
+        // Only the sources flagged by track2steer_update are recomputed, using the cached direction
+
         unsigned int iSep;
         unsigned int iBin;
+        unsigned int iBinAnchor;
         unsigned int iChannel;
         
         float dist;
@@ -77,13 +173,24 @@
         
         float Areal;
         float Aimag;
+        float Rreal;
+        float Rimag;
+        float tmp;
 
         unsigned int iSampleSC;
         unsigned int iSampleBC;        
 
+        // Start from the anchor preceding the range, so the result does not depend on how bins are split
+
+        iBinAnchor = iBinStart - (iBinStart % TRACK2STEER_ANCHOR);
+
         for (iSep = 0; iSep < obj->nSeps; iSep++) {
 
-            if (tracks->ids[iSep] != 0) {
+            if (obj->updates[iSep] == 0x00) {
+                continue;
+            }
+
+            if (obj->ids[iSep] != 0) {
 
                 for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
 
@@ -92,23 +199,46 @@
 
                     if (mask == 1) {                   
 
-                        dist = tracks->array[iSep * 3 + 0] * obj->mics[iChannel * 3 + 0] + 
-                               tracks->array[iSep * 3 + 1] * obj->mics[iChannel * 3 + 1] +
-                               tracks->array[iSep * 3 + 2] * obj->mics[iChannel * 3 + 2]; 
+                        dist = obj->directions[iSep * 3 + 0] * obj->mics[iChannel * 3 + 0] + 
+                               obj->directions[iSep * 3 + 1] * obj->mics[iChannel * 3 + 1] +
+                               obj->directions[iSep * 3 + 2] * obj->mics[iChannel * 3 + 2]; 
 
                         delay = -1.0f * obj->speed * dist;
 
                         gain = gains->array[iSampleSC];
 
-                        for (iBin = 0; iBin < obj->halfFrameSize; iBin++) {
+                        // A[k+1] = A[k] * exp(j * factor[1] * delay)
+
+                        Rreal = cosf(obj->factor[1] * delay);
+                        Rimag = sinf(obj->factor[1] * delay);
+
+                        Areal = 0.0f;
+                        Aimag = 0.0f;
+
+                        for (iBin = iBinAnchor; iBin < iBinStop; iBin++) {
+
+                            if ((iBin % TRACK2STEER_ANCHOR) == 0) {
+
+                                Areal = gain * cosf(obj->factor[iBin] * delay);
+                                Aimag = gain * sinf(obj->factor[iBin] * delay);
+
+                            }
+                            else {
+
+                                tmp = Areal * Rreal - Aimag * Rimag;
+                                Aimag = Areal * Rimag + Aimag * Rreal;
+                                Areal = tmp;
+
+                            }
+
+                            if (iBin >= iBinStart) {
 
-                            iSampleBC = iBin * obj->nChannels + iChannel;
+                                iSampleBC = iBin * obj->nChannels + iChannel;
 
-                            Areal = gain * cosf(obj->factor[iBin] * delay);
-                            Aimag = gain * sinf(obj->factor[iBin] * delay);
+                                steers->array[iSep][iSampleBC * 2 + 0] = Areal;
+                                steers->array[iSep][iSampleBC * 2 + 1] = Aimag;
 
-                            steers->array[iSep][iSampleBC * 2 + 0] = Areal;
-                            steers->array[iSep][iSampleBC * 2 + 1] = Aimag;
+                            }
 
                         }
 
@@ -119,7 +249,7 @@
             }
             else {
 
-                memset(steers->array[iSep], 0x00, sizeof(float) * obj->halfFrameSize * obj->nChannels * 2);
+                memset(&(steers->array[iSep][iBinStart * obj->nChannels * 2]), 0x00, sizeof(float) * (iBinStop - iBinStart) * obj->nChannels * 2);
 
             }
 
@@ -0,0 +1,191 @@
+
+   /**
+    * \file     fastmath.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+    
+    #include <utils/fastmath.h>
+
+    void fastmath_exp(const float * in, float * out, const unsigned int N) {
+
+        //
+        // exp(x) = 2^n * exp(r), with n = round(x / ln(2)) and r = x - n * ln(2) in [-ln(2)/2, ln(2)/2]
+        //
+        // exp(r) is evaluated with a degree 6 Taylor polynomial, and 2^n is built in the exponent field
+        //
+
+        unsigned int n;
+
+        float x;
+        float t;
+        float r;
+        float p;
+        signed int k;
+
+        union {
+            float f;
+            signed int i;
+        } scale;
+
+        // Clamping is done in a separate pass, otherwise the compiler turns it into branches and 
+        // the main loop is no longer vectorized
+
+        for (n = 0; n < N; n++) {
+
+            x = in[n];
+            x = (x < -87.33654f) ? -87.33654f : x;
+            x = (x > 88.72283f) ? 88.72283f : x;
+            out[n] = x;
+
+        }
+
+        for (n = 0; n < N; n++) {
+
+            x = out[n];
+
+            // Adding and removing 1.5 * 2^23 rounds to the nearest integer
+
+            t = x * 1.44269504f + 12582912.0f;
+            t = t - 12582912.0f;
+            k = (signed int) t;
+
+            // ln(2) is split in two parts so that t * ln(2) adds no rounding error
+
+            r = x - t * 0.693359375f;
+            r = r + t * 2.12194440e-4f;
+
+            p = 1.0f / 720.0f;
+            p = p * r + 1.0f / 120.0f;
+            p = p * r + 1.0f / 24.0f;
+            p = p * r + 1.0f / 6.0f;
+            p = p * r + 0.5f;
+            p = p * r + 1.0f;
+            p = p * r + 1.0f;
+
+            // At the upper bound k = 128, so the scaling is split in two to stay in range
+
+            scale.i = (k + 126) << 23;
+
+            out[n] = (p * scale.f) * 2.0f;
+
+        }
+
+    }
+
+    void fastmath_log(const float * in, float * out, const unsigned int N) {
+
+        //
+        // log(x) = e * ln(2) + log(m), with x = 2^e * m and m in [sqrt(2)/2, sqrt(2)]
+        //
+        // log(m) = 2 * atanh(s) with s = (m - 1) / (m + 1), evaluated with a degree 9 odd series
+        //
+
+        unsigned int n;
+
+        float x;
+        float m;
+        float f;
+        float s;
+        float z;
+        float p;
+        float e;
+        signed int exponent;
+
+        union {
+            float f;
+            signed int i;
+        } bits;
+
+        for (n = 0; n < N; n++) {
+
+            x = in[n];
+            x = (x < FLT_MIN) ? FLT_MIN : x;
+            out[n] = x;
+
+        }
+
+        for (n = 0; n < N; n++) {
+
+            // Offsetting by the bits of sqrt(2)/2 before splitting exponent and mantissa 
+            // directly gives m in [sqrt(2)/2, sqrt(2)), without any comparison
+
+            bits.f = out[n];
+            bits.i += 0x3F800000 - 0x3F3504F3;
+            exponent = (bits.i >> 23) - 127;
+            bits.i = (bits.i & 0x007FFFFF) + 0x3F3504F3;
+            m = bits.f;
+
+            e = (float) exponent;
+
+            f = m - 1.0f;
+            s = f / (2.0f + f);
+            z = s * s;
+
+            p = 2.0f / 9.0f;
+            p = p * z + 2.0f / 7.0f;
+            p = p * z + 2.0f / 5.0f;
+            p = p * z + 2.0f / 3.0f;
+            p = p * z * s;
+
+            // ln(2) is split in two parts so that e * ln(2) adds no rounding error
+
+            out[n] = ((2.0f * s + p) - e * 2.12194440e-4f) + e * 0.693359375f;
+
+        }
+
+    }
+
+    void fastmath_pow(const float * base, const float * exponent, float * out, const unsigned int N) {
+
+        //
+        // base^exponent = exp(exponent * log(base))
+        //
+
+        unsigned int n;
+
+        fastmath_log(base, out, N);
+
+        for (n = 0; n < N; n++) {
+            out[n] *= exponent[n];
+        }
+
+        fastmath_exp(out, out, N);
+
+    }
+
+    void fastmath_sigmoid(const float * in, float * out, const unsigned int N) {
+
+        //
+        // sigmoid(x) = 1 / (1 + exp(-x))
+        //
+
+        unsigned int n;
+
+        for (n = 0; n < N; n++) {
+            out[n] = -1.0f * in[n];
+        }
+
+        fastmath_exp(out, out, N);
+
+        for (n = 0; n < N; n++) {
+            out[n] = 1.0f / (1.0f + out[n]);
+        }
+
+    }
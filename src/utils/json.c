@@ -0,0 +1,108 @@
+   
+   /**
+    * \file     json.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <utils/json.h>
+
+    char * json_text(char * cursor, const char * text) {
+
+        unsigned int nChars;
+
+        nChars = strlen(text);
+        memcpy(cursor, text, sizeof(char) * (nChars + 1));
+
+        return &(cursor[nChars]);
+
+    }
+
+    char * json_uint64(char * cursor, const unsigned long long value) {
+
+        char digits[20];
+        unsigned int nDigits;
+        unsigned int iDigit;
+        unsigned long long remainder;
+
+        remainder = value;
+        nDigits = 0;
+
+        do {
+
+            digits[nDigits] = '0' + (char) (remainder % 10);
+            remainder /= 10;
+            nDigits++;
+
+        } while (remainder > 0);
+
+        for (iDigit = 0; iDigit < nDigits; iDigit++) {
+            cursor[iDigit] = digits[nDigits - 1 - iDigit];
+        }
+
+        cursor[nDigits] = 0x00;
+
+        return &(cursor[nDigits]);
+
+    }
+
+    char * json_float3(char * cursor, const float value) {
+
+        double scaled;
+        long long rounded;
+        unsigned long long integer;
+        unsigned int fraction;
+        int nChars;
+
+        // Same text as printf("%1.3f"). A float has 24 significant bits, so value * 1000
+        // is exact in a double, and rint rounds it half to even like printf does.
+        // The rounded integer must stay below 2^53, so magnitudes of 9e12 (just under
+        // 2^53 / 1000) or more, and nan/inf, go through snprintf.
+
+        if (!(fabs((double) value) < 9.0E12)) {
+
+            nChars = snprintf(cursor, 48, "%1.3f", value);
+            return &(cursor[nChars]);
+
+        }
+
+        scaled = fabs((double) value) * 1000.0;
+
+        rounded = (long long) rint(scaled);
+
+        integer = (unsigned long long) (rounded / 1000);
+        fraction = (unsigned int) (rounded % 1000);
+
+        // The sign stays even when the value rounds to zero (-0.000)
+        if (signbit(value)) {
+            *cursor = '-';
+            cursor++;
+        }
+
+        cursor = json_uint64(cursor, integer);
+
+        cursor[0] = '.';
+        cursor[1] = '0' + (char) (fraction / 100);
+        cursor[2] = '0' + (char) ((fraction / 10) % 10);
+        cursor[3] = '0' + (char) (fraction % 10);
+        cursor[4] = 0x00;
+
+        return &(cursor[4]);
+
+    }
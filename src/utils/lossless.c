@@ -0,0 +1,626 @@
+
+   /**
+    * \file     lossless.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    *
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+
+    #include <utils/lossless.h>
+
+    lossless_obj * lossless_construct(const unsigned int nChannels, const unsigned int hopSize, const unsigned int nBits) {
+
+        lossless_obj * obj;
+
+        if ((nBits != 16) && (nBits != 24)) {
+            printf("Lossless: Invalid number of bits.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        if ((nChannels == 0) || (nChannels > 255) || (hopSize == 0) || (hopSize > 65535)) {
+            printf("Lossless: Invalid number of channels or hop size.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        obj = (lossless_obj *) malloc(sizeof(lossless_obj));
+
+        obj->nChannels = nChannels;
+        obj->hopSize = hopSize;
+        obj->nBits = nBits;
+        obj->nBytes = nBits / 8;
+
+        obj->samples = (int *) malloc(sizeof(int) * nChannels * hopSize);
+        memset(obj->samples, 0x00, sizeof(int) * nChannels * hopSize);
+        obj->residuals = (unsigned int *) malloc(sizeof(unsigned int) * hopSize);
+        memset(obj->residuals, 0x00, sizeof(unsigned int) * hopSize);
+
+        memset(&(obj->bits), 0x00, sizeof(lossless_bits_obj));
+
+        return obj;
+
+    }
+
+    void lossless_destroy(lossless_obj * obj) {
+
+        free((void *) obj->samples);
+        free((void *) obj->residuals);
+
+        free((void *) obj);
+
+    }
+
+    unsigned int lossless_bound(const lossless_obj * obj) {
+
+        // A channel never takes more room than its samples stored as is
+        return lossless_headerSize + obj->nChannels * (1 + obj->hopSize * obj->nBytes);
+
+    }
+
+    unsigned int lossless_encode(lossless_obj * obj, char * bytes) {
+
+        unsigned int iChannel;
+        unsigned int nBytes;
+        unsigned char * frame;
+
+        frame = (unsigned char *) bytes;
+        nBytes = lossless_headerSize;
+
+        for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+            nBytes += lossless_encode_channel(obj, iChannel, &(frame[nBytes]));
+        }
+
+        lossless_sample_put(&(frame[0]), (int) lossless_magic, 4);
+        lossless_sample_put(&(frame[4]), (int) nBytes, 4);
+        lossless_sample_put(&(frame[8]), (int) obj->hopSize, 2);
+        frame[10] = (unsigned char) obj->nChannels;
+        frame[11] = (unsigned char) obj->nBits;
+
+        return nBytes;
+
+    }
+
+    unsigned int lossless_encode_channel(lossless_obj * obj, const unsigned int iChannel, unsigned char * bytes) {
+
+        const int * x;
+        unsigned int * u;
+        unsigned int nSamples;
+        unsigned int nResiduals;
+        unsigned int iSample;
+        unsigned int iOrder;
+        unsigned int order;
+        unsigned int k;
+        unsigned int kMax;
+        unsigned int q;
+        unsigned int nEscape;
+        unsigned int sizeVerbatim;
+        unsigned int sizeFixed;
+
+        int e0, e1, e2, e3, e4;
+        int last0, last1, last2, last3;
+        int r;
+
+        unsigned long long sums[lossless_maxOrder + 1];
+        unsigned long long sum;
+        unsigned long long nBitsK;
+        unsigned long long nBitsK1;
+
+        x = &(obj->samples[iChannel * obj->hopSize]);
+        u = obj->residuals;
+        nSamples = obj->hopSize;
+        sizeVerbatim = 1 + nSamples * obj->nBytes;
+
+        // Silent channels (e.g. a track that is not active) take one sample
+
+        for (iSample = 1; iSample < nSamples; iSample++) {
+            if (x[iSample] != x[0]) {
+                break;
+            }
+        }
+
+        if (iSample == nSamples) {
+
+            bytes[0] = lossless_mode_constant;
+            lossless_sample_put(&(bytes[1]), x[0], obj->nBytes);
+
+            return 1 + obj->nBytes;
+
+        }
+
+        if (nSamples <= lossless_maxOrder) {
+
+            bytes[0] = lossless_mode_verbatim;
+
+            for (iSample = 0; iSample < nSamples; iSample++) {
+                lossless_sample_put(&(bytes[1 + iSample * obj->nBytes]), x[iSample], obj->nBytes);
+            }
+
+            return sizeVerbatim;
+
+        }
+
+        // Pick the fixed predictor with the smallest sum of absolute residuals,
+        // computing all orders together as successive differences
+
+        memset(sums, 0x00, sizeof(sums));
+
+        last0 = x[3];
+        last1 = x[3] - x[2];
+        last2 = last1 - (x[2] - x[1]);
+        last3 = last2 - ((x[2] - x[1]) - (x[1] - x[0]));
+
+        for (iSample = lossless_maxOrder; iSample < nSamples; iSample++) {
+
+            e0 = x[iSample];
+            e1 = e0 - last0;
+            e2 = e1 - last1;
+            e3 = e2 - last2;
+            e4 = e3 - last3;
+
+            sums[0] += (unsigned long long) ((e0 < 0) ? -e0 : e0);
+            sums[1] += (unsigned long long) ((e1 < 0) ? -e1 : e1);
+            sums[2] += (unsigned long long) ((e2 < 0) ? -e2 : e2);
+            sums[3] += (unsigned long long) ((e3 < 0) ? -e3 : e3);
+            sums[4] += (unsigned long long) ((e4 < 0) ? -e4 : e4);
+
+            last0 = e0;
+            last1 = e1;
+            last2 = e2;
+            last3 = e3;
+
+        }
+
+        order = 0;
+
+        for (iOrder = 1; iOrder <= lossless_maxOrder; iOrder++) {
+            if (sums[iOrder] < sums[order]) {
+                order = iOrder;
+            }
+        }
+
+        // Zigzagged residuals: 0, -1, 1, -2, 2... become 0, 1, 2, 3, 4...
+
+        nResiduals = nSamples - order;
+        sum = 0;
+
+        for (iSample = order; iSample < nSamples; iSample++) {
+
+            switch(order) {
+                case 0: r = x[iSample]; break;
+                case 1: r = x[iSample] - x[iSample-1]; break;
+                case 2: r = x[iSample] - 2*x[iSample-1] + x[iSample-2]; break;
+                case 3: r = x[iSample] - 3*x[iSample-1] + 3*x[iSample-2] - x[iSample-3]; break;
+                default: r = x[iSample] - 4*x[iSample-1] + 6*x[iSample-2] - 4*x[iSample-3] + x[iSample-4]; break;
+            }
+
+            u[iSample - order] = (((unsigned int) r) << 1) ^ ((unsigned int) (r >> 31));
+            sum += u[iSample - order];
+
+        }
+
+        // Rice parameter from the mean, then the best of it and the next one
+
+        kMax = obj->nBits + 4;
+        k = 0;
+
+        while ((k < kMax) && ((((unsigned long long) nResiduals) << (k + 1)) <= sum)) {
+            k++;
+        }
+
+        nBitsK = 0;
+        nBitsK1 = 0;
+        nEscape = lossless_escape + 1 + obj->nBits + 5;
+
+        for (iSample = 0; iSample < nResiduals; iSample++) {
+
+            q = u[iSample] >> k;
+            nBitsK += (q < lossless_escape) ? (q + 1 + k) : nEscape;
+
+            q = u[iSample] >> (k + 1);
+            nBitsK1 += (q < lossless_escape) ? (q + 2 + k) : nEscape;
+
+        }
+
+        if ((nBitsK1 < nBitsK) && (k < kMax)) {
+            k++;
+            nBitsK = nBitsK1;
+        }
+
+        sizeFixed = 2 + order * obj->nBytes + (unsigned int) ((nBitsK + 7) / 8);
+
+        if (sizeFixed >= sizeVerbatim) {
+
+            bytes[0] = lossless_mode_verbatim;
+
+            for (iSample = 0; iSample < nSamples; iSample++) {
+                lossless_sample_put(&(bytes[1 + iSample * obj->nBytes]), x[iSample], obj->nBytes);
+            }
+
+            return sizeVerbatim;
+
+        }
+
+        bytes[0] = (unsigned char) (lossless_mode_fixed + order);
+        bytes[1] = (unsigned char) k;
+
+        for (iSample = 0; iSample < order; iSample++) {
+            lossless_sample_put(&(bytes[2 + iSample * obj->nBytes]), x[iSample], obj->nBytes);
+        }
+
+        obj->bits.bytes = &(bytes[2 + order * obj->nBytes]);
+        obj->bits.acc = 0;
+        obj->bits.nAcc = 0;
+
+        for (iSample = 0; iSample < nResiduals; iSample++) {
+
+            q = u[iSample] >> k;
+
+            if (q < lossless_escape) {
+                lossless_bits_put(&(obj->bits), 1, q + 1);
+                lossless_bits_put(&(obj->bits), u[iSample] & ((1u << k) - 1), k);
+            }
+            else {
+                lossless_bits_put(&(obj->bits), 1, lossless_escape + 1);
+                lossless_bits_put(&(obj->bits), u[iSample], obj->nBits + 5);
+            }
+
+        }
+
+        lossless_bits_align(&(obj->bits));
+
+        return (unsigned int) (obj->bits.bytes - bytes);
+
+    }
+
+    int lossless_peek(const char * bytes, const unsigned int nBytes, unsigned int * hopSize, unsigned int * nChannels, unsigned int * nBits) {
+
+        const unsigned char * frame;
+        unsigned int magic;
+        unsigned int frameSize;
+
+        frame = (const unsigned char *) bytes;
+
+        if (nBytes < lossless_headerSize) {
+            return 0;
+        }
+
+        magic = ((unsigned int) frame[0]) | (((unsigned int) frame[1]) << 8) | (((unsigned int) frame[2]) << 16) | (((unsigned int) frame[3]) << 24);
+        frameSize = ((unsigned int) frame[4]) | (((unsigned int) frame[5]) << 8) | (((unsigned int) frame[6]) << 16) | (((unsigned int) frame[7]) << 24);
+
+        if ((magic != lossless_magic) || (frameSize < lossless_headerSize) || (frameSize > 0x7FFFFFFF)) {
+            return -1;
+        }
+
+        if (hopSize != NULL) {
+            *hopSize = ((unsigned int) frame[8]) | (((unsigned int) frame[9]) << 8);
+        }
+        if (nChannels != NULL) {
+            *nChannels = (unsigned int) frame[10];
+        }
+        if (nBits != NULL) {
+            *nBits = (unsigned int) frame[11];
+        }
+
+        return (int) frameSize;
+
+    }
+
+    int lossless_decode(lossless_obj * obj, const char * bytes, const unsigned int nBytes) {
+
+        int frameSize;
+        unsigned int hopSize;
+        unsigned int nChannels;
+        unsigned int nBits;
+        unsigned int iChannel;
+        const unsigned char * channel;
+        const unsigned char * end;
+
+        frameSize = lossless_peek(bytes, nBytes, &hopSize, &nChannels, &nBits);
+
+        if (frameSize <= 0) {
+            return frameSize;
+        }
+
+        if ((hopSize != obj->hopSize) || (nChannels != obj->nChannels) || (nBits != obj->nBits)) {
+            return -1;
+        }
+
+        if (((unsigned int) frameSize) > nBytes) {
+            return 0;
+        }
+
+        channel = (const unsigned char *) &(bytes[lossless_headerSize]);
+        end = (const unsigned char *) &(bytes[frameSize]);
+
+        for (iChannel = 0; iChannel < obj->nChannels; iChannel++) {
+
+            channel = lossless_decode_channel(obj, iChannel, channel, end);
+
+            if (channel == NULL) {
+                return -1;
+            }
+
+        }
+
+        // The channels fill the frame exactly (each one ends on a byte boundary)
+        if (channel != end) {
+            return -1;
+        }
+
+        return frameSize;
+
+    }
+
+    const unsigned char * lossless_decode_channel(lossless_obj * obj, const unsigned int iChannel, const unsigned char * bytes, const unsigned char * end) {
+
+        int * x;
+        unsigned int nSamples;
+        unsigned int iSample;
+        unsigned int mode;
+        unsigned int order;
+        unsigned int k;
+        unsigned int q;
+        unsigned int u;
+        long long r;
+        long long sample;
+        long long sampleMin;
+        long long sampleMax;
+
+        x = &(obj->samples[iChannel * obj->hopSize]);
+        nSamples = obj->hopSize;
+
+        if (bytes >= end) {
+            return NULL;
+        }
+
+        mode = *bytes;
+        bytes++;
+
+        if (mode == lossless_mode_constant) {
+
+            if (((unsigned int) (end - bytes)) < obj->nBytes) {
+                return NULL;
+            }
+
+            x[0] = lossless_sample_get(bytes, obj->nBytes);
+
+            for (iSample = 1; iSample < nSamples; iSample++) {
+                x[iSample] = x[0];
+            }
+
+            return &(bytes[obj->nBytes]);
+
+        }
+
+        if (mode == lossless_mode_verbatim) {
+
+            if (((unsigned int) (end - bytes)) < (nSamples * obj->nBytes)) {
+                return NULL;
+            }
+
+            for (iSample = 0; iSample < nSamples; iSample++) {
+                x[iSample] = lossless_sample_get(&(bytes[iSample * obj->nBytes]), obj->nBytes);
+            }
+
+            return &(bytes[nSamples * obj->nBytes]);
+
+        }
+
+        order = mode - lossless_mode_fixed;
+
+        if ((order > lossless_maxOrder) || (order > nSamples) || (((unsigned int) (end - bytes)) < (1 + order * obj->nBytes))) {
+            return NULL;
+        }
+
+        k = *bytes;
+        bytes++;
+
+        if (k > (obj->nBits + 4)) {
+            return NULL;
+        }
+
+        for (iSample = 0; iSample < order; iSample++) {
+            x[iSample] = lossless_sample_get(&(bytes[iSample * obj->nBytes]), obj->nBytes);
+        }
+
+        obj->bits.bytes = (unsigned char *) &(bytes[order * obj->nBytes]);
+        obj->bits.end = end;
+        obj->bits.acc = 0;
+        obj->bits.nAcc = 0;
+        obj->bits.overrun = 0;
+
+        sampleMin = -(1ll << (obj->nBits - 1));
+        sampleMax = (1ll << (obj->nBits - 1)) - 1;
+
+        for (iSample = order; iSample < nSamples; iSample++) {
+
+            q = lossless_bits_unary(&(obj->bits), lossless_escape);
+
+            if (q < lossless_escape) {
+                u = (q << k) | lossless_bits_get(&(obj->bits), k);
+            }
+            else {
+                u = lossless_bits_get(&(obj->bits), obj->nBits + 5);
+            }
+
+            r = ((long long) (u >> 1)) ^ (-((long long) (u & 1)));
+
+            // Corrupt residuals must neither overflow nor leave the range of the samples
+            switch(order) {
+                case 0: sample = r; break;
+                case 1: sample = r + (long long) x[iSample-1]; break;
+                case 2: sample = r + 2 * (long long) x[iSample-1] - (long long) x[iSample-2]; break;
+                case 3: sample = r + 3 * (long long) x[iSample-1] - 3 * (long long) x[iSample-2] + (long long) x[iSample-3]; break;
+                default: sample = r + 4 * (long long) x[iSample-1] - 6 * (long long) x[iSample-2] + 4 * (long long) x[iSample-3] - (long long) x[iSample-4]; break;
+            }
+
+            if ((sample < sampleMin) || (sample > sampleMax)) {
+                return NULL;
+            }
+
+            x[iSample] = (int) sample;
+
+        }
+
+        if (obj->bits.overrun == 1) {
+            return NULL;
+        }
+
+        // The bits left in the accumulator only pad the last byte
+        return obj->bits.bytes;
+
+    }
+
+    void lossless_bits_put(lossless_bits_obj * bits, const unsigned int value, const unsigned int nBits) {
+
+        bits->acc = (bits->acc << nBits) | ((unsigned long long) value);
+        bits->nAcc += nBits;
+
+        while (bits->nAcc >= 8) {
+            bits->nAcc -= 8;
+            *(bits->bytes) = (unsigned char) (bits->acc >> bits->nAcc);
+            bits->bytes++;
+        }
+
+    }
+
+    void lossless_bits_align(lossless_bits_obj * bits) {
+
+        if (bits->nAcc > 0) {
+            *(bits->bytes) = (unsigned char) (bits->acc << (8 - bits->nAcc));
+            bits->bytes++;
+            bits->nAcc = 0;
+        }
+
+    }
+
+    unsigned int lossless_bits_get(lossless_bits_obj * bits, const unsigned int nBits) {
+
+        while (bits->nAcc < nBits) {
+
+            if (bits->bytes >= bits->end) {
+                bits->overrun = 1;
+                return 0;
+            }
+
+            bits->acc = (bits->acc << 8) | ((unsigned long long) *(bits->bytes));
+            bits->nAcc += 8;
+            bits->bytes++;
+
+        }
+
+        bits->nAcc -= nBits;
+
+        return (unsigned int) ((bits->acc >> bits->nAcc) & ((1ull << nBits) - 1));
+
+    }
+
+    unsigned int lossless_bits_unary(lossless_bits_obj * bits, const unsigned int nMax) {
+
+        unsigned int q;
+        unsigned int top;
+        unsigned int iBit;
+
+        q = 0;
+
+        while (1) {
+
+            if (bits->nAcc == 0) {
+
+                if (bits->bytes >= bits->end) {
+                    bits->overrun = 1;
+                    return nMax;
+                }
+
+                bits->acc = (bits->acc << 8) | ((unsigned long long) *(bits->bytes));
+                bits->nAcc = 8;
+                bits->bytes++;
+
+            }
+
+            // At most 8 bits are left after a refill of one byte
+            top = (unsigned int) (bits->acc & ((1ull << bits->nAcc) - 1));
+
+            if (top == 0) {
+
+                q += bits->nAcc;
+                bits->nAcc = 0;
+
+            }
+            else {
+
+                iBit = bits->nAcc - 1;
+
+                while (((top >> iBit) & 0x1) == 0) {
+                    iBit--;
+                }
+
+                q += bits->nAcc - 1 - iBit;
+                bits->nAcc = iBit;
+
+                break;
+
+            }
+
+            if (q > nMax) {
+                bits->overrun = 1;
+                return nMax;
+            }
+
+        }
+
+        if (q > nMax) {
+            bits->overrun = 1;
+            return nMax;
+        }
+
+        return q;
+
+    }
+
+    void lossless_sample_put(unsigned char * bytes, const int sample, const unsigned int nBytes) {
+
+        switch(nBytes) {
+            case 4: bytes[3] = (unsigned char) ((sample & 0xFF000000) >> 24);
+            case 3: bytes[2] = (unsigned char) ((sample & 0x00FF0000) >> 16);
+            case 2: bytes[1] = (unsigned char) ((sample & 0x0000FF00) >> 8);
+            case 1: bytes[0] = (unsigned char) ((sample & 0x000000FF) >> 0);
+        }
+
+    }
+
+    int lossless_sample_get(const unsigned char * bytes, const unsigned int nBytes) {
+
+        unsigned int value;
+        unsigned int shift;
+
+        value = 0;
+
+        switch(nBytes) {
+            case 4: value |= ((unsigned int) bytes[3]) << 24;
+            case 3: value |= ((unsigned int) bytes[2]) << 16;
+            case 2: value |= ((unsigned int) bytes[1]) << 8;
+            case 1: value |= ((unsigned int) bytes[0]) << 0;
+        }
+
+        // Sign extension
+        shift = 32 - 8 * nBytes;
+
+        return ((int) (value << shift)) >> shift;
+
+    }
@@ -159,3 +159,274 @@
         }
 
     }
+
+    void pcm_signedXXbits2normalized_interleaved(const char * bytes, const unsigned int nBytes, const unsigned int nChannels, const unsigned int nSamples, float ** array) {
+
+        unsigned int iChannel;
+        unsigned int iGroup;
+        unsigned int nGroup;
+        unsigned int iSample;
+        unsigned int stride;
+        const unsigned char * frame;
+        const unsigned char * src;
+        float * dest[4];
+
+        stride = nChannels * nBytes;
+
+        for (iChannel = 0; iChannel < nChannels; iChannel += nGroup) {
+
+            nGroup = ((nChannels - iChannel) < 4) ? (nChannels - iChannel) : 4;
+
+            for (iGroup = 0; iGroup < nGroup; iGroup++) {
+                dest[iGroup] = array[iChannel + iGroup];
+            }
+
+            frame = (const unsigned char *) &(bytes[iChannel * nBytes]);
+
+            switch(nBytes) {
+
+                case 1:
+
+                    for (iSample = 0; iSample < nSamples; iSample++) {
+
+                        for (iGroup = 0, src = frame; iGroup < nGroup; iGroup++, src += 1) {
+                            dest[iGroup][iSample] = ((float) ((signed char) src[0])) / 128.0f;
+                        }
+
+                        frame += stride;
+
+                    }
+
+                break;
+
+                case 2:
+
+                    for (iSample = 0; iSample < nSamples; iSample++) {
+
+                        for (iGroup = 0, src = frame; iGroup < nGroup; iGroup++, src += 2) {
+                            dest[iGroup][iSample] = ((float) (((int) ((signed char) src[1])) * 256 + ((int) src[0]))) / 32768.0f;
+                        }
+
+                        frame += stride;
+
+                    }
+
+                break;
+
+                case 3:
+
+                    for (iSample = 0; iSample < nSamples; iSample++) {
+
+                        for (iGroup = 0, src = frame; iGroup < nGroup; iGroup++, src += 3) {
+                            dest[iGroup][iSample] = ((float) (((int) ((signed char) src[2])) * 65536 + ((int) src[1]) * 256 + ((int) src[0]))) / 8388608.0f;
+                        }
+
+                        frame += stride;
+
+                    }
+
+                break;
+
+                case 4:
+
+                    for (iSample = 0; iSample < nSamples; iSample++) {
+
+                        for (iGroup = 0, src = frame; iGroup < nGroup; iGroup++, src += 4) {
+                            dest[iGroup][iSample] = ((float) (((int) ((signed char) src[3])) * 16777216 + ((int) src[2]) * 65536 + ((int) src[1]) * 256 + ((int) src[0]))) / 2147483648.0f;
+                        }
+
+                        frame += stride;
+
+                    }
+
+                break;
+
+            }
+
+        }
+
+    }
+
+    void pcm_float2normalized_interleaved(const char * bytes, const unsigned int nChannels, const unsigned int nSamples, float ** array) {
+
+        unsigned int iChannel;
+        unsigned int iGroup;
+        unsigned int nGroup;
+        unsigned int iSample;
+        const char * frame;
+        float * dest[4];
+
+        // Samples are 32-bit floats in the byte order of the host. The bytes may come
+        // straight from a mapped file at any offset, so each sample is loaded with memcpy
+        // (a single load where the target allows unaligned accesses)
+        for (iChannel = 0; iChannel < nChannels; iChannel += nGroup) {
+
+            nGroup = ((nChannels - iChannel) < 4) ? (nChannels - iChannel) : 4;
+
+            for (iGroup = 0; iGroup < nGroup; iGroup++) {
+                dest[iGroup] = array[iChannel + iGroup];
+            }
+
+            frame = &(bytes[iChannel * sizeof(float)]);
+
+            for (iSample = 0; iSample < nSamples; iSample++) {
+
+                for (iGroup = 0; iGroup < nGroup; iGroup++) {
+                    memcpy(&(dest[iGroup][iSample]), &(frame[iGroup * sizeof(float)]), sizeof(float));
+                }
+
+                frame += nChannels * sizeof(float);
+
+            }
+
+        }
+
+    }
+
+    void pcm_normalized2signedXXbits_interleaved(float ** array, const float gain, const unsigned int nBytes, const unsigned int nChannels, const unsigned int nSamples, char * bytes) {
+
+        unsigned int iChannel;
+        unsigned int iGroup;
+        unsigned int nGroup;
+        unsigned int iSample;
+        unsigned int stride;
+        unsigned char * frame;
+        unsigned char * dest;
+        const float * src[4];
+
+        float scale;
+        float minValue;
+        float maxValue;
+        float sample;
+        float fraction;
+        int sample32;
+
+        stride = nChannels * nBytes;
+
+        // Largest float below 2^31 for 32 bits, since 2^31-1 is not representable
+        switch(nBytes) {
+            case 1: scale = 128.0f; minValue = -128.0f; maxValue = 127.0f; break;
+            case 2: scale = 32768.0f; minValue = -32768.0f; maxValue = 32767.0f; break;
+            case 3: scale = 8388608.0f; minValue = -8388608.0f; maxValue = 8388607.0f; break;
+            case 4: scale = 2147483648.0f; minValue = -2147483648.0f; maxValue = 2147483520.0f; break;
+            default: scale = 0.0f; minValue = 0.0f; maxValue = 0.0f; break;
+        }
+
+        for (iChannel = 0; iChannel < nChannels; iChannel += nGroup) {
+
+            nGroup = ((nChannels - iChannel) < 4) ? (nChannels - iChannel) : 4;
+
+            for (iGroup = 0; iGroup < nGroup; iGroup++) {
+                src[iGroup] = array[iChannel + iGroup];
+            }
+
+            frame = (unsigned char *) &(bytes[iChannel * nBytes]);
+
+            for (iSample = 0; iSample < nSamples; iSample++) {
+
+                for (iGroup = 0, dest = frame; iGroup < nGroup; iGroup++, dest += nBytes) {
+
+                    sample = (gain * src[iGroup][iSample]) * scale;
+                    sample = (sample > maxValue) ? maxValue : sample;
+                    sample = (sample < minValue) ? minValue : sample;
+
+                    // Same result as roundf (halfway cases away from zero), without the call
+                    sample32 = (int) sample;
+                    fraction = sample - ((float) sample32);
+                    sample32 += (fraction >= 0.5f) - (fraction <= -0.5f);
+
+                    switch(nBytes) {
+                        case 4: dest[3] = (unsigned char) ((sample32 & 0xFF000000) >> 24);
+                        case 3: dest[2] = (unsigned char) ((sample32 & 0x00FF0000) >> 16);
+                        case 2: dest[1] = (unsigned char) ((sample32 & 0x0000FF00) >> 8);
+                        case 1: dest[0] = (unsigned char) ((sample32 & 0x000000FF) >> 0);
+                    }
+
+                }
+
+                frame += stride;
+
+            }
+
+        }
+
+    }
+
+    void pcm_normalized2float_interleaved(float ** array, const float gain, const unsigned int nChannels, const unsigned int nSamples, char * bytes) {
+
+        unsigned int iChannel;
+        unsigned int iGroup;
+        unsigned int nGroup;
+        unsigned int iSample;
+        float * frame;
+        const float * src[4];
+
+        // Samples are 32-bit floats in the byte order of the host
+        for (iChannel = 0; iChannel < nChannels; iChannel += nGroup) {
+
+            nGroup = ((nChannels - iChannel) < 4) ? (nChannels - iChannel) : 4;
+
+            for (iGroup = 0; iGroup < nGroup; iGroup++) {
+                src[iGroup] = array[iChannel + iGroup];
+            }
+
+            frame = &(((float *) bytes)[iChannel]);
+
+            for (iSample = 0; iSample < nSamples; iSample++) {
+
+                for (iGroup = 0; iGroup < nGroup; iGroup++) {
+                    frame[iGroup] = gain * src[iGroup][iSample];
+                }
+
+                frame += nChannels;
+
+            }
+
+        }
+
+    }
+
+    void pcm_normalized2signedXXbits_planar(float ** array, const float gain, const unsigned int nBytes, const unsigned int nChannels, const unsigned int nSamples, int * samples) {
+
+        unsigned int iChannel;
+        unsigned int iSample;
+        const float * src;
+        int * dest;
+
+        float scale;
+        float minValue;
+        float maxValue;
+        float sample;
+        float fraction;
+        int sample32;
+
+        switch(nBytes) {
+            case 1: scale = 128.0f; minValue = -128.0f; maxValue = 127.0f; break;
+            case 2: scale = 32768.0f; minValue = -32768.0f; maxValue = 32767.0f; break;
+            case 3: scale = 8388608.0f; minValue = -8388608.0f; maxValue = 8388607.0f; break;
+            case 4: scale = 2147483648.0f; minValue = -2147483648.0f; maxValue = 2147483520.0f; break;
+            default: scale = 0.0f; minValue = 0.0f; maxValue = 0.0f; break;
+        }
+
+        for (iChannel = 0; iChannel < nChannels; iChannel++) {
+
+            src = array[iChannel];
+            dest = &(samples[iChannel * nSamples]);
+
+            for (iSample = 0; iSample < nSamples; iSample++) {
+
+                sample = (gain * src[iSample]) * scale;
+                sample = (sample > maxValue) ? maxValue : sample;
+                sample = (sample < minValue) ? minValue : sample;
+
+                sample32 = (int) sample;
+                fraction = sample - ((float) sample32);
+                sample32 += (fraction >= 0.5f) - (fraction <= -0.5f);
+
+                dest[iSample] = sample32;
+
+            }
+
+        }
+
+    }
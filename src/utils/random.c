@@ -115,6 +115,46 @@
 
     }
 
+    void random_generate_r(const random_obj * obj, const unsigned int nSamples, unsigned int * indexes, unsigned int * seed) {
+
+         unsigned int iSample;
+         float rndNumber;
+         
+         unsigned int indexLow;
+         unsigned int indexHigh;
+         unsigned int indexMiddle;
+         unsigned int i;
+
+         for (iSample = 0; iSample < nSamples; iSample++) {
+
+             rndNumber = (float) ((double)rand_r(seed) / (double)RAND_MAX);
+
+             indexLow = 0;
+             indexHigh = obj->N;
+
+             for (i = 0; i < obj->I; i++) {
+
+                 indexMiddle = (indexLow + indexHigh) / 2;
+
+                 if (obj->cdf[indexMiddle] <= rndNumber) {
+
+                     indexLow = indexMiddle;
+
+                 }
+                 else {
+
+                     indexHigh = indexMiddle;
+
+                 }
+
+             }
+
+            indexes[iSample] = indexLow;
+
+         }
+
+    }
+
     normal_obj * normal_construct_zero(const double epsilon) {
 
         normal_obj * obj;
@@ -206,3 +246,17 @@
         }
 
     }
+
+    void normaloff_generate_r(const normaloff_obj * obj, const unsigned int nSamples, float * values, unsigned int * seed) {
+
+        unsigned int iSample;
+        unsigned int index;
+
+        for (iSample = 0; iSample < nSamples; iSample++) {
+
+            index = rand_r(seed) % (obj->N);
+            values[iSample] = obj->values[index];
+
+        }
+
+    }
@@ -0,0 +1,288 @@
+   
+   /**
+    * \file     wave.c
+    * \author   François Grondin <francois.grondin2@usherbrooke.ca>
+    * \version  2.0
+    * \date     2018-03-18
+    * \copyright
+    *
+    * This program is free software: you can redistribute it and/or modify
+    * it under the terms of the GNU General Public License as published by
+    * the Free Software Foundation, either version 3 of the License, or
+    * (at your option) any later version.
+    *
+    * This program is distributed in the hope that it will be useful,
+    * but WITHOUT ANY WARRANTY; without even the implied warranty of
+    * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    * GNU General Public License for more details.
+    * 
+    * You should have received a copy of the GNU General Public License
+    * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+    *
+    */
+
+    #include <utils/wave.h>
+
+    wave_obj * wave_construct_zero(void) {
+
+        wave_obj * obj;
+
+        obj = (wave_obj *) malloc(sizeof(wave_obj));
+
+        obj->container = 'n';
+
+        obj->nChannels = 0;
+        obj->fS = 0;
+        obj->nBits = 0;
+        obj->isFloat = 0;
+
+        obj->dataOffset = 0;
+        obj->dataSize = 0;
+
+        return obj;
+
+    }
+
+    wave_obj * wave_construct_file(const char * fileName) {
+
+        wave_obj * obj;
+        int fd;
+        struct stat st;
+        void * map;
+
+        obj = wave_construct_zero();
+
+        if (stat(fileName, &st) < 0) {
+            printf("Cannot open file %s\n", fileName);
+            exit(EXIT_FAILURE);
+        }
+
+        // A pipe or a device cannot be read twice, so it is taken as raw without being opened here
+        if (!S_ISREG(st.st_mode)) {
+            return obj;
+        }
+
+        fd = open(fileName, O_RDONLY);
+
+        if (fd < 0) {
+            printf("Cannot open file %s\n", fileName);
+            exit(EXIT_FAILURE);
+        }
+
+        if (fstat(fd, &st) < 0) {
+            printf("Cannot read the size of file %s\n", fileName);
+            exit(EXIT_FAILURE);
+        }
+
+        // An empty file is a raw file with no data (mmap refuses a zero length)
+        if (st.st_size > 0) {
+
+            map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (map == MAP_FAILED) {
+                printf("Cannot map file %s\n", fileName);
+                exit(EXIT_FAILURE);
+            }
+
+            if (wave_parse(obj, (const char *) map, (unsigned long long) st.st_size) < 0) {
+                printf("Invalid or unsupported WAV header in file %s\n", fileName);
+                exit(EXIT_FAILURE);
+            }
+
+            munmap(map, (size_t) st.st_size);
+
+        }
+
+        close(fd);
+
+        return obj;
+
+    }
+
+    void wave_destroy(wave_obj * obj) {
+
+        free((void *) obj);
+
+    }
+
+    int wave_parse(wave_obj * obj, const char * bytes, const unsigned long long nBytes) {
+
+        unsigned long long offset;
+        unsigned long long chunkSize;
+        unsigned long long ds64DataSize;
+        unsigned int formatTag;
+        unsigned int blockAlign;
+        char hasFormat;
+        char hasData;
+
+        // Anything else than a RIFF or RF64 WAVE header is a raw file
+
+        if ((nBytes < 12) || 
+            ((memcmp(bytes, "RIFF", 4) != 0) && (memcmp(bytes, "RF64", 4) != 0)) ||
+            (memcmp(&(bytes[8]), "WAVE", 4) != 0)) {
+
+            obj->container = 'n';
+            obj->dataOffset = 0;
+            obj->dataSize = nBytes;
+
+            return 0;
+
+        }
+
+        obj->container = (memcmp(bytes, "RIFF", 4) == 0) ? 'w' : 'r';
+
+        ds64DataSize = 0;
+        formatTag = 0;
+        blockAlign = 0;
+        hasFormat = 0;
+        hasData = 0;
+
+        offset = 12;
+
+        while (offset + 8 <= nBytes) {
+
+            chunkSize = wave_uint32(&(bytes[offset + 4]));
+
+            if ((memcmp(&(bytes[offset]), "ds64", 4) == 0) && (chunkSize >= 24) && (offset + 8 + 24 <= nBytes)) {
+
+                ds64DataSize = wave_uint64(&(bytes[offset + 8 + 8]));
+
+            }
+
+            if ((memcmp(&(bytes[offset]), "fmt ", 4) == 0) && (chunkSize >= 16) && (offset + 8 + 16 <= nBytes)) {
+
+                formatTag = wave_uint16(&(bytes[offset + 8]));
+                obj->nChannels = wave_uint16(&(bytes[offset + 8 + 2]));
+                obj->fS = wave_uint32(&(bytes[offset + 8 + 4]));
+                blockAlign = wave_uint16(&(bytes[offset + 8 + 12]));
+                obj->nBits = wave_uint16(&(bytes[offset + 8 + 14]));
+
+                // WAVE_FORMAT_EXTENSIBLE: the actual format is the first field of the sub-format GUID
+                if ((formatTag == 0xFFFE) && (chunkSize >= 40) && (offset + 8 + 40 <= nBytes)) {
+                    formatTag = wave_uint16(&(bytes[offset + 8 + 24]));
+                }
+
+                hasFormat = 1;
+
+            }
+
+            if (memcmp(&(bytes[offset]), "data", 4) == 0) {
+
+                // RF64 stores 0xFFFFFFFF here, and the real size in the ds64 chunk
+                if ((obj->container == 'r') && (chunkSize == 0xFFFFFFFF)) {
+                    chunkSize = ds64DataSize;
+                }
+
+                obj->dataOffset = offset + 8;
+                obj->dataSize = chunkSize;
+
+                // A recording cut short (or still being written) ends with the file
+                if (obj->dataOffset + obj->dataSize > nBytes) {
+                    obj->dataSize = nBytes - obj->dataOffset;
+                }
+
+                hasData = 1;
+
+                break;
+
+            }
+
+            // Chunks are padded to an even number of bytes
+            offset += 8 + chunkSize + (chunkSize & 1);
+
+        }
+
+        if ((hasFormat == 0) || (hasData == 0)) {
+            return -1;
+        }
+
+        // Samples are read as packed frames of nChannels * nBits / 8 bytes
+        if (blockAlign != (obj->nChannels * obj->nBits / 8)) {
+            return -1;
+        }
+
+        // 1: PCM, 3: IEEE float. 8-bit PCM is unsigned in WAV files, and is not supported.
+
+        switch (formatTag) {
+
+            case 1:
+
+                if ((obj->nBits != 16) && (obj->nBits != 24) && (obj->nBits != 32)) {
+                    return -1;
+                }
+
+                obj->isFloat = 0;
+
+            break;
+
+            case 3:
+
+                if (obj->nBits != 32) {
+                    return -1;
+                }
+
+                obj->isFloat = 1;
+
+            break;
+
+            default:
+
+                return -1;
+
+            break;
+
+        }
+
+        return 0;
+
+    }
+
+    unsigned int wave_uint16(const char * bytes) {
+
+        const unsigned char * ubytes;
+
+        ubytes = (const unsigned char *) bytes;
+
+        return ((unsigned int) ubytes[0]) | 
+               (((unsigned int) ubytes[1]) << 8);
+
+    }
+
+    unsigned int wave_uint32(const char * bytes) {
+
+        const unsigned char * ubytes;
+
+        ubytes = (const unsigned char *) bytes;
+
+        return ((unsigned int) ubytes[0]) | 
+               (((unsigned int) ubytes[1]) << 8) | 
+               (((unsigned int) ubytes[2]) << 16) | 
+               (((unsigned int) ubytes[3]) << 24);
+
+    }
+
+    unsigned long long wave_uint64(const char * bytes) {
+
+        return ((unsigned long long) wave_uint32(bytes)) | 
+               (((unsigned long long) wave_uint32(&(bytes[4]))) << 32);
+
+    }
+
+    void wave_printf(const wave_obj * obj) {
+
+        switch (obj->container) {
+
+            case 'n': printf("container = raw\n"); break;
+            case 'w': printf("container = RIFF/WAVE\n"); break;
+            case 'r': printf("container = RF64/WAVE\n"); break;
+
+        }
+
+        printf("nChannels = %u\n", obj->nChannels);
+        printf("fS = %u\n", obj->fS);
+        printf("nBits = %u\n", obj->nBits);
+        printf("isFloat = %d\n", obj->isFloat);
+        printf("dataOffset = %llu\n", obj->dataOffset);
+        printf("dataSize = %llu\n", obj->dataSize);
+
+    }